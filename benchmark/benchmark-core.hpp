@@ -0,0 +1,165 @@
+// Copyright (c) 2023 Andrea Ballestrazzi
+#pragma once
+
+// Third-party
+#include <nlohmann/json.hpp>
+
+// C++ STL
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <numeric>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#ifdef __linux__
+#include <sstream>
+#endif // __linux__
+
+namespace benchmark {
+
+using clock_type = std::chrono::steady_clock;
+using nanoseconds = std::chrono::duration<double, std::nano>;
+
+//!!
+//! \brief Represents the timing statistics of a benchmark case.
+//!
+struct CaseResult {
+    std::string name{};
+    std::size_t iterations{};
+    //! Operations performed by every iteration, used to compute the time per operation.
+    std::size_t operationsPerIteration{1};
+    nanoseconds minTime{};
+    nanoseconds medianTime{};
+    nanoseconds meanTime{};
+    nanoseconds maxTime{};
+    //! Peak resident set size reached while the case was running, in KiB. Zero if unknown.
+    std::uint64_t peakRssKiB{};
+};
+
+//!!
+//! \brief Resets the peak resident set size of the process, so the next reading only
+//!  accounts the memory used from now on. Supported on Linux only.
+//!
+inline void ResetPeakResidentSetSize() noexcept {
+#ifdef __linux__
+    // Writing 5 to clear_refs resets the VmHWM counter of the process.
+    std::ofstream clearRefs{"/proc/self/clear_refs"};
+    clearRefs << "5";
+#endif // __linux__
+}
+
+//!!
+//! \brief Retrieves the peak resident set size of the process in KiB.
+//!
+//! \return The peak resident set size, or zero if the platform doesn't expose it.
+[[nodiscard]] inline std::uint64_t GetPeakResidentSetSize() noexcept {
+#ifdef __linux__
+    std::ifstream statusFile{"/proc/self/status"};
+    std::string line{};
+    while (std::getline(statusFile, line)) {
+        if (line.starts_with("VmHWM:")) {
+            std::istringstream lineStream{line.substr(6)};
+            std::uint64_t peakKiB{};
+            lineStream >> peakKiB;
+            return peakKiB;
+        }
+    }
+#endif // __linux__
+    return 0;
+}
+
+//!!
+//! \brief Runs a benchmark case the given number of times. The setup function runs before
+//!  every iteration and is not timed, so each iteration can work on fresh data.
+//!
+//! \param name The name of the case.
+//! \param iterations The number of timed iterations.
+//! \param setup The untimed function called before every iteration.
+//! \param body The timed function.
+//! \return The statistics of the case.
+[[nodiscard]] inline CaseResult RunCase(std::string name, std::size_t iterations,
+                                        const std::function<void()>& setup,
+                                        const std::function<void()>& body) {
+    std::vector<nanoseconds> times{};
+    times.reserve(iterations);
+
+    ResetPeakResidentSetSize();
+    for (std::size_t i{}; i < iterations; ++i) {
+        setup();
+
+        const auto startTime{clock_type::now()};
+        body();
+        times.push_back(clock_type::now() - startTime);
+    }
+
+    CaseResult result{};
+    result.name = std::move(name);
+    result.iterations = iterations;
+    result.peakRssKiB = GetPeakResidentSetSize();
+
+    if (times.empty())
+        return result;
+
+    std::ranges::sort(times);
+    result.minTime = times.front();
+    result.maxTime = times.back();
+    result.medianTime = times[times.size() / 2];
+    result.meanTime = std::accumulate(times.begin(), times.end(), nanoseconds{}) /
+                      static_cast<double>(times.size());
+
+    return result;
+}
+
+[[nodiscard]] inline CaseResult RunCase(std::string name, std::size_t iterations,
+                                        const std::function<void()>& body) {
+    return RunCase(std::move(name), iterations, [] {}, body);
+}
+
+//!!
+//! \brief Writes the results of a benchmark suite to a JSON file, so they can be compared
+//!  between runs by external tools.
+//!
+//! \param outputPath The path of the results file.
+//! \param suiteName The name of the benchmark suite.
+//! \param configuration The parameters the suite has been run with.
+//! \param results The results of the cases.
+inline void WriteResultsFile(const std::filesystem::path& outputPath,
+                             std::string_view suiteName, const nlohmann::json& configuration,
+                             const std::vector<CaseResult>& results) {
+    nlohmann::json resultsJson = nlohmann::json::array();
+    for (const CaseResult& result : results) {
+        resultsJson.push_back({
+            {"name", result.name},
+            {"iterations", result.iterations},
+            {"operationsPerIteration", result.operationsPerIteration},
+            {"minNs", result.minTime.count()},
+            {"medianNs", result.medianTime.count()},
+            {"meanNs", result.meanTime.count()},
+            {"maxNs", result.maxTime.count()},
+            {"medianNsPerOperation",
+             result.medianTime.count() / static_cast<double>(result.operationsPerIteration)},
+            {"peakRssKiB", result.peakRssKiB}
+        });
+    }
+
+    const nlohmann::json outputJson{
+        {"suite", suiteName},
+        {"configuration", configuration},
+        {"results", std::move(resultsJson)}
+    };
+
+    if (outputPath.has_parent_path())
+        std::filesystem::create_directories(outputPath.parent_path());
+
+    std::ofstream outputFile{outputPath};
+    outputFile << outputJson.dump(4) << '\n';
+}
+
+} // namespace benchmark
@@ -0,0 +1,214 @@
+// Copyright (c) 2023 Andrea Ballestrazzi
+#include <benchmark-core.hpp>
+
+#include <gh_cmd/command-schema.hpp>
+#include <gh_cmd/gh_cmd.hpp>
+
+// C++ STL
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <filesystem>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace {
+
+// The lines typed the most while configuring and monitoring the greenhouse.
+constexpr std::array<std::string_view, 4> COMMAND_LINES{
+    "auto-watering -A 63000 -D 1200000 -V 26 -U 23", "status", "auto-watering --stop",
+    "status --help"};
+
+using AutoWateringSchema =
+    gh_cmd::schema::CommandSchema<"auto-watering", gh_cmd::schema::Switch<"help", 'h'>,
+                                  gh_cmd::schema::Switch<"stop">,
+                                  gh_cmd::schema::Value<"activation-time", 'A', std::uint64_t>,
+                                  gh_cmd::schema::Value<"deactivation-time", 'D', std::uint64_t>,
+                                  gh_cmd::schema::Value<"valve-pin-id", 'V', std::uint64_t>,
+                                  gh_cmd::schema::Value<"pump-pin-id", 'U', std::uint64_t>>;
+using StatusSchema =
+    gh_cmd::schema::CommandSchema<"status", gh_cmd::schema::Switch<"help", 'h'>>;
+
+using CommandTable = gh_cmd::schema::CommandTable<AutoWateringSchema, StatusSchema>;
+
+//!!
+//! \brief The dispatch used by the terminal: the line is split with a string stream, the
+//!  command is found in a map and its popl parser looks for the options by name.
+//!
+class RuntimeDispatcher {
+public:
+    RuntimeDispatcher() {
+        auto autoWateringParser{std::make_unique<gh_cmd::DefaultOptionParser<char>>()};
+        autoWateringParser->addSwitch(
+            std::make_shared<gh_cmd::Switch<char>>('h', "help", "Displays this help page."));
+        autoWateringParser->addSwitch(
+            std::make_shared<gh_cmd::Switch<char>>('s', "stop", "Stops the system."));
+        for (const auto& [shortName, longName] :
+             {std::pair{'A', "activation-time"}, std::pair{'D', "deactivation-time"},
+              std::pair{'V', "valve-pin-id"}, std::pair{'U', "pump-pin-id"}}) {
+            autoWateringParser->addOption(std::make_shared<gh_cmd::Value<char, std::uint64_t>>(
+                shortName, longName, "A configuration value."));
+        }
+
+        auto statusParser{std::make_unique<gh_cmd::DefaultOptionParser<char>>()};
+        statusParser->addSwitch(
+            std::make_shared<gh_cmd::Switch<char>>('h', "help", "Displays this help page."));
+
+        m_parsers.emplace("auto-watering", std::move(autoWateringParser));
+        m_parsers.emplace("status", std::move(statusParser));
+    }
+
+    //! \return The sum of the set values, so that the work can't be optimized away.
+    [[nodiscard]] std::uint64_t dispatch(std::string_view line) {
+        std::istringstream lineStream{std::string{line}};
+        std::vector<std::string> lineTokens{};
+        for (std::string currentToken{}; lineStream >> currentToken;)
+            lineTokens.push_back(std::move(currentToken));
+
+        if (lineTokens.empty() || !m_parsers.contains(lineTokens[0]))
+            return 0;
+
+        gh_cmd::DefaultOptionParser<char>& parser{*m_parsers.at(lineTokens[0])};
+        parser.parse(lineTokens);
+
+        std::uint64_t valuesSum{};
+        for (const auto& option : parser.getOptions()) {
+            if (!option->isSet())
+                continue;
+
+            const auto* valueOption{
+                dynamic_cast<const gh_cmd::Value<char, std::uint64_t>*>(option.get())};
+            valuesSum += valueOption != nullptr ? valueOption->value() : 1;
+        }
+
+        gh_cmd::utility::ClearAllOptions(parser.getOptions());
+        return valuesSum;
+    }
+
+private:
+    std::map<std::string, std::unique_ptr<gh_cmd::DefaultOptionParser<char>>> m_parsers{};
+};
+
+//! \return The sum of the set values, computed like the runtime dispatcher does.
+[[nodiscard]] std::uint64_t DispatchWithSchema(std::string_view line) {
+    std::uint64_t valuesSum{};
+    const auto countSwitch{[&valuesSum] {
+        ++valuesSum;
+    }};
+    const auto sumValue{[&valuesSum](const std::uint64_t value) {
+        valuesSum += value;
+    }};
+
+    [[maybe_unused]] const gh_cmd::schema::ParseResult result{CommandTable::dispatch(
+        line,
+        [&](const AutoWateringSchema::parsed_options& options) {
+            options.visit(countSwitch, countSwitch, sumValue, sumValue, sumValue, sumValue);
+        },
+        [&](const StatusSchema::parsed_options& options) {
+            options.visit(countSwitch);
+        })};
+
+    return valuesSum;
+}
+
+void PrintResult(const benchmark::CaseResult& result) {
+    const double nsPerLine{result.medianTime.count() /
+                           static_cast<double>(result.operationsPerIteration)};
+
+    std::cout << std::left << std::setw(10) << result.name << std::right << std::fixed
+              << std::setprecision(3) << " median " << std::setw(10)
+              << result.medianTime.count() / 1e6 << " ms   " << std::setw(10) << nsPerLine
+              << " ns/line\n";
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    constexpr std::size_t DEFAULT_LINES{200'000};
+    constexpr std::size_t DEFAULT_ITERATIONS{10};
+    const std::string defaultOutputPath{"command-schema-benchmark.json"};
+
+    gh_cmd::DefaultOptionParser<char> optionParser{"command_schema_benchmark [OPTIONS]"};
+
+    const auto helpSwitch{
+        std::make_shared<gh_cmd::Switch<char>>('h', "help", "Displays this help page.")};
+    const auto linesOption{std::make_shared<gh_cmd::Value<char, std::size_t>>(
+        'l', "lines", "Number of command lines dispatched by every iteration.")};
+    const auto iterationsOption{std::make_shared<gh_cmd::Value<char, std::size_t>>(
+        'i', "iterations", "Number of timed iterations of every case.")};
+    const auto outputOption{std::make_shared<gh_cmd::Value<char, std::string>>(
+        'o', "output", "Path of the JSON results file.")};
+
+    optionParser.addSwitch(helpSwitch);
+    optionParser.addOption(linesOption);
+    optionParser.addOption(iterationsOption);
+    optionParser.addOption(outputOption);
+
+    try {
+        optionParser.parse(std::vector<std::string>{argv, argv + argc});
+    } catch (const std::exception& e) {
+        std::cerr << e.what() << '\n';
+        optionParser.printHelp(std::cerr);
+        return 1;
+    }
+
+    if (helpSwitch->isSet()) {
+        optionParser.printHelp(std::cout);
+        return 0;
+    }
+
+    // The gh_cmd values don't keep their default after parsing, so the defaults are
+    // resolved here.
+    const std::size_t linesCount{
+        std::max<std::size_t>(linesOption->isSet() ? linesOption->value() : DEFAULT_LINES, 1)};
+    const std::size_t iterations{std::max<std::size_t>(
+        iterationsOption->isSet() ? iterationsOption->value() : DEFAULT_ITERATIONS, 1)};
+    const std::filesystem::path outputPath{outputOption->isSet() ? outputOption->value()
+                                                                 : defaultOutputPath};
+
+    RuntimeDispatcher runtimeDispatcher{};
+    std::uint64_t runtimeChecksum{};
+    std::uint64_t schemaChecksum{};
+
+    std::vector<benchmark::CaseResult> results{};
+    results.push_back(benchmark::RunCase("runtime", iterations, [&] {
+        for (std::size_t i{}; i < linesCount; ++i)
+            runtimeChecksum += runtimeDispatcher.dispatch(COMMAND_LINES[i % COMMAND_LINES.size()]);
+    }));
+    results.back().operationsPerIteration = linesCount;
+
+    results.push_back(benchmark::RunCase("schema", iterations, [&] {
+        for (std::size_t i{}; i < linesCount; ++i)
+            schemaChecksum += DispatchWithSchema(COMMAND_LINES[i % COMMAND_LINES.size()]);
+    }));
+    results.back().operationsPerIteration = linesCount;
+
+    for (const benchmark::CaseResult& result : results)
+        PrintResult(result);
+
+    // Both the dispatchers see the same options, so the checksums must match.
+    const bool bSameResult{runtimeChecksum == schemaChecksum};
+    const nlohmann::json configurationJson{
+        {"lines", linesCount},
+        {"sameResult", bSameResult}
+    };
+
+    try {
+        benchmark::WriteResultsFile(outputPath, "command-schema", configurationJson, results);
+    } catch (const std::exception& e) {
+        std::cerr << "Unable to write the results file: " << e.what() << '\n';
+        return 1;
+    }
+
+    std::cout << "Results written to " << outputPath.string() << '\n';
+    return bSameResult ? 0 : 1;
+}
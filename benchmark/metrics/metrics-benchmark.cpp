@@ -0,0 +1,208 @@
+// Copyright (c) 2023 Andrea Ballestrazzi
+#include <benchmark-core.hpp>
+
+#include <gh_cmd/gh_cmd.hpp>
+#include <metrics/counter.hpp>
+#include <metrics/histogram.hpp>
+
+// C++ STL
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <filesystem>
+#include <iomanip>
+#include <iostream>
+#include <latch>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace {
+
+//!!
+//! \brief The counter the metrics module replaces: every thread increments the same atomic,
+//!  so the cache line bounces between the cores.
+//!
+class SharedAtomicCounter {
+public:
+    void increment() noexcept {
+        m_value.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    [[nodiscard]] std::uint64_t getValue() const noexcept {
+        return m_value.load(std::memory_order_relaxed);
+    }
+
+private:
+    std::atomic<std::uint64_t> m_value{};
+};
+
+//!!
+//! \brief A histogram with the same buckets of the lock-free one, guarded by a mutex.
+//!
+class LockedHistogram {
+public:
+    void record(const std::uint64_t value) {
+        std::lock_guard lock{m_mutex};
+        ++m_buckets[gc::metrics::HistogramBuckets::GetBucketIndex(value)];
+        ++m_count;
+        m_sum += value;
+        m_max = std::max(m_max, value);
+    }
+
+    [[nodiscard]] std::uint64_t getCount() {
+        std::lock_guard lock{m_mutex};
+        return m_count;
+    }
+
+private:
+    std::mutex m_mutex{};
+    std::array<std::uint64_t, gc::metrics::HistogramBuckets::BUCKETS_COUNT> m_buckets{};
+    std::uint64_t m_count{};
+    std::uint64_t m_sum{};
+    std::uint64_t m_max{};
+};
+
+//!!
+//! \brief Runs the record function on the given number of threads, which start together.
+//!
+template <typename RecordFunction>
+void RecordConcurrently(const std::size_t threadsCount, const std::size_t recordsPerThread,
+                        RecordFunction recordFunction) {
+    std::latch startLatch{static_cast<std::ptrdiff_t>(threadsCount)};
+
+    std::vector<std::jthread> threads{};
+    threads.reserve(threadsCount);
+    for (std::size_t i{}; i < threadsCount; ++i) {
+        threads.emplace_back([&startLatch, &recordFunction, recordsPerThread] {
+            startLatch.arrive_and_wait();
+            for (std::size_t j{}; j < recordsPerThread; ++j)
+                recordFunction(j);
+        });
+    }
+}
+
+void PrintResult(const benchmark::CaseResult& result) {
+    const double nsPerRecord{result.medianTime.count() /
+                             static_cast<double>(result.operationsPerIteration)};
+
+    std::cout << std::left << std::setw(18) << result.name << std::right << std::fixed
+              << std::setprecision(3) << " median " << std::setw(10)
+              << result.medianTime.count() / 1e6 << " ms   " << std::setw(10) << nsPerRecord
+              << " ns/record\n";
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    constexpr std::size_t DEFAULT_THREADS{4};
+    constexpr std::size_t DEFAULT_RECORDS{1'000'000};
+    constexpr std::size_t DEFAULT_ITERATIONS{10};
+    const std::string defaultOutputPath{"metrics-benchmark.json"};
+
+    gh_cmd::DefaultOptionParser<char> optionParser{"metrics_benchmark [OPTIONS]"};
+
+    const auto helpSwitch{
+        std::make_shared<gh_cmd::Switch<char>>('h', "help", "Displays this help page.")};
+    const auto threadsOption{std::make_shared<gh_cmd::Value<char, std::size_t>>(
+        't', "threads", "Number of threads recording at the same time.")};
+    const auto recordsOption{std::make_shared<gh_cmd::Value<char, std::size_t>>(
+        'r', "records", "Number of values recorded by every thread in every iteration.")};
+    const auto iterationsOption{std::make_shared<gh_cmd::Value<char, std::size_t>>(
+        'i', "iterations", "Number of timed iterations of every case.")};
+    const auto outputOption{std::make_shared<gh_cmd::Value<char, std::string>>(
+        'o', "output", "Path of the JSON results file.")};
+
+    optionParser.addSwitch(helpSwitch);
+    optionParser.addOption(threadsOption);
+    optionParser.addOption(recordsOption);
+    optionParser.addOption(iterationsOption);
+    optionParser.addOption(outputOption);
+
+    try {
+        optionParser.parse(std::vector<std::string>{argv, argv + argc});
+    } catch (const std::exception& e) {
+        std::cerr << e.what() << '\n';
+        optionParser.printHelp(std::cerr);
+        return 1;
+    }
+
+    if (helpSwitch->isSet()) {
+        optionParser.printHelp(std::cout);
+        return 0;
+    }
+
+    // The gh_cmd values don't keep their default after parsing, so the defaults are
+    // resolved here.
+    const std::size_t threadsCount{std::max<std::size_t>(
+        threadsOption->isSet() ? threadsOption->value() : DEFAULT_THREADS, 1)};
+    const std::size_t recordsPerThread{std::max<std::size_t>(
+        recordsOption->isSet() ? recordsOption->value() : DEFAULT_RECORDS, 1)};
+    const std::size_t iterations{std::max<std::size_t>(
+        iterationsOption->isSet() ? iterationsOption->value() : DEFAULT_ITERATIONS, 1)};
+    const std::filesystem::path outputPath{outputOption->isSet() ? outputOption->value()
+                                                                 : defaultOutputPath};
+    const std::size_t recordsPerIteration{threadsCount * recordsPerThread};
+
+    // The metrics are allocated on the heap: the sharded histogram is too large for the stack.
+    const auto sharedCounter{std::make_unique<SharedAtomicCounter>()};
+    const auto shardedCounter{std::make_unique<gc::metrics::Counter>()};
+    const auto lockedHistogram{std::make_unique<LockedHistogram>()};
+    const auto shardedHistogram{std::make_unique<gc::metrics::Histogram>()};
+
+    std::vector<benchmark::CaseResult> results{};
+    results.push_back(benchmark::RunCase("atomic-counter", iterations, [&] {
+        RecordConcurrently(threadsCount, recordsPerThread,
+                           [&](std::size_t) { sharedCounter->increment(); });
+    }));
+    results.back().operationsPerIteration = recordsPerIteration;
+
+    results.push_back(benchmark::RunCase("sharded-counter", iterations, [&] {
+        RecordConcurrently(threadsCount, recordsPerThread,
+                           [&](std::size_t) { shardedCounter->increment(); });
+    }));
+    results.back().operationsPerIteration = recordsPerIteration;
+
+    // The recorded values span many buckets, like the durations of the real operations.
+    results.push_back(benchmark::RunCase("locked-histogram", iterations, [&] {
+        RecordConcurrently(threadsCount, recordsPerThread,
+                           [&](std::size_t j) { lockedHistogram->record(j * 37); });
+    }));
+    results.back().operationsPerIteration = recordsPerIteration;
+
+    results.push_back(benchmark::RunCase("sharded-histogram", iterations, [&] {
+        RecordConcurrently(threadsCount, recordsPerThread,
+                           [&](std::size_t j) { shardedHistogram->record(j * 37); });
+    }));
+    results.back().operationsPerIteration = recordsPerIteration;
+
+    for (const benchmark::CaseResult& result : results)
+        PrintResult(result);
+
+    // Every implementation must have seen all the records.
+    const std::uint64_t expectedRecords{recordsPerIteration * iterations};
+    const bool bSameResult{sharedCounter->getValue() == expectedRecords &&
+                           shardedCounter->getValue() == expectedRecords &&
+                           lockedHistogram->getCount() == expectedRecords &&
+                           shardedHistogram->getSnapshot().count == expectedRecords};
+    const nlohmann::json configurationJson{
+        {"threads", threadsCount},
+        {"recordsPerThread", recordsPerThread},
+        {"sameResult", bSameResult}
+    };
+
+    try {
+        benchmark::WriteResultsFile(outputPath, "metrics", configurationJson, results);
+    } catch (const std::exception& e) {
+        std::cerr << "Unable to write the results file: " << e.what() << '\n';
+        return 1;
+    }
+
+    std::cout << "Results written to " << outputPath.string() << '\n';
+    return bSameResult ? 0 : 1;
+}
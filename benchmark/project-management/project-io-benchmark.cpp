@@ -0,0 +1,270 @@
+// Copyright (c) 2023 Andrea Ballestrazzi
+#include <benchmark-core.hpp>
+#include <project-management/synthetic-project-generator.hpp>
+
+#include <project-io/json-project-reader.hpp>
+#include <project-io/json-project-writer.hpp>
+#include <project-io/lazy-json-project-reader.hpp>
+
+#include <gh_cmd/gh_cmd.hpp>
+
+// C++ STL
+#include <algorithm>
+#include <cstdint>
+#include <exception>
+#include <filesystem>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <optional>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace {
+
+using namespace benchmark::project_management;
+using gc::project_management::Project;
+using gc::project_management::ProjectNode;
+
+[[nodiscard]] std::string WriteProject(const Project& project) {
+    auto outputStream{std::make_unique<std::ostringstream>()};
+    std::ostringstream& outputStreamRef{*outputStream};
+
+    gc::project_management::project_io::JsonProjectWriter writer{std::move(outputStream)};
+    writer.serializeProject(project);
+
+    return outputStreamRef.str();
+}
+
+template <typename ReaderType>
+[[nodiscard]] Project ReadProject(const std::string& serializedProject) {
+    ReaderType reader{std::make_unique<std::istringstream>(serializedProject)};
+    return reader.readProject();
+}
+
+void MaterializeAllObjects(const ProjectNode& node) {
+    for (const auto& [key, child] : node.getObjects())
+        MaterializeAllObjects(child);
+}
+
+[[nodiscard]] std::uint64_t LookupValue(const ProjectNode& root, const ValuePath& path) {
+    const ProjectNode* node{&root};
+    for (const std::string& key : path.objectKeys)
+        node = &node->getObject(key);
+
+    switch (path.kind) {
+    case ValueKind::Bool:
+        return node->getValue<bool>(path.valueKey) ? 1 : 0;
+    case ValueKind::Int:
+        return static_cast<std::uint64_t>(node->getValue<std::int64_t>(path.valueKey));
+    case ValueKind::UInt:
+        return node->getValue<std::uint64_t>(path.valueKey);
+    case ValueKind::Double:
+        return static_cast<std::uint64_t>(node->getValue<double>(path.valueKey));
+    case ValueKind::String:
+    default:
+        return node->getValue<std::string>(path.valueKey).size();
+    }
+}
+
+[[nodiscard]] std::optional<std::vector<ValueKind>> ParseValueKinds(const std::string& kinds) {
+    std::vector<ValueKind> valueKinds{};
+    std::istringstream kindsStream{kinds};
+
+    for (std::string kindName{}; std::getline(kindsStream, kindName, ',');) {
+        const std::optional<ValueKind> kind{ParseValueKind(kindName)};
+        if (!kind.has_value())
+            return std::nullopt;
+
+        valueKinds.push_back(*kind);
+    }
+
+    if (valueKinds.empty())
+        return std::nullopt;
+
+    return valueKinds;
+}
+
+//!!
+//! \brief Retrieves the value of an option, or its default value if the user didn't set it.
+//!  The gh_cmd values are reset to a value-initialized state, so the default must be repeated.
+//!
+template <typename ValueType>
+[[nodiscard]] ValueType GetValueOr(const gh_cmd::Value<char, ValueType>& option,
+                                   ValueType defaultValue) {
+    return option.isSet() ? option.value() : defaultValue;
+}
+
+void PrintResult(const benchmark::CaseResult& result) {
+    std::cout << std::left << std::setw(16) << result.name << std::right << std::fixed
+              << std::setprecision(3) << " median " << std::setw(12)
+              << result.medianTime.count() / 1e6 << " ms   min " << std::setw(12)
+              << result.minTime.count() / 1e6 << " ms   peak RSS " << result.peakRssKiB
+              << " KiB\n";
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    constexpr std::size_t DEFAULT_DEPTH{4};
+    constexpr std::size_t DEFAULT_FAN_OUT{6};
+    constexpr std::size_t DEFAULT_VALUES_PER_NODE{8};
+    constexpr std::size_t DEFAULT_ARRAY_SIZE{16};
+    constexpr std::size_t DEFAULT_ITERATIONS{10};
+    constexpr std::uint32_t DEFAULT_SEED{42};
+    const std::string defaultTypes{"bool,int,uint,double,string"};
+    const std::string defaultOutputPath{"project-io-benchmark.json"};
+
+    gh_cmd::DefaultOptionParser<char> optionParser{"project_io_benchmark [OPTIONS]"};
+
+    const auto helpSwitch{
+        std::make_shared<gh_cmd::Switch<char>>('h', "help", "Displays this help page.")};
+    const auto depthOption{std::make_shared<gh_cmd::Value<char, std::size_t>>(
+        'd', "depth", "Number of object levels below the project root.", DEFAULT_DEPTH)};
+    const auto fanOutOption{std::make_shared<gh_cmd::Value<char, std::size_t>>(
+        'f', "fan-out", "Number of child objects of every non-leaf object.",
+        DEFAULT_FAN_OUT)};
+    const auto valuesOption{std::make_shared<gh_cmd::Value<char, std::size_t>>(
+        'v', "values", "Number of scalar values of every object.", DEFAULT_VALUES_PER_NODE)};
+    const auto arraySizeOption{std::make_shared<gh_cmd::Value<char, std::size_t>>(
+        'a', "array-size", "Number of elements of the generated arrays.",
+        DEFAULT_ARRAY_SIZE)};
+    const auto typesOption{std::make_shared<gh_cmd::Value<char, std::string>>(
+        't', "types", "Comma-separated list of the value types (bool,int,uint,double,string).",
+        defaultTypes)};
+    const auto iterationsOption{std::make_shared<gh_cmd::Value<char, std::size_t>>(
+        'i', "iterations", "Number of timed iterations of every case.",
+        DEFAULT_ITERATIONS)};
+    const auto seedOption{std::make_shared<gh_cmd::Value<char, std::uint32_t>>(
+        's', "seed", "Seed of the values generator.", DEFAULT_SEED)};
+    const auto outputOption{std::make_shared<gh_cmd::Value<char, std::string>>(
+        'o', "output", "Path of the JSON results file.", defaultOutputPath)};
+
+    optionParser.addSwitch(helpSwitch);
+    for (const auto& option :
+         std::vector<std::shared_ptr<gh_cmd::CommandOption<char>>>{
+             depthOption, fanOutOption, valuesOption, arraySizeOption, typesOption,
+             iterationsOption, seedOption, outputOption})
+        optionParser.addOption(option);
+
+    try {
+        optionParser.parse(std::vector<std::string>{argv, argv + argc});
+    } catch (const std::exception& e) {
+        std::cerr << e.what() << '\n';
+        optionParser.printHelp(std::cerr);
+        return 1;
+    }
+
+    if (helpSwitch->isSet()) {
+        optionParser.printHelp(std::cout);
+        return 0;
+    }
+
+    const std::string types{GetValueOr(*typesOption, defaultTypes)};
+    const std::filesystem::path outputPath{GetValueOr(*outputOption, defaultOutputPath)};
+
+    const std::optional<std::vector<ValueKind>> valueKinds{ParseValueKinds(types)};
+    if (!valueKinds.has_value()) {
+        std::cerr << "Invalid value types: " << types << '\n';
+        return 1;
+    }
+
+    SyntheticProjectConfig config{};
+    config.depth = GetValueOr(*depthOption, DEFAULT_DEPTH);
+    config.fanOut = GetValueOr(*fanOutOption, DEFAULT_FAN_OUT);
+    config.valuesPerNode = GetValueOr(*valuesOption, DEFAULT_VALUES_PER_NODE);
+    config.arraySize = GetValueOr(*arraySizeOption, DEFAULT_ARRAY_SIZE);
+    config.valueKinds = *valueKinds;
+    config.seed = GetValueOr(*seedOption, DEFAULT_SEED);
+
+    const std::size_t iterations{
+        std::max<std::size_t>(GetValueOr(*iterationsOption, DEFAULT_ITERATIONS), 1)};
+    std::vector<benchmark::CaseResult> results{};
+
+    // Generation
+    std::optional<SyntheticProject> syntheticProject{};
+    results.push_back(benchmark::RunCase("generate", iterations, [&] {
+        syntheticProject = GenerateSyntheticProject(config);
+    }));
+
+    const Project& project{syntheticProject->project};
+    const std::string serializedProject{WriteProject(project)};
+
+    std::cout << "Synthetic project: " << syntheticProject->stats.objects << " objects, "
+              << syntheticProject->stats.values << " values, "
+              << syntheticProject->stats.arrayElements << " array elements, "
+              << serializedProject.size() << " bytes\n";
+
+    // Serialization and parsing
+    results.push_back(benchmark::RunCase("write", iterations, [&] {
+        [[maybe_unused]] const std::string output{WriteProject(project)};
+    }));
+
+    results.push_back(benchmark::RunCase("read", iterations, [&] {
+        [[maybe_unused]] const Project readProject{
+            ReadProject<gc::project_management::project_io::JsonProjectReader>(serializedProject)};
+    }));
+
+    results.push_back(benchmark::RunCase("lazy-read", iterations, [&] {
+        [[maybe_unused]] const Project readProject{
+            ReadProject<gc::project_management::project_io::LazyJsonProjectReader>(
+                serializedProject)};
+    }));
+
+    results.push_back(benchmark::RunCase("lazy-read-full", iterations, [&] {
+        const Project readProject{
+            ReadProject<gc::project_management::project_io::LazyJsonProjectReader>(
+                serializedProject)};
+        MaterializeAllObjects(readProject);
+    }));
+
+    results.push_back(benchmark::RunCase("round-trip", iterations, [&] {
+        const Project readProject{
+            ReadProject<gc::project_management::project_io::JsonProjectReader>(serializedProject)};
+        [[maybe_unused]] const std::string output{WriteProject(readProject)};
+    }));
+
+    // Lookups
+    std::uint64_t lookupChecksum{};
+    benchmark::CaseResult lookupResult{benchmark::RunCase("lookup", iterations, [&] {
+        for (const ValuePath& path : syntheticProject->valuePaths)
+            lookupChecksum += LookupValue(project, path);
+    })};
+    lookupResult.operationsPerIteration = std::max<std::size_t>(
+        syntheticProject->valuePaths.size(), 1);
+    results.push_back(lookupResult);
+
+    // Destruction. The copy is made outside the timed section.
+    std::optional<Project> projectToDestroy{};
+    results.push_back(benchmark::RunCase(
+        "destruction", iterations, [&] { projectToDestroy = project; },
+        [&] { projectToDestroy.reset(); }));
+
+    for (const benchmark::CaseResult& result : results)
+        PrintResult(result);
+
+    const nlohmann::json configurationJson{
+        {"depth", config.depth},
+        {"fanOut", config.fanOut},
+        {"valuesPerNode", config.valuesPerNode},
+        {"arraySize", config.arraySize},
+        {"types", types},
+        {"seed", config.seed},
+        {"objects", syntheticProject->stats.objects},
+        {"values", syntheticProject->stats.values},
+        {"arrayElements", syntheticProject->stats.arrayElements},
+        {"serializedBytes", serializedProject.size()},
+        {"lookupChecksum", lookupChecksum}
+    };
+
+    try {
+        benchmark::WriteResultsFile(outputPath, "project-io", configurationJson, results);
+    } catch (const std::exception& e) {
+        std::cerr << "Unable to write the results file: " << e.what() << '\n';
+        return 1;
+    }
+
+    std::cout << "Results written to " << outputPath.string() << '\n';
+    return 0;
+}
@@ -0,0 +1,137 @@
+// Copyright (c) 2023 Andrea Ballestrazzi
+#include <project-management/synthetic-project-generator.hpp>
+
+// C++ STL
+#include <algorithm>
+#include <array>
+#include <random>
+#include <utility>
+
+namespace benchmark::project_management {
+
+namespace details {
+
+constexpr std::array<std::pair<std::string_view, ValueKind>, 5> VALUE_KIND_NAMES{
+    std::pair{std::string_view{"bool"}, ValueKind::Bool},
+    std::pair{std::string_view{"int"}, ValueKind::Int},
+    std::pair{std::string_view{"uint"}, ValueKind::UInt},
+    std::pair{std::string_view{"double"}, ValueKind::Double},
+    std::pair{std::string_view{"string"}, ValueKind::String}};
+
+//!!
+//! \brief Builds the nodes of a synthetic project, keeping track of the generated values.
+//!
+class SyntheticNodeBuilder {
+public:
+    using node_type = gc::project_management::ProjectNode;
+    using value_type = node_type::value_impl_type;
+
+    SyntheticNodeBuilder(const SyntheticProjectConfig& config, SyntheticProject& output) noexcept
+        : m_config{config},
+          m_output{output},
+          m_randomEngine{config.seed} {}
+
+    void fillNode(node_type& node, std::size_t remainingDepth, std::vector<std::string>& keys) {
+        for (std::size_t i{}; i < m_config.valuesPerNode; ++i) {
+            const ValueKind kind{nextKind(i)};
+            std::string valueKey{"value" + std::to_string(i)};
+
+            node.addValue(valueKey, makeValue(kind));
+            m_output.valuePaths.push_back(ValuePath{keys, std::move(valueKey), kind});
+        }
+        m_output.stats.values += m_config.valuesPerNode;
+
+        std::vector<value_type> values{};
+        values.reserve(m_config.arraySize);
+        const ValueKind arrayKind{nextKind(keys.size())};
+        std::generate_n(std::back_inserter(values), m_config.arraySize,
+                        [this, arrayKind] { return makeValue(arrayKind); });
+        node.addValueArray("array", std::move(values));
+        m_output.stats.arrayElements += m_config.arraySize;
+
+        if (remainingDepth == 0) {
+            std::vector<node_type> records(m_config.arraySize);
+            for (node_type& record : records) {
+                for (std::size_t i{}; i < m_config.valuesPerNode; ++i)
+                    record.addValue("value" + std::to_string(i), makeValue(nextKind(i)));
+            }
+
+            m_output.stats.arrayElements += m_config.arraySize * m_config.valuesPerNode;
+            node.addObjectArray("records", std::move(records));
+            return;
+        }
+
+        for (std::size_t i{}; i < m_config.fanOut; ++i) {
+            keys.push_back("object" + std::to_string(i));
+
+            node_type child{};
+            fillNode(child, remainingDepth - 1, keys);
+            node.addObject(keys.back(), std::move(child));
+            ++m_output.stats.objects;
+
+            keys.pop_back();
+        }
+    }
+
+private:
+    const SyntheticProjectConfig& m_config;
+    SyntheticProject& m_output;
+    std::mt19937_64 m_randomEngine;
+
+    [[nodiscard]] ValueKind nextKind(std::size_t index) const noexcept {
+        return m_config.valueKinds[index % m_config.valueKinds.size()];
+    }
+
+    [[nodiscard]] value_type makeValue(ValueKind kind) {
+        switch (kind) {
+        case ValueKind::Bool:
+            return value_type{(m_randomEngine() & 1U) != 0};
+        case ValueKind::Int:
+            return value_type{static_cast<std::int64_t>(m_randomEngine() >> 1U) -
+                              (std::int64_t{1} << 62U)};
+        case ValueKind::UInt:
+            return value_type{static_cast<std::uint64_t>(m_randomEngine())};
+        case ValueKind::Double:
+            return value_type{std::uniform_real_distribution<double>{-1e6, 1e6}(m_randomEngine)};
+        case ValueKind::String:
+        default:
+            return value_type{"string-" + std::to_string(m_randomEngine() % 1'000'000)};
+        }
+    }
+};
+
+} // namespace details
+
+std::string_view ValueKindToString(ValueKind kind) noexcept {
+    const auto kindIt{std::ranges::find(details::VALUE_KIND_NAMES, kind,
+                                        &std::pair<std::string_view, ValueKind>::second)};
+    return kindIt != details::VALUE_KIND_NAMES.end() ? kindIt->first : std::string_view{};
+}
+
+std::optional<ValueKind> ParseValueKind(std::string_view kindName) noexcept {
+    const auto kindIt{std::ranges::find(details::VALUE_KIND_NAMES, kindName,
+                                        &std::pair<std::string_view, ValueKind>::first)};
+    if (kindIt == details::VALUE_KIND_NAMES.end())
+        return std::nullopt;
+
+    return kindIt->second;
+}
+
+SyntheticProject GenerateSyntheticProject(const SyntheticProjectConfig& config) {
+    using namespace gc::project_management;
+
+    SyntheticProject output{};
+    output.project = Project{Project::time_point_type{}, "synthetic-project",
+                             Project::project_version{1, 2, 0}};
+
+    if (config.valueKinds.empty())
+        return output;
+
+    details::SyntheticNodeBuilder builder{config, output};
+    std::vector<std::string> keys{};
+    builder.fillNode(output.project, config.depth, keys);
+
+    return output;
+}
+
+} // namespace benchmark::project_management
@@ -0,0 +1,82 @@
+// Copyright (c) 2023 Andrea Ballestrazzi
+#pragma once
+
+#include <project-management/project.hpp>
+
+// C++ STL
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace benchmark::project_management {
+
+//!!
+//! \brief Represents the types of the values that can be generated inside a project.
+//!
+enum class ValueKind {
+    Bool,
+    Int,
+    UInt,
+    Double,
+    String
+};
+
+[[nodiscard]] std::string_view ValueKindToString(ValueKind kind) noexcept;
+[[nodiscard]] std::optional<ValueKind> ParseValueKind(std::string_view kindName) noexcept;
+
+//!!
+//! \brief Describes the shape of a synthetic project.
+//!
+struct SyntheticProjectConfig {
+    //! Number of object levels below the project root.
+    std::size_t depth{3};
+    //! Number of child objects of every non-leaf object.
+    std::size_t fanOut{4};
+    //! Number of scalar values of every object.
+    std::size_t valuesPerNode{8};
+    //! Number of elements of the value arrays and of the leaf object arrays.
+    std::size_t arraySize{16};
+    //! Types of the generated values. They are used in round-robin order.
+    std::vector<ValueKind> valueKinds{ValueKind::Bool, ValueKind::Int, ValueKind::UInt,
+                                      ValueKind::Double, ValueKind::String};
+    std::uint32_t seed{42};
+};
+
+//!!
+//! \brief Represents the path from the project root to a scalar value.
+//!
+struct ValuePath {
+    std::vector<std::string> objectKeys{};
+    std::string valueKey{};
+    ValueKind kind{};
+};
+
+//!!
+//! \brief Represents the size of a synthetic project.
+//!
+struct SyntheticProjectStats {
+    std::size_t objects{};
+    std::size_t values{};
+    std::size_t arrayElements{};
+};
+
+struct SyntheticProject {
+    gc::project_management::Project project{};
+    std::vector<ValuePath> valuePaths{};
+    SyntheticProjectStats stats{};
+};
+
+//!!
+//! \brief Generates a project with the given shape. Every object has the configured number
+//!  of values, a value array and, unless it's a leaf, the configured number of child objects.
+//!  Leaf objects also have an array of records. The values are pseudo-random but depend only
+//!  on the configuration, so the same configuration always generates the same project.
+//!
+//! \param config The shape of the project.
+//! \return The generated project with the paths of all its object values.
+[[nodiscard]] SyntheticProject GenerateSyntheticProject(const SyntheticProjectConfig& config);
+
+} // namespace benchmark::project_management
@@ -0,0 +1,245 @@
+// Copyright (c) 2023 Andrea Ballestrazzi
+#include <benchmark-core.hpp>
+
+#include <application/event-loop.hpp>
+#include <commands/status-command.hpp>
+#include <diagnostics/diagnostic-status-probeable.hpp>
+#include <remote/command-client.hpp>
+#include <remote/command-server.hpp>
+
+#include <gh_cmd/gh_cmd.hpp>
+#include <gh_log/spl-logger.hpp>
+
+// C++ STL
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <cstddef>
+#include <exception>
+#include <filesystem>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+// POSIX
+#include <unistd.h>
+
+namespace {
+
+//!!
+//! \brief A system with a diagnostic of the same size of the automatic watering one.
+//!
+struct FakeWateringSystem final : public rpi_gc::diagnostics::DiagnosticStatusProbeable {
+    [[nodiscard]] rpi_gc::diagnostics::DiagnosticSnapshot captureDiagnostic() const override {
+        using rpi_gc::diagnostics::DiagnosticField;
+
+        return rpi_gc::diagnostics::DiagnosticSnapshot{
+            .system = "automatic-watering",
+            .title = "Automatic watering system (AWS)",
+            .fields = {DiagnosticField{"status", "Status", std::string{"Running"}},
+                       DiagnosticField{"name", "Active flow", std::string{"greenhouse-north"}}},
+            .sections = {{.key = "flow",
+                          .title = "AWS Flow",
+                          .fields = {DiagnosticField{"waterValvePin", "Water valve output PIN",
+                                                     std::uint64_t{26}},
+                                     DiagnosticField{"waterPumpPin", "Water pump output PIN",
+                                                     std::uint64_t{23}}}}}};
+    }
+};
+
+//!!
+//! \brief Runs the clients concurrently, every one pipelining its status requests.
+//!
+//! \return The number of responses that weren't the expected status output.
+std::size_t RunClients(const std::filesystem::path& socketPath, std::size_t clientsCount,
+                       std::size_t requestsCount, std::size_t pipelineDepth,
+                       const std::string& expectedResponse) {
+    std::atomic<std::size_t> wrongResponsesCount{};
+    std::vector<std::jthread> clientThreads{};
+
+    for (std::size_t clientIndex{}; clientIndex < clientsCount; ++clientIndex) {
+        clientThreads.emplace_back([&] {
+            try {
+                rpi_gc::remote::CommandClient client{};
+                client.connect(socketPath);
+
+                std::size_t sentCount{};
+                std::size_t receivedCount{};
+                while (receivedCount < requestsCount) {
+                    while (sentCount < requestsCount && sentCount - receivedCount < pipelineDepth) {
+                        client.send("status");
+                        ++sentCount;
+                    }
+
+                    if (client.receiveResponse() != expectedResponse) {
+                        ++wrongResponsesCount;
+                    }
+
+                    ++receivedCount;
+                }
+            } catch (const std::exception& e) {
+                std::cerr << "Client failure: " << e.what() << '\n';
+                wrongResponsesCount += requestsCount;
+            }
+        });
+    }
+
+    clientThreads.clear();
+    return wrongResponsesCount.load();
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    constexpr std::size_t DEFAULT_CLIENTS{8};
+    constexpr std::size_t DEFAULT_REQUESTS{5'000};
+    constexpr std::size_t DEFAULT_PIPELINE_DEPTH{8};
+    constexpr std::size_t DEFAULT_ITERATIONS{3};
+    constexpr std::size_t DEFAULT_MIN_REQUESTS_PER_SECOND{2'000};
+    const std::string defaultOutputPath{"command-server-load-benchmark.json"};
+
+    gh_cmd::DefaultOptionParser<char> optionParser{"command_server_load_benchmark [OPTIONS]"};
+
+    const auto helpSwitch{
+        std::make_shared<gh_cmd::Switch<char>>('h', "help", "Displays this help page.")};
+    const auto clientsOption{std::make_shared<gh_cmd::Value<char, std::size_t>>(
+        'c', "clients", "Number of concurrent clients.")};
+    const auto requestsOption{std::make_shared<gh_cmd::Value<char, std::size_t>>(
+        'r', "requests", "Number of status requests sent by every client.")};
+    const auto depthOption{std::make_shared<gh_cmd::Value<char, std::size_t>>(
+        'd', "depth", "Number of requests a client sends before waiting for a response.")};
+    const auto iterationsOption{std::make_shared<gh_cmd::Value<char, std::size_t>>(
+        'i', "iterations", "Number of timed iterations.")};
+    const auto minRateOption{std::make_shared<gh_cmd::Value<char, std::size_t>>(
+        'm', "min-rate", "Requests per second below which the load test fails.")};
+    const auto outputOption{std::make_shared<gh_cmd::Value<char, std::string>>(
+        'o', "output", "Path of the JSON results file.")};
+
+    optionParser.addSwitch(helpSwitch);
+    optionParser.addOption(clientsOption);
+    optionParser.addOption(requestsOption);
+    optionParser.addOption(depthOption);
+    optionParser.addOption(iterationsOption);
+    optionParser.addOption(minRateOption);
+    optionParser.addOption(outputOption);
+
+    try {
+        optionParser.parse(std::vector<std::string>{argv, argv + argc});
+    } catch (const std::exception& e) {
+        std::cerr << e.what() << '\n';
+        optionParser.printHelp(std::cerr);
+        return 1;
+    }
+
+    if (helpSwitch->isSet()) {
+        optionParser.printHelp(std::cout);
+        return 0;
+    }
+
+    // The gh_cmd values don't keep their default after parsing, so the defaults are
+    // resolved here.
+    const std::size_t clientsCount{std::max<std::size_t>(
+        clientsOption->isSet() ? clientsOption->value() : DEFAULT_CLIENTS, 1)};
+    const std::size_t requestsCount{std::max<std::size_t>(
+        requestsOption->isSet() ? requestsOption->value() : DEFAULT_REQUESTS, 1)};
+    const std::size_t pipelineDepth{std::max<std::size_t>(
+        depthOption->isSet() ? depthOption->value() : DEFAULT_PIPELINE_DEPTH, 1)};
+    const std::size_t iterations{std::max<std::size_t>(
+        iterationsOption->isSet() ? iterationsOption->value() : DEFAULT_ITERATIONS, 1)};
+    const std::size_t minRequestsPerSecond{
+        minRateOption->isSet() ? minRateOption->value() : DEFAULT_MIN_REQUESTS_PER_SECOND};
+    const std::filesystem::path outputPath{outputOption->isSet() ? outputOption->value()
+                                                                 : defaultOutputPath};
+
+    const std::filesystem::path socketPath{
+        std::filesystem::temp_directory_path() /
+        ("command-server-load-" + std::to_string(::getpid()) + ".sock")};
+
+    FakeWateringSystem wateringSystem{};
+    rpi_gc::EventLoop eventLoop{};
+    rpi_gc::remote::CommandServer commandServer{
+        eventLoop,
+        [&wateringSystem](std::ostream& outputStream) {
+            auto statusOptionParser{
+                std::make_unique<gh_cmd::DefaultOptionParser<char>>("[OPTIONS] => status")};
+            statusOptionParser->addSwitch(
+                std::make_shared<gh_cmd::Switch<char>>('h', "help", "Displays this help page."));
+
+            std::vector<rpi_gc::remote::CommandServer::command_pointer> commands{};
+            commands.push_back(std::make_unique<rpi_gc::commands::StatusCommand>(
+                std::move(statusOptionParser),
+                std::vector<rpi_gc::commands::StatusCommand::diagnostic_probeable_ref>{
+                    std::cref(wateringSystem)},
+                outputStream));
+            return commands;
+        },
+        gh_log::SPLLogger::createColoredStdOutLogger("command-server"), clientsCount + 1};
+
+    try {
+        commandServer.start(socketPath);
+    } catch (const std::exception& e) {
+        std::cerr << "Unable to start the command server: " << e.what() << '\n';
+        return 1;
+    }
+
+    std::jthread serverThread{[&eventLoop] {
+        eventLoop.run();
+    }};
+
+    // The expected response is the output of the status command when nobody else uses it.
+    std::string expectedResponse{};
+    {
+        rpi_gc::remote::CommandClient client{};
+        client.connect(socketPath);
+        expectedResponse = client.execute("status");
+    }
+
+    std::size_t wrongResponsesCount{};
+    std::vector<benchmark::CaseResult> results{};
+    results.push_back(benchmark::RunCase("pipelined status requests", iterations, [&] {
+        wrongResponsesCount +=
+            RunClients(socketPath, clientsCount, requestsCount, pipelineDepth, expectedResponse);
+    }));
+    results.back().operationsPerIteration = clientsCount * requestsCount;
+
+    eventLoop.stop();
+    serverThread.join();
+    commandServer.stop();
+
+    const benchmark::CaseResult& result{results.back()};
+    const double requestsPerSecond{static_cast<double>(result.operationsPerIteration) /
+                                   (result.medianTime.count() / 1e9)};
+    const double microsecondsPerRequest{result.medianTime.count() / 1e3 /
+                                        static_cast<double>(result.operationsPerIteration)};
+
+    std::cout << std::left << std::setw(32) << result.name << std::right << std::fixed
+              << std::setprecision(0) << std::setw(12) << requestsPerSecond << " req/s"
+              << std::setprecision(2) << std::setw(12) << microsecondsPerRequest << " us/req"
+              << '\n';
+
+    benchmark::WriteResultsFile(outputPath, "command_server_load_benchmark",
+                                {{"clients", clientsCount},
+                                 {"requestsPerClient", requestsCount},
+                                 {"pipelineDepth", pipelineDepth},
+                                 {"iterations", iterations},
+                                 {"requestsPerSecond", requestsPerSecond},
+                                 {"wrongResponses", wrongResponsesCount}},
+                                results);
+
+    if (wrongResponsesCount != 0) {
+        std::cerr << wrongResponsesCount << " responses were wrong or missing.\n";
+        return 1;
+    }
+
+    if (requestsPerSecond < static_cast<double>(minRequestsPerSecond)) {
+        std::cerr << "The server handled fewer than " << minRequestsPerSecond
+                  << " requests per second.\n";
+        return 1;
+    }
+
+    return 0;
+}
@@ -0,0 +1,130 @@
+// Copyright (c) 2023 Andrea Ballestrazzi
+#include <benchmark-core.hpp>
+
+#include <automatic-watering/time-providers/configurable-daily-cycle-aws-time-provider.hpp>
+#include <automatic-watering/time-providers/moisture-controlled-aws-time-provider.hpp>
+#include <automatic-watering/time-providers/moisture-controller.hpp>
+#include <sensors/sensor-sample-ring.hpp>
+
+#include <gh_cmd/gh_cmd.hpp>
+
+// C++ STL
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <filesystem>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace {
+
+//! \return A moisture that oscillates around the setpoint, as the soil between two waterings.
+[[nodiscard]] double GetMoisture(const std::size_t index) noexcept {
+    return 35.0 + 8.0 * std::sin(static_cast<double>(index) * 0.01);
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    constexpr std::size_t DEFAULT_DECISIONS{100'000};
+    constexpr std::size_t DEFAULT_ITERATIONS{10};
+    const std::string defaultOutputPath{"moisture-control-benchmark.json"};
+
+    gh_cmd::DefaultOptionParser<char> optionParser{"moisture_control_benchmark [OPTIONS]"};
+
+    const auto helpSwitch{
+        std::make_shared<gh_cmd::Switch<char>>('h', "help", "Displays this help page.")};
+    const auto decisionsOption{std::make_shared<gh_cmd::Value<char, std::size_t>>(
+        'd', "decisions", "Number of watering decisions of every iteration.")};
+    const auto iterationsOption{std::make_shared<gh_cmd::Value<char, std::size_t>>(
+        'i', "iterations", "Number of timed iterations.")};
+    const auto outputOption{std::make_shared<gh_cmd::Value<char, std::string>>(
+        'o', "output", "Path of the JSON results file.")};
+
+    optionParser.addSwitch(helpSwitch);
+    optionParser.addOption(decisionsOption);
+    optionParser.addOption(iterationsOption);
+    optionParser.addOption(outputOption);
+
+    try {
+        optionParser.parse(std::vector<std::string>{argv, argv + argc});
+    } catch (const std::exception& e) {
+        std::cerr << e.what() << '\n';
+        optionParser.printHelp(std::cerr);
+        return 1;
+    }
+
+    if (helpSwitch->isSet()) {
+        optionParser.printHelp(std::cout);
+        return 0;
+    }
+
+    // The gh_cmd values don't keep their default after parsing, so the defaults are
+    // resolved here.
+    const std::size_t decisionsCount{std::max<std::size_t>(
+        decisionsOption->isSet() ? decisionsOption->value() : DEFAULT_DECISIONS, 1)};
+    const std::size_t iterations{std::max<std::size_t>(
+        iterationsOption->isSet() ? iterationsOption->value() : DEFAULT_ITERATIONS, 1)};
+    const std::filesystem::path outputPath{outputOption->isSet() ? outputOption->value()
+                                                                 : defaultOutputPath};
+
+    using namespace std::chrono_literals;
+    using rpi_gc::automatic_watering::WateringSystemTimeProvider;
+
+    std::vector<benchmark::CaseResult> results{};
+    double durationsSum{};
+
+    rpi_gc::automatic_watering::MoistureController controller{
+        rpi_gc::automatic_watering::MoistureControlParameters{}};
+    results.push_back(benchmark::RunCase("controller step", iterations, [&] {
+        for (std::size_t i{}; i < decisionsCount; ++i)
+            durationsSum += controller.step(GetMoisture(i), 60s).demand;
+    }));
+    results.back().operationsPerIteration = decisionsCount;
+
+    // Every decision reads a new sample from the ring and computes both the durations, as a
+    // watering cycle does.
+    rpi_gc::sensors::SensorSampleRing moistureSamples{1024};
+    rpi_gc::automatic_watering::ConfigurableDailyCycleAWSTimeProvider fallbackProvider{
+        6000ms, 600'000ms, 600ms};
+    rpi_gc::automatic_watering::MoistureControlledAWSTimeProvider timeProvider{
+        moistureSamples, std::ref(fallbackProvider)};
+    const std::int64_t startTimestamp{std::chrono::duration_cast<std::chrono::milliseconds>(
+                                          std::chrono::system_clock::now().time_since_epoch())
+                                          .count()};
+    results.push_back(benchmark::RunCase("provider decision", iterations, [&] {
+        for (std::size_t i{}; i < decisionsCount; ++i) {
+            moistureSamples.push(rpi_gc::sensors::SensorSample{
+                startTimestamp + static_cast<std::int64_t>(i % 1000), GetMoisture(i)});
+            const WateringSystemTimeProvider::time_unit activationTime{
+                timeProvider.getWateringSystemActivationDuration()};
+            const WateringSystemTimeProvider::time_unit deactivationTime{
+                timeProvider.getWateringSystemDeactivationDuration()};
+            durationsSum += static_cast<double>((activationTime + deactivationTime).count());
+        }
+    }));
+    results.back().operationsPerIteration = decisionsCount;
+
+    for (const benchmark::CaseResult& result : results) {
+        std::cout << std::left << std::setw(24) << result.name << std::right << std::fixed
+                  << std::setprecision(1) << std::setw(12)
+                  << result.medianTime.count() / static_cast<double>(result.operationsPerIteration)
+                  << " ns/decision" << '\n';
+    }
+
+    // The sum keeps the decisions from being optimized away.
+    benchmark::WriteResultsFile(outputPath, "moisture_control_benchmark",
+                                {{"decisions", decisionsCount},
+                                 {"iterations", iterations},
+                                 {"checksum", durationsSum}},
+                                results);
+
+    return 0;
+}
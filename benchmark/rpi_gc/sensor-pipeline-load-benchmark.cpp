@@ -0,0 +1,183 @@
+// Copyright (c) 2023 Andrea Ballestrazzi
+#include <benchmark-core.hpp>
+
+#include <sensors/sensor-acquisition-pipeline.hpp>
+
+#include <gh_cmd/gh_cmd.hpp>
+#include <gh_hal/backends/simulated/scripted-sensor-source.hpp>
+#include <metrics/metrics-registry.hpp>
+
+// C++ STL
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <filesystem>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace {
+
+using gh_hal::backends::simulated::ScriptedSensorSource;
+using gh_hal::backends::simulated::SensorScriptStep;
+using rpi_gc::sensors::SensorAcquisitionPipeline;
+
+//!!
+//! \brief Reads all the sensors of the pipeline in a loop, as a storage consumer would.
+//!
+//! \return The number of samples read.
+std::uint64_t ConsumeSamples(const SensorAcquisitionPipeline& pipeline,
+                             const std::atomic_bool& bStopConsuming) {
+    std::vector<std::uint64_t> positions(pipeline.getSensorsCount());
+    std::vector<rpi_gc::sensors::SensorSample> samples{};
+    std::uint64_t readSamplesCount{};
+
+    while (!bStopConsuming.load(std::memory_order_relaxed)) {
+        for (std::size_t i{}; i < positions.size(); ++i) {
+            samples.clear();
+            positions[i] = pipeline.getSamples(i).readFrom(positions[i], samples);
+            readSamplesCount += samples.size();
+        }
+
+        std::this_thread::sleep_for(std::chrono::milliseconds{1});
+    }
+
+    return readSamplesCount;
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    constexpr std::size_t DEFAULT_SENSORS{500};
+    constexpr std::size_t DEFAULT_PERIOD_MS{10};
+    constexpr std::size_t DEFAULT_DURATION_MS{2'000};
+    constexpr std::size_t DEFAULT_CONSUMERS{2};
+    const std::string defaultOutputPath{"sensor-pipeline-load-benchmark.json"};
+
+    gh_cmd::DefaultOptionParser<char> optionParser{"sensor_pipeline_load_benchmark [OPTIONS]"};
+
+    const auto helpSwitch{
+        std::make_shared<gh_cmd::Switch<char>>('h', "help", "Displays this help page.")};
+    const auto sensorsOption{std::make_shared<gh_cmd::Value<char, std::size_t>>(
+        's', "sensors", "Number of simulated sensors.")};
+    const auto periodOption{std::make_shared<gh_cmd::Value<char, std::size_t>>(
+        'p', "period", "Sampling period of every sensor, in milliseconds.")};
+    const auto durationOption{std::make_shared<gh_cmd::Value<char, std::size_t>>(
+        'd', "duration", "Duration of the load test, in milliseconds.")};
+    const auto consumersOption{std::make_shared<gh_cmd::Value<char, std::size_t>>(
+        'c', "consumers", "Number of threads reading the samples of all the sensors.")};
+    const auto outputOption{std::make_shared<gh_cmd::Value<char, std::string>>(
+        'o', "output", "Path of the JSON results file.")};
+
+    optionParser.addSwitch(helpSwitch);
+    optionParser.addOption(sensorsOption);
+    optionParser.addOption(periodOption);
+    optionParser.addOption(durationOption);
+    optionParser.addOption(consumersOption);
+    optionParser.addOption(outputOption);
+
+    try {
+        optionParser.parse(std::vector<std::string>{argv, argv + argc});
+    } catch (const std::exception& e) {
+        std::cerr << e.what() << '\n';
+        optionParser.printHelp(std::cerr);
+        return 1;
+    }
+
+    if (helpSwitch->isSet()) {
+        optionParser.printHelp(std::cout);
+        return 0;
+    }
+
+    // The gh_cmd values don't keep their default after parsing, so the defaults are
+    // resolved here.
+    const std::size_t sensorsCount{std::max<std::size_t>(
+        sensorsOption->isSet() ? sensorsOption->value() : DEFAULT_SENSORS, 1)};
+    const std::size_t periodMs{std::max<std::size_t>(
+        periodOption->isSet() ? periodOption->value() : DEFAULT_PERIOD_MS, 1)};
+    const std::size_t durationMs{std::max<std::size_t>(
+        durationOption->isSet() ? durationOption->value() : DEFAULT_DURATION_MS, 1)};
+    const std::size_t consumersCount{
+        consumersOption->isSet() ? consumersOption->value() : DEFAULT_CONSUMERS};
+    const std::filesystem::path outputPath{outputOption->isSet() ? outputOption->value()
+                                                                 : defaultOutputPath};
+
+    SensorAcquisitionPipeline pipeline{};
+    for (std::size_t i{}; i < sensorsCount; ++i) {
+        pipeline.registerSensor(
+            "sensor-" + std::to_string(i),
+            std::make_shared<ScriptedSensorSource>(
+                std::vector<SensorScriptStep>{SensorScriptStep{.kind = SensorScriptStep::Kind::Ramp,
+                                                               .fromValue = 15.0,
+                                                               .toValue = 30.0,
+                                                               .readsCount = 1000}},
+                true, 0.25, i + 1),
+            std::chrono::milliseconds{periodMs});
+    }
+
+    std::atomic_bool bStopConsuming{};
+    std::atomic<std::uint64_t> consumedSamplesCount{};
+
+    std::vector<benchmark::CaseResult> results{};
+    results.push_back(benchmark::RunCase("sampling under load", 1, [&] {
+        pipeline.start();
+
+        std::vector<std::jthread> consumerThreads{};
+        for (std::size_t i{}; i < consumersCount; ++i) {
+            consumerThreads.emplace_back([&] {
+                consumedSamplesCount += ConsumeSamples(pipeline, bStopConsuming);
+            });
+        }
+
+        std::this_thread::sleep_for(std::chrono::milliseconds{durationMs});
+        bStopConsuming = true;
+        consumerThreads.clear();
+        pipeline.stop();
+    }));
+
+    std::uint64_t samplesCount{};
+    std::uint64_t missedSamplingsCount{};
+    for (std::size_t i{}; i < sensorsCount; ++i) {
+        samplesCount += pipeline.getSamples(i).getWrittenCount();
+        missedSamplingsCount += pipeline.getMissedSamplingsCount(i);
+    }
+    results.back().operationsPerIteration = static_cast<std::size_t>(samplesCount);
+
+    const gc::metrics::HistogramSnapshot latenessSnapshot{
+        gc::metrics::GetDefaultRegistry()
+            .histogram("gc_sensor_sampling_lateness_ns", "")
+            .getSnapshot()};
+    const double samplesPerSecond{static_cast<double>(samplesCount) /
+                                  (results.back().medianTime.count() / 1e9)};
+    const double expectedSamplesPerSecond{static_cast<double>(sensorsCount) * 1000.0 /
+                                          static_cast<double>(periodMs)};
+    const double p99LatenessUs{
+        static_cast<double>(latenessSnapshot.getValueAtQuantile(0.99)) / 1e3};
+
+    std::cout << std::left << std::setw(24) << "sampling under load" << std::right << std::fixed
+              << std::setprecision(0) << std::setw(12) << samplesPerSecond << " samples/s"
+              << std::setw(12) << expectedSamplesPerSecond << " expected" << std::setw(10)
+              << missedSamplingsCount << " missed" << std::setprecision(1) << std::setw(12)
+              << p99LatenessUs << " us p99 lateness" << '\n';
+
+    benchmark::WriteResultsFile(outputPath, "sensor_pipeline_load_benchmark",
+                                {{"sensors", sensorsCount},
+                                 {"periodMs", periodMs},
+                                 {"durationMs", durationMs},
+                                 {"consumers", consumersCount},
+                                 {"samplesPerSecond", samplesPerSecond},
+                                 {"expectedSamplesPerSecond", expectedSamplesPerSecond},
+                                 {"missedSamplings", missedSamplingsCount},
+                                 {"consumedSamples", consumedSamplesCount.load()},
+                                 {"p99SamplingLatenessNs",
+                                  latenessSnapshot.getValueAtQuantile(0.99)}},
+                                results);
+
+    return 0;
+}
@@ -0,0 +1,158 @@
+// Copyright (c) 2023 Andrea Ballestrazzi
+#include <benchmark-core.hpp>
+
+#include <sensors/signal-filters.hpp>
+
+#include <gh_cmd/gh_cmd.hpp>
+
+// C++ STL
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <exception>
+#include <filesystem>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <span>
+#include <string>
+#include <vector>
+
+namespace {
+
+using rpi_gc::sensors::SignalFilterBackend;
+
+//!!
+//! \brief Filters a block of every channel with its own filter, as a consumer does after
+//!  reading the rings of the sensors.
+//!
+template <typename Filter>
+void FilterChannels(std::vector<Filter>& filters, const std::vector<std::vector<double>>& inputs,
+                    std::vector<std::vector<double>>& outputs) {
+    for (std::size_t channel{}; channel < filters.size(); ++channel)
+        filters[channel].process(inputs[channel], outputs[channel]);
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    constexpr std::size_t DEFAULT_CHANNELS{256};
+    constexpr std::size_t DEFAULT_BLOCK_SIZE{1024};
+    constexpr std::size_t DEFAULT_ITERATIONS{20};
+    constexpr std::size_t WINDOW_SIZE{5};
+    const std::string defaultOutputPath{"signal-filters-benchmark.json"};
+
+    gh_cmd::DefaultOptionParser<char> optionParser{"signal_filters_benchmark [OPTIONS]"};
+
+    const auto helpSwitch{
+        std::make_shared<gh_cmd::Switch<char>>('h', "help", "Displays this help page.")};
+    const auto channelsOption{std::make_shared<gh_cmd::Value<char, std::size_t>>(
+        'c', "channels", "Number of filtered channels.")};
+    const auto blockOption{std::make_shared<gh_cmd::Value<char, std::size_t>>(
+        'b', "block", "Number of samples of every channel filtered at once.")};
+    const auto iterationsOption{std::make_shared<gh_cmd::Value<char, std::size_t>>(
+        'i', "iterations", "Number of timed iterations.")};
+    const auto outputOption{std::make_shared<gh_cmd::Value<char, std::string>>(
+        'o', "output", "Path of the JSON results file.")};
+
+    optionParser.addSwitch(helpSwitch);
+    optionParser.addOption(channelsOption);
+    optionParser.addOption(blockOption);
+    optionParser.addOption(iterationsOption);
+    optionParser.addOption(outputOption);
+
+    try {
+        optionParser.parse(std::vector<std::string>{argv, argv + argc});
+    } catch (const std::exception& e) {
+        std::cerr << e.what() << '\n';
+        optionParser.printHelp(std::cerr);
+        return 1;
+    }
+
+    if (helpSwitch->isSet()) {
+        optionParser.printHelp(std::cout);
+        return 0;
+    }
+
+    // The gh_cmd values don't keep their default after parsing, so the defaults are
+    // resolved here.
+    const std::size_t channelsCount{std::max<std::size_t>(
+        channelsOption->isSet() ? channelsOption->value() : DEFAULT_CHANNELS, 1)};
+    const std::size_t blockSize{std::max<std::size_t>(
+        blockOption->isSet() ? blockOption->value() : DEFAULT_BLOCK_SIZE, 1)};
+    const std::size_t iterations{std::max<std::size_t>(
+        iterationsOption->isSet() ? iterationsOption->value() : DEFAULT_ITERATIONS, 1)};
+    const std::filesystem::path outputPath{outputOption->isSet() ? outputOption->value()
+                                                                 : defaultOutputPath};
+
+    // Noisy readings with some spikes, a different phase for every channel.
+    std::mt19937 generator{42};
+    std::uniform_real_distribution<double> noise{-0.5, 0.5};
+    std::vector<std::vector<double>> inputs(channelsCount, std::vector<double>(blockSize));
+    std::vector<std::vector<double>> outputs(channelsCount, std::vector<double>(blockSize));
+    for (std::size_t channel{}; channel < channelsCount; ++channel) {
+        for (std::size_t i{}; i < blockSize; ++i) {
+            inputs[channel][i] = 30.0 +
+                                 5.0 * std::sin(static_cast<double>(i + channel * 7) * 0.05) +
+                                 noise(generator) + (i % 97 == 96 ? 40.0 : 0.0);
+        }
+    }
+
+    std::vector<benchmark::CaseResult> results{};
+    const std::size_t samplesPerIteration{channelsCount * blockSize};
+    for (const SignalFilterBackend backend :
+         {SignalFilterBackend::Scalar, SignalFilterBackend::Sse2, SignalFilterBackend::Avx,
+          SignalFilterBackend::Neon}) {
+        if (!rpi_gc::sensors::IsSignalFilterBackendSupported(backend))
+            continue;
+
+        const std::string backendName{rpi_gc::sensors::GetSignalFilterBackendName(backend)};
+        std::vector<rpi_gc::sensors::MovingAverageFilter> movingAverages{};
+        std::vector<rpi_gc::sensors::ExponentialSmoothingFilter> smoothings{};
+        std::vector<rpi_gc::sensors::MedianFilter> medians{};
+        std::vector<rpi_gc::sensors::OutlierRejectionFilter> rejections{};
+        for (std::size_t channel{}; channel < channelsCount; ++channel) {
+            movingAverages.emplace_back(WINDOW_SIZE, backend);
+            smoothings.emplace_back(0.2, backend);
+            medians.emplace_back(WINDOW_SIZE, backend);
+            rejections.emplace_back(WINDOW_SIZE, 3.0, backend);
+        }
+
+        results.push_back(benchmark::RunCase("moving average " + backendName, iterations, [&] {
+            FilterChannels(movingAverages, inputs, outputs);
+        }));
+        results.push_back(benchmark::RunCase("exponential smoothing " + backendName, iterations,
+                                             [&] { FilterChannels(smoothings, inputs, outputs); }));
+        results.push_back(benchmark::RunCase("median " + backendName, iterations, [&] {
+            FilterChannels(medians, inputs, outputs);
+        }));
+        results.push_back(benchmark::RunCase("outlier rejection " + backendName, iterations, [&] {
+            FilterChannels(rejections, inputs, outputs);
+        }));
+    }
+
+    for (benchmark::CaseResult& result : results)
+        result.operationsPerIteration = samplesPerIteration;
+
+    for (const benchmark::CaseResult& result : results) {
+        const double nsPerSample{result.medianTime.count() /
+                                 static_cast<double>(result.operationsPerIteration)};
+        std::cout << std::left << std::setw(32) << result.name << std::right << std::fixed
+                  << std::setprecision(2) << std::setw(10) << nsPerSample << " ns/sample"
+                  << std::setw(12) << 1000.0 / nsPerSample << " Msamples/s" << '\n';
+    }
+
+    const std::string bestBackendName{rpi_gc::sensors::GetSignalFilterBackendName(
+        rpi_gc::sensors::GetBestSignalFilterBackend())};
+    benchmark::WriteResultsFile(outputPath, "signal_filters_benchmark",
+                                {{"channels", channelsCount},
+                                 {"blockSize", blockSize},
+                                 {"windowSize", WINDOW_SIZE},
+                                 {"iterations", iterations},
+                                 {"bestBackend", bestBackendName}},
+                                results);
+
+    return 0;
+}
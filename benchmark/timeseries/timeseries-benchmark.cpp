@@ -0,0 +1,277 @@
+// Copyright (c) 2023 Andrea Ballestrazzi
+#include <benchmark-core.hpp>
+
+#include <project-management/project-io/project-reader.hpp>
+#include <project-management/project-io/project-writer.hpp>
+#include <project-management/project.hpp>
+#include <timeseries/time-series-store.hpp>
+
+#include <gh_cmd/gh_cmd.hpp>
+
+// C++ STL
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <filesystem>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <string>
+#include <type_traits>
+#include <variant>
+#include <vector>
+
+namespace {
+
+using gc::project_management::Project;
+using gc::timeseries::Sample;
+using gc::timeseries::timestamp_type;
+
+constexpr std::string_view SERIES_NAME{"moisture"};
+
+//!!
+//! \brief Generates the readings of a sensor sampled every ten seconds with some jitter: a
+//!  random walk quantized to a tenth, like the readings of a real probe.
+//!
+[[nodiscard]] std::vector<Sample> GenerateSamples(const std::size_t samplesCount,
+                                                  const std::uint32_t seed) {
+    std::mt19937 randomEngine{seed};
+    std::uniform_int_distribution<timestamp_type> jitterDistribution{-20, 20};
+    std::normal_distribution<double> stepDistribution{0.0, 0.05};
+
+    std::vector<Sample> samples{};
+    samples.reserve(samplesCount);
+
+    constexpr timestamp_type START_TIMESTAMP{1'700'000'000'000};
+    constexpr timestamp_type SAMPLING_PERIOD{10'000};
+    double level{40.0};
+    for (std::size_t i{}; i < samplesCount; ++i) {
+        level = std::clamp(level + stepDistribution(randomEngine), 0.0, 100.0);
+
+        const timestamp_type timestamp{START_TIMESTAMP +
+                                       static_cast<timestamp_type>(i) * SAMPLING_PERIOD +
+                                       jitterDistribution(randomEngine)};
+        samples.push_back(Sample{timestamp, std::round(level * 10.0) / 10.0});
+    }
+
+    return samples;
+}
+
+void WriteJsonSamples(const std::filesystem::path& filePath, const std::vector<Sample>& samples) {
+    std::vector<std::int64_t> timestamps{};
+    std::vector<double> values{};
+    timestamps.reserve(samples.size());
+    values.reserve(samples.size());
+    for (const Sample& sample : samples) {
+        timestamps.push_back(sample.timestamp);
+        values.push_back(sample.value);
+    }
+
+    Project project{Project::time_point_type{}, "time-series", Project::project_version{1, 2, 0}};
+    project.addValueArray("timestamps", std::move(timestamps));
+    project.addValueArray("values", std::move(values));
+
+    *gc::project_management::project_io::createJsonProjectFileWriter(filePath) << project;
+}
+
+template <typename NumberType>
+[[nodiscard]] NumberType ToNumber(const Project::value_impl_type& value) {
+    return std::visit(
+        [](const auto& alternative) -> NumberType {
+            if constexpr (std::is_arithmetic_v<std::decay_t<decltype(alternative)>>) {
+                return static_cast<NumberType>(alternative);
+            } else {
+                return NumberType{};
+            }
+        },
+        value);
+}
+
+//! \brief Appends the samples of the JSON file in [from, to]. The whole file is parsed.
+void QueryJsonSamples(const std::filesystem::path& filePath, const timestamp_type from,
+                      const timestamp_type to, std::vector<Sample>& samples) {
+    Project project{};
+    *gc::project_management::project_io::CreateJsonProjectFileReader(filePath) >> project;
+
+    const auto& timestamps{project.getValueArray("timestamps")};
+    const auto& values{project.getValueArray("values")};
+    for (std::size_t i{}; i < std::min(timestamps.size(), values.size()); ++i) {
+        const auto timestamp{ToNumber<timestamp_type>(timestamps[i])};
+        if (timestamp >= from && timestamp <= to)
+            samples.push_back(Sample{timestamp, ToNumber<double>(values[i])});
+    }
+}
+
+[[nodiscard]] std::uintmax_t GetDirectorySize(const std::filesystem::path& directory) {
+    std::uintmax_t directorySize{};
+    for (const auto& entry : std::filesystem::recursive_directory_iterator{directory}) {
+        if (entry.is_regular_file())
+            directorySize += entry.file_size();
+    }
+
+    return directorySize;
+}
+
+void PrintResult(const benchmark::CaseResult& result) {
+    const double samplesPerSecond{static_cast<double>(result.operationsPerIteration) /
+                                  (result.medianTime.count() / 1e9)};
+
+    std::cout << std::left << std::setw(16) << result.name << std::right << std::fixed
+              << std::setprecision(3) << " median " << std::setw(10)
+              << result.medianTime.count() / 1e6 << " ms   " << std::setw(14)
+              << std::setprecision(0) << samplesPerSecond << " samples/s\n";
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    constexpr std::size_t DEFAULT_SAMPLES{100'000};
+    constexpr std::size_t DEFAULT_ITERATIONS{10};
+    constexpr std::uint32_t DEFAULT_SEED{42};
+    const std::string defaultOutputPath{"timeseries-benchmark.json"};
+
+    gh_cmd::DefaultOptionParser<char> optionParser{"timeseries_benchmark [OPTIONS]"};
+
+    const auto helpSwitch{
+        std::make_shared<gh_cmd::Switch<char>>('h', "help", "Displays this help page.")};
+    const auto samplesOption{std::make_shared<gh_cmd::Value<char, std::size_t>>(
+        'n', "samples", "Number of samples of the series.")};
+    const auto iterationsOption{std::make_shared<gh_cmd::Value<char, std::size_t>>(
+        'i', "iterations", "Number of timed iterations of every case.")};
+    const auto seedOption{std::make_shared<gh_cmd::Value<char, std::uint32_t>>(
+        's', "seed", "Seed of the samples generator.")};
+    const auto outputOption{std::make_shared<gh_cmd::Value<char, std::string>>(
+        'o', "output", "Path of the JSON results file.")};
+
+    optionParser.addSwitch(helpSwitch);
+    optionParser.addOption(samplesOption);
+    optionParser.addOption(iterationsOption);
+    optionParser.addOption(seedOption);
+    optionParser.addOption(outputOption);
+
+    try {
+        optionParser.parse(std::vector<std::string>{argv, argv + argc});
+    } catch (const std::exception& e) {
+        std::cerr << e.what() << '\n';
+        optionParser.printHelp(std::cerr);
+        return 1;
+    }
+
+    if (helpSwitch->isSet()) {
+        optionParser.printHelp(std::cout);
+        return 0;
+    }
+
+    // The gh_cmd values don't keep their default after parsing, so the defaults are
+    // resolved here.
+    const std::size_t samplesCount{std::max<std::size_t>(
+        samplesOption->isSet() ? samplesOption->value() : DEFAULT_SAMPLES, 10)};
+    const std::size_t iterations{std::max<std::size_t>(
+        iterationsOption->isSet() ? iterationsOption->value() : DEFAULT_ITERATIONS, 1)};
+    const std::uint32_t seed{seedOption->isSet() ? seedOption->value() : DEFAULT_SEED};
+    const std::filesystem::path outputPath{outputOption->isSet() ? outputOption->value()
+                                                                 : defaultOutputPath};
+
+    const std::vector<Sample> samples{GenerateSamples(samplesCount, seed)};
+    const std::filesystem::path workingDirectory{std::filesystem::temp_directory_path() /
+                                                 "fep-timeseries-benchmark"};
+    const std::filesystem::path storeDirectory{workingDirectory / "store"};
+    const std::filesystem::path jsonFilePath{workingDirectory / "time-series.json"};
+
+    // The tenth of the series in the middle.
+    const timestamp_type partialFrom{samples[samplesCount * 9 / 20].timestamp};
+    const timestamp_type partialTo{samples[samplesCount * 11 / 20 - 1].timestamp};
+    const std::size_t partialSamplesCount{samplesCount * 11 / 20 - samplesCount * 9 / 20};
+
+    std::vector<benchmark::CaseResult> results{};
+    const auto removeWorkingDirectory{[&] {
+        std::filesystem::remove_all(workingDirectory);
+        std::filesystem::create_directories(workingDirectory);
+    }};
+
+    // Ingestion
+    results.push_back(benchmark::RunCase("store-ingest", iterations, removeWorkingDirectory, [&] {
+        gc::timeseries::TimeSeriesStore store{storeDirectory};
+        for (const Sample& sample : samples)
+            store.append(SERIES_NAME, sample.timestamp, sample.value);
+    }));
+    results.back().operationsPerIteration = samplesCount;
+
+    results.push_back(benchmark::RunCase("json-ingest", iterations, [&] {
+        WriteJsonSamples(jsonFilePath, samples);
+    }));
+    results.back().operationsPerIteration = samplesCount;
+
+    // Range scans
+    gc::timeseries::TimeSeriesStore store{storeDirectory};
+    std::vector<Sample> storeFullScan{};
+    std::vector<Sample> jsonFullScan{};
+    std::vector<Sample> storePartialScan{};
+    std::vector<Sample> jsonPartialScan{};
+
+    results.push_back(benchmark::RunCase("store-scan-full", iterations, [&] {
+        storeFullScan.clear();
+        store.query(SERIES_NAME, samples.front().timestamp, samples.back().timestamp,
+                    storeFullScan);
+    }));
+    results.back().operationsPerIteration = samplesCount;
+
+    results.push_back(benchmark::RunCase("json-scan-full", iterations, [&] {
+        jsonFullScan.clear();
+        QueryJsonSamples(jsonFilePath, samples.front().timestamp, samples.back().timestamp,
+                         jsonFullScan);
+    }));
+    results.back().operationsPerIteration = samplesCount;
+
+    results.push_back(benchmark::RunCase("store-scan-10%", iterations, [&] {
+        storePartialScan.clear();
+        store.query(SERIES_NAME, partialFrom, partialTo, storePartialScan);
+    }));
+    results.back().operationsPerIteration = partialSamplesCount;
+
+    results.push_back(benchmark::RunCase("json-scan-10%", iterations, [&] {
+        jsonPartialScan.clear();
+        QueryJsonSamples(jsonFilePath, partialFrom, partialTo, jsonPartialScan);
+    }));
+    results.back().operationsPerIteration = partialSamplesCount;
+
+    const double storeBytesPerSample{static_cast<double>(GetDirectorySize(storeDirectory)) /
+                                     static_cast<double>(samplesCount)};
+    const double jsonBytesPerSample{
+        static_cast<double>(std::filesystem::file_size(jsonFilePath)) /
+        static_cast<double>(samplesCount)};
+
+    std::cout << "Series: " << samplesCount << " samples\n";
+    for (const benchmark::CaseResult& result : results)
+        PrintResult(result);
+
+    std::cout << std::setprecision(2) << "Bytes per sample: store " << storeBytesPerSample
+              << ", JSON " << jsonBytesPerSample << '\n';
+
+    // Both the formats are lossless, so the scans must return the generated samples.
+    const bool bSameResult{storeFullScan == samples && jsonFullScan == samples &&
+                           storePartialScan == jsonPartialScan &&
+                           storePartialScan.size() == partialSamplesCount};
+    const nlohmann::json configurationJson{
+        {"samples",             samplesCount       },
+        {"seed",                seed               },
+        {"storeBytesPerSample", storeBytesPerSample},
+        {"jsonBytesPerSample",  jsonBytesPerSample },
+        {"sameResult",          bSameResult        }
+    };
+
+    std::filesystem::remove_all(workingDirectory);
+
+    try {
+        benchmark::WriteResultsFile(outputPath, "timeseries", configurationJson, results);
+    } catch (const std::exception& e) {
+        std::cerr << "Unable to write the results file: " << e.what() << '\n';
+        return 1;
+    }
+
+    std::cout << "Results written to " << outputPath.string() << '\n';
+    return bSameResult ? 0 : 1;
+}
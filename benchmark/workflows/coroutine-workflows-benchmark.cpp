@@ -0,0 +1,209 @@
+// Copyright (c) 2023 Andrea Ballestrazzi
+#include <benchmark-core.hpp>
+
+#include <workflows/coroutine-scheduler.hpp>
+
+#include <gh_cmd/gh_cmd.hpp>
+
+// C++ STL
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <filesystem>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <optional>
+#include <random>
+#include <string>
+#include <vector>
+
+#ifdef __GLIBC__
+#include <malloc.h>
+#endif
+
+namespace {
+
+using gc::workflows::coroutines::clock_type;
+using gc::workflows::coroutines::Scheduler;
+using gc::workflows::coroutines::Task;
+
+struct WakeUpStatistics {
+    std::uint64_t wakeUpsCount{};
+    benchmark::nanoseconds totalLateness{};
+    benchmark::nanoseconds worstLateness{};
+};
+
+//!!
+//! \brief A watering-like workflow: it sleeps for a period a given number of times and
+//!  records how late it's woken up by the scheduler.
+//!
+Task SleepingWorkflow(WakeUpStatistics& statistics, std::size_t cycles,
+                      clock_type::duration period) {
+    for (std::size_t i{}; i < cycles; ++i) {
+        const clock_type::time_point deadline{clock_type::now() + period};
+        co_await gc::workflows::coroutines::Delay(period);
+
+        const benchmark::nanoseconds lateness{clock_type::now() - deadline};
+        ++statistics.wakeUpsCount;
+        statistics.totalLateness += lateness;
+        statistics.worstLateness = std::max(statistics.worstLateness, lateness);
+    }
+
+    co_return true;
+}
+
+//!!
+//! \brief Spawns the workflows with periods spread around the given one, so the wake ups
+//!  don't all happen at the same time.
+//!
+void SpawnWorkflows(Scheduler& scheduler, WakeUpStatistics& statistics,
+                    std::size_t workflowsCount, std::size_t cycles,
+                    std::chrono::milliseconds period) {
+    std::mt19937 randomEngine{42};
+    std::uniform_int_distribution<std::int64_t> periodDistribution{period.count() / 2,
+                                                                   period.count() * 3 / 2};
+
+    for (std::size_t i{}; i < workflowsCount; ++i) {
+        const std::chrono::milliseconds workflowPeriod{periodDistribution(randomEngine)};
+        scheduler.spawn(SleepingWorkflow(statistics, cycles, workflowPeriod));
+    }
+}
+
+//!!
+//! \brief Measures the heap memory taken by every suspended workflow: its coroutine frame
+//!  and its bookkeeping inside the scheduler.
+//!
+[[nodiscard]] std::optional<std::size_t> MeasureBytesPerWorkflow(std::size_t workflowsCount) {
+#ifdef __GLIBC__
+    WakeUpStatistics statistics{};
+    Scheduler scheduler{};
+
+    const std::size_t bytesBefore{mallinfo2().uordblks};
+    SpawnWorkflows(scheduler, statistics, workflowsCount, 1, std::chrono::milliseconds{1});
+    const std::size_t bytesAfter{mallinfo2().uordblks};
+
+    scheduler.run();
+    return (bytesAfter - bytesBefore) / workflowsCount;
+#else
+    static_cast<void>(workflowsCount);
+    return std::nullopt;
+#endif
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    constexpr std::size_t DEFAULT_WORKFLOWS{10'000};
+    constexpr std::size_t DEFAULT_CYCLES{10};
+    constexpr std::size_t DEFAULT_PERIOD_MS{50};
+    constexpr std::size_t DEFAULT_ITERATIONS{5};
+    const std::string defaultOutputPath{"coroutine-workflows-benchmark.json"};
+
+    gh_cmd::DefaultOptionParser<char> optionParser{"coroutine_workflows_benchmark [OPTIONS]"};
+
+    const auto helpSwitch{
+        std::make_shared<gh_cmd::Switch<char>>('h', "help", "Displays this help page.")};
+    const auto workflowsOption{std::make_shared<gh_cmd::Value<char, std::size_t>>(
+        'w', "workflows", "Number of concurrent sleeping workflows.")};
+    const auto cyclesOption{std::make_shared<gh_cmd::Value<char, std::size_t>>(
+        'c', "cycles", "Number of sleeps of every workflow.")};
+    const auto periodOption{std::make_shared<gh_cmd::Value<char, std::size_t>>(
+        'p', "period", "Average sleep period in milliseconds.")};
+    const auto iterationsOption{std::make_shared<gh_cmd::Value<char, std::size_t>>(
+        'i', "iterations", "Number of timed iterations.")};
+    const auto outputOption{std::make_shared<gh_cmd::Value<char, std::string>>(
+        'o', "output", "Path of the JSON results file.")};
+
+    optionParser.addSwitch(helpSwitch);
+    optionParser.addOption(workflowsOption);
+    optionParser.addOption(cyclesOption);
+    optionParser.addOption(periodOption);
+    optionParser.addOption(iterationsOption);
+    optionParser.addOption(outputOption);
+
+    try {
+        optionParser.parse(std::vector<std::string>{argv, argv + argc});
+    } catch (const std::exception& e) {
+        std::cerr << e.what() << '\n';
+        optionParser.printHelp(std::cerr);
+        return 1;
+    }
+
+    if (helpSwitch->isSet()) {
+        optionParser.printHelp(std::cout);
+        return 0;
+    }
+
+    // The gh_cmd values don't keep their default after parsing, so the defaults are
+    // resolved here.
+    const std::size_t workflowsCount{std::max<std::size_t>(
+        workflowsOption->isSet() ? workflowsOption->value() : DEFAULT_WORKFLOWS, 1)};
+    const std::size_t cycles{
+        std::max<std::size_t>(cyclesOption->isSet() ? cyclesOption->value() : DEFAULT_CYCLES, 1)};
+    const std::chrono::milliseconds period{std::max<std::size_t>(
+        periodOption->isSet() ? periodOption->value() : DEFAULT_PERIOD_MS, 2)};
+    const std::size_t iterations{std::max<std::size_t>(
+        iterationsOption->isSet() ? iterationsOption->value() : DEFAULT_ITERATIONS, 1)};
+    const std::filesystem::path outputPath{outputOption->isSet() ? outputOption->value()
+                                                                 : defaultOutputPath};
+
+    std::unique_ptr<Scheduler> scheduler{};
+    WakeUpStatistics statistics{};
+    std::size_t failedTasksCount{};
+
+    std::vector<benchmark::CaseResult> results{};
+    results.push_back(benchmark::RunCase(
+        "sleeping-workflows", iterations,
+        [&] {
+            scheduler = std::make_unique<Scheduler>();
+            SpawnWorkflows(*scheduler, statistics, workflowsCount, cycles, period);
+        },
+        [&] {
+            static_cast<void>(scheduler->run());
+            failedTasksCount += scheduler->getFailedTasksCount();
+        }));
+    results.back().operationsPerIteration = workflowsCount * cycles;
+    scheduler.reset();
+
+    const std::optional<std::size_t> bytesPerWorkflow{MeasureBytesPerWorkflow(workflowsCount)};
+    const double meanLatenessUs{statistics.wakeUpsCount == 0
+                                    ? 0.0
+                                    : statistics.totalLateness.count() / 1e3 /
+                                          static_cast<double>(statistics.wakeUpsCount)};
+    const double worstLatenessUs{statistics.worstLateness.count() / 1e3};
+
+    const benchmark::CaseResult& result{results.back()};
+    std::cout << std::fixed << std::setprecision(3) << workflowsCount
+              << " workflows on one thread, " << cycles << " sleeps each\n"
+              << "  median run      " << result.medianTime.count() / 1e6 << " ms\n"
+              << "  mean lateness   " << meanLatenessUs << " us\n"
+              << "  worst lateness  " << worstLatenessUs << " us\n"
+              << "  peak RSS        " << result.peakRssKiB << " KiB\n";
+    if (bytesPerWorkflow.has_value())
+        std::cout << "  memory/workflow " << *bytesPerWorkflow << " bytes\n";
+
+    const nlohmann::json configurationJson{
+        {"workflows", workflowsCount},
+        {"cycles", cycles},
+        {"periodMs", period.count()},
+        {"meanLatenessUs", meanLatenessUs},
+        {"worstLatenessUs", worstLatenessUs},
+        {"bytesPerWorkflow", bytesPerWorkflow.has_value() ? nlohmann::json(*bytesPerWorkflow)
+                                                          : nlohmann::json(nullptr)},
+        {"failedTasks", failedTasksCount}
+    };
+
+    try {
+        benchmark::WriteResultsFile(outputPath, "coroutine-workflows", configurationJson,
+                                    results);
+    } catch (const std::exception& e) {
+        std::cerr << "Unable to write the results file: " << e.what() << '\n';
+        return 1;
+    }
+
+    std::cout << "Results written to " << outputPath.string() << '\n';
+    return failedTasksCount == 0 ? 0 : 1;
+}
@@ -0,0 +1,166 @@
+// Copyright (c) 2023 Andrea Ballestrazzi
+#include <benchmark-core.hpp>
+
+#include <workflows/static-workflow.hpp>
+#include <workflows/workflow-loop.hpp>
+#include <workflows/workflow-profiler.hpp>
+#include <workflows/workflow.hpp>
+
+#include <gh_cmd/gh_cmd.hpp>
+
+// C++ STL
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <filesystem>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace {
+
+// The steps simulate the cheap bookkeeping done by the controller between two hardware
+// operations, so the cost of the workflow machinery dominates.
+constexpr std::size_t STEPS_COUNT{8};
+
+[[nodiscard]] gc::workflows::Workflow CreateDynamicWorkflow(std::uint64_t& accumulator) {
+    gc::workflows::Workflow workflow{"dynamic-workflow"};
+
+    for (std::size_t i{}; i < STEPS_COUNT; ++i) {
+        workflow.addStep(std::make_unique<gc::workflows::steps::Function>(
+            "step-" + std::to_string(i), [&accumulator, i] {
+                accumulator = accumulator * 31 + i;
+                return true;
+            }));
+    }
+
+    return workflow;
+}
+
+template <std::size_t... Indices>
+[[nodiscard]] auto CreateStaticWorkflow(std::uint64_t& accumulator,
+                                        std::index_sequence<Indices...>) {
+    return gc::workflows::MakeStaticWorkflow("static-workflow", [&accumulator] {
+        accumulator = accumulator * 31 + Indices;
+        return true;
+    }...);
+}
+
+void PrintResult(const benchmark::CaseResult& result) {
+    const double nsPerStep{result.medianTime.count() /
+                           static_cast<double>(result.operationsPerIteration)};
+
+    std::cout << std::left << std::setw(10) << result.name << std::right << std::fixed
+              << std::setprecision(3) << " median " << std::setw(10)
+              << result.medianTime.count() / 1e6 << " ms   " << std::setw(8) << nsPerStep
+              << " ns/step\n";
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    constexpr std::size_t DEFAULT_LOOPS{1'000'000};
+    constexpr std::size_t DEFAULT_ITERATIONS{10};
+    const std::string defaultOutputPath{"static-workflow-benchmark.json"};
+
+    gh_cmd::DefaultOptionParser<char> optionParser{"static_workflow_benchmark [OPTIONS]"};
+
+    const auto helpSwitch{
+        std::make_shared<gh_cmd::Switch<char>>('h', "help", "Displays this help page.")};
+    const auto loopsOption{std::make_shared<gh_cmd::Value<char, std::size_t>>(
+        'l', "loops", "Number of workflow executions of every iteration.")};
+    const auto iterationsOption{std::make_shared<gh_cmd::Value<char, std::size_t>>(
+        'i', "iterations", "Number of timed iterations of every case.")};
+    const auto outputOption{std::make_shared<gh_cmd::Value<char, std::string>>(
+        'o', "output", "Path of the JSON results file.")};
+
+    optionParser.addSwitch(helpSwitch);
+    optionParser.addOption(loopsOption);
+    optionParser.addOption(iterationsOption);
+    optionParser.addOption(outputOption);
+
+    try {
+        optionParser.parse(std::vector<std::string>{argv, argv + argc});
+    } catch (const std::exception& e) {
+        std::cerr << e.what() << '\n';
+        optionParser.printHelp(std::cerr);
+        return 1;
+    }
+
+    if (helpSwitch->isSet()) {
+        optionParser.printHelp(std::cout);
+        return 0;
+    }
+
+    // The gh_cmd values don't keep their default after parsing, so the defaults are
+    // resolved here.
+    const std::size_t loops{
+        std::max<std::size_t>(loopsOption->isSet() ? loopsOption->value() : DEFAULT_LOOPS, 1)};
+    const std::size_t iterations{std::max<std::size_t>(
+        iterationsOption->isSet() ? iterationsOption->value() : DEFAULT_ITERATIONS, 1)};
+    const std::filesystem::path outputPath{outputOption->isSet() ? outputOption->value()
+                                                                 : defaultOutputPath};
+
+    std::uint64_t dynamicAccumulator{};
+    std::uint64_t staticAccumulator{};
+
+    gc::workflows::Workflow dynamicWorkflow{CreateDynamicWorkflow(dynamicAccumulator)};
+    auto staticWorkflow{
+        CreateStaticWorkflow(staticAccumulator, std::make_index_sequence<STEPS_COUNT>{})};
+
+    std::vector<benchmark::CaseResult> results{};
+    bool bAllSucceeded{true};
+
+    results.push_back(benchmark::RunCase("dynamic", iterations, [&] {
+        gc::workflows::WorkflowLoop loop{dynamicWorkflow,
+                                         gc::workflows::repeat_modes::Dynamic{loops}};
+        bAllSucceeded = loop.loopWorkflow() && bAllSucceeded;
+    }));
+    results.back().operationsPerIteration = loops * STEPS_COUNT;
+
+    // The same workflow with a profiler attached, to measure the cost of the profiling.
+    std::uint64_t profiledAccumulator{};
+    gc::workflows::Workflow profiledWorkflow{CreateDynamicWorkflow(profiledAccumulator)};
+    gc::workflows::WorkflowProfiler profiler{STEPS_COUNT + 1, 1};
+    profiledWorkflow.setProfiler(&profiler);
+
+    results.push_back(benchmark::RunCase("profiled", iterations, [&] {
+        gc::workflows::WorkflowLoop loop{profiledWorkflow,
+                                         gc::workflows::repeat_modes::Dynamic{loops}};
+        bAllSucceeded = loop.loopWorkflow() && bAllSucceeded;
+    }));
+    results.back().operationsPerIteration = loops * STEPS_COUNT;
+
+    results.push_back(benchmark::RunCase("static", iterations, [&] {
+        gc::workflows::WorkflowLoop loop{staticWorkflow,
+                                         gc::workflows::repeat_modes::Dynamic{loops}};
+        bAllSucceeded = loop.loopWorkflow() && bAllSucceeded;
+    }));
+    results.back().operationsPerIteration = loops * STEPS_COUNT;
+
+    for (const benchmark::CaseResult& result : results)
+        PrintResult(result);
+
+    // All the workflows run the same computation, so the accumulators must match.
+    const bool bSameResult{dynamicAccumulator == staticAccumulator &&
+                           profiledAccumulator == staticAccumulator};
+    const nlohmann::json configurationJson{
+        {"stepsCount", STEPS_COUNT},
+        {"loops", loops},
+        {"allSucceeded", bAllSucceeded},
+        {"sameResult", bSameResult}
+    };
+
+    try {
+        benchmark::WriteResultsFile(outputPath, "static-workflow", configurationJson, results);
+    } catch (const std::exception& e) {
+        std::cerr << "Unable to write the results file: " << e.what() << '\n';
+        return 1;
+    }
+
+    std::cout << "Results written to " << outputPath.string() << '\n';
+    return bAllSucceeded && bSameResult ? 0 : 1;
+}
@@ -0,0 +1,167 @@
+// Copyright (c) 2023 Andrea Ballestrazzi
+#include <benchmark-core.hpp>
+
+#include <workflows/parallel-workflow-executor.hpp>
+#include <workflows/work-stealing-thread-pool.hpp>
+#include <workflows/workflow-graph.hpp>
+
+#include <gh_cmd/gh_cmd.hpp>
+
+// C++ STL
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <exception>
+#include <filesystem>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace {
+
+using gc::workflows::IdView;
+using gc::workflows::WorkflowGraph;
+
+//!!
+//! \brief Busy-waits for the given time, simulating the work of a zone check
+//!  (sensor sampling and filtering) without yielding the CPU.
+//!
+bool SimulateZoneCheck(std::chrono::microseconds workTime) noexcept {
+    const auto endTime{benchmark::clock_type::now() + workTime};
+    while (benchmark::clock_type::now() < endTime) {
+    }
+
+    return true;
+}
+
+//!!
+//! \brief Builds a wide graph: the given number of independent zone checks followed by an
+//!  irrigation step that depends on all of them.
+//!
+[[nodiscard]] WorkflowGraph CreateIrrigationGraph(std::size_t zonesCount,
+                                                  std::chrono::microseconds workTime) {
+    using gc::workflows::steps::Function;
+
+    WorkflowGraph graph{"irrigation-" + std::to_string(zonesCount)};
+    std::vector<std::string> zoneIds{};
+    zoneIds.reserve(zonesCount);
+
+    for (std::size_t i{}; i < zonesCount; ++i) {
+        zoneIds.push_back("zone-check-" + std::to_string(i));
+        [[maybe_unused]] const bool bAdded{graph.addStep(std::make_unique<Function>(
+            zoneIds.back(), [workTime] { return SimulateZoneCheck(workTime); }))};
+    }
+
+    [[maybe_unused]] const bool bAdded{
+        graph.addStep(std::make_unique<Function>("irrigation",
+                                                 [workTime] {
+                                                     return SimulateZoneCheck(workTime);
+                                                 }),
+                      std::vector<IdView>{zoneIds.begin(), zoneIds.end()})};
+
+    return graph;
+}
+
+void PrintResult(const benchmark::CaseResult& result) {
+    std::cout << std::left << std::setw(24) << result.name << std::right << std::fixed
+              << std::setprecision(3) << " median " << std::setw(10)
+              << result.medianTime.count() / 1e6 << " ms   min " << std::setw(10)
+              << result.minTime.count() / 1e6 << " ms\n";
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    constexpr std::array<std::size_t, 4> GRAPH_WIDTHS{8, 32, 128, 512};
+    constexpr std::size_t DEFAULT_ITERATIONS{10};
+    constexpr std::size_t DEFAULT_STEP_MICROSECONDS{200};
+    const std::size_t defaultWorkersCount{std::max(std::thread::hardware_concurrency(), 1U)};
+    const std::string defaultOutputPath{"workflow-dag-benchmark.json"};
+
+    gh_cmd::DefaultOptionParser<char> optionParser{"workflow_dag_benchmark [OPTIONS]"};
+
+    const auto helpSwitch{
+        std::make_shared<gh_cmd::Switch<char>>('h', "help", "Displays this help page.")};
+    const auto workersOption{std::make_shared<gh_cmd::Value<char, std::size_t>>(
+        'w', "workers", "Number of worker threads of the parallel executor.")};
+    const auto stepTimeOption{std::make_shared<gh_cmd::Value<char, std::size_t>>(
+        's', "step-us", "Time spent by every step, in microseconds.")};
+    const auto iterationsOption{std::make_shared<gh_cmd::Value<char, std::size_t>>(
+        'i', "iterations", "Number of timed iterations of every case.")};
+    const auto outputOption{std::make_shared<gh_cmd::Value<char, std::string>>(
+        'o', "output", "Path of the JSON results file.")};
+
+    optionParser.addSwitch(helpSwitch);
+    optionParser.addOption(workersOption);
+    optionParser.addOption(stepTimeOption);
+    optionParser.addOption(iterationsOption);
+    optionParser.addOption(outputOption);
+
+    try {
+        optionParser.parse(std::vector<std::string>{argv, argv + argc});
+    } catch (const std::exception& e) {
+        std::cerr << e.what() << '\n';
+        optionParser.printHelp(std::cerr);
+        return 1;
+    }
+
+    if (helpSwitch->isSet()) {
+        optionParser.printHelp(std::cout);
+        return 0;
+    }
+
+    // The gh_cmd values don't keep their default after parsing, so the defaults are
+    // resolved here.
+    const std::size_t workersCount{workersOption->isSet() ? workersOption->value()
+                                                          : defaultWorkersCount};
+    const std::chrono::microseconds workTime{
+        stepTimeOption->isSet() ? stepTimeOption->value() : DEFAULT_STEP_MICROSECONDS};
+    const std::size_t iterations{std::max<std::size_t>(
+        iterationsOption->isSet() ? iterationsOption->value() : DEFAULT_ITERATIONS, 1)};
+    const std::filesystem::path outputPath{outputOption->isSet() ? outputOption->value()
+                                                                 : defaultOutputPath};
+
+    gc::workflows::WorkStealingThreadPool threadPool{workersCount};
+    gc::workflows::ParallelWorkflowExecutor executor{threadPool};
+
+    std::vector<benchmark::CaseResult> results{};
+    bool bAllSucceeded{true};
+
+    for (const std::size_t width : GRAPH_WIDTHS) {
+        WorkflowGraph graph{CreateIrrigationGraph(width, workTime)};
+        const std::string widthSuffix{"/width-" + std::to_string(width)};
+
+        results.push_back(benchmark::RunCase("sequential" + widthSuffix, iterations, [&] {
+            bAllSucceeded = graph.execute() && bAllSucceeded;
+        }));
+        results.back().operationsPerIteration = graph.size();
+
+        results.push_back(benchmark::RunCase("parallel" + widthSuffix, iterations, [&] {
+            bAllSucceeded = executor.execute(graph) && bAllSucceeded;
+        }));
+        results.back().operationsPerIteration = graph.size();
+    }
+
+    for (const benchmark::CaseResult& result : results)
+        PrintResult(result);
+
+    const nlohmann::json configurationJson{
+        {"workers", threadPool.getWorkersCount()},
+        {"stepMicroseconds", workTime.count()},
+        {"allSucceeded", bAllSucceeded}
+    };
+
+    try {
+        benchmark::WriteResultsFile(outputPath, "workflow-dag", configurationJson, results);
+    } catch (const std::exception& e) {
+        std::cerr << "Unable to write the results file: " << e.what() << '\n';
+        return 1;
+    }
+
+    std::cout << "Results written to " << outputPath.string() << '\n';
+    return bAllSucceeded ? 0 : 1;
+}
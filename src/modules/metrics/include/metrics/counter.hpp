@@ -0,0 +1,50 @@
+// Copyright (c) 2023 Andrea Ballestrazzi
+#pragma once
+
+#include "metrics/sharding.hpp"
+
+// C++ STL
+#include <array>
+#include <atomic>
+#include <cstdint>
+
+namespace gc::metrics {
+
+//!!
+//! \brief A monotonic counter. Every thread increments the shard it has been assigned, so
+//!  the increments from different threads don't contend on the same cache line. The value
+//!  is the sum of the shards.
+//!
+class Counter final {
+public:
+    using value_type = std::uint64_t;
+
+    Counter() noexcept = default;
+
+    Counter(const Counter&) = delete;
+    Counter& operator=(const Counter&) = delete;
+
+    void increment(const value_type value = 1) noexcept {
+        m_shards[GetThreadShardIndex()].value.fetch_add(value, std::memory_order_relaxed);
+    }
+
+    //!!
+    //! \brief Sums the shards. The increments made concurrently may be partially included.
+    //!
+    [[nodiscard]] value_type getValue() const noexcept {
+        value_type value{};
+        for (const Shard& shard : m_shards)
+            value += shard.value.load(std::memory_order_relaxed);
+
+        return value;
+    }
+
+private:
+    struct alignas(CACHE_LINE_SIZE) Shard {
+        std::atomic<value_type> value{};
+    };
+
+    std::array<Shard, SHARDS_COUNT> m_shards{};
+};
+
+} // namespace gc::metrics
@@ -0,0 +1,58 @@
+// Copyright (c) 2023 Andrea Ballestrazzi
+#pragma once
+
+#include "metrics/sharding.hpp"
+
+// C++ STL
+#include <array>
+#include <atomic>
+#include <cstdint>
+
+namespace gc::metrics {
+
+//!!
+//! \brief A value that can go up and down, e.g. the number of running systems. The changes
+//!  are sharded like the counters ones and the value is the sum of the shards.
+//!
+class Gauge final {
+public:
+    using value_type = std::int64_t;
+
+    Gauge() noexcept = default;
+
+    Gauge(const Gauge&) = delete;
+    Gauge& operator=(const Gauge&) = delete;
+
+    void add(const value_type delta) noexcept {
+        m_shards[GetThreadShardIndex()].value.fetch_add(delta, std::memory_order_relaxed);
+    }
+
+    void sub(const value_type delta) noexcept {
+        add(-delta);
+    }
+
+    //!!
+    //! \brief Sets the gauge to the given value. It's meant for the gauges with a single
+    //!  writer: an add() made concurrently by another thread may be lost.
+    //!
+    void set(const value_type value) noexcept {
+        add(value - getValue());
+    }
+
+    [[nodiscard]] value_type getValue() const noexcept {
+        value_type value{};
+        for (const Shard& shard : m_shards)
+            value += shard.value.load(std::memory_order_relaxed);
+
+        return value;
+    }
+
+private:
+    struct alignas(CACHE_LINE_SIZE) Shard {
+        std::atomic<value_type> value{};
+    };
+
+    std::array<Shard, SHARDS_COUNT> m_shards{};
+};
+
+} // namespace gc::metrics
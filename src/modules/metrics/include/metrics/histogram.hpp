@@ -0,0 +1,138 @@
+// Copyright (c) 2023 Andrea Ballestrazzi
+#pragma once
+
+#include "metrics/sharding.hpp"
+
+// C++ STL
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+
+namespace gc::metrics {
+
+//!!
+//! \brief The log-linear buckets of the histograms, in the HDR histograms style: every power
+//!  of two is split into SUB_BUCKETS_COUNT linear buckets, so the relative error of a recorded
+//!  value is at most 1 / SUB_BUCKETS_COUNT. Values above MAX_VALUE fall in the last bucket.
+//!
+struct HistogramBuckets {
+    using value_type = std::uint64_t;
+    using count_type = std::uint64_t;
+
+    static constexpr std::size_t SUB_BUCKETS_BITS{4};
+    static constexpr std::size_t SUB_BUCKETS_COUNT{std::size_t{1} << SUB_BUCKETS_BITS};
+    //! The most significant bit of the largest tracked value (about 18 minutes in ns).
+    static constexpr std::size_t MAX_VALUE_BIT{40};
+    static constexpr value_type MAX_VALUE{(value_type{1} << (MAX_VALUE_BIT + 1)) - 1};
+    static constexpr std::size_t BUCKETS_COUNT{(MAX_VALUE_BIT - SUB_BUCKETS_BITS + 2) *
+                                               SUB_BUCKETS_COUNT};
+
+    [[nodiscard]] static constexpr std::size_t GetBucketIndex(value_type value) noexcept {
+        value = std::min(value, MAX_VALUE);
+        if (value < SUB_BUCKETS_COUNT)
+            return static_cast<std::size_t>(value);
+
+        const std::size_t msb{static_cast<std::size_t>(std::bit_width(value)) - 1};
+        const std::size_t shift{msb - SUB_BUCKETS_BITS};
+        const std::size_t subBucket{static_cast<std::size_t>(value >> shift) &
+                                    (SUB_BUCKETS_COUNT - 1)};
+
+        return (shift + 1) * SUB_BUCKETS_COUNT + subBucket;
+    }
+
+    [[nodiscard]] static constexpr value_type GetBucketLowerBound(std::size_t index) noexcept {
+        if (index < SUB_BUCKETS_COUNT)
+            return static_cast<value_type>(index);
+
+        const std::size_t shift{index / SUB_BUCKETS_COUNT - 1};
+        const std::size_t subBucket{index % SUB_BUCKETS_COUNT};
+        return static_cast<value_type>(SUB_BUCKETS_COUNT + subBucket) << shift;
+    }
+
+    [[nodiscard]] static constexpr value_type GetBucketUpperBound(std::size_t index) noexcept {
+        if (index < SUB_BUCKETS_COUNT)
+            return static_cast<value_type>(index);
+
+        const std::size_t shift{index / SUB_BUCKETS_COUNT - 1};
+        return GetBucketLowerBound(index) + (value_type{1} << shift) - 1;
+    }
+};
+
+static_assert(HistogramBuckets::GetBucketIndex(HistogramBuckets::MAX_VALUE) ==
+              HistogramBuckets::BUCKETS_COUNT - 1);
+
+//!!
+//! \brief The merged content of a histogram at a given time.
+//!
+struct HistogramSnapshot {
+    using value_type = HistogramBuckets::value_type;
+    using count_type = HistogramBuckets::count_type;
+
+    std::array<count_type, HistogramBuckets::BUCKETS_COUNT> buckets{};
+    count_type count{};
+    value_type sum{};
+    value_type max{};
+
+    //!!
+    //! \brief Estimates the value at the given quantile as the upper bound of the bucket
+    //!  that contains it, so the estimate is never lower than the recorded value.
+    //!
+    //! \param[in] quantile The quantile, between 0 and 1.
+    //! \return The estimated value, or zero if the histogram is empty.
+    //!
+    [[nodiscard]] value_type getValueAtQuantile(double quantile) const noexcept;
+
+    [[nodiscard]] double getMean() const noexcept {
+        return count == 0 ? 0.0 : static_cast<double>(sum) / static_cast<double>(count);
+    }
+};
+
+//!!
+//! \brief A histogram that records values without locks. Every thread records into the shard
+//!  it has been assigned with relaxed atomic increments, and the shards are merged only when
+//!  a snapshot is taken.
+//!
+class Histogram final {
+public:
+    using value_type = HistogramBuckets::value_type;
+
+    Histogram() noexcept = default;
+
+    Histogram(const Histogram&) = delete;
+    Histogram& operator=(const Histogram&) = delete;
+
+    void record(const value_type value) noexcept {
+        Shard& shard{m_shards[GetThreadShardIndex()]};
+
+        shard.buckets[HistogramBuckets::GetBucketIndex(value)].fetch_add(
+            1, std::memory_order_relaxed);
+        shard.sum.fetch_add(value, std::memory_order_relaxed);
+
+        value_type currentMax{shard.max.load(std::memory_order_relaxed)};
+        while (value > currentMax &&
+               !shard.max.compare_exchange_weak(currentMax, value, std::memory_order_relaxed)) {
+        }
+    }
+
+    //!!
+    //! \brief Merges the shards. The values recorded concurrently may be partially included,
+    //!  e.g. in the count but not yet in the sum.
+    //!
+    [[nodiscard]] HistogramSnapshot getSnapshot() const noexcept;
+
+private:
+    using atomic_counter = std::atomic<HistogramBuckets::count_type>;
+
+    struct alignas(CACHE_LINE_SIZE) Shard {
+        std::array<atomic_counter, HistogramBuckets::BUCKETS_COUNT> buckets{};
+        std::atomic<value_type> sum{};
+        std::atomic<value_type> max{};
+    };
+
+    std::array<Shard, SHARDS_COUNT> m_shards{};
+};
+
+} // namespace gc::metrics
@@ -0,0 +1,115 @@
+// Copyright (c) 2023 Andrea Ballestrazzi
+#pragma once
+
+#include "metrics/counter.hpp"
+#include "metrics/gauge.hpp"
+#include "metrics/histogram.hpp"
+
+// C++ STL
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <variant>
+#include <vector>
+
+namespace gc::metrics {
+
+//! The labels of a metric as (name, value) pairs, e.g. {"level", "error"}.
+using metric_labels = std::vector<std::pair<std::string, std::string>>;
+
+enum class MetricKind { Counter, Gauge, Histogram };
+
+struct MetricDescriptor {
+    std::string name{};
+    std::string help{};
+    metric_labels labels{};
+    MetricKind kind{};
+};
+
+using metric_sample_value =
+    std::variant<Counter::value_type, Gauge::value_type, HistogramSnapshot>;
+
+//!!
+//! \brief The value of a metric at the time it has been collected.
+//!
+struct MetricSample {
+    MetricDescriptor descriptor{};
+    metric_sample_value value{};
+};
+
+//!!
+//! \brief Owns the metrics of the application. The metrics are created or looked up under a
+//!  lock, so they should be acquired once and the returned references kept: recording a
+//!  value on them never locks. The references are valid as long as the registry.
+//!
+class MetricsRegistry final {
+public:
+    MetricsRegistry() = default;
+
+    MetricsRegistry(const MetricsRegistry&) = delete;
+    MetricsRegistry& operator=(const MetricsRegistry&) = delete;
+
+    //!!
+    //! \brief Gets the counter with the given name and labels, creating it if it doesn't
+    //!  exist yet. The help is kept from the first registration.
+    //!
+    //! \throw std::invalid_argument if the name is used by a metric of another kind.
+    //!
+    [[nodiscard]] Counter& counter(std::string_view name, std::string_view help,
+                                   metric_labels labels = {});
+
+    //!!
+    //! \brief Gets the gauge with the given name and labels, creating it if it doesn't
+    //!  exist yet.
+    //!
+    //! \throw std::invalid_argument if the name is used by a metric of another kind.
+    //!
+    [[nodiscard]] Gauge& gauge(std::string_view name, std::string_view help,
+                               metric_labels labels = {});
+
+    //!!
+    //! \brief Gets the histogram with the given name and labels, creating it if it doesn't
+    //!  exist yet.
+    //!
+    //! \throw std::invalid_argument if the name is used by a metric of another kind.
+    //!
+    [[nodiscard]] Histogram& histogram(std::string_view name, std::string_view help,
+                                       metric_labels labels = {});
+
+    //!!
+    //! \brief Reads all the metrics, in registration order.
+    //!
+    [[nodiscard]] std::vector<MetricSample> collect() const;
+
+    //!!
+    //! \brief Reads all the metrics into the given samples, in registration order. The
+    //!  samples are overwritten in place, so once the vector has grown to the number of
+    //!  metrics collecting them again doesn't allocate.
+    //!
+    void collect(std::vector<MetricSample>& samples) const;
+
+private:
+    using metric_type = std::variant<std::unique_ptr<Counter>, std::unique_ptr<Gauge>,
+                                     std::unique_ptr<Histogram>>;
+
+    struct MetricEntry {
+        MetricDescriptor descriptor{};
+        metric_type metric{};
+    };
+
+    template <typename MetricType>
+    [[nodiscard]] MetricType& get_or_create(std::string_view name, std::string_view help,
+                                            metric_labels labels, MetricKind kind);
+
+    mutable std::mutex m_metricsMutex{};
+    std::vector<MetricEntry> m_metrics{};
+};
+
+//!!
+//! \brief Gets the registry where the application modules register their metrics.
+//!
+[[nodiscard]] MetricsRegistry& GetDefaultRegistry() noexcept;
+
+} // namespace gc::metrics
@@ -0,0 +1,46 @@
+// Copyright (c) 2023 Andrea Ballestrazzi
+#pragma once
+
+#include "metrics/metrics-registry.hpp"
+
+// C++ STL
+#include <array>
+#include <functional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace gc::metrics {
+
+//!!
+//! \brief Renders the metrics of a registry in the Prometheus text exposition format
+//!  (version 0.0.4). The counters and the gauges are rendered as such, while the histograms
+//!  are rendered as summaries with the QUANTILES quantiles, their sum and their count.
+//!
+//!  The exporter keeps the collected samples and the rendered text between two renderings, so
+//!  once the buffers have grown to the size of the metrics a scrape doesn't allocate.
+//!
+class PrometheusTextExporter final {
+public:
+    static constexpr std::string_view CONTENT_TYPE{"text/plain; version=0.0.4; charset=utf-8"};
+    static constexpr std::array<double, 4> QUANTILES{0.5, 0.9, 0.99, 0.999};
+
+    explicit PrometheusTextExporter(const MetricsRegistry& registry) noexcept
+        : m_registry{std::cref(registry)} {}
+
+    //!!
+    //! \brief Collects the metrics and renders them. The samples with the same name are
+    //!  grouped under a single HELP and TYPE header, as the format requires.
+    //!
+    //! \return A view of the rendered text, valid until the next rendering.
+    //!
+    [[nodiscard]] std::string_view render();
+
+private:
+    std::reference_wrapper<const MetricsRegistry> m_registry;
+    std::vector<MetricSample> m_samples{};
+    std::vector<bool> m_renderedSamples{};
+    std::string m_output{};
+};
+
+} // namespace gc::metrics
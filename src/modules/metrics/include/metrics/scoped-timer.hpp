@@ -0,0 +1,38 @@
+// Copyright (c) 2023 Andrea Ballestrazzi
+#pragma once
+
+#include "metrics/histogram.hpp"
+
+// C++ STL
+#include <chrono>
+#include <functional>
+
+namespace gc::metrics {
+
+//!!
+//! \brief Records in a histogram the nanoseconds elapsed between its construction and its
+//!  destruction.
+//!
+class ScopedTimer final {
+public:
+    using clock_type = std::chrono::steady_clock;
+
+    explicit ScopedTimer(Histogram& histogram) noexcept
+        : m_histogram{std::ref(histogram)},
+          m_startTime{clock_type::now()} {}
+
+    ~ScopedTimer() noexcept {
+        const auto elapsedTime{std::chrono::duration_cast<std::chrono::nanoseconds>(
+            clock_type::now() - m_startTime)};
+        m_histogram.get().record(static_cast<Histogram::value_type>(elapsedTime.count()));
+    }
+
+    ScopedTimer(const ScopedTimer&) = delete;
+    ScopedTimer& operator=(const ScopedTimer&) = delete;
+
+private:
+    std::reference_wrapper<Histogram> m_histogram;
+    clock_type::time_point m_startTime;
+};
+
+} // namespace gc::metrics
@@ -0,0 +1,32 @@
+// Copyright (c) 2023 Andrea Ballestrazzi
+#pragma once
+
+// C++ STL
+#include <cstddef>
+
+namespace gc::metrics {
+
+//! The size of the cache lines: every shard is aligned to it, so the threads that update
+//! different shards don't invalidate each other's caches.
+constexpr std::size_t CACHE_LINE_SIZE{64};
+
+//! The number of shards of every metric. The threads are spread over the shards in
+//! round-robin, so up to SHARDS_COUNT threads update a metric without contention.
+constexpr std::size_t SHARDS_COUNT{8};
+
+namespace details {
+
+[[nodiscard]] std::size_t AcquireShardIndex() noexcept;
+
+} // namespace details
+
+//!!
+//! \brief Gets the shard used by the calling thread. The shard is chosen the first time a
+//!  thread records a metric and it's shared by all the metrics.
+//!
+[[nodiscard]] inline std::size_t GetThreadShardIndex() noexcept {
+    thread_local const std::size_t shardIndex{details::AcquireShardIndex()};
+    return shardIndex;
+}
+
+} // namespace gc::metrics
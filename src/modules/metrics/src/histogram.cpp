@@ -0,0 +1,44 @@
+// Copyright (c) 2023 Andrea Ballestrazzi
+#include "metrics/histogram.hpp"
+
+namespace gc::metrics {
+
+HistogramSnapshot::value_type HistogramSnapshot::getValueAtQuantile(
+    double quantile) const noexcept {
+    if (count == 0)
+        return 0;
+
+    quantile = std::clamp(quantile, 0.0, 1.0);
+    const count_type rank{std::max<count_type>(
+        static_cast<count_type>(quantile * static_cast<double>(count) + 0.5), 1)};
+
+    count_type cumulativeCount{};
+    for (std::size_t i{}; i < HistogramBuckets::BUCKETS_COUNT; ++i) {
+        cumulativeCount += buckets[i];
+        if (cumulativeCount >= rank)
+            return std::min(HistogramBuckets::GetBucketUpperBound(i), max);
+    }
+
+    return max;
+}
+
+HistogramSnapshot Histogram::getSnapshot() const noexcept {
+    HistogramSnapshot snapshot{};
+
+    for (const Shard& shard : m_shards) {
+        for (std::size_t i{}; i < HistogramBuckets::BUCKETS_COUNT; ++i) {
+            const HistogramSnapshot::count_type bucketCount{
+                shard.buckets[i].load(std::memory_order_relaxed)};
+
+            snapshot.buckets[i] += bucketCount;
+            snapshot.count += bucketCount;
+        }
+
+        snapshot.sum += shard.sum.load(std::memory_order_relaxed);
+        snapshot.max = std::max(snapshot.max, shard.max.load(std::memory_order_relaxed));
+    }
+
+    return snapshot;
+}
+
+} // namespace gc::metrics
@@ -0,0 +1,89 @@
+// Copyright (c) 2023 Andrea Ballestrazzi
+#include "metrics/metrics-registry.hpp"
+
+// C++ STL
+#include <stdexcept>
+#include <type_traits>
+
+namespace gc::metrics {
+
+template <typename MetricType>
+MetricType& MetricsRegistry::get_or_create(std::string_view name, std::string_view help,
+                                           metric_labels labels, const MetricKind kind) {
+    std::lock_guard lock{m_metricsMutex};
+
+    for (MetricEntry& entry : m_metrics) {
+        if (entry.descriptor.name != name)
+            continue;
+
+        if (entry.descriptor.kind != kind)
+            throw std::invalid_argument{"The metric \"" + std::string{name} +
+                                        "\" is already registered with another kind."};
+
+        if (entry.descriptor.labels == labels)
+            return *std::get<std::unique_ptr<MetricType>>(entry.metric);
+    }
+
+    MetricEntry& newEntry{m_metrics.emplace_back(MetricEntry{
+        MetricDescriptor{std::string{name}, std::string{help}, std::move(labels), kind},
+        std::make_unique<MetricType>()})};
+
+    return *std::get<std::unique_ptr<MetricType>>(newEntry.metric);
+}
+
+Counter& MetricsRegistry::counter(std::string_view name, std::string_view help,
+                                  metric_labels labels) {
+    return get_or_create<Counter>(name, help, std::move(labels), MetricKind::Counter);
+}
+
+Gauge& MetricsRegistry::gauge(std::string_view name, std::string_view help,
+                              metric_labels labels) {
+    return get_or_create<Gauge>(name, help, std::move(labels), MetricKind::Gauge);
+}
+
+Histogram& MetricsRegistry::histogram(std::string_view name, std::string_view help,
+                                      metric_labels labels) {
+    return get_or_create<Histogram>(name, help, std::move(labels), MetricKind::Histogram);
+}
+
+std::vector<MetricSample> MetricsRegistry::collect() const {
+    std::vector<MetricSample> samples{};
+    collect(samples);
+
+    return samples;
+}
+
+void MetricsRegistry::collect(std::vector<MetricSample>& samples) const {
+    std::lock_guard lock{m_metricsMutex};
+
+    samples.resize(m_metrics.size());
+    for (std::size_t i{}; i < m_metrics.size(); ++i) {
+        const MetricEntry& entry{m_metrics[i]};
+        MetricSample& sample{samples[i]};
+
+        // The assignments reuse the storage of the strings and of the labels.
+        sample.descriptor.name = entry.descriptor.name;
+        sample.descriptor.help = entry.descriptor.help;
+        sample.descriptor.labels = entry.descriptor.labels;
+        sample.descriptor.kind = entry.descriptor.kind;
+
+        std::visit(
+            [&sample](const auto& metric) {
+                using metric_ptr_type = std::decay_t<decltype(metric)>;
+
+                if constexpr (std::is_same_v<metric_ptr_type, std::unique_ptr<Histogram>>) {
+                    sample.value = metric->getSnapshot();
+                } else {
+                    sample.value = metric->getValue();
+                }
+            },
+            entry.metric);
+    }
+}
+
+MetricsRegistry& GetDefaultRegistry() noexcept {
+    static MetricsRegistry defaultRegistry{};
+    return defaultRegistry;
+}
+
+} // namespace gc::metrics
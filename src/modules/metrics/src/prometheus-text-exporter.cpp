@@ -0,0 +1,146 @@
+// Copyright (c) 2023 Andrea Ballestrazzi
+#include "metrics/prometheus-text-exporter.hpp"
+
+// C++ STL
+#include <charconv>
+#include <type_traits>
+#include <variant>
+
+namespace gc::metrics {
+
+namespace {
+
+template <typename NumberType>
+void AppendNumber(std::string& output, const NumberType number) {
+    std::array<char, 32> buffer{};
+    const auto [end, errorCode]{
+        std::to_chars(buffer.data(), buffer.data() + buffer.size(), number)};
+    output.append(buffer.data(), errorCode == std::errc{} ? end : buffer.data());
+}
+
+//!!
+//! \brief Appends a text escaping the backslashes and the new lines and, for the label
+//!  values, the double quotes.
+//!
+void AppendEscaped(std::string& output, std::string_view text, const bool bEscapeQuotes) {
+    for (const char c : text) {
+        if (c == '\\') {
+            output.append("\\\\");
+        } else if (c == '\n') {
+            output.append("\\n");
+        } else if (c == '"' && bEscapeQuotes) {
+            output.append("\\\"");
+        } else {
+            output.push_back(c);
+        }
+    }
+}
+
+[[nodiscard]] std::string_view GetTypeName(const MetricKind kind) noexcept {
+    switch (kind) {
+        case MetricKind::Counter:
+            return "counter";
+        case MetricKind::Gauge:
+            return "gauge";
+        case MetricKind::Histogram:
+            return "summary";
+    }
+
+    return "untyped";
+}
+
+void AppendHeader(std::string& output, const MetricDescriptor& descriptor) {
+    output.append("# HELP ").append(descriptor.name).push_back(' ');
+    AppendEscaped(output, descriptor.help, false);
+    output.append("\n# TYPE ").append(descriptor.name).push_back(' ');
+    output.append(GetTypeName(descriptor.kind)).push_back('\n');
+}
+
+//!!
+//! \brief Appends the name of a sample with its labels, e.g. name_sum{level="info"}. The
+//!  quantile label of the summaries is appended after the others if it's given.
+//!
+void AppendSampleName(std::string& output, const MetricDescriptor& descriptor,
+                      std::string_view suffix, const double* const quantile = nullptr) {
+    output.append(descriptor.name).append(suffix);
+    if (descriptor.labels.empty() && quantile == nullptr)
+        return;
+
+    output.push_back('{');
+    for (const auto& [labelName, labelValue] : descriptor.labels) {
+        output.append(labelName).append("=\"");
+        AppendEscaped(output, labelValue, true);
+        output.append("\",");
+    }
+
+    if (quantile != nullptr) {
+        output.append("quantile=\"");
+        AppendNumber(output, *quantile);
+        output.append("\",");
+    }
+
+    // The trailing comma of the last label is replaced.
+    output.back() = '}';
+}
+
+void AppendSample(std::string& output, const MetricSample& sample) {
+    std::visit(
+        [&output, &sample](const auto& value) {
+            using value_type = std::decay_t<decltype(value)>;
+
+            if constexpr (std::is_same_v<value_type, HistogramSnapshot>) {
+                for (const double& quantile : PrometheusTextExporter::QUANTILES) {
+                    AppendSampleName(output, sample.descriptor, {}, &quantile);
+                    output.push_back(' ');
+                    AppendNumber(output, value.getValueAtQuantile(quantile));
+                    output.push_back('\n');
+                }
+
+                AppendSampleName(output, sample.descriptor, "_sum");
+                output.push_back(' ');
+                AppendNumber(output, value.sum);
+                output.push_back('\n');
+
+                AppendSampleName(output, sample.descriptor, "_count");
+                output.push_back(' ');
+                AppendNumber(output, value.count);
+                output.push_back('\n');
+            } else {
+                AppendSampleName(output, sample.descriptor, {});
+                output.push_back(' ');
+                AppendNumber(output, value);
+                output.push_back('\n');
+            }
+        },
+        sample.value);
+}
+
+} // namespace
+
+std::string_view PrometheusTextExporter::render() {
+    m_registry.get().collect(m_samples);
+    m_renderedSamples.assign(m_samples.size(), false);
+    m_output.clear();
+
+    for (std::size_t i{}; i < m_samples.size(); ++i) {
+        if (m_renderedSamples[i])
+            continue;
+
+        // The samples of a metric with many labels may have been registered in between the
+        // ones of other metrics, so they are gathered here.
+        const std::string_view metricName{m_samples[i].descriptor.name};
+        AppendHeader(m_output, m_samples[i].descriptor);
+
+        for (std::size_t j{i}; j < m_samples.size(); ++j) {
+            if (m_renderedSamples[j] || m_samples[j].descriptor.name != metricName)
+                continue;
+
+            AppendSample(m_output, m_samples[j]);
+            m_renderedSamples[j] = true;
+        }
+    }
+
+    return m_output;
+}
+
+} // namespace gc::metrics
@@ -0,0 +1,14 @@
+// Copyright (c) 2023 Andrea Ballestrazzi
+#include "metrics/sharding.hpp"
+
+// C++ STL
+#include <atomic>
+
+namespace gc::metrics::details {
+
+std::size_t AcquireShardIndex() noexcept {
+    static std::atomic<std::size_t> nextShardIndex{};
+    return nextShardIndex.fetch_add(1, std::memory_order_relaxed) % SHARDS_COUNT;
+}
+
+} // namespace gc::metrics::details
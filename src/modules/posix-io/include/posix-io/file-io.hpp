@@ -0,0 +1,76 @@
+// Copyright (c) 2023 Andrea Ballestrazzi
+#pragma once
+
+// C++ STL
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <span>
+
+// POSIX
+#include <sys/types.h>
+
+namespace gc::posix_io {
+
+//!!
+//! \brief Closes a file descriptor when the scope is left.
+//!
+class FileDescriptorGuard final {
+public:
+    explicit FileDescriptorGuard(const int fileDescriptor) noexcept
+        : m_fileDescriptor{fileDescriptor} {}
+
+    ~FileDescriptorGuard() noexcept;
+
+    FileDescriptorGuard(const FileDescriptorGuard&) = delete;
+    FileDescriptorGuard& operator=(const FileDescriptorGuard&) = delete;
+
+private:
+    int m_fileDescriptor;
+};
+
+//!!
+//! \brief Writes all the bytes at the given offset of a file, retrying the interrupted and
+//!  partial writes.
+//!
+//! \param[in] errorMessage The description of the error thrown if the write fails.
+//! \throw std::system_error if the bytes can't be written.
+//!
+void WriteAll(int fileDescriptor, const std::uint8_t* data, std::size_t size, off_t offset,
+              const char* errorMessage);
+
+//!!
+//! \brief Reads the given bytes at the given offset of a file, retrying the interrupted and
+//!  partial reads.
+//!
+//! \param[in] errorMessage The description of the error thrown if the read fails.
+//! \return False if the end of the file has been reached before reading all the bytes.
+//! \throw std::system_error if the bytes can't be read.
+//!
+[[nodiscard]] bool ReadAll(int fileDescriptor, std::uint8_t* data, std::size_t size,
+                           off_t offset, const char* errorMessage);
+
+//!!
+//! \brief Stores a field of a binary record in the byte order of the host.
+//!
+template <typename FieldType>
+void StoreField(std::span<std::uint8_t> bytes, const std::size_t offset,
+                const FieldType field) noexcept {
+    assert(offset + sizeof(FieldType) <= bytes.size());
+    std::memcpy(bytes.data() + offset, &field, sizeof(FieldType));
+}
+
+//!!
+//! \brief Loads a field of a binary record stored by StoreField().
+//!
+template <typename FieldType>
+[[nodiscard]] FieldType LoadField(std::span<const std::uint8_t> bytes,
+                                  const std::size_t offset) noexcept {
+    assert(offset + sizeof(FieldType) <= bytes.size());
+    FieldType field{};
+    std::memcpy(&field, bytes.data() + offset, sizeof(FieldType));
+    return field;
+}
+
+} // namespace gc::posix_io
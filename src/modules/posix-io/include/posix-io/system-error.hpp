@@ -0,0 +1,14 @@
+// Copyright (c) 2023 Andrea Ballestrazzi
+#pragma once
+
+namespace gc::posix_io {
+
+//!!
+//! \brief Throws the error of the last failed system call.
+//!
+//! \param[in] what The description of the failed operation.
+//! \throw std::system_error with the current errno.
+//!
+[[noreturn]] void ThrowSystemError(const char* what);
+
+} // namespace gc::posix_io
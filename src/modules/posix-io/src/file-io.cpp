@@ -0,0 +1,57 @@
+// Copyright (c) 2023 Andrea Ballestrazzi
+#include "posix-io/file-io.hpp"
+
+#include "posix-io/system-error.hpp"
+
+// C++ STL
+#include <cerrno>
+
+// POSIX
+#include <unistd.h>
+
+namespace gc::posix_io {
+
+FileDescriptorGuard::~FileDescriptorGuard() noexcept {
+    ::close(m_fileDescriptor);
+}
+
+void WriteAll(const int fileDescriptor, const std::uint8_t* data, std::size_t size, off_t offset,
+              const char* errorMessage) {
+    while (size > 0) {
+        const ssize_t writtenBytes{::pwrite(fileDescriptor, data, size, offset)};
+        if (writtenBytes < 0) {
+            if (errno == EINTR)
+                continue;
+
+            ThrowSystemError(errorMessage);
+        }
+
+        data += writtenBytes;
+        size -= static_cast<std::size_t>(writtenBytes);
+        offset += writtenBytes;
+    }
+}
+
+bool ReadAll(const int fileDescriptor, std::uint8_t* data, std::size_t size, off_t offset,
+             const char* errorMessage) {
+    while (size > 0) {
+        const ssize_t readBytes{::pread(fileDescriptor, data, size, offset)};
+        if (readBytes < 0) {
+            if (errno == EINTR)
+                continue;
+
+            ThrowSystemError(errorMessage);
+        }
+
+        if (readBytes == 0)
+            return false;
+
+        data += readBytes;
+        size -= static_cast<std::size_t>(readBytes);
+        offset += readBytes;
+    }
+
+    return true;
+}
+
+} // namespace gc::posix_io
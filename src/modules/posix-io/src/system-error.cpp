@@ -0,0 +1,14 @@
+// Copyright (c) 2023 Andrea Ballestrazzi
+#include "posix-io/system-error.hpp"
+
+// C++ STL
+#include <cerrno>
+#include <system_error>
+
+namespace gc::posix_io {
+
+void ThrowSystemError(const char* what) {
+    throw std::system_error{errno, std::system_category(), what};
+}
+
+} // namespace gc::posix_io
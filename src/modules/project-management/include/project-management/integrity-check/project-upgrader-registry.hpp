@@ -0,0 +1,80 @@
+// Copyright (c) 2023 Andrea Ballestrazzi
+#pragma once
+
+#include <project-management/integrity-check/project-integrity-checker.hpp>
+#include <project-management/project.hpp>
+
+// Third-party
+#include <semver.hpp>
+
+// C++ STL
+#include <functional>
+#include <memory>
+#include <vector>
+
+namespace gc::project_management::integrity_check {
+
+//!!
+//! \brief Represents a registry of versioned project upgraders. Every upgrader is registered
+//!  with the version range it migrates from and the version it produces, so the registry can
+//!  build the migration path graph between two versions and walk it.
+//!
+class ProjectUpgraderRegistry final {
+public:
+    using version_type = Project::project_version;
+    using upgrader_pointer = std::unique_ptr<ProjectIntegrityChecker>;
+    using upgrader_factory = std::function<upgrader_pointer()>;
+
+    //!!
+    //! \brief Represents a single edge of the migration graph. The step can be applied
+    //!  to all the projects with a version in the range [fromVersion, toVersion).
+    //!
+    struct MigrationStep {
+        version_type fromVersion{};
+        version_type toVersion{};
+        upgrader_factory factory{};
+    };
+
+    using migration_path = std::vector<const MigrationStep*>;
+
+    //!!
+    //! \brief Registers a new upgrader. Upgraders are created on demand through the given
+    //!  factory, so the registry can be shared between threads as long as it's not modified.
+    //!
+    //! \param fromVersion The lowest project version the upgrader can be applied to.
+    //! \param toVersion The version the project has after the upgrade.
+    //! \param factory The function that creates the upgrader.
+    //! \throws std::invalid_argument if the target version isn't greater than the source version.
+    void registerUpgrader(version_type fromVersion, version_type toVersion,
+                          upgrader_factory factory);
+
+    //!!
+    //! \brief Finds the chain of upgraders that brings a project from the given version to the
+    //!  highest reachable version that doesn't exceed the target one, using as few upgraders
+    //!  as possible.
+    //!
+    //! \param fromVersion The version of the project to upgrade.
+    //! \param targetVersion The maximum version the project can be upgraded to.
+    //! \return The steps to apply in order. Empty if the project doesn't need any upgrade.
+    [[nodiscard]] migration_path findMigrationPath(version_type fromVersion,
+                                                   version_type targetVersion) const;
+
+    //!!
+    //! \brief Upgrades the given project following the migration path to the target version.
+    //!  After every step the project version is updated to the step target version.
+    //!  Upgraders may throw exceptions if the project cannot be read.
+    //!
+    //! \param project The project to upgrade.
+    //! \param targetVersion The maximum version the project can be upgraded to.
+    //! \return True if all the steps were applied successfully, false otherwise.
+    [[nodiscard]] bool migrate(Project& project, version_type targetVersion) const;
+
+    [[nodiscard]] const std::vector<MigrationStep>& getSteps() const noexcept {
+        return m_steps;
+    }
+
+private:
+    std::vector<MigrationStep> m_steps{};
+};
+
+} // namespace gc::project_management::integrity_check
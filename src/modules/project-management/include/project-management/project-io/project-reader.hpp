@@ -34,4 +34,13 @@ inline ProjectReader& operator>>(ProjectReader& reader, Project& inputProject) {
 [[nodiscard]] std::unique_ptr<ProjectReader> CreateJsonProjectFileReader(
     const std::filesystem::path& path);
 
+//!!
+//! \brief Create a Json Project File Reader object with the specified path that parses
+//!  the top-level objects only when they're first accessed.
+//!  If the file doesn't exist it throws an std::invalid_argument.
+//! \param path
+//! \return std::unique_ptr<ProjectReader>
+[[nodiscard]] std::unique_ptr<ProjectReader> CreateLazyJsonProjectFileReader(
+    const std::filesystem::path& path);
+
 } // namespace gc::project_management::project_io
@@ -9,7 +9,9 @@
 #include <chrono>
 #include <concepts>
 #include <cstdint>
+#include <functional>
 #include <map>
+#include <mutex>
 #include <ranges>
 #include <string>
 #include <type_traits>
@@ -37,6 +39,31 @@ inline constexpr bool InvalidVariantType = false;
 class ProjectNode {
 public:
     using value_impl_type = std::variant<bool, std::int64_t, std::uint64_t, double, std::string>;
+    using deferred_object_loader = std::function<ProjectNode()>;
+
+    ProjectNode() noexcept = default;
+
+    ProjectNode(const ProjectNode& other)
+        : m_values{other.m_values},
+          m_valuesArrays{other.m_valuesArrays},
+          m_objectsArrays{other.m_objectsArrays} {
+        // The objects of the other node may be materialized concurrently.
+        const std::lock_guard lock{other.m_objectsMutex.mutex};
+        m_objects = other.m_objects;
+        m_deferredObjects = other.m_deferredObjects;
+    }
+
+    ProjectNode(ProjectNode&&) noexcept = default;
+    ~ProjectNode() noexcept = default;
+
+    ProjectNode& operator=(const ProjectNode& other) {
+        if (this != &other)
+            *this = ProjectNode{other};
+
+        return *this;
+    }
+
+    ProjectNode& operator=(ProjectNode&&) noexcept = default;
 
     //!!
     //! \brief Add a value to the node. If the value is already present, it will be overwritten.
@@ -105,7 +132,24 @@ public:
     //! \param node The object to add.
     //! \return A reference to the node.
     auto& addObject(ProjectFieldKey auto&& key, ProjectNode&& node) {
-        m_objects[std::forward<decltype(key)>(key)] = std::move(node);
+        std::string finalKey{std::forward<decltype(key)>(key)};
+        m_deferredObjects.erase(finalKey);
+        m_objects[std::move(finalKey)] = std::move(node);
+        return *this;
+    }
+
+    //!!
+    //! \brief Add an object whose content is produced on demand. The loader is invoked
+    //!  only the first time the object is accessed and its result replaces the loader.
+    //!  If an object with the same key is already present, it will be overwritten.
+    //!
+    //! \param key The key of the object.
+    //! \param loader The callable that builds the object when it's first needed.
+    //! \return A reference to the node.
+    auto& addDeferredObject(ProjectFieldKey auto&& key, deferred_object_loader loader) {
+        std::string finalKey{std::forward<decltype(key)>(key)};
+        m_objects.erase(finalKey);
+        m_deferredObjects[std::move(finalKey)] = std::move(loader);
         return *this;
     }
 
@@ -135,7 +179,7 @@ public:
     [[nodiscard]] bool contains(ProjectFieldKey auto&& key) const noexcept {
         return m_values.contains(std::forward<decltype(key)>(key)) ||
                m_valuesArrays.contains(std::forward<decltype(key)>(key)) ||
-               m_objects.contains(std::forward<decltype(key)>(key)) ||
+               containsObject(std::forward<decltype(key)>(key)) ||
                m_objectsArrays.contains(std::forward<decltype(key)>(key));
     }
 
@@ -148,7 +192,9 @@ public:
     }
 
     [[nodiscard]] bool containsObject(ProjectFieldKey auto&& key) const noexcept {
-        return m_objects.contains(std::forward<decltype(key)>(key));
+        const std::lock_guard lock{m_objectsMutex.mutex};
+        return m_objects.contains(std::forward<decltype(key)>(key)) ||
+               m_deferredObjects.contains(std::forward<decltype(key)>(key));
     }
 
     template <ProjectFieldValue ValueType>
@@ -173,11 +219,19 @@ public:
     }
 
     [[nodiscard]] const auto& getObject(ProjectFieldKey auto&& key) const {
-        return m_objects.at(std::forward<decltype(key)>(key));
+        const std::string finalKey{std::forward<decltype(key)>(key)};
+
+        const std::lock_guard lock{m_objectsMutex.mutex};
+        materialize_deferred_object(finalKey);
+        return m_objects.at(finalKey);
     }
 
     [[nodiscard]] auto& getObject(ProjectFieldKey auto&& key) {
-        return m_objects.at(std::forward<decltype(key)>(key));
+        const std::string finalKey{std::forward<decltype(key)>(key)};
+
+        const std::lock_guard lock{m_objectsMutex.mutex};
+        materialize_deferred_object(finalKey);
+        return m_objects.at(finalKey);
     }
 
     [[nodiscard]] const auto& getObjectArray(ProjectFieldKey auto&& key) const {
@@ -196,7 +250,22 @@ public:
         return m_valuesArrays;
     }
 
-    [[nodiscard]] const auto& getObjects() const noexcept {
+    //!!
+    //! \brief Retrieve all the objects of this node. Every deferred object is loaded
+    //!  before returning.
+    //!
+    //! \note The returned map isn't guarded: once every object is loaded it's only read by
+    //!  the const accessors, but it must not be used while another thread adds or removes
+    //!  the objects of this node.
+    //! \throw The error of a deferred object that can't be loaded, e.g. a malformed section.
+    //!  The objects that can't be loaded stay deferred.
+    //!
+    //! \return The objects of this node.
+    [[nodiscard]] const auto& getObjects() const {
+        const std::lock_guard lock{m_objectsMutex.mutex};
+        while (!m_deferredObjects.empty())
+            materialize_deferred_object(m_deferredObjects.begin()->first);
+
         return m_objects;
     }
 
@@ -212,8 +281,44 @@ public:
 protected:
     std::map<std::string, value_impl_type> m_values{};
     std::map<std::string, std::vector<value_impl_type>> m_valuesArrays{};
-    std::map<std::string, ProjectNode> m_objects{};
     std::map<std::string, std::vector<ProjectNode>> m_objectsArrays{};
+
+    // Objects are mutable because a deferred object is moved into m_objects
+    // the first time it is accessed, even through a const node. Both maps are
+    // guarded by m_objectsMutex as const nodes can be read by many threads.
+    mutable std::map<std::string, ProjectNode> m_objects{};
+    mutable std::map<std::string, deferred_object_loader> m_deferredObjects{};
+
+private:
+    //!!
+    //! \brief Mutex that can be a member of a copyable node: every node has its own.
+    struct ObjectsMutex {
+        ObjectsMutex() noexcept = default;
+        ObjectsMutex(const ObjectsMutex&) noexcept {}
+        ObjectsMutex& operator=(const ObjectsMutex&) noexcept {
+            return *this;
+        }
+
+        std::mutex mutex{};
+    };
+
+    mutable ObjectsMutex m_objectsMutex{};
+
+    //!!
+    //! \brief Loads the deferred object with the given key, if any. If the loader
+    //!  throws, the object stays deferred and the exception is propagated.
+    //!  The caller must hold m_objectsMutex.
+    //!
+    //! \param key The key of the object to load.
+    void materialize_deferred_object(const std::string& key) const {
+        auto deferredIt{m_deferredObjects.find(key)};
+        if (deferredIt == m_deferredObjects.end())
+            return;
+
+        // The key may belong to the deferred entry itself, so we erase it last.
+        m_objects[key] = deferredIt->second();
+        m_deferredObjects.erase(deferredIt);
+    }
 };
 
 using ProjectFieldObject = ProjectNode;
@@ -0,0 +1,532 @@
+// Copyright (c) 2023 Andrea Ballestrazzi
+#pragma once
+
+#include <project-management/project.hpp>
+
+// C++ STL
+#include <array>
+#include <bitset>
+#include <chrono>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+//!!
+//! \brief Compile-time schemas used to bind plain structs to project nodes.
+//!
+//!  A struct opts in by exposing a `static constexpr auto schema()` function that returns
+//!  the list of its field descriptors:
+//!
+//!  struct DeviceConfig {
+//!      std::string name;
+//!      std::uint64_t pinID;
+//!
+//!      static constexpr auto schema() noexcept {
+//!          return MakeSchema(MakeField("name", &DeviceConfig::name),
+//!                            MakeField("pinID", &DeviceConfig::pinID));
+//!      }
+//!  };
+//!
+//!  Supported member types are bool, integral and floating point numbers, std::string,
+//!  std::chrono::duration (stored as its count), enums (through MakeEnumField), other
+//!  schematized structs (stored as objects) and std::vector of schematized structs (stored
+//!  as object arrays). Wrapping a member in std::optional makes the field optional.
+namespace gc::project_management::schema {
+
+//!!
+//! \brief The reason why a project node couldn't be decoded.
+//!
+enum class DecodeError : std::uint8_t {
+    None,
+
+    // A required field isn't present in the node.
+    MissingField,
+
+    // The field is present but its type doesn't match the schema.
+    TypeMismatch,
+
+    // The field is a number that doesn't fit the member type.
+    ValueOutOfRange,
+
+    // The field is a string that doesn't name any of the enum values.
+    UnknownEnumValue
+};
+
+//!!
+//! \brief The result of a decoding operation. It evaluates to true if the node
+//!  was decoded successfully. On failure, the key refers to the first field
+//!  that didn't pass the validation.
+//!
+struct DecodeResult {
+    DecodeError error{DecodeError::None};
+    std::string_view key{};
+
+    [[nodiscard]] constexpr explicit operator bool() const noexcept {
+        return error == DecodeError::None;
+    }
+};
+
+[[nodiscard]] constexpr std::string_view DecodeErrorToString(const DecodeError error) noexcept {
+    switch (error) {
+        case DecodeError::None:
+            return "no error";
+        case DecodeError::MissingField:
+            return "missing field";
+        case DecodeError::TypeMismatch:
+            return "type mismatch";
+        case DecodeError::ValueOutOfRange:
+            return "value out of range";
+        case DecodeError::UnknownEnumValue:
+            return "unknown enum value";
+    }
+
+    return "unknown error";
+}
+
+//!!
+//! \brief Describes a field bound to a struct member.
+//!
+template <typename Owner, typename Member>
+struct Field {
+    using owner_type = Owner;
+    using member_type = Member;
+
+    std::string_view key;
+    Member Owner::*member;
+};
+
+//!!
+//! \brief Describes an enum field stored as one of the given names.
+//!
+template <typename Owner, typename Enum, std::size_t N>
+struct EnumField {
+    using owner_type = Owner;
+    using member_type = Enum;
+
+    std::string_view key;
+    Enum Owner::*member;
+    std::array<std::pair<std::string_view, Enum>, N> names;
+};
+
+template <typename Owner, typename Member>
+[[nodiscard]] constexpr auto MakeField(std::string_view key, Member Owner::*member) noexcept {
+    return Field<Owner, Member>{key, member};
+}
+
+template <typename Owner, typename Enum, std::size_t N>
+    requires std::is_enum_v<Enum>
+[[nodiscard]] constexpr auto MakeEnumField(
+    std::string_view key, Enum Owner::*member,
+    const std::array<std::pair<std::string_view, Enum>, N>& names) noexcept {
+    return EnumField<Owner, Enum, N>{key, member, names};
+}
+
+template <typename... FieldTypes>
+[[nodiscard]] constexpr auto MakeSchema(FieldTypes... fields) noexcept {
+    return std::tuple<FieldTypes...>{fields...};
+}
+
+//!!
+//! \brief A struct that exposes a compile-time list of field descriptors.
+//!
+template <typename T>
+concept Schematized = requires { std::tuple_size<decltype(T::schema())>::value; };
+
+namespace details {
+
+template <typename T>
+struct IsOptional : std::false_type {};
+
+template <typename T>
+struct IsOptional<std::optional<T>> : std::true_type {
+    using value_type = T;
+};
+
+template <typename T>
+struct IsVector : std::false_type {};
+
+template <typename T, typename Allocator>
+struct IsVector<std::vector<T, Allocator>> : std::true_type {
+    using value_type = T;
+};
+
+template <typename T>
+struct IsDuration : std::false_type {};
+
+template <typename Rep, typename Period>
+struct IsDuration<std::chrono::duration<Rep, Period>> : std::true_type {};
+
+template <typename T>
+struct UnwrapOptional {
+    using type = T;
+};
+
+template <typename T>
+struct UnwrapOptional<std::optional<T>> {
+    using type = T;
+};
+
+template <typename FieldType>
+using field_value_type = typename UnwrapOptional<typename FieldType::member_type>::type;
+
+//!!
+//! \brief Where a field lives inside a project node.
+//!
+enum class FieldStorage {
+    Value,
+    Object,
+    ObjectArray
+};
+
+template <typename FieldType>
+[[nodiscard]] consteval FieldStorage StorageOf() noexcept {
+    using value_type = field_value_type<FieldType>;
+
+    if constexpr (Schematized<value_type>)
+        return FieldStorage::Object;
+    else if constexpr (IsVector<value_type>::value)
+        return FieldStorage::ObjectArray;
+    else
+        return FieldStorage::Value;
+}
+
+//!!
+//! \brief Object arrays are never required: empty arrays aren't stored by the
+//!  project readers at all.
+template <typename FieldType>
+[[nodiscard]] consteval bool IsRequired() noexcept {
+    return !IsOptional<typename FieldType::member_type>::value &&
+           StorageOf<FieldType>() != FieldStorage::ObjectArray;
+}
+
+template <typename Fields, typename Function, std::size_t... Is>
+constexpr void ForEachField(const Fields& fields, Function&& function,
+                            std::index_sequence<Is...>) {
+    (function(std::get<Is>(fields), std::integral_constant<std::size_t, Is>{}), ...);
+}
+
+template <typename Fields, typename Function>
+constexpr void ForEachField(const Fields& fields, Function&& function) {
+    ForEachField(fields, std::forward<Function>(function),
+                 std::make_index_sequence<std::tuple_size_v<Fields>>{});
+}
+
+//!!
+//! \brief Invokes the function on the field with the given key, if any.
+//!
+template <typename Fields, typename Function, std::size_t... Is>
+constexpr void VisitFieldByKey(const Fields& fields, std::string_view key, Function&& function,
+                               std::index_sequence<Is...>) {
+    [[maybe_unused]] const bool bFound{
+        ((std::get<Is>(fields).key == key
+              ? (function(std::get<Is>(fields), std::integral_constant<std::size_t, Is>{}), true)
+              : false) ||
+         ...)};
+}
+
+template <typename Fields, typename Function>
+constexpr void VisitFieldByKey(const Fields& fields, std::string_view key, Function&& function) {
+    VisitFieldByKey(fields, key, std::forward<Function>(function),
+                    std::make_index_sequence<std::tuple_size_v<Fields>>{});
+}
+
+template <typename Integer>
+[[nodiscard]] constexpr DecodeError DecodeInteger(const ProjectNode::value_impl_type& value,
+                                                  Integer& out) noexcept {
+    if (const auto* unsignedValue{std::get_if<std::uint64_t>(&value)}) {
+        if (!std::in_range<Integer>(*unsignedValue))
+            return DecodeError::ValueOutOfRange;
+
+        out = static_cast<Integer>(*unsignedValue);
+        return DecodeError::None;
+    }
+
+    if (const auto* signedValue{std::get_if<std::int64_t>(&value)}) {
+        if (!std::in_range<Integer>(*signedValue))
+            return DecodeError::ValueOutOfRange;
+
+        out = static_cast<Integer>(*signedValue);
+        return DecodeError::None;
+    }
+
+    return DecodeError::TypeMismatch;
+}
+
+template <typename T>
+[[nodiscard]] DecodeError DecodeValue(const ProjectNode::value_impl_type& value, T& out) {
+    if constexpr (std::is_same_v<T, bool>) {
+        const auto* boolValue{std::get_if<bool>(&value)};
+        if (boolValue == nullptr)
+            return DecodeError::TypeMismatch;
+
+        out = *boolValue;
+        return DecodeError::None;
+    } else if constexpr (std::is_integral_v<T>) {
+        return DecodeInteger(value, out);
+    } else if constexpr (std::is_floating_point_v<T>) {
+        // Integral numbers are accepted as floating point values because
+        // the JSON format doesn't distinguish between 1 and 1.0.
+        if (const auto* doubleValue{std::get_if<double>(&value)})
+            out = static_cast<T>(*doubleValue);
+        else if (const auto* unsignedValue{std::get_if<std::uint64_t>(&value)})
+            out = static_cast<T>(*unsignedValue);
+        else if (const auto* signedValue{std::get_if<std::int64_t>(&value)})
+            out = static_cast<T>(*signedValue);
+        else
+            return DecodeError::TypeMismatch;
+
+        return DecodeError::None;
+    } else if constexpr (std::is_same_v<T, std::string>) {
+        const auto* stringValue{std::get_if<std::string>(&value)};
+        if (stringValue == nullptr)
+            return DecodeError::TypeMismatch;
+
+        out = *stringValue;
+        return DecodeError::None;
+    } else if constexpr (IsDuration<T>::value) {
+        typename T::rep count{};
+        const DecodeError error{DecodeValue(value, count)};
+        if (error == DecodeError::None)
+            out = T{count};
+
+        return error;
+    } else {
+        static_assert(project_management::details::InvalidVariantType<T>,
+                      "Field type not supported.");
+    }
+}
+
+template <typename T>
+[[nodiscard]] ProjectNode::value_impl_type EncodeValue(const T& value) {
+    if constexpr (std::is_same_v<T, bool> || std::is_same_v<T, std::string>)
+        return value;
+    else if constexpr (std::is_integral_v<T> && std::is_unsigned_v<T>)
+        return static_cast<std::uint64_t>(value);
+    else if constexpr (std::is_integral_v<T>)
+        return static_cast<std::int64_t>(value);
+    else if constexpr (std::is_floating_point_v<T>)
+        return static_cast<double>(value);
+    else if constexpr (IsDuration<T>::value)
+        return EncodeValue(value.count());
+    else
+        static_assert(project_management::details::InvalidVariantType<T>,
+                      "Field type not supported.");
+}
+
+template <typename T>
+struct IsEnumField : std::false_type {};
+
+template <typename Owner, typename Enum, std::size_t N>
+struct IsEnumField<EnumField<Owner, Enum, N>> : std::true_type {};
+
+template <typename FieldType, typename T>
+[[nodiscard]] DecodeError DecodeFieldValue(const FieldType& field,
+                                           const ProjectNode::value_impl_type& value, T& out) {
+    if constexpr (IsEnumField<FieldType>::value) {
+        const auto* stringValue{std::get_if<std::string>(&value)};
+        if (stringValue == nullptr)
+            return DecodeError::TypeMismatch;
+
+        for (const auto& [name, enumValue] : field.names) {
+            if (name == *stringValue) {
+                out = enumValue;
+                return DecodeError::None;
+            }
+        }
+
+        return DecodeError::UnknownEnumValue;
+    } else {
+        return DecodeValue(value, out);
+    }
+}
+
+template <typename FieldType, typename T>
+[[nodiscard]] ProjectNode::value_impl_type EncodeFieldValue(const FieldType& field,
+                                                            const T& value) {
+    if constexpr (IsEnumField<FieldType>::value) {
+        for (const auto& [name, enumValue] : field.names) {
+            if (enumValue == value)
+                return std::string{name};
+        }
+
+        return std::string{};
+    } else {
+        return EncodeValue(value);
+    }
+}
+
+//!!
+//! \brief Returns the member storage, engaging it first if it's optional.
+//!
+template <typename Member>
+[[nodiscard]] auto& EmplaceMember(Member& member) {
+    if constexpr (IsOptional<Member>::value)
+        return member.emplace();
+    else
+        return member;
+}
+
+} // namespace details
+
+template <Schematized T>
+[[nodiscard]] DecodeResult Decode(const ProjectNode& node, T& object);
+
+template <Schematized T>
+[[nodiscard]] ProjectNode Encode(const T& object);
+
+//!!
+//! \brief Decodes the given node into the given object. Each entry of the node is matched
+//!  against the schema once, then a single validation pass checks the required fields.
+//!  Entries that aren't part of the schema are ignored. No exception is thrown for a node
+//!  that doesn't match the schema: the returned result describes the first mismatch.
+//!
+//! \param node The node to decode.
+//! \param object The object that receives the decoded values.
+//! \return The decoding result.
+template <Schematized T>
+DecodeResult Decode(const ProjectNode& node, T& object) {
+    static constexpr auto FIELDS{T::schema()};
+    constexpr std::size_t FIELDS_COUNT{std::tuple_size_v<decltype(FIELDS)>};
+
+    std::bitset<FIELDS_COUNT> foundFields{};
+    DecodeResult result{};
+
+    const auto checkStorage = [&result](const auto& field, const details::FieldStorage storage) {
+        if (details::StorageOf<std::remove_cvref_t<decltype(field)>>() == storage)
+            return true;
+
+        result = DecodeResult{DecodeError::TypeMismatch, field.key};
+        return false;
+    };
+
+    for (const auto& [key, value] : node.getValues()) {
+        details::VisitFieldByKey(FIELDS, key, [&](const auto& field, auto index) {
+            using field_type = std::remove_cvref_t<decltype(field)>;
+
+            if (!checkStorage(field, details::FieldStorage::Value))
+                return;
+
+            if constexpr (details::StorageOf<field_type>() == details::FieldStorage::Value) {
+                auto& member{details::EmplaceMember(object.*field.member)};
+                const DecodeError error{details::DecodeFieldValue(field, value, member)};
+                if (error != DecodeError::None) {
+                    result = DecodeResult{error, field.key};
+                    return;
+                }
+
+                foundFields.set(index);
+            }
+        });
+
+        if (!result)
+            return result;
+    }
+
+    for (const auto& [key, childNode] : node.getObjects()) {
+        details::VisitFieldByKey(FIELDS, key, [&](const auto& field, auto index) {
+            using field_type = std::remove_cvref_t<decltype(field)>;
+
+            if (!checkStorage(field, details::FieldStorage::Object))
+                return;
+
+            if constexpr (details::StorageOf<field_type>() == details::FieldStorage::Object) {
+                result = Decode(childNode, details::EmplaceMember(object.*field.member));
+                if (result)
+                    foundFields.set(index);
+            }
+        });
+
+        if (!result)
+            return result;
+    }
+
+    for (const auto& [key, childNodes] : node.getAllObjectArrays()) {
+        details::VisitFieldByKey(FIELDS, key, [&](const auto& field, auto index) {
+            using field_type = std::remove_cvref_t<decltype(field)>;
+
+            if (!checkStorage(field, details::FieldStorage::ObjectArray))
+                return;
+
+            if constexpr (details::StorageOf<field_type>() ==
+                          details::FieldStorage::ObjectArray) {
+                auto& member{details::EmplaceMember(object.*field.member)};
+                member.clear();
+                member.reserve(childNodes.size());
+
+                for (const ProjectNode& childNode : childNodes) {
+                    result = Decode(childNode, member.emplace_back());
+                    if (!result)
+                        return;
+                }
+
+                foundFields.set(index);
+            }
+        });
+
+        if (!result)
+            return result;
+    }
+
+    // Validation pass: every required field must have been found.
+    details::ForEachField(FIELDS, [&](const auto& field, auto index) {
+        if constexpr (details::IsRequired<std::remove_cvref_t<decltype(field)>>()) {
+            if (result && !foundFields.test(index))
+                result = DecodeResult{DecodeError::MissingField, field.key};
+        }
+    });
+
+    return result;
+}
+
+//!!
+//! \brief Encodes the given object into a new project node. Optional fields without
+//!  a value are skipped.
+//!
+//! \param object The object to encode.
+//! \return The project node that represents the object.
+template <Schematized T>
+ProjectNode Encode(const T& object) {
+    static constexpr auto FIELDS{T::schema()};
+
+    ProjectNode node{};
+    details::ForEachField(FIELDS, [&node, &object](const auto& field, auto) {
+        using field_type = std::remove_cvref_t<decltype(field)>;
+        const auto& member{object.*field.member};
+
+        const details::field_value_type<field_type>* value{};
+        if constexpr (details::IsOptional<typename field_type::member_type>::value) {
+            if (!member.has_value())
+                return;
+
+            value = &member.value();
+        } else {
+            value = &member;
+        }
+
+        constexpr details::FieldStorage storage{details::StorageOf<field_type>()};
+        if constexpr (storage == details::FieldStorage::Value) {
+            node.addValue(std::string{field.key}, details::EncodeFieldValue(field, *value));
+        } else if constexpr (storage == details::FieldStorage::Object) {
+            node.addObject(std::string{field.key}, Encode(*value));
+        } else {
+            std::vector<ProjectNode> childNodes{};
+            childNodes.reserve(value->size());
+            for (const auto& child : *value)
+                childNodes.push_back(Encode(child));
+
+            node.addObjectArray(std::string{field.key}, std::move(childNodes));
+        }
+    });
+
+    return node;
+}
+
+} // namespace gc::project_management::schema
@@ -0,0 +1,83 @@
+// Copyright (c) 2023 Andrea Ballestrazzi
+#include <project-management/integrity-check/project-upgrader-registry.hpp>
+
+// C++ STL
+#include <algorithm>
+#include <stdexcept>
+#include <utility>
+
+namespace gc::project_management::integrity_check {
+
+void ProjectUpgraderRegistry::registerUpgrader(version_type fromVersion, version_type toVersion,
+                                               upgrader_factory factory) {
+    if (!(fromVersion < toVersion))
+        throw std::invalid_argument{"An upgrader must produce a version greater than " +
+                                    fromVersion.to_string()};
+
+    m_steps.push_back(MigrationStep{fromVersion, toVersion, std::move(factory)});
+}
+
+auto ProjectUpgraderRegistry::findMigrationPath(version_type fromVersion,
+                                                version_type targetVersion) const
+    -> migration_path {
+    // Breadth-first visit of the version graph: the nodes are the versions reachable
+    // from the starting one and the edges are the registered steps. A step applies to
+    // a version if it falls in the step range and the step doesn't overshoot the target.
+    struct VisitedVersion {
+        version_type version{};
+        migration_path path{};
+    };
+
+    const auto isApplicable{[targetVersion](const MigrationStep& step, version_type version) {
+        return step.fromVersion <= version && version < step.toVersion &&
+               step.toVersion <= targetVersion;
+    }};
+
+    std::vector<VisitedVersion> frontier{VisitedVersion{fromVersion, {}}};
+    std::vector<version_type> visitedVersions{fromVersion};
+    VisitedVersion bestMatch{frontier.front()};
+
+    while (!frontier.empty()) {
+        std::vector<VisitedVersion> nextFrontier{};
+
+        for (const VisitedVersion& current : frontier) {
+            for (const MigrationStep& step : m_steps) {
+                if (!isApplicable(step, current.version) ||
+                    std::ranges::find(visitedVersions, step.toVersion) != visitedVersions.end())
+                    continue;
+
+                VisitedVersion next{step.toVersion, current.path};
+                next.path.push_back(&step);
+                visitedVersions.push_back(step.toVersion);
+
+                // Paths of the same length are compared on the version they land on;
+                // the frontier is visited by increasing length so the first one wins ties.
+                if (bestMatch.version < next.version)
+                    bestMatch = next;
+
+                nextFrontier.push_back(std::move(next));
+            }
+        }
+
+        frontier = std::move(nextFrontier);
+    }
+
+    return bestMatch.path;
+}
+
+bool ProjectUpgraderRegistry::migrate(Project& project, version_type targetVersion) const {
+    const migration_path path{findMigrationPath(project.getVersion(), targetVersion)};
+
+    for (const MigrationStep* step : path) {
+        const upgrader_pointer upgrader{step->factory()};
+
+        if (!upgrader->checkIntegrity(project) && !upgrader->tryApplyIntegrityFixes(project))
+            return false;
+
+        Project::updateVersion(project, step->toVersion);
+    }
+
+    return true;
+}
+
+} // namespace gc::project_management::integrity_check
@@ -0,0 +1,68 @@
+// Copyright (c) 2023 Andrea Ballestrazzi
+#include <project-io/json-project-node-reader.hpp>
+
+// C++ STL
+#include <stdexcept>
+#include <vector>
+
+namespace gc::project_management::project_io::details {
+
+auto createVariantFromJsonNode(const nlohmann::json& jsonNode) -> ProjectNode::value_impl_type {
+    if (jsonNode.is_boolean())
+        return jsonNode.get<bool>();
+    else if (jsonNode.is_number_integer()) {
+        if (jsonNode.is_number_unsigned())
+            return jsonNode.get<std::uint64_t>();
+        else
+            return jsonNode.get<std::int64_t>();
+    } else if (jsonNode.is_number_float())
+        return jsonNode.get<double>();
+    else if (jsonNode.is_string())
+        return jsonNode.get<std::string>();
+
+    throw std::runtime_error{"JSON node type not supported."};
+}
+
+void readJsonMember(ProjectNode& node, const std::string& key, const nlohmann::json& value) {
+    // If the value is an array, we read it as an array.
+    if (value.is_array()) {
+        std::vector<ProjectNode::value_impl_type> valueArray{};
+        std::vector<ProjectNode> objectArray{};
+        for (const auto& arrayValue : value) {
+            // If the array value is an object, we read it as an object.
+            if (arrayValue.is_object()) {
+                objectArray.push_back(readProjectNode(arrayValue));
+                continue;
+            }
+
+            // We need to instance a variant based on the array value type.
+            ProjectNode::value_impl_type finalValue{createVariantFromJsonNode(arrayValue)};
+            valueArray.push_back(std::move(finalValue));
+        }
+
+        if (!objectArray.empty())
+            node.addObjectArray(key, std::move(objectArray));
+        else if (!valueArray.empty())
+            node.addValueArray(key, std::move(valueArray));
+    }
+
+    // If the value is an object, we read it as an object of values.
+    else if (value.is_object()) {
+        node.addObject(key, readProjectNode(value));
+    }
+    // If the value is a simple value, we read it as a simple value.
+    else {
+        node.addValue(key, createVariantFromJsonNode(value));
+    }
+}
+
+ProjectNode readProjectNode(const nlohmann::json& jsonNode) {
+    ProjectNode finalNode{};
+
+    for (const auto& [key, value] : jsonNode.items())
+        readJsonMember(finalNode, key, value);
+
+    return finalNode;
+}
+
+} // namespace gc::project_management::project_io::details
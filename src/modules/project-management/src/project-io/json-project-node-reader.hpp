@@ -0,0 +1,38 @@
+// Copyright (c) 2023 Andrea Ballestrazzi
+#pragma once
+
+#include <project-management/project.hpp>
+
+#include <nlohmann/json.hpp>
+
+// C++ STL
+#include <string>
+
+namespace gc::project_management::project_io::details {
+
+//!!
+//! \brief Converts a JSON scalar into the corresponding project value.
+//!  Throws a std::runtime_error if the JSON node isn't a supported scalar.
+//!
+//! \param jsonNode The JSON scalar to convert.
+//! \return The project value.
+[[nodiscard]] auto createVariantFromJsonNode(const nlohmann::json& jsonNode)
+    -> ProjectNode::value_impl_type;
+
+//!!
+//! \brief Reads a JSON member (value, array or object) and adds it to the given
+//!  project node under the given key.
+//!
+//! \param node The node that will receive the member.
+//! \param key The key of the member.
+//! \param value The JSON value of the member.
+void readJsonMember(ProjectNode& node, const std::string& key, const nlohmann::json& value);
+
+//!!
+//! \brief Reads an entire JSON object into a project node.
+//!
+//! \param jsonNode The JSON object to read.
+//! \return The project node.
+[[nodiscard]] ProjectNode readProjectNode(const nlohmann::json& jsonNode);
+
+} // namespace gc::project_management::project_io::details
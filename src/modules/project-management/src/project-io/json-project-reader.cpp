@@ -1,5 +1,7 @@
 // Copyright (c) 2023 Andrea Ballestrazzi
+#include <project-io/json-project-node-reader.hpp>
 #include <project-io/json-project-reader.hpp>
+#include <project-io/project-io-metrics.hpp>
 
 #include <nlohmann/json.hpp>
 
@@ -8,31 +10,12 @@
 
 namespace gc::project_management::project_io {
 
-namespace details {
-
-auto createVariantFromJsonNode(const nlohmann::json& jsonNode)
-    -> gc::project_management::ProjectNode::value_impl_type {
-    if (jsonNode.is_boolean())
-        return jsonNode.get<bool>();
-    else if (jsonNode.is_number_integer()) {
-        if (jsonNode.is_number_unsigned())
-            return jsonNode.get<std::uint64_t>();
-        else
-            return jsonNode.get<std::int64_t>();
-    } else if (jsonNode.is_number_float())
-        return jsonNode.get<double>();
-    else if (jsonNode.is_string())
-        return jsonNode.get<std::string>();
-
-    throw std::runtime_error{"JSON node type not supported."};
-}
-
-} // namespace details
-
 JsonProjectReader::JsonProjectReader(std::unique_ptr<std::istream> ist) noexcept
     : m_inputStream{std::move(ist)} {}
 
 Project JsonProjectReader::readProject() {
+    const ProjectIOMeasurement readMeasurement{GetProjectReadMetrics()};
+
     nlohmann::json inputProjectJson{};
     // Read the JSON from the input file.
     *m_inputStream >> inputProjectJson;
@@ -61,80 +44,10 @@ Project JsonProjectReader::readProject() {
         if (key == "creation_timedate" || key == "title" || key == "version")
             continue;
 
-        // If the value is an array, we read it as an array.
-        if (value.is_array()) {
-            std::vector<ProjectNode::value_impl_type> valueArray{};
-            std::vector<ProjectNode> objectArray{};
-            for (const auto& arrayValue : value) {
-                // If the array value is an object, we read it as an object.
-                if (arrayValue.is_object()) {
-                    objectArray.push_back(read_project_node(arrayValue));
-                    continue;
-                }
-
-                // We need to instance a variant based on the array value type.
-                ProjectNode::value_impl_type finalValue{
-                    details::createVariantFromJsonNode(arrayValue)};
-                valueArray.push_back(std::move(finalValue));
-            }
-
-            if (!objectArray.empty())
-                finalProject.addObjectArray(key, std::move(objectArray));
-            else if (!valueArray.empty())
-                finalProject.addValueArray(key, std::move(valueArray));
-        }
-
-        // If the value is an object, we read it as an object of values.
-        else if (value.is_object()) {
-            finalProject.addObject(key, read_project_node(value));
-        }
-        // If the value is a simple value, we read it as a simple value.
-        else {
-            finalProject.addValue(key, details::createVariantFromJsonNode(value));
-        }
+        details::readJsonMember(finalProject, key, value);
     }
 
     return finalProject;
 }
 
-ProjectNode JsonProjectReader::read_project_node(const nlohmann::json& jsonNode) {
-    ProjectNode finalNode{};
-
-    for (const auto& [key, value] : jsonNode.items()) {
-        // If the value is an array, we read it as an array.
-        if (value.is_array()) {
-            std::vector<ProjectNode::value_impl_type> valueArray{};
-            std::vector<ProjectNode> objectArray{};
-            for (const auto& arrayValue : value) {
-                // If the array value is an object, we read it as an object.
-                if (arrayValue.is_object()) {
-                    objectArray.push_back(read_project_node(arrayValue));
-                    continue;
-                }
-
-                // We need to instance a variant based on the array value type.
-                ProjectNode::value_impl_type finalValue{
-                    details::createVariantFromJsonNode(arrayValue)};
-                valueArray.push_back(std::move(finalValue));
-            }
-
-            if (!objectArray.empty())
-                finalNode.addObjectArray(key, std::move(objectArray));
-            else if (!valueArray.empty())
-                finalNode.addValueArray(key, std::move(valueArray));
-        }
-
-        // If the value is an object, we read it as an object of values.
-        else if (value.is_object()) {
-            finalNode.addObject(key, read_project_node(value));
-        }
-        // If the value is a simple value, we read it as a simple value.
-        else {
-            finalNode.addValue(key, details::createVariantFromJsonNode(value));
-        }
-    }
-
-    return finalNode;
-}
-
 } // namespace gc::project_management::project_io
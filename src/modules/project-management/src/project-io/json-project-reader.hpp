@@ -27,9 +27,6 @@ public:
 
 private:
     std::unique_ptr<std::istream> m_inputStream;
-
-    [[nodiscard]] gc::project_management::ProjectNode read_project_node(
-        const nlohmann::json& jsonNode);
 };
 
 } // namespace gc::project_management::project_io
@@ -1,5 +1,6 @@
 // Copyright (c) 2023 Andrea Ballestrazzi
 #include <project-io/json-project-writer.hpp>
+#include <project-io/project-io-metrics.hpp>
 
 // Third-party
 #include <nlohmann/json.hpp>
@@ -13,6 +14,8 @@ JsonProjectWriter::JsonProjectWriter(std::unique_ptr<std::ostream> outputStream)
     : m_outputStream{std::move(outputStream)} {}
 
 void JsonProjectWriter::serializeProject(const Project& project) {
+    const ProjectIOMeasurement writeMeasurement{GetProjectWriteMetrics()};
+
     nlohmann::json projectJson{};
 
     projectJson["version"] = project.getVersion().to_string();
@@ -0,0 +1,230 @@
+// Copyright (c) 2023 Andrea Ballestrazzi
+#include <project-io/json-project-node-reader.hpp>
+#include <project-io/lazy-json-project-reader.hpp>
+#include <project-io/project-io-metrics.hpp>
+
+// Third-party
+#include <nlohmann/json.hpp>
+
+// C++ STL
+#include <chrono>
+#include <iterator>
+#include <stdexcept>
+
+namespace gc::project_management::project_io {
+
+namespace details {
+
+namespace {
+
+[[nodiscard]] constexpr bool IsJsonWhitespace(const char c) noexcept {
+    return c == ' ' || c == '\t' || c == '\n' || c == '\r';
+}
+
+[[noreturn]] void ThrowMalformedDocument(const std::size_t position) {
+    throw std::runtime_error{"Malformed project JSON near position " + std::to_string(position) +
+                             "."};
+}
+
+[[nodiscard]] std::size_t SkipWhitespaces(std::string_view document, std::size_t pos) noexcept {
+    while (pos < document.size() && IsJsonWhitespace(document[pos]))
+        ++pos;
+
+    return pos;
+}
+
+//!!
+//! \brief Skips a JSON string starting at the opening quote.
+//!
+//! \return The position right after the closing quote.
+[[nodiscard]] std::size_t SkipString(std::string_view document, std::size_t pos) {
+    // Skip the opening quote.
+    ++pos;
+    while (pos < document.size()) {
+        if (document[pos] == '\\')
+            pos += 2;
+        else if (document[pos] == '"')
+            return pos + 1;
+        else
+            ++pos;
+    }
+
+    ThrowMalformedDocument(pos);
+}
+
+//!!
+//! \brief Skips a JSON value of any kind starting at the given position.
+//!
+//! \return The position right after the value.
+[[nodiscard]] std::size_t SkipValue(std::string_view document, std::size_t pos) {
+    if (pos >= document.size())
+        ThrowMalformedDocument(pos);
+
+    if (document[pos] == '"')
+        return SkipString(document, pos);
+
+    if (document[pos] == '{' || document[pos] == '[') {
+        // We only need to match the brackets, ignoring the ones inside strings.
+        std::size_t depth{};
+        while (pos < document.size()) {
+            const char c{document[pos]};
+            if (c == '"') {
+                pos = SkipString(document, pos);
+                continue;
+            }
+
+            if (c == '{' || c == '[')
+                ++depth;
+            else if (c == '}' || c == ']') {
+                if (--depth == 0)
+                    return pos + 1;
+            }
+
+            ++pos;
+        }
+
+        ThrowMalformedDocument(pos);
+    }
+
+    // Scalars: numbers, booleans and null end at the first delimiter.
+    const std::size_t valueBegin{pos};
+    while (pos < document.size() && document[pos] != ',' && document[pos] != '}' &&
+           document[pos] != ']' && !IsJsonWhitespace(document[pos]))
+        ++pos;
+
+    if (pos == valueBegin)
+        ThrowMalformedDocument(pos);
+
+    return pos;
+}
+
+} // namespace
+
+std::vector<JsonMemberRange> IndexJsonRootMembers(std::string_view document) {
+    std::vector<JsonMemberRange> members{};
+
+    std::size_t pos{SkipWhitespaces(document, 0)};
+    if (pos >= document.size() || document[pos] != '{')
+        ThrowMalformedDocument(pos);
+
+    pos = SkipWhitespaces(document, pos + 1);
+    if (pos < document.size() && document[pos] == '}')
+        return members;
+
+    while (true) {
+        if (pos >= document.size() || document[pos] != '"')
+            ThrowMalformedDocument(pos);
+
+        const std::size_t keyBegin{pos};
+        pos = SkipString(document, pos);
+        const std::string_view rawKey{document.substr(keyBegin + 1, pos - keyBegin - 2)};
+
+        JsonMemberRange member{};
+        // Only keys with escape sequences need a real decoding.
+        if (rawKey.find('\\') == std::string_view::npos)
+            member.key = std::string{rawKey};
+        else
+            member.key = nlohmann::json::parse(document.substr(keyBegin, pos - keyBegin))
+                             .get<std::string>();
+
+        pos = SkipWhitespaces(document, pos);
+        if (pos >= document.size() || document[pos] != ':')
+            ThrowMalformedDocument(pos);
+
+        member.valueBegin = SkipWhitespaces(document, pos + 1);
+        member.valueEnd = SkipValue(document, member.valueBegin);
+        members.push_back(std::move(member));
+
+        pos = SkipWhitespaces(document, members.back().valueEnd);
+        if (pos >= document.size())
+            ThrowMalformedDocument(pos);
+
+        if (document[pos] == '}')
+            break;
+
+        if (document[pos] != ',')
+            ThrowMalformedDocument(pos);
+
+        pos = SkipWhitespaces(document, pos + 1);
+    }
+
+    // Only whitespaces are allowed after the root object.
+    if (SkipWhitespaces(document, pos + 1) != document.size())
+        ThrowMalformedDocument(pos + 1);
+
+    return members;
+}
+
+} // namespace details
+
+LazyJsonProjectReader::LazyJsonProjectReader(std::unique_ptr<std::istream> ist) noexcept
+    : m_inputStream{std::move(ist)} {}
+
+Project LazyJsonProjectReader::readProject() {
+    // The deferred objects are loaded later, so they aren't part of the measured read.
+    const ProjectIOMeasurement readMeasurement{GetProjectReadMetrics()};
+
+    // The document is shared with every deferred object, so it stays alive
+    // until the last section is loaded.
+    const auto document{std::make_shared<const std::string>(
+        std::istreambuf_iterator<char>{*m_inputStream}, std::istreambuf_iterator<char>{})};
+    const std::string_view documentView{*document};
+
+    const std::vector<details::JsonMemberRange> members{
+        details::IndexJsonRootMembers(documentView)};
+
+    const auto parseMember = [documentView](const details::JsonMemberRange& member) {
+        return nlohmann::json::parse(documentView.substr(
+            member.valueBegin, member.valueEnd - member.valueBegin));
+    };
+
+    const auto findHeaderMember = [&members](std::string_view key) {
+        const auto memberIt{std::ranges::find(members, key, &details::JsonMemberRange::key)};
+        if (memberIt == members.end())
+            throw std::runtime_error{"Missing project header field: " + std::string{key}};
+
+        return *memberIt;
+    };
+
+    // Begin read the project header:
+    // - creation time-date
+    // - project title
+    // - project version
+    const Project::time_point_type creationTimeDate{std::chrono::system_clock::from_time_t(
+        parseMember(findHeaderMember("creation_timedate")).get<std::time_t>())};
+
+    std::string projectTitle{parseMember(findHeaderMember("title")).get<std::string>()};
+    std::string projectVersionStr{parseMember(findHeaderMember("version")).get<std::string>()};
+
+    // If the version string is empty, we set it to 0.0.0 as default.
+    if (projectVersionStr.empty())
+        projectVersionStr = "0.0.0";
+
+    semver::version projectVersion{semver::from_string(projectVersionStr)};
+    Project finalProject{creationTimeDate, std::move(projectTitle), projectVersion};
+
+    for (const auto& member : members) {
+        // Skip the project header.
+        if (member.key == "creation_timedate" || member.key == "title" ||
+            member.key == "version")
+            continue;
+
+        // Objects are the only sections we defer: values and arrays are cheap and
+        // needed by the integrity checkers anyway. The objects aren't parsed, nor
+        // validated, until they're first accessed: a malformed object is reported then.
+        if (documentView[member.valueBegin] == '{') {
+            finalProject.addDeferredObject(member.key, [document, member]() {
+                const std::string_view objectView{document->data() + member.valueBegin,
+                                                  member.valueEnd - member.valueBegin};
+                return details::readProjectNode(nlohmann::json::parse(objectView));
+            });
+            continue;
+        }
+
+        details::readJsonMember(finalProject, member.key, parseMember(member));
+    }
+
+    return finalProject;
+}
+
+} // namespace gc::project_management::project_io
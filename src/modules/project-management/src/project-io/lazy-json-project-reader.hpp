@@ -0,0 +1,62 @@
+// Copyright (c) 2023 Andrea Ballestrazzi
+#pragma once
+
+#include <project-management/project-io/project-reader.hpp>
+#include <project-management/project.hpp>
+
+// C++ STL
+#include <cstddef>
+#include <istream>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace gc::project_management::project_io {
+
+namespace details {
+
+//!!
+//! \brief Represents the position of a top-level member inside a JSON document.
+//!  The range [valueBegin, valueEnd) contains only the member value.
+//!
+struct JsonMemberRange {
+    std::string key;
+    std::size_t valueBegin{};
+    std::size_t valueEnd{};
+};
+
+//!!
+//! \brief Scans the given JSON document and collects the byte ranges of every member
+//!  of the root object. Nested values are skipped without being parsed.
+//!  Throws a std::runtime_error if the document structure is malformed.
+//!
+//! \param document The JSON document to scan.
+//! \return The ranges of the root members, in document order.
+[[nodiscard]] std::vector<JsonMemberRange> IndexJsonRootMembers(std::string_view document);
+
+} // namespace details
+
+//!!
+//! \brief A project reader that reads a project from a JSON file, deferring the
+//!  parsing of the top-level objects until they're first accessed.
+//!
+//! \note Only the structure of the document is checked when the project is read. A
+//!  malformed top-level object is reported by the first access to it, e.g. getObject()
+//!  or getObjects(), which throws the parse error.
+class LazyJsonProjectReader final : public ProjectReader {
+public:
+    explicit LazyJsonProjectReader(std::unique_ptr<std::istream> inputStream) noexcept;
+
+    //!!
+    //! \brief Read a project from the input stream. Top-level objects are
+    //!  added as deferred objects.
+    //!
+    //! \return Project The project read from the input stream.
+    [[nodiscard]] Project readProject() override;
+
+private:
+    std::unique_ptr<std::istream> m_inputStream;
+};
+
+} // namespace gc::project_management::project_io
@@ -0,0 +1,38 @@
+// Copyright (c) 2023 Andrea Ballestrazzi
+#include <project-io/project-io-metrics.hpp>
+
+#include <metrics/metrics-registry.hpp>
+
+// C++ STL
+#include <string>
+
+namespace gc::project_management::project_io {
+
+namespace {
+
+[[nodiscard]] ProjectIOMetrics CreateProjectIOMetrics(const std::string& operation) {
+    metrics::MetricsRegistry& registry{metrics::GetDefaultRegistry()};
+
+    return ProjectIOMetrics{
+        registry.counter("gc_project_io_operations_total", "Number of project reads and writes.",
+                         {{"operation", operation}}),
+        registry.counter("gc_project_io_failures_total",
+                         "Number of project reads and writes that have failed.",
+                         {{"operation", operation}}),
+        registry.histogram("gc_project_io_duration_ns", "Duration of the project reads and writes.",
+                           {{"operation", operation}})};
+}
+
+} // namespace
+
+ProjectIOMetrics& GetProjectReadMetrics() {
+    static ProjectIOMetrics readMetrics{CreateProjectIOMetrics("read")};
+    return readMetrics;
+}
+
+ProjectIOMetrics& GetProjectWriteMetrics() {
+    static ProjectIOMetrics writeMetrics{CreateProjectIOMetrics("write")};
+    return writeMetrics;
+}
+
+} // namespace gc::project_management::project_io
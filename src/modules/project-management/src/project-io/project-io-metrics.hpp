@@ -0,0 +1,50 @@
+// Copyright (c) 2023 Andrea Ballestrazzi
+#pragma once
+
+#include <metrics/counter.hpp>
+#include <metrics/histogram.hpp>
+#include <metrics/scoped-timer.hpp>
+
+// C++ STL
+#include <exception>
+#include <functional>
+
+namespace gc::project_management::project_io {
+
+struct ProjectIOMetrics {
+    metrics::Counter& operations;
+    metrics::Counter& failures;
+    metrics::Histogram& duration;
+};
+
+[[nodiscard]] ProjectIOMetrics& GetProjectReadMetrics();
+[[nodiscard]] ProjectIOMetrics& GetProjectWriteMetrics();
+
+//!!
+//! \brief Measures a project read or write that lasts for the scope of the object. The
+//!  operation is counted as failed if the scope is left by an exception.
+//!
+class ProjectIOMeasurement final {
+public:
+    explicit ProjectIOMeasurement(ProjectIOMetrics& ioMetrics) noexcept
+        : m_ioMetrics{std::ref(ioMetrics)},
+          m_durationTimer{ioMetrics.duration},
+          m_uncaughtExceptions{std::uncaught_exceptions()} {
+        ioMetrics.operations.increment();
+    }
+
+    ~ProjectIOMeasurement() noexcept {
+        if (std::uncaught_exceptions() > m_uncaughtExceptions)
+            m_ioMetrics.get().failures.increment();
+    }
+
+    ProjectIOMeasurement(const ProjectIOMeasurement&) = delete;
+    ProjectIOMeasurement& operator=(const ProjectIOMeasurement&) = delete;
+
+private:
+    std::reference_wrapper<ProjectIOMetrics> m_ioMetrics;
+    metrics::ScopedTimer m_durationTimer;
+    int m_uncaughtExceptions{};
+};
+
+} // namespace gc::project_management::project_io
@@ -1,5 +1,6 @@
 // Copyright (c) 2023 Andrea Ballestrazzi
 #include <project-io/json-project-reader.hpp>
+#include <project-io/lazy-json-project-reader.hpp>
 #include <project-management/project-io/project-reader.hpp>
 
 // C++ STL
@@ -8,14 +9,31 @@
 
 namespace gc::project_management::project_io {
 
-std::unique_ptr<ProjectReader> CreateJsonProjectFileReader(const std::filesystem::path& path) {
+namespace details {
+
+void CheckProjectFilePath(const std::filesystem::path& path) {
     if (!std::filesystem::exists(path))
         throw std::invalid_argument{"The specified path does not exist."};
 
     if (!std::filesystem::is_regular_file(path))
         throw std::invalid_argument{"The specified path is not a valid JSON file."};
+}
+
+} // namespace details
+
+std::unique_ptr<ProjectReader> CreateJsonProjectFileReader(const std::filesystem::path& path) {
+    details::CheckProjectFilePath(path);
 
     return std::make_unique<JsonProjectReader>(std::make_unique<std::ifstream>(path));
 }
 
+std::unique_ptr<ProjectReader> CreateLazyJsonProjectFileReader(const std::filesystem::path& path) {
+    details::CheckProjectFilePath(path);
+
+    // The lazy reader reads the whole document at once, so binary mode avoids
+    // any newline translation that would shift the indexed ranges.
+    return std::make_unique<LazyJsonProjectReader>(
+        std::make_unique<std::ifstream>(path, std::ios::binary));
+}
+
 } // namespace gc::project_management::project_io
@@ -0,0 +1,56 @@
+// Copyright (c) 2023 Andrea Ballestrazzi
+#pragma once
+
+#include "timeseries/sample.hpp"
+
+// C++ STL
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+
+namespace gc::timeseries {
+
+//!!
+//! \brief The summary of the samples of a time interval. The aggregates of two intervals can
+//!  be merged, so that the coarser resolutions are computed from the finer ones.
+//!
+struct Aggregate {
+    double min{std::numeric_limits<double>::infinity()};
+    double max{-std::numeric_limits<double>::infinity()};
+    double sum{};
+    std::uint64_t count{};
+
+    void add(const double value) noexcept {
+        min = std::min(min, value);
+        max = std::max(max, value);
+        sum += value;
+        ++count;
+    }
+
+    void merge(const Aggregate& other) noexcept {
+        min = std::min(min, other.min);
+        max = std::max(max, other.max);
+        sum += other.sum;
+        count += other.count;
+    }
+
+    //! \return The mean of the samples, or zero if there are none.
+    [[nodiscard]] double getMean() const noexcept {
+        return count > 0 ? sum / static_cast<double>(count) : 0.0;
+    }
+
+    [[nodiscard]] friend bool operator==(const Aggregate&, const Aggregate&) noexcept = default;
+};
+
+//!!
+//! \brief The aggregate of the interval that starts at the given timestamp.
+//!
+struct AggregateSample {
+    timestamp_type timestamp{};
+    Aggregate aggregate{};
+
+    [[nodiscard]] friend bool operator==(const AggregateSample&,
+                                         const AggregateSample&) noexcept = default;
+};
+
+} // namespace gc::timeseries
@@ -0,0 +1,121 @@
+// Copyright (c) 2023 Andrea Ballestrazzi
+#pragma once
+
+// C++ STL
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <stdexcept>
+#include <vector>
+
+namespace gc::timeseries {
+
+//!!
+//! \brief Appends bit fields to a byte buffer, most significant bit first.
+//!
+class BitWriter final {
+public:
+    //!!
+    //! \brief Appends the lowest bits of a value.
+    //!
+    //! \param[in] value The value, whose bits above bitsCount are ignored.
+    //! \param[in] bitsCount The number of bits to append, at most 64.
+    //!
+    void writeBits(const std::uint64_t value, unsigned bitsCount) {
+        assert(bitsCount <= 64);
+
+        while (bitsCount > 0) {
+            const unsigned bitOffset{static_cast<unsigned>(m_bitsCount % 8)};
+            if (bitOffset == 0)
+                m_bytes.push_back(0);
+
+            const unsigned freeBits{8 - bitOffset};
+            const unsigned writtenBits{std::min(freeBits, bitsCount)};
+            const std::uint64_t fieldBits{(value >> (bitsCount - writtenBits)) &
+                                          ((std::uint64_t{1} << writtenBits) - 1)};
+
+            m_bytes.back() |= static_cast<std::uint8_t>(fieldBits << (freeBits - writtenBits));
+            bitsCount -= writtenBits;
+            m_bitsCount += writtenBits;
+        }
+    }
+
+    void writeBit(const bool bBit) {
+        writeBits(bBit ? 1 : 0, 1);
+    }
+
+    //! \return The written bytes. The unused bits of the last byte are zero.
+    [[nodiscard]] const std::vector<std::uint8_t>& getBytes() const noexcept {
+        return m_bytes;
+    }
+
+    [[nodiscard]] std::uint64_t getBitsCount() const noexcept {
+        return m_bitsCount;
+    }
+
+    void clear() noexcept {
+        m_bytes.clear();
+        m_bitsCount = 0;
+    }
+
+private:
+    std::vector<std::uint8_t> m_bytes{};
+    std::uint64_t m_bitsCount{};
+};
+
+//!!
+//! \brief Reads the bit fields written by a BitWriter.
+//!
+class BitReader final {
+public:
+    BitReader(std::span<const std::uint8_t> bytes, const std::uint64_t bitsCount) noexcept
+        : m_bytes{bytes},
+          m_bitsCount{std::min<std::uint64_t>(bitsCount, bytes.size() * 8)} {}
+
+    //!!
+    //! \brief Reads the next bits as the lowest bits of the returned value.
+    //!
+    //! \param[in] bitsCount The number of bits to read, at most 64.
+    //! \throw std::out_of_range if the stream has less bits left.
+    //!
+    [[nodiscard]] std::uint64_t readBits(unsigned bitsCount) {
+        assert(bitsCount <= 64);
+        if (m_bitsCount - m_position < bitsCount)
+            throw std::out_of_range{"The bit stream is truncated."};
+
+        std::uint64_t value{};
+        while (bitsCount > 0) {
+            const unsigned bitOffset{static_cast<unsigned>(m_position % 8)};
+            const unsigned availableBits{8 - bitOffset};
+            const unsigned readBits{std::min(availableBits, bitsCount)};
+
+            const std::uint8_t byte{m_bytes[static_cast<std::size_t>(m_position / 8)]};
+            const std::uint64_t fieldBits{(static_cast<std::uint64_t>(byte) >>
+                                           (availableBits - readBits)) &
+                                          ((std::uint64_t{1} << readBits) - 1)};
+
+            value = (value << readBits) | fieldBits;
+            bitsCount -= readBits;
+            m_position += readBits;
+        }
+
+        return value;
+    }
+
+    [[nodiscard]] bool readBit() {
+        return readBits(1) != 0;
+    }
+
+    [[nodiscard]] std::uint64_t getRemainingBitsCount() const noexcept {
+        return m_bitsCount - m_position;
+    }
+
+private:
+    std::span<const std::uint8_t> m_bytes;
+    std::uint64_t m_bitsCount;
+    std::uint64_t m_position{};
+};
+
+} // namespace gc::timeseries
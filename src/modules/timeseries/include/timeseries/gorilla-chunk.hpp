@@ -0,0 +1,105 @@
+// Copyright (c) 2023 Andrea Ballestrazzi
+#pragma once
+
+#include "timeseries/bit-stream.hpp"
+#include "timeseries/sample.hpp"
+
+// C++ STL
+#include <cstdint>
+#include <span>
+#include <vector>
+
+namespace gc::timeseries {
+
+//!!
+//! \brief Compresses the samples of a series with the encoding of Facebook's Gorilla:
+//!
+//!  - the first timestamp and value are stored as they are;
+//!  - the timestamps are stored as the difference between their delta and the previous one,
+//!    which is zero for regularly sampled series and takes a single bit;
+//!  - the values are XORed with the previous one and only the meaningful bits of the result
+//!    are stored, reusing the previous leading and trailing zeros count when they fit.
+//!
+//!  A regular series of slowly changing values takes less than two bytes per sample.
+//!
+class ChunkEncoder final {
+public:
+    //!!
+    //! \brief Appends a sample. The timestamps are expected not to decrease, but any sequence
+    //!  is encoded losslessly.
+    //!
+    void append(const Sample& sample);
+
+    [[nodiscard]] std::uint32_t getSamplesCount() const noexcept {
+        return m_samplesCount;
+    }
+
+    [[nodiscard]] timestamp_type getFirstTimestamp() const noexcept {
+        return m_firstTimestamp;
+    }
+
+    [[nodiscard]] timestamp_type getLastTimestamp() const noexcept {
+        return m_lastTimestamp;
+    }
+
+    [[nodiscard]] const std::vector<std::uint8_t>& getBytes() const noexcept {
+        return m_writer.getBytes();
+    }
+
+    [[nodiscard]] std::uint64_t getBitsCount() const noexcept {
+        return m_writer.getBitsCount();
+    }
+
+private:
+    BitWriter m_writer{};
+    std::uint32_t m_samplesCount{};
+    timestamp_type m_firstTimestamp{};
+    timestamp_type m_lastTimestamp{};
+    std::uint64_t m_lastDelta{};
+    std::uint64_t m_lastValueBits{};
+    //! The zeros around the meaningful bits of the last stored XOR. No window is stored yet
+    //! while the leading zeros count is 64.
+    unsigned m_leadingZeros{64};
+    unsigned m_trailingZeros{};
+
+    void append_timestamp(timestamp_type timestamp);
+    void append_value(double value);
+};
+
+//!!
+//! \brief Decodes the samples encoded by a ChunkEncoder, in order.
+//!
+class ChunkDecoder final {
+public:
+    //!!
+    //! \param[in] bytes The encoded bytes.
+    //! \param[in] bitsCount The number of meaningful bits of the bytes.
+    //! \param[in] samplesCount The number of encoded samples.
+    //!
+    ChunkDecoder(std::span<const std::uint8_t> bytes, std::uint64_t bitsCount,
+                 std::uint32_t samplesCount) noexcept;
+
+    //!!
+    //! \brief Decodes the next sample.
+    //!
+    //! \param[out] sample The decoded sample.
+    //! \return False if all the samples have been decoded.
+    //! \throw std::out_of_range if the bytes are truncated.
+    //!
+    [[nodiscard]] bool next(Sample& sample);
+
+private:
+    BitReader m_reader;
+    std::uint32_t m_samplesCount;
+    std::uint32_t m_decodedSamplesCount{};
+    std::uint64_t m_lastTimestamp{};
+    std::uint64_t m_lastDelta{};
+    std::uint64_t m_lastValueBits{};
+    unsigned m_leadingZeros{};
+    unsigned m_trailingZeros{};
+
+    [[nodiscard]] std::uint64_t read_delta_of_delta();
+    [[nodiscard]] std::uint64_t read_value_bits();
+};
+
+} // namespace gc::timeseries
@@ -0,0 +1,174 @@
+// Copyright (c) 2023 Andrea Ballestrazzi
+#pragma once
+
+#include "timeseries/aggregate.hpp"
+#include "timeseries/sample.hpp"
+#include "timeseries/time-series-store.hpp"
+
+// C++ STL
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <functional>
+#include <limits>
+#include <map>
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace gc::timeseries {
+
+//!!
+//! \brief The resolutions kept by a RollupEngine, from the finest to the coarsest.
+//!
+enum class Resolution : std::uint8_t {
+    Raw,
+    Minute,
+    Hour,
+    Day
+};
+
+//! \return The duration of the intervals of a resolution in milliseconds, zero for Raw.
+[[nodiscard]] constexpr timestamp_type GetResolutionDuration(const Resolution resolution) noexcept {
+    switch (resolution) {
+    case Resolution::Minute:
+        return 60'000;
+    case Resolution::Hour:
+        return 3'600'000;
+    case Resolution::Day:
+        return 86'400'000;
+    case Resolution::Raw:
+    default:
+        return 0;
+    }
+}
+
+struct RollupOptions {
+    //! How long the raw samples are kept, in milliseconds. Zero keeps them forever.
+    timestamp_type rawRetention{7 * GetResolutionDuration(Resolution::Day)};
+    //! How long the 1-minute aggregates are kept, in milliseconds. Zero keeps them forever.
+    timestamp_type minuteRetention{90 * GetResolutionDuration(Resolution::Day)};
+    //! The options of the store of every resolution.
+    StoreOptions storeOptions{};
+};
+
+struct RollupQueryResult {
+    //! The resolution the query has been served from.
+    Resolution resolution{};
+    //! The aggregates in timestamp order. The raw samples have an aggregate of one sample.
+    std::vector<AggregateSample> samples{};
+};
+
+//!!
+//! \brief Stores time series together with their 1-minute, 1-hour and 1-day aggregates, and
+//!  serves the queries from the coarsest resolution that satisfies them.
+//!
+//!  The timestamps are the milliseconds since the epoch and the intervals are aligned to it,
+//!  so the days are UTC days. Every resolution is a TimeSeriesStore in its own directory,
+//!  where each series is split in the min, max, sum and count series.
+//!
+//!  The aggregation is incremental: every sample is added to the open minute of its series,
+//!  and a closed interval is written and merged into the open interval of the next
+//!  resolution, so the stored data is never read again. On flush() the open intervals are
+//!  written as they are and restarted empty: the queries merge the aggregates of the same
+//!  interval, so that a restart doesn't lose the partial intervals.
+//!
+//!  The old raw samples and 1-minute aggregates are deleted every hour of samples, following
+//!  the retention policy of RollupOptions. The NaN values are stored as raw samples but are
+//!  not aggregated.
+//!
+//!  The engine is not thread-safe.
+//!
+class RollupEngine final {
+public:
+    //!!
+    //! \brief Opens the stores of the resolutions in the given directory, creating them if
+    //!  needed.
+    //!
+    //! \throw std::filesystem::filesystem_error if the directories can't be created.
+    //!
+    explicit RollupEngine(const std::filesystem::path& rootDirectory, RollupOptions options = {});
+
+    //!!
+    //! \brief Writes the open intervals. The write errors are ignored.
+    //!
+    ~RollupEngine() noexcept;
+
+    RollupEngine(const RollupEngine&) = delete;
+    RollupEngine& operator=(const RollupEngine&) = delete;
+
+    //!!
+    //! \brief Appends a sample to a series and updates its aggregates.
+    //!
+    //! \throw std::invalid_argument if the name is invalid or the timestamp is less than the
+    //!  last one of the series.
+    //! \throw std::system_error if the samples can't be written.
+    //!
+    void append(std::string_view series, timestamp_type timestamp, double value);
+
+    //!!
+    //! \brief Writes the open intervals and the buffered samples of all the series.
+    //!
+    //! \throw std::system_error if the samples can't be written.
+    //!
+    void flush();
+
+    //!!
+    //! \brief Queries the aggregates of a series in [from, to]. The query is served from the
+    //!  coarsest resolution whose intervals are not longer than the step, or from a coarser
+    //!  one if that resolution doesn't reach back to the start of the range anymore. The open
+    //!  intervals are included.
+    //!
+    //! \param[in] step The longest interval the caller accepts, e.g. the duration of a pixel
+    //!  of a chart. Zero requests the raw samples.
+    //! \throw std::invalid_argument if the name of the series is invalid.
+    //! \throw std::system_error if the stored data can't be read.
+    //!
+    [[nodiscard]] RollupQueryResult query(std::string_view series, timestamp_type from,
+                                          timestamp_type to, timestamp_type step);
+
+    //!!
+    //! \brief Deletes the raw samples and the 1-minute aggregates of all the series that are
+    //!  older than their retention.
+    //!
+    //! \param[in] now The current timestamp.
+    //!
+    void applyRetention(timestamp_type now);
+
+private:
+    static constexpr std::size_t RESOLUTIONS_COUNT{4};
+    //! The resolutions with an open interval: minute, hour and day.
+    static constexpr std::size_t AGGREGATED_RESOLUTIONS_COUNT{RESOLUTIONS_COUNT - 1};
+
+    struct OpenInterval {
+        timestamp_type start{};
+        Aggregate aggregate{};
+        bool bOpen{};
+    };
+
+    struct SeriesRollup {
+        std::array<OpenInterval, AGGREGATED_RESOLUTIONS_COUNT> intervals{};
+        //! The hour of the last retention check.
+        timestamp_type retentionHour{std::numeric_limits<timestamp_type>::min()};
+    };
+
+    RollupOptions m_options;
+    std::array<std::unique_ptr<TimeSeriesStore>, RESOLUTIONS_COUNT> m_stores{};
+    std::map<std::string, SeriesRollup, std::less<>> m_series{};
+
+    [[nodiscard]] TimeSeriesStore& get_store(Resolution resolution) noexcept;
+    void write_interval(std::string_view series, std::size_t intervalIndex,
+                        SeriesRollup& seriesRollup);
+    [[nodiscard]] std::optional<timestamp_type> get_first_timestamp(std::string_view series,
+                                                                    Resolution resolution);
+    [[nodiscard]] Resolution select_resolution(std::string_view series, timestamp_type from,
+                                               timestamp_type step);
+    void read_aggregates(std::string_view series, Resolution resolution, timestamp_type from,
+                         timestamp_type to, std::vector<AggregateSample>& samples);
+    void apply_series_retention(std::string_view series, timestamp_type now);
+};
+
+} // namespace gc::timeseries
@@ -0,0 +1,20 @@
+// Copyright (c) 2023 Andrea Ballestrazzi
+#pragma once
+
+// C++ STL
+#include <cstdint>
+
+namespace gc::timeseries {
+
+//! The timestamps of the samples, e.g. the milliseconds since the epoch. The store doesn't
+//! depend on their unit, but the compression is best when they are regular.
+using timestamp_type = std::int64_t;
+
+struct Sample {
+    timestamp_type timestamp{};
+    double value{};
+
+    [[nodiscard]] friend bool operator==(const Sample&, const Sample&) noexcept = default;
+};
+
+} // namespace gc::timeseries
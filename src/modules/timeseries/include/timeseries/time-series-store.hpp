@@ -0,0 +1,134 @@
+// Copyright (c) 2023 Andrea Ballestrazzi
+#pragma once
+
+#include "timeseries/gorilla-chunk.hpp"
+#include "timeseries/sample.hpp"
+
+// C++ STL
+#include <cstdint>
+#include <filesystem>
+#include <functional>
+#include <map>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace gc::timeseries {
+
+//! \return True if the name can be used for a series: letters, digits, '_', '-' and '.' only.
+[[nodiscard]] bool IsValidSeriesName(std::string_view series) noexcept;
+
+struct StoreOptions {
+    //! The samples after which a series continues in a new chunk file.
+    std::uint32_t maxSamplesPerChunk{4096};
+    //! The samples buffered by a series before they are written to its chunk file.
+    std::uint32_t flushThreshold{256};
+};
+
+//!!
+//! \brief An append-only store of numeric time series, e.g. the sensor readings.
+//!
+//!  Every series is a directory of chunk files, each one holding up to
+//!  StoreOptions::maxSamplesPerChunk samples compressed by a ChunkEncoder. The samples are
+//!  buffered in memory and appended to the last chunk file every
+//!  StoreOptions::flushThreshold samples, on flush() and on destruction. To spare the SD card,
+//!  a chunk file is synced only once it's complete: the samples buffered or not yet written
+//!  back by the system are lost on power failures. The last chunk of a series may then be
+//!  truncated, and it's read up to its last complete sample.
+//!
+//!  The range queries map the chunk files in memory and skip the ones outside the range by
+//!  reading their header only. The chunk files that can't be read are skipped.
+//!
+//!  The store is not thread-safe and a directory must be opened by one store at a time.
+//!
+class TimeSeriesStore final {
+public:
+    //!!
+    //! \brief Opens the store in the given directory, creating it if needed. The series
+    //!  already in the directory are continued in new chunk files.
+    //!
+    //! \throw std::filesystem::filesystem_error if the directory can't be created.
+    //!
+    explicit TimeSeriesStore(std::filesystem::path rootDirectory, StoreOptions options = {});
+
+    //!!
+    //! \brief Writes the buffered samples. The write errors are ignored.
+    //!
+    ~TimeSeriesStore() noexcept;
+
+    TimeSeriesStore(const TimeSeriesStore&) = delete;
+    TimeSeriesStore& operator=(const TimeSeriesStore&) = delete;
+
+    //!!
+    //! \brief Appends a sample to a series, creating the series if needed.
+    //!
+    //! \param[in] series The name of the series: letters, digits, '_', '-' and '.' only.
+    //! \throw std::invalid_argument if the name is invalid or the timestamp is less than the
+    //!  last one of the series.
+    //! \throw std::system_error if the buffered samples can't be written, or a complete chunk
+    //!  can't be synced.
+    //!
+    void append(std::string_view series, timestamp_type timestamp, double value);
+
+    //!!
+    //! \brief Writes the buffered samples of all the series to their chunk files.
+    //!
+    //! \throw std::system_error if the samples can't be written.
+    //!
+    void flush();
+
+    //!!
+    //! \brief Appends the samples of a series with a timestamp in [from, to] to a vector, in
+    //!  timestamp order. The buffered samples of the series are written first.
+    //!
+    //! \throw std::invalid_argument if the name of the series is invalid.
+    //! \throw std::system_error if the buffered samples can't be written.
+    //!
+    void query(std::string_view series, timestamp_type from, timestamp_type to,
+               std::vector<Sample>& samples);
+
+    [[nodiscard]] std::vector<Sample> query(std::string_view series, timestamp_type from,
+                                            timestamp_type to);
+
+    //!!
+    //! \brief Retrieves the timestamp of the oldest sample of a series that is still stored.
+    //!
+    //! \return The timestamp, or std::nullopt if the series has no samples.
+    //! \throw std::invalid_argument if the name of the series is invalid.
+    //!
+    [[nodiscard]] std::optional<timestamp_type> getFirstTimestamp(std::string_view series);
+
+    //!!
+    //! \brief Deletes the chunk files of a series whose samples all precede a timestamp. The
+    //!  chunks are deleted as a whole, so some older samples may be kept, and the chunk that
+    //!  is being appended and the unreadable ones are never deleted.
+    //!
+    //! \return The number of deleted samples.
+    //! \throw std::invalid_argument if the name of the series is invalid.
+    //!
+    std::uint64_t removeBefore(std::string_view series, timestamp_type timestamp);
+
+    //! \return The names of the series in the store, sorted.
+    [[nodiscard]] std::vector<std::string> listSeries() const;
+
+private:
+    struct SeriesState {
+        std::filesystem::path directory{};
+        std::uint32_t chunkIndex{};
+        ChunkEncoder encoder{};
+        //! The bits of the encoder already written to the chunk file.
+        std::uint64_t writtenBitsCount{};
+        bool bHasSamples{};
+        timestamp_type lastTimestamp{};
+    };
+
+    std::filesystem::path m_rootDirectory;
+    StoreOptions m_options;
+    std::map<std::string, SeriesState, std::less<>> m_series{};
+
+    [[nodiscard]] SeriesState& get_series(std::string_view series);
+    void flush_series(SeriesState& seriesState);
+};
+
+} // namespace gc::timeseries
@@ -0,0 +1,191 @@
+// Copyright (c) 2023 Andrea Ballestrazzi
+#include "chunk-file.hpp"
+
+#include <posix-io/file-io.hpp>
+#include <posix-io/system-error.hpp>
+
+// C++ STL
+#include <array>
+#include <charconv>
+#include <stdexcept>
+#include <string_view>
+
+// POSIX
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace gc::timeseries {
+
+namespace {
+
+using posix_io::FileDescriptorGuard;
+using posix_io::LoadField;
+using posix_io::StoreField;
+using posix_io::ThrowSystemError;
+using posix_io::WriteAll;
+
+constexpr std::string_view CHUNK_FILE_PREFIX{"chunk-"};
+constexpr std::string_view CHUNK_FILE_EXTENSION{".gcts"};
+//! The digits of the largest uint32_t, so that the names are sorted like the indices.
+constexpr std::size_t CHUNK_INDEX_DIGITS{10};
+constexpr std::size_t CHUNK_FILE_NAME_SIZE{CHUNK_FILE_PREFIX.size() + CHUNK_INDEX_DIGITS +
+                                           CHUNK_FILE_EXTENSION.size()};
+constexpr const char* CHUNK_WRITE_ERROR{"Unable to write the chunk file"};
+
+// The offsets of the header fields. The 16 bits after the version and the 32 bits after the
+// samples count are reserved.
+constexpr std::size_t MAGIC_OFFSET{0};
+constexpr std::size_t VERSION_OFFSET{4};
+constexpr std::size_t SAMPLES_COUNT_OFFSET{8};
+constexpr std::size_t FIRST_TIMESTAMP_OFFSET{16};
+constexpr std::size_t LAST_TIMESTAMP_OFFSET{24};
+constexpr std::size_t BITS_COUNT_OFFSET{32};
+
+[[nodiscard]] ChunkHeader ReadHeaderFields(std::span<const std::uint8_t> fileBytes) {
+    if (fileBytes.size() < ChunkHeader::SIZE ||
+        LoadField<std::uint32_t>(fileBytes, MAGIC_OFFSET) != ChunkHeader::MAGIC)
+        throw std::runtime_error{"The file is not a chunk file."};
+
+    if (LoadField<std::uint16_t>(fileBytes, VERSION_OFFSET) != ChunkHeader::VERSION)
+        throw std::runtime_error{"The chunk file version is not supported."};
+
+    ChunkHeader header{};
+    header.samplesCount = LoadField<std::uint32_t>(fileBytes, SAMPLES_COUNT_OFFSET);
+    header.firstTimestamp = LoadField<timestamp_type>(fileBytes, FIRST_TIMESTAMP_OFFSET);
+    header.lastTimestamp = LoadField<timestamp_type>(fileBytes, LAST_TIMESTAMP_OFFSET);
+    header.bitsCount = LoadField<std::uint64_t>(fileBytes, BITS_COUNT_OFFSET);
+    return header;
+}
+
+//! \return The bits of encoded samples stored after the header of a chunk file.
+[[nodiscard]] std::uint64_t GetStoredBitsCount(std::span<const std::uint8_t> fileBytes) noexcept {
+    return static_cast<std::uint64_t>(fileBytes.size() - ChunkHeader::SIZE) * 8;
+}
+
+} // namespace
+
+std::string GetChunkFileName(const std::uint32_t chunkIndex) {
+    std::array<char, CHUNK_INDEX_DIGITS> digits{};
+    const char* const digitsEnd{
+        std::to_chars(digits.data(), digits.data() + digits.size(), chunkIndex).ptr};
+    const auto digitsCount{static_cast<std::size_t>(digitsEnd - digits.data())};
+
+    std::string fileName{CHUNK_FILE_PREFIX};
+    if (digitsCount < CHUNK_INDEX_DIGITS)
+        fileName.append(CHUNK_INDEX_DIGITS - digitsCount, '0');
+
+    fileName.append(digits.data(), digitsCount).append(CHUNK_FILE_EXTENSION);
+    return fileName;
+}
+
+bool ParseChunkFileName(const std::string& fileName, std::uint32_t& chunkIndex) {
+    const std::string_view name{fileName};
+    if (name.size() != CHUNK_FILE_NAME_SIZE || !name.starts_with(CHUNK_FILE_PREFIX) ||
+        !name.ends_with(CHUNK_FILE_EXTENSION))
+        return false;
+
+    const char* const digitsBegin{name.data() + CHUNK_FILE_PREFIX.size()};
+    const char* const digitsEnd{digitsBegin + CHUNK_INDEX_DIGITS};
+    const auto [end, errorCode]{std::from_chars(digitsBegin, digitsEnd, chunkIndex)};
+
+    return errorCode == std::errc{} && end == digitsEnd;
+}
+
+void WriteChunkFile(const std::filesystem::path& filePath, const ChunkEncoder& encoder,
+                    const std::uint64_t writtenBitsCount) {
+    const int fileDescriptor{::open(filePath.c_str(), O_WRONLY | O_CREAT | O_CLOEXEC, 0644)};
+    if (fileDescriptor < 0)
+        ThrowSystemError("Unable to open the chunk file");
+
+    const FileDescriptorGuard fileDescriptorGuard{fileDescriptor};
+
+    // The last byte written before may have been partial, so it's written again.
+    const std::vector<std::uint8_t>& bytes{encoder.getBytes()};
+    const std::size_t firstByte{static_cast<std::size_t>(writtenBitsCount / 8)};
+    if (firstByte < bytes.size()) {
+        WriteAll(fileDescriptor, bytes.data() + firstByte, bytes.size() - firstByte,
+                 static_cast<off_t>(ChunkHeader::SIZE + firstByte), CHUNK_WRITE_ERROR);
+    }
+
+    std::array<std::uint8_t, ChunkHeader::SIZE> headerBytes{};
+    StoreField(headerBytes, MAGIC_OFFSET, ChunkHeader::MAGIC);
+    StoreField(headerBytes, VERSION_OFFSET, ChunkHeader::VERSION);
+    StoreField(headerBytes, SAMPLES_COUNT_OFFSET, encoder.getSamplesCount());
+    StoreField(headerBytes, FIRST_TIMESTAMP_OFFSET, encoder.getFirstTimestamp());
+    StoreField(headerBytes, LAST_TIMESTAMP_OFFSET, encoder.getLastTimestamp());
+    StoreField(headerBytes, BITS_COUNT_OFFSET, encoder.getBitsCount());
+
+    WriteAll(fileDescriptor, headerBytes.data(), headerBytes.size(), 0, CHUNK_WRITE_ERROR);
+}
+
+void SyncChunkFile(const std::filesystem::path& filePath) {
+    const int fileDescriptor{::open(filePath.c_str(), O_WRONLY | O_CLOEXEC)};
+    if (fileDescriptor < 0)
+        ThrowSystemError("Unable to open the chunk file");
+
+    const FileDescriptorGuard fileDescriptorGuard{fileDescriptor};
+    if (::fdatasync(fileDescriptor) != 0)
+        ThrowSystemError("Unable to sync the chunk file");
+}
+
+MappedFile::MappedFile(const std::filesystem::path& filePath) {
+    const int fileDescriptor{::open(filePath.c_str(), O_RDONLY | O_CLOEXEC)};
+    if (fileDescriptor < 0)
+        ThrowSystemError("Unable to open the chunk file");
+
+    // The mapping stays valid after the descriptor is closed.
+    const FileDescriptorGuard fileDescriptorGuard{fileDescriptor};
+
+    struct stat fileStatus {};
+    if (::fstat(fileDescriptor, &fileStatus) != 0)
+        ThrowSystemError("Unable to read the size of the chunk file");
+
+    m_size = static_cast<std::size_t>(fileStatus.st_size);
+    if (m_size == 0)
+        return;
+
+    void* const data{::mmap(nullptr, m_size, PROT_READ, MAP_PRIVATE, fileDescriptor, 0)};
+    if (data == MAP_FAILED)
+        ThrowSystemError("Unable to map the chunk file");
+
+    m_data = static_cast<const std::uint8_t*>(data);
+}
+
+MappedFile::~MappedFile() noexcept {
+    if (m_data != nullptr)
+        ::munmap(const_cast<std::uint8_t*>(m_data), m_size);
+}
+
+ChunkHeader ReadChunkHeader(std::span<const std::uint8_t> fileBytes) {
+    const ChunkHeader header{ReadHeaderFields(fileBytes)};
+    if (GetStoredBitsCount(fileBytes) < header.bitsCount)
+        throw std::runtime_error{"The chunk file is truncated."};
+
+    return header;
+}
+
+ChunkHeader RecoverChunkHeader(std::span<const std::uint8_t> fileBytes) {
+    ChunkHeader header{ReadHeaderFields(fileBytes)};
+    if (GetStoredBitsCount(fileBytes) >= header.bitsCount)
+        return header;
+
+    // The samples are decoded up to the first one that isn't complete in the file.
+    header.bitsCount = GetStoredBitsCount(fileBytes);
+    ChunkDecoder decoder{fileBytes.subspan(ChunkHeader::SIZE), header.bitsCount,
+                         header.samplesCount};
+
+    std::uint32_t completeSamplesCount{};
+    try {
+        for (Sample sample{}; decoder.next(sample); ++completeSamplesCount)
+            header.lastTimestamp = sample.timestamp;
+    } catch (const std::out_of_range&) {
+        // The end of the stored bits.
+    }
+
+    header.samplesCount = completeSamplesCount;
+    return header;
+}
+
+} // namespace gc::timeseries
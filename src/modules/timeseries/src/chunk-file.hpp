@@ -0,0 +1,93 @@
+// Copyright (c) 2023 Andrea Ballestrazzi
+#pragma once
+
+#include "timeseries/gorilla-chunk.hpp"
+#include "timeseries/sample.hpp"
+
+// C++ STL
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <span>
+#include <string>
+
+namespace gc::timeseries {
+
+//!!
+//! \brief The header at the start of every chunk file, followed by the encoded samples. All
+//!  the fields are in the byte order of the host.
+//!
+struct ChunkHeader {
+    static constexpr std::uint32_t MAGIC{0x53544347}; // "GCTS"
+    static constexpr std::uint16_t VERSION{1};
+    static constexpr std::size_t SIZE{40};
+
+    std::uint32_t samplesCount{};
+    timestamp_type firstTimestamp{};
+    timestamp_type lastTimestamp{};
+    std::uint64_t bitsCount{};
+};
+
+//! \return The name of the chunk file with the given index, e.g. "chunk-0000000012.gcts".
+[[nodiscard]] std::string GetChunkFileName(std::uint32_t chunkIndex);
+
+//! \return True if the name is the one of a chunk file, storing its index.
+[[nodiscard]] bool ParseChunkFileName(const std::string& fileName, std::uint32_t& chunkIndex);
+
+//!!
+//! \brief Writes the samples of a chunk encoded after the given bit, then the header. The
+//!  header is written last, so that it never accounts for samples that aren't in the file.
+//!
+//! \param[in] filePath The path of the chunk file, created if it doesn't exist.
+//! \param[in] encoder The encoder of the chunk.
+//! \param[in] writtenBitsCount The bits of the chunk already written to the file.
+//! \throw std::system_error if the file can't be written.
+//!
+void WriteChunkFile(const std::filesystem::path& filePath, const ChunkEncoder& encoder,
+                    std::uint64_t writtenBitsCount);
+
+//!!
+//! \brief Flushes the written chunk file to the storage, so that it survives a power failure.
+//!
+//! \throw std::system_error if the file can't be synced.
+//!
+void SyncChunkFile(const std::filesystem::path& filePath);
+
+//!!
+//! \brief A file mapped in memory for reading. The mapping is released on destruction.
+//!
+class MappedFile final {
+public:
+    //! \throw std::system_error if the file can't be opened or mapped.
+    explicit MappedFile(const std::filesystem::path& filePath);
+    ~MappedFile() noexcept;
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    [[nodiscard]] std::span<const std::uint8_t> getBytes() const noexcept {
+        return {m_data, m_size};
+    }
+
+private:
+    const std::uint8_t* m_data{};
+    std::size_t m_size{};
+};
+
+//!!
+//! \brief Reads the header at the start of the bytes of a chunk file.
+//!
+//! \throw std::runtime_error if the header is invalid or the encoded samples are truncated.
+//!
+[[nodiscard]] ChunkHeader ReadChunkHeader(std::span<const std::uint8_t> fileBytes);
+
+//!!
+//! \brief Reads the header of a chunk file whose encoded samples may be truncated, e.g. by a
+//!  power failure before they were written back while the header was. The counts of a
+//!  truncated chunk are clamped to the samples that are complete in the file.
+//!
+//! \throw std::runtime_error if the header is invalid.
+//!
+[[nodiscard]] ChunkHeader RecoverChunkHeader(std::span<const std::uint8_t> fileBytes);
+
+} // namespace gc::timeseries
@@ -0,0 +1,175 @@
+// Copyright (c) 2023 Andrea Ballestrazzi
+#include "timeseries/gorilla-chunk.hpp"
+
+// C++ STL
+#include <algorithm>
+#include <bit>
+
+namespace gc::timeseries {
+
+namespace {
+
+//!!
+//! \brief The variable-length fields of the delta-of-delta timestamps: the control bits that
+//!  select the field, their count, the bits of the biased value and the smallest value the
+//!  field can hold. The values that don't fit any field are stored in 64 bits.
+//!
+struct DeltaOfDeltaField {
+    std::uint64_t controlBits{};
+    unsigned controlBitsCount{};
+    unsigned valueBitsCount{};
+    std::int64_t minValue{};
+};
+
+constexpr DeltaOfDeltaField DOD_FIELDS[]{
+    {0b10,   2, 7,  -63  },
+    {0b110,  3, 9,  -255 },
+    {0b1110, 4, 12, -2047},
+};
+
+constexpr std::uint64_t DOD_RAW_CONTROL_BITS{0b1111};
+constexpr unsigned DOD_RAW_CONTROL_BITS_COUNT{4};
+
+//! The leading zeros count is stored in 5 bits.
+constexpr unsigned MAX_STORED_LEADING_ZEROS{31};
+
+} // namespace
+
+void ChunkEncoder::append(const Sample& sample) {
+    append_timestamp(sample.timestamp);
+    append_value(sample.value);
+
+    if (m_samplesCount == 0)
+        m_firstTimestamp = sample.timestamp;
+
+    m_lastTimestamp = sample.timestamp;
+    ++m_samplesCount;
+}
+
+void ChunkEncoder::append_timestamp(const timestamp_type timestamp) {
+    if (m_samplesCount == 0) {
+        m_writer.writeBits(static_cast<std::uint64_t>(timestamp), 64);
+        return;
+    }
+
+    // The arithmetic is unsigned, so that any pair of timestamps wraps around losslessly.
+    const std::uint64_t delta{static_cast<std::uint64_t>(timestamp) -
+                              static_cast<std::uint64_t>(m_lastTimestamp)};
+    const auto deltaOfDelta{static_cast<std::int64_t>(delta - m_lastDelta)};
+    m_lastDelta = delta;
+
+    if (deltaOfDelta == 0) {
+        m_writer.writeBit(false);
+        return;
+    }
+
+    for (const DeltaOfDeltaField& field : DOD_FIELDS) {
+        const std::int64_t maxValue{field.minValue +
+                                    static_cast<std::int64_t>((1U << field.valueBitsCount) - 1)};
+        if (deltaOfDelta >= field.minValue && deltaOfDelta <= maxValue) {
+            m_writer.writeBits(field.controlBits, field.controlBitsCount);
+            m_writer.writeBits(static_cast<std::uint64_t>(deltaOfDelta - field.minValue),
+                               field.valueBitsCount);
+            return;
+        }
+    }
+
+    m_writer.writeBits(DOD_RAW_CONTROL_BITS, DOD_RAW_CONTROL_BITS_COUNT);
+    m_writer.writeBits(static_cast<std::uint64_t>(deltaOfDelta), 64);
+}
+
+void ChunkEncoder::append_value(const double value) {
+    const auto valueBits{std::bit_cast<std::uint64_t>(value)};
+    if (m_samplesCount == 0) {
+        m_writer.writeBits(valueBits, 64);
+        m_lastValueBits = valueBits;
+        return;
+    }
+
+    const std::uint64_t xorBits{valueBits ^ m_lastValueBits};
+    m_lastValueBits = valueBits;
+
+    if (xorBits == 0) {
+        m_writer.writeBit(false);
+        return;
+    }
+
+    m_writer.writeBit(true);
+
+    const unsigned leadingZeros{
+        std::min(static_cast<unsigned>(std::countl_zero(xorBits)), MAX_STORED_LEADING_ZEROS)};
+    const auto trailingZeros{static_cast<unsigned>(std::countr_zero(xorBits))};
+
+    // The meaningful bits fit in the previous window: only them are stored.
+    if (m_leadingZeros != 64 && leadingZeros >= m_leadingZeros &&
+        trailingZeros >= m_trailingZeros) {
+        m_writer.writeBit(false);
+        m_writer.writeBits(xorBits >> m_trailingZeros, 64 - m_leadingZeros - m_trailingZeros);
+        return;
+    }
+
+    const unsigned meaningfulBitsCount{64 - leadingZeros - trailingZeros};
+    m_writer.writeBit(true);
+    m_writer.writeBits(leadingZeros, 5);
+    m_writer.writeBits(meaningfulBitsCount - 1, 6);
+    m_writer.writeBits(xorBits >> trailingZeros, meaningfulBitsCount);
+
+    m_leadingZeros = leadingZeros;
+    m_trailingZeros = trailingZeros;
+}
+
+ChunkDecoder::ChunkDecoder(std::span<const std::uint8_t> bytes, const std::uint64_t bitsCount,
+                           const std::uint32_t samplesCount) noexcept
+    : m_reader{bytes, bitsCount},
+      m_samplesCount{samplesCount} {}
+
+bool ChunkDecoder::next(Sample& sample) {
+    if (m_decodedSamplesCount == m_samplesCount)
+        return false;
+
+    if (m_decodedSamplesCount == 0) {
+        m_lastTimestamp = m_reader.readBits(64);
+        m_lastValueBits = m_reader.readBits(64);
+    } else {
+        m_lastDelta += read_delta_of_delta();
+        m_lastTimestamp += m_lastDelta;
+        m_lastValueBits ^= read_value_bits();
+    }
+
+    sample.timestamp = static_cast<timestamp_type>(m_lastTimestamp);
+    sample.value = std::bit_cast<double>(m_lastValueBits);
+    ++m_decodedSamplesCount;
+
+    return true;
+}
+
+std::uint64_t ChunkDecoder::read_delta_of_delta() {
+    if (!m_reader.readBit())
+        return 0;
+
+    for (const DeltaOfDeltaField& field : DOD_FIELDS) {
+        // The control bits are a sequence of ones terminated by a zero.
+        if (!m_reader.readBit()) {
+            const auto biasedValue{static_cast<std::int64_t>(m_reader.readBits(
+                field.valueBitsCount))};
+            return static_cast<std::uint64_t>(biasedValue + field.minValue);
+        }
+    }
+
+    return m_reader.readBits(64);
+}
+
+std::uint64_t ChunkDecoder::read_value_bits() {
+    if (!m_reader.readBit())
+        return 0;
+
+    if (m_reader.readBit()) {
+        m_leadingZeros = static_cast<unsigned>(m_reader.readBits(5));
+        const unsigned meaningfulBitsCount{static_cast<unsigned>(m_reader.readBits(6)) + 1};
+        m_trailingZeros = 64 - m_leadingZeros - meaningfulBitsCount;
+    }
+
+    return m_reader.readBits(64 - m_leadingZeros - m_trailingZeros) << m_trailingZeros;
+}
+
+} // namespace gc::timeseries
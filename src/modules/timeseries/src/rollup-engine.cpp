@@ -0,0 +1,262 @@
+// Copyright (c) 2023 Andrea Ballestrazzi
+#include "timeseries/rollup-engine.hpp"
+
+// C++ STL
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+namespace gc::timeseries {
+
+namespace {
+
+constexpr std::array<std::string_view, 4> STORE_DIRECTORIES{"raw", "1m", "1h", "1d"};
+
+//! The suffixes of the series that hold the fields of the aggregates.
+constexpr std::array<std::string_view, 4> AGGREGATE_FIELDS{".min", ".max", ".sum", ".count"};
+
+[[nodiscard]] constexpr Resolution GetIntervalResolution(const std::size_t intervalIndex) noexcept {
+    return static_cast<Resolution>(intervalIndex + 1);
+}
+
+//! \return The start of the interval of the given duration that holds the timestamp.
+[[nodiscard]] constexpr timestamp_type GetIntervalStart(const timestamp_type timestamp,
+                                                        const timestamp_type duration) noexcept {
+    const timestamp_type remainder{timestamp % duration};
+    return remainder < 0 ? timestamp - remainder - duration : timestamp - remainder;
+}
+
+[[nodiscard]] std::string GetFieldSeriesName(std::string_view series, std::string_view field) {
+    std::string fieldSeries{series};
+    fieldSeries.append(field);
+    return fieldSeries;
+}
+
+void ValidateSeriesName(std::string_view series) {
+    if (!IsValidSeriesName(series))
+        throw std::invalid_argument{"The series name is invalid."};
+}
+
+//!!
+//! \brief Appends an aggregate, merging it into the last one if they are of the same interval,
+//!  as it happens for the intervals written by flush().
+//!
+void AppendAggregateSample(std::vector<AggregateSample>& samples,
+                           const AggregateSample& sample) {
+    if (!samples.empty() && samples.back().timestamp == sample.timestamp) {
+        samples.back().aggregate.merge(sample.aggregate);
+    } else {
+        samples.push_back(sample);
+    }
+}
+
+} // namespace
+
+RollupEngine::RollupEngine(const std::filesystem::path& rootDirectory, RollupOptions options)
+    : m_options{options} {
+    for (std::size_t i{}; i < RESOLUTIONS_COUNT; ++i) {
+        m_stores[i] = std::make_unique<TimeSeriesStore>(rootDirectory / STORE_DIRECTORIES[i],
+                                                        m_options.storeOptions);
+    }
+}
+
+RollupEngine::~RollupEngine() noexcept {
+    try {
+        flush();
+    } catch (...) {
+        // Nothing can be done from a destructor.
+    }
+}
+
+void RollupEngine::append(std::string_view series, const timestamp_type timestamp,
+                          const double value) {
+    // The raw store validates the name and the timestamp before any interval is touched.
+    get_store(Resolution::Raw).append(series, timestamp, value);
+    if (std::isnan(value))
+        return;
+
+    auto seriesIt{m_series.find(series)};
+    if (seriesIt == m_series.end())
+        seriesIt = m_series.emplace(std::string{series}, SeriesRollup{}).first;
+
+    SeriesRollup& seriesRollup{seriesIt->second};
+
+    // The finer intervals are closed first, so that they are merged into the coarser ones
+    // before those are closed too.
+    for (std::size_t i{}; i < AGGREGATED_RESOLUTIONS_COUNT; ++i) {
+        OpenInterval& interval{seriesRollup.intervals[i]};
+        const timestamp_type intervalStart{
+            GetIntervalStart(timestamp, GetResolutionDuration(GetIntervalResolution(i)))};
+
+        if (interval.bOpen && interval.start != intervalStart)
+            write_interval(series, i, seriesRollup);
+
+        interval.start = intervalStart;
+        interval.bOpen = true;
+    }
+
+    seriesRollup.intervals.front().aggregate.add(value);
+
+    constexpr std::size_t HOUR_INTERVAL_INDEX{static_cast<std::size_t>(Resolution::Hour) - 1};
+    const timestamp_type currentHour{seriesRollup.intervals[HOUR_INTERVAL_INDEX].start};
+    if (currentHour != seriesRollup.retentionHour) {
+        seriesRollup.retentionHour = currentHour;
+        apply_series_retention(series, timestamp);
+    }
+}
+
+void RollupEngine::flush() {
+    for (auto& [series, seriesRollup] : m_series) {
+        for (std::size_t i{}; i < AGGREGATED_RESOLUTIONS_COUNT; ++i)
+            write_interval(series, i, seriesRollup);
+    }
+
+    for (const std::unique_ptr<TimeSeriesStore>& store : m_stores)
+        store->flush();
+}
+
+RollupQueryResult RollupEngine::query(std::string_view series, const timestamp_type from,
+                                      const timestamp_type to, const timestamp_type step) {
+    ValidateSeriesName(series);
+
+    RollupQueryResult result{};
+    result.resolution = select_resolution(series, from, step);
+    if (from > to)
+        return result;
+
+    if (result.resolution == Resolution::Raw) {
+        for (const Sample& sample : get_store(Resolution::Raw).query(series, from, to)) {
+            const Aggregate aggregate{sample.value, sample.value, sample.value, 1};
+            result.samples.push_back(AggregateSample{sample.timestamp, aggregate});
+        }
+
+        return result;
+    }
+
+    // The interval that holds the start of the range is included.
+    const timestamp_type firstIntervalStart{
+        GetIntervalStart(from, GetResolutionDuration(result.resolution))};
+    read_aggregates(series, result.resolution, firstIntervalStart, to, result.samples);
+
+    const auto seriesIt{m_series.find(series)};
+    if (seriesIt == m_series.end())
+        return result;
+
+    // The open interval hasn't been written yet, and neither have the finer ones inside it.
+    const auto intervalIndex{static_cast<std::size_t>(result.resolution) - 1};
+    const OpenInterval& openInterval{seriesIt->second.intervals[intervalIndex]};
+    if (!openInterval.bOpen || openInterval.start < firstIntervalStart || openInterval.start > to)
+        return result;
+
+    Aggregate openAggregate{};
+    for (std::size_t i{}; i <= intervalIndex; ++i)
+        openAggregate.merge(seriesIt->second.intervals[i].aggregate);
+
+    if (openAggregate.count > 0)
+        AppendAggregateSample(result.samples, AggregateSample{openInterval.start, openAggregate});
+
+    return result;
+}
+
+void RollupEngine::applyRetention(const timestamp_type now) {
+    for (const std::string& series : get_store(Resolution::Raw).listSeries())
+        apply_series_retention(series, now);
+}
+
+TimeSeriesStore& RollupEngine::get_store(const Resolution resolution) noexcept {
+    return *m_stores[static_cast<std::size_t>(resolution)];
+}
+
+void RollupEngine::write_interval(std::string_view series, const std::size_t intervalIndex,
+                                  SeriesRollup& seriesRollup) {
+    OpenInterval& interval{seriesRollup.intervals[intervalIndex]};
+    if (interval.aggregate.count == 0)
+        return;
+
+    const Aggregate& aggregate{interval.aggregate};
+    const std::array<double, AGGREGATE_FIELDS.size()> fields{
+        aggregate.min, aggregate.max, aggregate.sum, static_cast<double>(aggregate.count)};
+
+    TimeSeriesStore& store{get_store(GetIntervalResolution(intervalIndex))};
+    for (std::size_t i{}; i < AGGREGATE_FIELDS.size(); ++i)
+        store.append(GetFieldSeriesName(series, AGGREGATE_FIELDS[i]), interval.start, fields[i]);
+
+    if (intervalIndex + 1 < AGGREGATED_RESOLUTIONS_COUNT)
+        seriesRollup.intervals[intervalIndex + 1].aggregate.merge(aggregate);
+
+    interval.aggregate = Aggregate{};
+}
+
+std::optional<timestamp_type> RollupEngine::get_first_timestamp(std::string_view series,
+                                                                const Resolution resolution) {
+    if (resolution == Resolution::Raw)
+        return get_store(Resolution::Raw).getFirstTimestamp(series);
+
+    return get_store(resolution).getFirstTimestamp(
+        GetFieldSeriesName(series, AGGREGATE_FIELDS.back()));
+}
+
+Resolution RollupEngine::select_resolution(std::string_view series, const timestamp_type from,
+                                           const timestamp_type step) {
+    std::size_t resolutionIndex{};
+    for (std::size_t i{1}; i < RESOLUTIONS_COUNT; ++i) {
+        if (GetResolutionDuration(static_cast<Resolution>(i)) <= step)
+            resolutionIndex = i;
+    }
+
+    // A resolution has lost its oldest data to the retention if it starts after the first
+    // interval of the next coarser one. In that case the coarser one is used if it reaches
+    // further back.
+    for (; resolutionIndex + 1 < RESOLUTIONS_COUNT; ++resolutionIndex) {
+        const auto resolution{static_cast<Resolution>(resolutionIndex)};
+        const auto coarserResolution{static_cast<Resolution>(resolutionIndex + 1)};
+
+        const std::optional<timestamp_type> firstTimestamp{
+            get_first_timestamp(series, resolution)};
+        const std::optional<timestamp_type> coarserFirstTimestamp{
+            get_first_timestamp(series, coarserResolution)};
+
+        const bool bTrimmed{firstTimestamp.has_value() && coarserFirstTimestamp.has_value() &&
+                            *firstTimestamp >= *coarserFirstTimestamp +
+                                                   GetResolutionDuration(coarserResolution)};
+        if (!bTrimmed || *firstTimestamp <= from)
+            break;
+    }
+
+    return static_cast<Resolution>(resolutionIndex);
+}
+
+void RollupEngine::read_aggregates(std::string_view series, const Resolution resolution,
+                                   const timestamp_type from, const timestamp_type to,
+                                   std::vector<AggregateSample>& samples) {
+    TimeSeriesStore& store{get_store(resolution)};
+
+    std::array<std::vector<Sample>, AGGREGATE_FIELDS.size()> fields{};
+    for (std::size_t i{}; i < AGGREGATE_FIELDS.size(); ++i)
+        store.query(GetFieldSeriesName(series, AGGREGATE_FIELDS[i]), from, to, fields[i]);
+
+    // The fields are appended together, but a failed write may have left some of them behind.
+    std::size_t samplesCount{fields.front().size()};
+    for (const std::vector<Sample>& field : fields)
+        samplesCount = std::min(samplesCount, field.size());
+
+    for (std::size_t i{}; i < samplesCount; ++i) {
+        const Aggregate aggregate{fields[0][i].value, fields[1][i].value, fields[2][i].value,
+                                  static_cast<std::uint64_t>(fields[3][i].value)};
+        AppendAggregateSample(samples, AggregateSample{fields[0][i].timestamp, aggregate});
+    }
+}
+
+void RollupEngine::apply_series_retention(std::string_view series, const timestamp_type now) {
+    if (m_options.rawRetention > 0)
+        get_store(Resolution::Raw).removeBefore(series, now - m_options.rawRetention);
+
+    if (m_options.minuteRetention > 0) {
+        for (const std::string_view field : AGGREGATE_FIELDS) {
+            get_store(Resolution::Minute)
+                .removeBefore(GetFieldSeriesName(series, field), now - m_options.minuteRetention);
+        }
+    }
+}
+
+} // namespace gc::timeseries
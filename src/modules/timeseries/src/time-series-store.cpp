@@ -0,0 +1,254 @@
+// Copyright (c) 2023 Andrea Ballestrazzi
+#include "timeseries/time-series-store.hpp"
+
+#include "chunk-file.hpp"
+
+// C++ STL
+#include <algorithm>
+#include <optional>
+#include <stdexcept>
+#include <utility>
+
+namespace gc::timeseries {
+
+namespace {
+
+void ValidateSeriesName(std::string_view series) {
+    if (!IsValidSeriesName(series))
+        throw std::invalid_argument{"The series name is invalid."};
+}
+
+//! \return The indices of the chunk files in the directory of a series, sorted.
+[[nodiscard]] std::vector<std::uint32_t> ListChunkIndices(
+    const std::filesystem::path& seriesDirectory) {
+    std::vector<std::uint32_t> chunkIndices{};
+
+    std::error_code errorCode{};
+    for (const auto& entry : std::filesystem::directory_iterator{seriesDirectory, errorCode}) {
+        std::uint32_t chunkIndex{};
+        if (entry.is_regular_file() &&
+            ParseChunkFileName(entry.path().filename().string(), chunkIndex))
+            chunkIndices.push_back(chunkIndex);
+    }
+
+    std::sort(chunkIndices.begin(), chunkIndices.end());
+    return chunkIndices;
+}
+
+//!!
+//! \brief Reads the header of a chunk file, recovering a truncated chunk.
+//!
+//! \return The header, or std::nullopt if the file can't be read or isn't a chunk file.
+//!
+[[nodiscard]] std::optional<ChunkHeader> TryReadChunkHeader(
+    const std::filesystem::path& chunkFilePath) {
+    try {
+        const MappedFile chunkFile{chunkFilePath};
+        return RecoverChunkHeader(chunkFile.getBytes());
+    } catch (const std::runtime_error&) {
+        return std::nullopt;
+    }
+}
+
+} // namespace
+
+bool IsValidSeriesName(std::string_view series) noexcept {
+    if (series.empty() || series == "." || series == "..")
+        return false;
+
+    return std::all_of(series.begin(), series.end(), [](const char c) {
+        return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || (c >= '0' && c <= '9') ||
+               c == '_' || c == '-' || c == '.';
+    });
+}
+
+TimeSeriesStore::TimeSeriesStore(std::filesystem::path rootDirectory, StoreOptions options)
+    : m_rootDirectory{std::move(rootDirectory)},
+      m_options{options} {
+    m_options.maxSamplesPerChunk = std::max<std::uint32_t>(m_options.maxSamplesPerChunk, 1);
+    m_options.flushThreshold = std::max<std::uint32_t>(m_options.flushThreshold, 1);
+
+    std::filesystem::create_directories(m_rootDirectory);
+}
+
+TimeSeriesStore::~TimeSeriesStore() noexcept {
+    try {
+        flush();
+    } catch (...) {
+        // Nothing can be done from a destructor.
+    }
+}
+
+void TimeSeriesStore::append(std::string_view series, const timestamp_type timestamp,
+                             const double value) {
+    SeriesState& seriesState{get_series(series)};
+    if (seriesState.bHasSamples && timestamp < seriesState.lastTimestamp)
+        throw std::invalid_argument{"The timestamp precedes the last one of the series."};
+
+    if (seriesState.encoder.getSamplesCount() == m_options.maxSamplesPerChunk) {
+        // A complete chunk is synced once, so that only the last chunk of a series can be
+        // truncated by a power failure.
+        flush_series(seriesState);
+        SyncChunkFile(seriesState.directory / GetChunkFileName(seriesState.chunkIndex));
+
+        ++seriesState.chunkIndex;
+        seriesState.encoder = ChunkEncoder{};
+        seriesState.writtenBitsCount = 0;
+    }
+
+    seriesState.encoder.append(Sample{timestamp, value});
+    seriesState.bHasSamples = true;
+    seriesState.lastTimestamp = timestamp;
+
+    if (seriesState.encoder.getSamplesCount() % m_options.flushThreshold == 0)
+        flush_series(seriesState);
+}
+
+void TimeSeriesStore::flush() {
+    for (auto& [name, seriesState] : m_series)
+        flush_series(seriesState);
+}
+
+void TimeSeriesStore::query(std::string_view series, const timestamp_type from,
+                            const timestamp_type to, std::vector<Sample>& samples) {
+    ValidateSeriesName(series);
+    if (from > to)
+        return;
+
+    if (const auto seriesIt{m_series.find(series)}; seriesIt != m_series.end())
+        flush_series(seriesIt->second);
+
+    const std::filesystem::path seriesDirectory{m_rootDirectory / series};
+    for (const std::uint32_t chunkIndex : ListChunkIndices(seriesDirectory)) {
+        try {
+            const MappedFile chunkFile{seriesDirectory / GetChunkFileName(chunkIndex)};
+            const std::span<const std::uint8_t> fileBytes{chunkFile.getBytes()};
+            const ChunkHeader header{RecoverChunkHeader(fileBytes)};
+
+            // The chunks are in timestamp order, so the next ones are after the range too.
+            if (header.samplesCount == 0 || header.lastTimestamp < from)
+                continue;
+            if (header.firstTimestamp > to)
+                break;
+
+            ChunkDecoder decoder{fileBytes.subspan(ChunkHeader::SIZE), header.bitsCount,
+                                 header.samplesCount};
+            for (Sample sample{}; decoder.next(sample);) {
+                if (sample.timestamp > to)
+                    break;
+
+                if (sample.timestamp >= from)
+                    samples.push_back(sample);
+            }
+        } catch (const std::runtime_error&) {
+            // An unreadable chunk doesn't hide the samples of the other ones.
+        } catch (const std::out_of_range&) {
+            // The samples of the chunk are corrupted.
+        }
+    }
+}
+
+std::vector<Sample> TimeSeriesStore::query(std::string_view series, const timestamp_type from,
+                                           const timestamp_type to) {
+    std::vector<Sample> samples{};
+    query(series, from, to, samples);
+    return samples;
+}
+
+std::optional<timestamp_type> TimeSeriesStore::getFirstTimestamp(std::string_view series) {
+    ValidateSeriesName(series);
+    if (const auto seriesIt{m_series.find(series)}; seriesIt != m_series.end())
+        flush_series(seriesIt->second);
+
+    const std::filesystem::path seriesDirectory{m_rootDirectory / series};
+    for (const std::uint32_t chunkIndex : ListChunkIndices(seriesDirectory)) {
+        const std::optional<ChunkHeader> header{
+            TryReadChunkHeader(seriesDirectory / GetChunkFileName(chunkIndex))};
+        if (header.has_value() && header->samplesCount > 0)
+            return header->firstTimestamp;
+    }
+
+    return std::nullopt;
+}
+
+std::uint64_t TimeSeriesStore::removeBefore(std::string_view series,
+                                            const timestamp_type timestamp) {
+    ValidateSeriesName(series);
+    const auto seriesIt{m_series.find(series)};
+
+    std::uint64_t removedSamplesCount{};
+    const std::filesystem::path seriesDirectory{m_rootDirectory / series};
+    for (const std::uint32_t chunkIndex : ListChunkIndices(seriesDirectory)) {
+        // The encoder of the series still writes into its chunk.
+        if (seriesIt != m_series.end() && chunkIndex == seriesIt->second.chunkIndex)
+            break;
+
+        const std::filesystem::path chunkFilePath{seriesDirectory / GetChunkFileName(chunkIndex)};
+        const std::optional<ChunkHeader> header{TryReadChunkHeader(chunkFilePath)};
+
+        // The unreadable chunks are left in place, their samples can't be dated.
+        if (!header.has_value())
+            continue;
+        if (header->samplesCount > 0 && header->lastTimestamp >= timestamp)
+            break;
+
+        std::filesystem::remove(chunkFilePath);
+        removedSamplesCount += header->samplesCount;
+    }
+
+    return removedSamplesCount;
+}
+
+std::vector<std::string> TimeSeriesStore::listSeries() const {
+    std::vector<std::string> seriesNames{};
+    for (const auto& entry : std::filesystem::directory_iterator{m_rootDirectory}) {
+        std::string name{entry.path().filename().string()};
+        if (entry.is_directory() && IsValidSeriesName(name))
+            seriesNames.push_back(std::move(name));
+    }
+
+    std::sort(seriesNames.begin(), seriesNames.end());
+    return seriesNames;
+}
+
+TimeSeriesStore::SeriesState& TimeSeriesStore::get_series(std::string_view series) {
+    if (const auto seriesIt{m_series.find(series)}; seriesIt != m_series.end())
+        return seriesIt->second;
+
+    ValidateSeriesName(series);
+
+    SeriesState seriesState{};
+    seriesState.directory = m_rootDirectory / series;
+    std::filesystem::create_directories(seriesState.directory);
+
+    // An existing series is continued in a new chunk, so that the written ones are never
+    // decoded again to restore the encoder state. The last timestamp is the one of the last
+    // readable chunk, e.g. when the last chunk lost its header in a power failure.
+    const std::vector<std::uint32_t> chunkIndices{ListChunkIndices(seriesState.directory)};
+    if (!chunkIndices.empty())
+        seriesState.chunkIndex = chunkIndices.back() + 1;
+
+    for (auto chunkIndexIt{chunkIndices.rbegin()}; chunkIndexIt != chunkIndices.rend();
+         ++chunkIndexIt) {
+        const std::optional<ChunkHeader> header{
+            TryReadChunkHeader(seriesState.directory / GetChunkFileName(*chunkIndexIt))};
+        if (header.has_value() && header->samplesCount > 0) {
+            seriesState.bHasSamples = true;
+            seriesState.lastTimestamp = header->lastTimestamp;
+            break;
+        }
+    }
+
+    return m_series.emplace(std::string{series}, std::move(seriesState)).first->second;
+}
+
+void TimeSeriesStore::flush_series(SeriesState& seriesState) {
+    if (seriesState.writtenBitsCount == seriesState.encoder.getBitsCount())
+        return;
+
+    WriteChunkFile(seriesState.directory / GetChunkFileName(seriesState.chunkIndex),
+                   seriesState.encoder, seriesState.writtenBitsCount);
+    seriesState.writtenBitsCount = seriesState.encoder.getBitsCount();
+}
+
+} // namespace gc::timeseries
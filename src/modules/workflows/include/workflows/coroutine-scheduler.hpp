@@ -0,0 +1,225 @@
+// Copyright (c) 2023 Andrea Ballestrazzi
+#pragma once
+
+#include "workflows/coroutine-task.hpp"
+
+// C++ STL
+#include <chrono>
+#include <condition_variable>
+#include <coroutine>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <optional>
+#include <queue>
+#include <stop_token>
+#include <vector>
+
+namespace gc::workflows::coroutines {
+
+using clock_type = std::chrono::steady_clock;
+using pin_offset_type = std::uint32_t;
+
+//!!
+//! \brief The kind of transition of a digital pin a task can wait for.
+//!
+enum class EdgeType {
+    //! From low to high.
+    Rising,
+    //! From high to low.
+    Falling,
+    //! Any transition.
+    Both
+};
+
+//!!
+//! \brief A single-thread event loop that runs coroutine tasks. Tasks that wait on a delay
+//!  or on a pin edge don't occupy the thread, so thousands of long-running workflows can
+//!  share it: the cost of a waiting task is its coroutine frame and a timer entry.
+//!
+//!  Tasks must be spawned from the thread that runs the loop, or before the loop starts.
+//!  Pin edges can be notified from any thread.
+//!
+class Scheduler final {
+public:
+    Scheduler() noexcept = default;
+
+    //!!
+    //! \brief Destroy all the tasks that haven't completed yet.
+    //!
+    ~Scheduler() noexcept;
+
+    Scheduler(const Scheduler&) = delete;
+    Scheduler& operator=(const Scheduler&) = delete;
+
+    //!!
+    //! \brief Take the ownership of the given task and schedule its start.
+    //!  Throws a std::invalid_argument if the task is empty or already completed.
+    //!
+    //! \param[in] task The task to run.
+    //!
+    void spawn(Task task);
+
+    //!!
+    //! \brief Run the event loop until all the tasks have completed or a stop is requested
+    //!  on the given token. A stop leaves the pending tasks suspended: they can be resumed
+    //!  by running the loop again.
+    //!
+    //! \param stopToken The token used to stop the loop from the outside.
+    //! \return The number of tasks that have completed during this run.
+    //!
+    std::size_t run(std::stop_token stopToken = {});
+
+    //!!
+    //! \brief Notify the loop that an edge has been detected on the given pin. All the
+    //!  tasks waiting for a matching edge on that pin are resumed. Thread safe.
+    //!
+    //! \param[in] pinOffset The offset of the pin inside its board chip.
+    //! \param[in] edge The detected edge. It must be either Rising or Falling.
+    //!
+    void notifyPinEdge(pin_offset_type pinOffset, EdgeType edge);
+
+    [[nodiscard]] std::size_t getPendingTasksCount() const noexcept {
+        return m_rootTasks.size();
+    }
+
+    [[nodiscard]] std::size_t getFailedTasksCount() const noexcept {
+        return m_failedTasksCount;
+    }
+
+    //!!
+    //! \brief Suspend the given coroutine until the deadline is reached.
+    //!
+    void resumeAt(clock_type::time_point deadline, std::coroutine_handle<> handle);
+
+    //!!
+    //! \brief Suspend the given coroutine until an edge matching the given one is notified
+    //!  on the pin, or until the optional deadline is reached.
+    //!
+    //! \param[out] bEdgeDetected Set to true before resuming the coroutine if the edge has
+    //!  been detected. It must stay valid while the coroutine is suspended.
+    //!
+    void resumeOnPinEdge(pin_offset_type pinOffset, EdgeType edge,
+                         std::optional<clock_type::time_point> deadline,
+                         std::coroutine_handle<> handle, bool& bEdgeDetected);
+
+private:
+    friend class Task::promise_type;
+
+    // Pin edge waits have a non-zero id. Their timer, if any, is ignored once the edge
+    // has been detected.
+    using wait_id_type = std::uint64_t;
+
+    struct TimerEntry {
+        clock_type::time_point deadline;
+        std::uint64_t sequence;
+        std::coroutine_handle<> handle;
+        wait_id_type waitId;
+
+        // Timers with the same deadline expire in the order they were created.
+        [[nodiscard]] bool operator>(const TimerEntry& other) const noexcept {
+            return deadline != other.deadline ? deadline > other.deadline
+                                              : sequence > other.sequence;
+        }
+    };
+
+    struct PinEdgeWait {
+        wait_id_type waitId;
+        pin_offset_type pinOffset;
+        EdgeType edge;
+        std::coroutine_handle<> handle;
+        bool* bEdgeDetected;
+    };
+
+    struct PinEdgeEvent {
+        pin_offset_type pinOffset;
+        EdgeType edge;
+    };
+
+    std::vector<Task::handle_type> m_rootTasks{};
+    std::vector<Task::handle_type> m_completedTasks{};
+    std::deque<std::coroutine_handle<>> m_readyQueue{};
+    std::priority_queue<TimerEntry, std::vector<TimerEntry>, std::greater<>> m_timers{};
+    std::uint64_t m_timersSequence{};
+    std::vector<PinEdgeWait> m_pinEdgeWaits{};
+    wait_id_type m_lastWaitId{};
+    std::size_t m_failedTasksCount{};
+
+    // Edges notified by other threads, consumed by the loop.
+    std::mutex m_eventsMutex{};
+    std::condition_variable_any m_eventsCondition{};
+    std::vector<PinEdgeEvent> m_pendingEdges{};
+
+    void root_task_completed(Task::handle_type handle) noexcept;
+    void destroy_completed_tasks() noexcept;
+    void dispatch_pending_edges();
+    void dispatch_expired_timers(clock_type::time_point now);
+    void wait_for_events(const std::stop_token& stopToken);
+};
+
+//!!
+//! \brief Suspends the awaiting task for the given duration.
+//!
+//! \param[in] duration The time to wait.
+//! \return The awaitable object.
+//!
+[[nodiscard]] inline auto Delay(clock_type::duration duration) noexcept {
+    struct Awaiter {
+        clock_type::duration duration;
+
+        [[nodiscard]] bool await_ready() const noexcept {
+            return duration <= clock_type::duration::zero();
+        }
+
+        void await_suspend(Task::handle_type handle) const {
+            handle.promise().getScheduler()->resumeAt(clock_type::now() + duration, handle);
+        }
+
+        constexpr void await_resume() const noexcept {}
+    };
+
+    return Awaiter{duration};
+}
+
+//!!
+//! \brief Suspends the awaiting task until the given edge is notified on the pin.
+//!
+//! \param[in] pinOffset The offset of the pin inside its board chip.
+//! \param[in] edge The edge to wait for.
+//! \param[in] timeout The maximum time to wait. No value means no timeout.
+//! \return The awaitable object. It produces true if the edge has been detected and false
+//!  if the timeout has expired.
+//!
+[[nodiscard]] inline auto PinEdge(pin_offset_type pinOffset, EdgeType edge,
+                                  std::optional<clock_type::duration> timeout = {}) noexcept {
+    struct Awaiter {
+        pin_offset_type pinOffset;
+        EdgeType edge;
+        std::optional<clock_type::duration> timeout;
+        bool bEdgeDetected{};
+
+        [[nodiscard]] constexpr bool await_ready() const noexcept {
+            return false;
+        }
+
+        void await_suspend(Task::handle_type handle) {
+            std::optional<clock_type::time_point> deadline{};
+            if (timeout.has_value()) {
+                deadline = clock_type::now() + *timeout;
+            }
+
+            handle.promise().getScheduler()->resumeOnPinEdge(pinOffset, edge, deadline, handle,
+                                                             bEdgeDetected);
+        }
+
+        [[nodiscard]] constexpr bool await_resume() const noexcept {
+            return bEdgeDetected;
+        }
+    };
+
+    return Awaiter{pinOffset, edge, timeout};
+}
+
+} // namespace gc::workflows::coroutines
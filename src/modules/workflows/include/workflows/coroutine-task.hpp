@@ -0,0 +1,150 @@
+// Copyright (c) 2023 Andrea Ballestrazzi
+#pragma once
+
+// C++ STL
+#include <coroutine>
+#include <cstddef>
+#include <utility>
+
+namespace gc::workflows::coroutines {
+
+class Scheduler;
+
+//!!
+//! \brief A coroutine workflow. Like a workflow step, it produces true on success and false
+//!  on failure (`co_return true;`). Unlike a step, it can suspend itself on the awaitables
+//!  of the scheduler (Delay(), PinEdge()) and on other tasks without blocking its thread.
+//!
+//!  Tasks are lazy: a task starts only when it's spawned on a Scheduler or awaited by
+//!  another task, which then resumes when the awaited task completes.
+//!
+class Task final {
+public:
+    class promise_type final {
+    public:
+        [[nodiscard]] Task get_return_object() noexcept {
+            return Task{std::coroutine_handle<promise_type>::from_promise(*this)};
+        }
+
+        [[nodiscard]] std::suspend_always initial_suspend() const noexcept {
+            return {};
+        }
+
+        struct FinalAwaiter {
+            [[nodiscard]] constexpr bool await_ready() const noexcept {
+                return false;
+            }
+
+            [[nodiscard]] std::coroutine_handle<> await_suspend(
+                std::coroutine_handle<promise_type> handle) const noexcept;
+
+            constexpr void await_resume() const noexcept {}
+        };
+
+        [[nodiscard]] FinalAwaiter final_suspend() const noexcept {
+            return {};
+        }
+
+        void return_value(bool result) noexcept {
+            m_bResult = result;
+        }
+
+        // Workflow steps can't throw, so an escaped exception is a failure of the task.
+        void unhandled_exception() noexcept {
+            m_bResult = false;
+        }
+
+        [[nodiscard]] Scheduler* getScheduler() const noexcept {
+            return m_scheduler;
+        }
+
+        [[nodiscard]] bool getResult() const noexcept {
+            return m_bResult;
+        }
+
+    private:
+        friend class Task;
+        friend class Scheduler;
+
+        Scheduler* m_scheduler{};
+        std::coroutine_handle<> m_continuation{};
+        // Position inside the scheduler's list of root tasks.
+        std::size_t m_rootIndex{};
+        bool m_bResult{};
+    };
+
+    using handle_type = std::coroutine_handle<promise_type>;
+
+    Task(Task&& other) noexcept : m_handle{std::exchange(other.m_handle, {})} {}
+
+    Task& operator=(Task&& other) noexcept {
+        if (this != &other) {
+            destroy();
+            m_handle = std::exchange(other.m_handle, {});
+        }
+
+        return *this;
+    }
+
+    Task(const Task&) = delete;
+    Task& operator=(const Task&) = delete;
+
+    ~Task() noexcept {
+        destroy();
+    }
+
+    //!!
+    //! \brief Awaits the completion of this task from another task. The awaiting task is
+    //!  resumed directly by the completed one.
+    //!
+    //! \return An awaiter that produces the result of the task.
+    //!
+    [[nodiscard]] auto operator co_await() && noexcept {
+        struct Awaiter {
+            handle_type handle;
+
+            [[nodiscard]] bool await_ready() const noexcept {
+                return !handle || handle.done();
+            }
+
+            [[nodiscard]] std::coroutine_handle<> await_suspend(
+                handle_type awaitingHandle) const noexcept {
+                handle.promise().m_scheduler = awaitingHandle.promise().m_scheduler;
+                handle.promise().m_continuation = awaitingHandle;
+                return handle;
+            }
+
+            [[nodiscard]] bool await_resume() const noexcept {
+                return handle && handle.promise().m_bResult;
+            }
+        };
+
+        return Awaiter{m_handle};
+    }
+
+    [[nodiscard]] bool done() const noexcept {
+        return !m_handle || m_handle.done();
+    }
+
+private:
+    friend class Scheduler;
+
+    explicit Task(handle_type handle) noexcept : m_handle{handle} {}
+
+    //!!
+    //! \brief Transfers the ownership of the coroutine frame to the caller.
+    //!
+    [[nodiscard]] handle_type release() noexcept {
+        return std::exchange(m_handle, {});
+    }
+
+    void destroy() noexcept {
+        if (m_handle) {
+            m_handle.destroy();
+        }
+    }
+
+    handle_type m_handle{};
+};
+
+} // namespace gc::workflows::coroutines
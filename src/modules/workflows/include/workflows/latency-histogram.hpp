@@ -0,0 +1,156 @@
+// Copyright (c) 2023 Andrea Ballestrazzi
+#pragma once
+
+// C++ STL
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+
+namespace gc::workflows {
+
+//!!
+//! \brief A log-linear histogram of latencies in nanoseconds. Every power of two is split
+//!  into SUB_BUCKETS_COUNT linear buckets, so the relative error of a recorded value is
+//!  at most 1 / SUB_BUCKETS_COUNT while the whole range takes a few hundred counters.
+//!  Values above MAX_VALUE fall in the last bucket.
+//!
+class LatencyHistogram final {
+public:
+    using value_type = std::uint64_t;
+    using count_type = std::uint64_t;
+
+    static constexpr std::size_t SUB_BUCKETS_BITS{3};
+    static constexpr std::size_t SUB_BUCKETS_COUNT{std::size_t{1} << SUB_BUCKETS_BITS};
+    //! The most significant bit of the largest tracked value (about 9 minutes).
+    static constexpr std::size_t MAX_VALUE_BIT{39};
+    static constexpr value_type MAX_VALUE{(value_type{1} << (MAX_VALUE_BIT + 1)) - 1};
+    static constexpr std::size_t BUCKETS_COUNT{(MAX_VALUE_BIT - SUB_BUCKETS_BITS + 2) *
+                                               SUB_BUCKETS_COUNT};
+
+    using buckets_type = std::array<count_type, BUCKETS_COUNT>;
+
+    //!!
+    //! \brief Computes the index of the bucket that contains the given value.
+    //!
+    [[nodiscard]] static constexpr std::size_t GetBucketIndex(value_type value) noexcept {
+        value = std::min(value, MAX_VALUE);
+        if (value < SUB_BUCKETS_COUNT) {
+            return static_cast<std::size_t>(value);
+        }
+
+        const std::size_t msb{static_cast<std::size_t>(std::bit_width(value)) - 1};
+        const std::size_t shift{msb - SUB_BUCKETS_BITS};
+        const std::size_t subBucket{static_cast<std::size_t>(value >> shift) &
+                                    (SUB_BUCKETS_COUNT - 1)};
+
+        return (shift + 1) * SUB_BUCKETS_COUNT + subBucket;
+    }
+
+    //!!
+    //! \brief Computes the smallest value contained in the given bucket.
+    //!
+    [[nodiscard]] static constexpr value_type GetBucketLowerBound(std::size_t index) noexcept {
+        if (index < SUB_BUCKETS_COUNT) {
+            return static_cast<value_type>(index);
+        }
+
+        const std::size_t shift{index / SUB_BUCKETS_COUNT - 1};
+        const std::size_t subBucket{index % SUB_BUCKETS_COUNT};
+        return static_cast<value_type>(SUB_BUCKETS_COUNT + subBucket) << shift;
+    }
+
+    //!!
+    //! \brief Computes the largest value contained in the given bucket.
+    //!
+    [[nodiscard]] static constexpr value_type GetBucketUpperBound(std::size_t index) noexcept {
+        if (index < SUB_BUCKETS_COUNT) {
+            return static_cast<value_type>(index);
+        }
+
+        const std::size_t shift{index / SUB_BUCKETS_COUNT - 1};
+        return GetBucketLowerBound(index) + (value_type{1} << shift) - 1;
+    }
+
+    constexpr void record(value_type value) noexcept {
+        addToBucket(GetBucketIndex(value), 1);
+        m_sum += value;
+        m_max = std::max(m_max, value);
+    }
+
+    //!!
+    //! \brief Adds the given count to a bucket. Used to rebuild a histogram from
+    //!  counters recorded elsewhere.
+    //!
+    constexpr void addToBucket(std::size_t index, count_type count) noexcept {
+        m_buckets[index] += count;
+        m_count += count;
+    }
+
+    constexpr void addSum(value_type sum, value_type max) noexcept {
+        m_sum += sum;
+        m_max = std::max(m_max, max);
+    }
+
+    constexpr void merge(const LatencyHistogram& other) noexcept {
+        for (std::size_t i{}; i < BUCKETS_COUNT; ++i) {
+            m_buckets[i] += other.m_buckets[i];
+        }
+
+        m_count += other.m_count;
+        m_sum += other.m_sum;
+        m_max = std::max(m_max, other.m_max);
+    }
+
+    //!!
+    //! \brief Estimates the value at the given quantile as the upper bound of the bucket
+    //!  that contains it, so the estimate is never lower than the recorded value.
+    //!
+    //! \param[in] quantile The quantile, between 0 and 1.
+    //! \return The estimated value, or zero if the histogram is empty.
+    //!
+    [[nodiscard]] constexpr value_type getValueAtQuantile(double quantile) const noexcept {
+        if (m_count == 0) {
+            return 0;
+        }
+
+        quantile = std::clamp(quantile, 0.0, 1.0);
+        const count_type rank{std::max<count_type>(
+            static_cast<count_type>(quantile * static_cast<double>(m_count) + 0.5), 1)};
+
+        count_type cumulativeCount{};
+        for (std::size_t i{}; i < BUCKETS_COUNT; ++i) {
+            cumulativeCount += m_buckets[i];
+            if (cumulativeCount >= rank) {
+                return std::min(GetBucketUpperBound(i), m_max);
+            }
+        }
+
+        return m_max;
+    }
+
+    [[nodiscard]] constexpr count_type getCount() const noexcept {
+        return m_count;
+    }
+
+    [[nodiscard]] constexpr value_type getMax() const noexcept {
+        return m_max;
+    }
+
+    [[nodiscard]] constexpr double getMean() const noexcept {
+        return m_count == 0 ? 0.0 : static_cast<double>(m_sum) / static_cast<double>(m_count);
+    }
+
+    [[nodiscard]] constexpr const buckets_type& getBuckets() const noexcept {
+        return m_buckets;
+    }
+
+private:
+    buckets_type m_buckets{};
+    count_type m_count{};
+    value_type m_sum{};
+    value_type m_max{};
+};
+
+} // namespace gc::workflows
@@ -0,0 +1,33 @@
+// Copyright (c) 2023 Andrea Ballestrazzi
+#pragma once
+
+#include "workflows/work-stealing-thread-pool.hpp"
+#include "workflows/workflow-graph.hpp"
+
+namespace gc::workflows {
+
+//!!
+//! \brief Executes the steps of a workflow graph on a thread pool. A step is submitted to
+//!  the pool as soon as all of its dependencies have been executed successfully, so
+//!  independent steps run concurrently. When a step fails, the steps that haven't been
+//!  started yet are cancelled; the ones already running are allowed to finish.
+//!
+class ParallelWorkflowExecutor final {
+public:
+    explicit ParallelWorkflowExecutor(WorkStealingThreadPool& threadPool) noexcept
+        : m_threadPool{threadPool} {}
+
+    //!!
+    //! \brief Execute the given graph and wait for its completion. Must not be called from a
+    //!  task running on the same pool, as it blocks the calling thread.
+    //!
+    //! \param[in] graph The graph to execute
+    //! \return True if all the steps have been executed successfully, false otherwise
+    //!
+    [[nodiscard]] bool execute(WorkflowGraph& graph) noexcept;
+
+private:
+    WorkStealingThreadPool& m_threadPool;
+};
+
+} // namespace gc::workflows
@@ -0,0 +1,117 @@
+// Copyright (c) 2023 Andrea Ballestrazzi
+#pragma once
+
+#include "workflows/workflow.hpp"
+
+// C++ STL
+#include <concepts>
+#include <cstddef>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+namespace gc::workflows {
+
+//!!
+//! \brief A concept that defines the requirements for a step of a static workflow.
+//!  Unlike WorkflowStep, a static step isn't polymorphic: it's stored by value and
+//!  its execute() method is called directly, so it can be inlined.
+//!
+template <typename S>
+concept StaticWorkflowStep = requires(S s) {
+    { s.execute() } -> std::convertible_to<bool>;
+};
+
+//!!
+//! \brief A workflow whose steps are known at compile time. The steps are stored by value
+//!  inside a tuple and executed in order with a fold expression, so there is no allocation,
+//!  no virtual call and no pointer chasing between the steps.
+//!
+//! \tparam Steps The types of the steps, executed in the order they're listed.
+//!
+template <StaticWorkflowStep... Steps>
+class StaticWorkflow final {
+public:
+    using id_type = IdType;
+    using steps_type = std::tuple<Steps...>;
+
+    explicit constexpr StaticWorkflow(id_type workflowId, Steps... steps) noexcept(
+        (std::is_nothrow_move_constructible_v<Steps> && ...))
+        : m_id(std::move(workflowId)),
+          m_steps{std::move(steps)...} {}
+
+    //!!
+    //! \brief Execute the workflow. The execution stops at the first step that fails.
+    //!
+    //! \return True if the workflow has been executed successfully, false otherwise
+    //!
+    [[nodiscard]] constexpr bool execute() noexcept {
+        return std::apply(
+            [](auto&... steps) {
+                return (static_cast<bool>(steps.execute()) && ...);
+            },
+            m_steps);
+    }
+
+    [[nodiscard]] static constexpr std::size_t size() noexcept {
+        return sizeof...(Steps);
+    }
+
+    [[nodiscard]] static constexpr bool empty() noexcept {
+        return sizeof...(Steps) == 0;
+    }
+
+    [[nodiscard]] const id_type& id() const noexcept {
+        return m_id;
+    }
+
+    template <std::size_t Index>
+    [[nodiscard]] constexpr auto& getStep() noexcept {
+        return std::get<Index>(m_steps);
+    }
+
+private:
+    id_type m_id;
+    steps_type m_steps;
+};
+
+namespace steps {
+
+//!!
+//! \brief A static workflow step that executes a callable stored by value.
+//!
+//! \tparam F The type of the callable. It must return a value convertible to bool.
+//!
+template <typename F>
+    requires std::invocable<F&> && std::convertible_to<std::invoke_result_t<F&>, bool>
+class StaticFunction final {
+public:
+    explicit constexpr StaticFunction(F function) noexcept(
+        std::is_nothrow_move_constructible_v<F>)
+        : m_function{std::move(function)} {}
+
+    [[nodiscard]] constexpr bool execute() noexcept {
+        return static_cast<bool>(m_function());
+    }
+
+private:
+    F m_function;
+};
+
+} // namespace steps
+
+//!!
+//! \brief Create a static workflow from a list of callables.
+//!
+//! \param[in] workflowId The id of the workflow
+//! \param[in] functions The callables to execute, in order
+//! \return The static workflow
+//!
+template <typename... Functions>
+[[nodiscard]] constexpr auto MakeStaticWorkflow(IdType workflowId, Functions&&... functions) {
+    return StaticWorkflow<steps::StaticFunction<std::decay_t<Functions>>...>{
+        std::move(workflowId),
+        steps::StaticFunction<std::decay_t<Functions>>{std::forward<Functions>(functions)}...};
+}
+
+} // namespace gc::workflows
@@ -0,0 +1,152 @@
+// Copyright (c) 2023 Andrea Ballestrazzi
+#pragma once
+
+#include "workflows/workflow-loop.hpp"
+
+// C++ STL
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <limits>
+#include <optional>
+#include <stdexcept>
+#include <stop_token>
+
+namespace gc::workflows {
+
+//!!
+//! \brief Blocks the calling thread until the given deadline is reached or a stop is requested
+//!  on the given token. The stop interrupts the wait immediately.
+//!
+//! \param deadline The time point to wait for.
+//! \param stopToken The token that interrupts the wait.
+//! \return True if the deadline has been reached, false if a stop has been requested.
+//!
+[[nodiscard]] bool SleepUntil(clock_type::time_point deadline, std::stop_token stopToken) noexcept;
+
+namespace repeat_modes {
+
+//!!
+//! \brief Represents the timing statistics collected by a timed repeat mode.
+//!
+struct TimingStatistics {
+    std::size_t iterations{};
+    //! Number of iterations that ended after the start of the next scheduled one.
+    std::size_t overruns{};
+    //! Worst delay between the scheduled start of an iteration and its actual start.
+    clock_type::duration worstLateness{};
+};
+
+//!!
+//! \brief What a fixed-rate repeat mode does when an iteration ends after the start of
+//!  the next scheduled one.
+//!
+enum class MissedDeadlinePolicy {
+    //! Drop the missed activations and keep the original schedule phase.
+    Skip,
+    //! Run the missed activations back-to-back until the schedule is met again.
+    CatchUp,
+    //! Start the next iteration immediately and restart the schedule from it.
+    Restart
+};
+
+//!!
+//! \brief A repeat mode that starts an iteration every period, measured from the start of
+//!  the first iteration, regardless of how long each iteration takes.
+//!
+class FixedRate final {
+public:
+    static constexpr std::size_t UNLIMITED_ITERATIONS{std::numeric_limits<std::size_t>::max()};
+
+    //!!
+    //! \brief Construct a new fixed-rate repeat mode.
+    //!
+    //! \param period The time between the starts of two iterations.
+    //! \param policy What to do when an iteration ends after the start of the next one.
+    //! \param maxIterations The number of iterations to execute.
+    //! \throw std::invalid_argument if the period isn't positive.
+    //!
+    explicit FixedRate(clock_type::duration period,
+                       MissedDeadlinePolicy policy = MissedDeadlinePolicy::Skip,
+                       std::size_t maxIterations = UNLIMITED_ITERATIONS)
+        : m_period{period},
+          m_policy{policy},
+          m_remainingIterations{maxIterations} {
+        // Every iteration would overrun a zero period, and the schedule is computed by
+        // dividing by it.
+        if (m_period <= clock_type::duration::zero())
+            throw std::invalid_argument{
+                "The period of a fixed-rate repeat mode must be positive."};
+    }
+
+    [[nodiscard]] constexpr bool canRepeat() const noexcept {
+        return m_remainingIterations > 0;
+    }
+
+    [[nodiscard]] bool waitNextIteration(std::stop_token stopToken) noexcept;
+
+    [[nodiscard]] clock_type::time_point getNextIterationTime() noexcept;
+
+    void iterationStarted() noexcept;
+
+    void iterationDone() noexcept;
+
+    [[nodiscard]] constexpr const TimingStatistics& getStatistics() const noexcept {
+        return m_statistics;
+    }
+
+private:
+    clock_type::duration m_period;
+    MissedDeadlinePolicy m_policy;
+    std::size_t m_remainingIterations;
+    std::optional<clock_type::time_point> m_nextActivation{};
+    clock_type::time_point m_currentActivation{};
+    TimingStatistics m_statistics{};
+};
+
+//!!
+//! \brief A repeat mode that waits the given delay between the end of an iteration and
+//!  the start of the next one. The first iteration starts immediately.
+//!
+class FixedDelay final {
+public:
+    static constexpr std::size_t UNLIMITED_ITERATIONS{std::numeric_limits<std::size_t>::max()};
+
+    //!!
+    //! \brief Construct a new fixed-delay repeat mode.
+    //!
+    //! \param delay The time between the end of an iteration and the start of the next one.
+    //!  A negative delay is the same as a zero delay: the iterations run back-to-back.
+    //! \param maxIterations The number of iterations to execute.
+    //!
+    explicit FixedDelay(clock_type::duration delay,
+                        std::size_t maxIterations = UNLIMITED_ITERATIONS) noexcept
+        : m_delay{std::max(delay, clock_type::duration::zero())},
+          m_remainingIterations{maxIterations} {}
+
+    [[nodiscard]] constexpr bool canRepeat() const noexcept {
+        return m_remainingIterations > 0;
+    }
+
+    [[nodiscard]] bool waitNextIteration(std::stop_token stopToken) noexcept;
+
+    [[nodiscard]] clock_type::time_point getNextIterationTime() noexcept;
+
+    void iterationStarted() noexcept;
+
+    void iterationDone() noexcept;
+
+    [[nodiscard]] constexpr const TimingStatistics& getStatistics() const noexcept {
+        return m_statistics;
+    }
+
+private:
+    clock_type::duration m_delay;
+    std::size_t m_remainingIterations;
+    std::optional<clock_type::time_point> m_nextActivation{};
+    TimingStatistics m_statistics{};
+};
+
+} // namespace repeat_modes
+
+} // namespace gc::workflows
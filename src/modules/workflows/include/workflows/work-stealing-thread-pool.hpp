@@ -0,0 +1,78 @@
+// Copyright (c) 2023 Andrea Ballestrazzi
+#pragma once
+
+// C++ STL
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <stop_token>
+#include <thread>
+#include <vector>
+
+namespace gc::workflows {
+
+//!!
+//! \brief A fixed-size thread pool where every worker owns a task queue. A worker pops the
+//!  newest task from its own queue and, when the queue is empty, steals the oldest task from
+//!  the queues of the other workers. Tasks submitted by a worker go to its own queue, so the
+//!  tasks spawned by a task tend to run on the same thread while idle workers balance the load.
+//!
+class WorkStealingThreadPool final {
+public:
+    using task_type = std::function<void()>;
+
+    //!!
+    //! \brief Construct a new pool and start its workers.
+    //!
+    //! \param[in] workersCount The number of worker threads. Zero means one worker.
+    //!
+    explicit WorkStealingThreadPool(std::size_t workersCount);
+
+    //!!
+    //! \brief Stop and join all the workers. Tasks that haven't been started are discarded,
+    //!  so the users of the pool must wait for their tasks before destroying it.
+    //!
+    ~WorkStealingThreadPool() noexcept;
+
+    WorkStealingThreadPool(const WorkStealingThreadPool&) = delete;
+    WorkStealingThreadPool& operator=(const WorkStealingThreadPool&) = delete;
+
+    //!!
+    //! \brief Submit a task to the pool. Tasks must not throw exceptions.
+    //!
+    //! \param[in] task The task to execute
+    //!
+    void submit(task_type task);
+
+    [[nodiscard]] std::size_t getWorkersCount() const noexcept {
+        return m_queues.size();
+    }
+
+private:
+    struct WorkerQueue {
+        std::mutex mutex{};
+        std::deque<task_type> tasks{};
+    };
+
+    std::vector<std::unique_ptr<WorkerQueue>> m_queues{};
+    std::atomic<std::size_t> m_nextQueue{};
+
+    // Number of tasks that have been submitted but not yet taken by a worker. It's modified
+    // under the mutex so that a sleeping worker can't miss a notification.
+    std::atomic<std::size_t> m_queuedTasks{};
+    std::mutex m_wakeUpMutex{};
+    std::condition_variable_any m_wakeUpCondition{};
+
+    // Workers are the last members so they are stopped before the queues are destroyed.
+    std::vector<std::jthread> m_workers{};
+
+    void worker_loop(std::stop_token stopToken, std::size_t workerIndex) noexcept;
+    [[nodiscard]] std::optional<task_type> try_take_task(std::size_t workerIndex) noexcept;
+};
+
+} // namespace gc::workflows
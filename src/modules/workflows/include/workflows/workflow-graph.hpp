@@ -0,0 +1,97 @@
+// Copyright (c) 2023 Andrea Ballestrazzi
+#pragma once
+
+#include "workflows/workflow.hpp"
+
+// C++ STL
+#include <cstddef>
+#include <functional>
+#include <map>
+#include <memory>
+#include <optional>
+#include <vector>
+
+namespace gc::workflows {
+
+//!!
+//! \brief A workflow whose steps are connected by dependency edges. A step can be executed
+//!  only after all of its dependencies have been executed successfully, so steps that don't
+//!  depend on each other can be executed in parallel (see ParallelWorkflowExecutor).
+//!  The dependencies of a step must be added before the step itself, so the graph is acyclic
+//!  by construction and the insertion order is always a valid execution order.
+//!
+class WorkflowGraph final {
+public:
+    using id_type = IdType;
+    using step_pointer = std::unique_ptr<WorkflowStep>;
+    using step_index = std::size_t;
+
+    explicit WorkflowGraph(id_type workflowId) noexcept : m_id(std::move(workflowId)) {}
+
+    //!!
+    //! \brief Add a step to the graph.
+    //!
+    //! \param[in] step The step to add
+    //! \param[in] dependencies The ids of the steps that must be executed before this one
+    //! \return True if the step has been added, false if its id is already used or one of
+    //!  its dependencies isn't part of the graph.
+    //!
+    [[nodiscard]] bool addStep(step_pointer step,
+                               const std::vector<IdView>& dependencies = {}) noexcept;
+
+    //!!
+    //! \brief Execute the steps sequentially, in insertion order. The execution stops at the
+    //!  first step that fails.
+    //!
+    //! \return True if all the steps have been executed successfully, false otherwise
+    //!
+    [[nodiscard]] bool execute() noexcept;
+
+    //!!
+    //! \brief Find the index of the step with the given id.
+    //!
+    //! \param[in] stepId The id of the step
+    //! \return The index of the step, or an empty optional if the step isn't part of the graph
+    //!
+    [[nodiscard]] std::optional<step_index> findStep(IdView stepId) const noexcept;
+
+    [[nodiscard]] WorkflowStep& getStep(step_index index) noexcept {
+        return *m_nodes[index].step;
+    }
+
+    //!!
+    //! \brief Get the indices of the steps that depend on the given one.
+    //!
+    [[nodiscard]] const std::vector<step_index>& getDependents(step_index index) const noexcept {
+        return m_nodes[index].dependents;
+    }
+
+    [[nodiscard]] std::size_t getDependenciesCount(step_index index) const noexcept {
+        return m_nodes[index].dependenciesCount;
+    }
+
+    [[nodiscard]] std::size_t size() const noexcept {
+        return m_nodes.size();
+    }
+
+    [[nodiscard]] bool empty() const noexcept {
+        return m_nodes.empty();
+    }
+
+    [[nodiscard]] const id_type& id() const noexcept {
+        return m_id;
+    }
+
+private:
+    struct Node {
+        step_pointer step{};
+        std::size_t dependenciesCount{};
+        std::vector<step_index> dependents{};
+    };
+
+    id_type m_id;
+    std::vector<Node> m_nodes{};
+    std::map<id_type, step_index, std::less<>> m_indices{};
+};
+
+} // namespace gc::workflows
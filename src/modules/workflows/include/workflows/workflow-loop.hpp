@@ -3,8 +3,17 @@
 
 #include "workflows/workflow.hpp"
 
+// C++ STL
+#include <chrono>
+#include <concepts>
+#include <cstddef>
+#include <stop_token>
+#include <utility>
+
 namespace gc::workflows {
 
+using clock_type = std::chrono::steady_clock;
+
 //!!
 //! \brief A concept that defines the requirements for a repeat mode
 //!  to be used with the WorkflowLoop class. A repeat mode must have
@@ -18,41 +27,118 @@ concept RepeatMode = requires(R r) {
     { r.iterationDone() } -> std::convertible_to<void>;
 };
 
+//!!
+//! \brief A concept that defines the requirements for a timed repeat mode. On top of
+//!  the RepeatMode requirements, a timed repeat mode must have a waitNextIteration()
+//!  method that blocks until the next iteration is due. It must return false, as soon
+//!  as possible, when a stop is requested on the given token.
+//!
+template <typename R>
+concept TimedRepeatMode = RepeatMode<R> && requires(R r, std::stop_token stopToken) {
+    { r.waitNextIteration(stopToken) } -> std::convertible_to<bool>;
+};
+
+//!!
+//! \brief A concept that defines the requirements for a repeat mode whose iterations are
+//!  due at given times, so that a scheduler can wait for them without blocking a thread.
+//!  getNextIterationTime() returns when the next iteration is due and iterationStarted()
+//!  is called right before the workflow is executed, exactly once per iteration.
+//!
+template <typename R>
+concept ScheduledRepeatMode = RepeatMode<R> && requires(R r) {
+    { r.getNextIterationTime() } -> std::convertible_to<clock_type::time_point>;
+    { r.iterationStarted() } -> std::convertible_to<void>;
+};
+
+//!!
+//! \brief A concept that defines the requirements for a workflow to be used with
+//!  the WorkflowLoop class. Both Workflow and StaticWorkflow satisfy it.
+//!
+template <typename W>
+concept ExecutableWorkflow = requires(W w) {
+    { w.execute() } -> std::convertible_to<bool>;
+};
+
 //!!
 //! \brief A class that executes a workflow in a loop, until the repeat mode
 //!  is satisfied.
 //!
 //! \tparam R The repeat mode to use
+//! \tparam W The type of the workflow to execute
 //!
-template <RepeatMode R>
+template <RepeatMode R, ExecutableWorkflow W = Workflow>
 class WorkflowLoop final {
 public:
     using repeat_mode = R;
+    using workflow_type = W;
 
-    explicit WorkflowLoop(Workflow& workflow, repeat_mode repeatMode) noexcept
+    explicit WorkflowLoop(workflow_type& workflow, repeat_mode repeatMode) noexcept
         : m_workflow{workflow},
           m_repeatMode{std::move(repeatMode)} {}
 
     //!!
-    //! \brief Executes the workflow in a loop, until the repeat mode is satisfied.
+    //! \brief Executes the workflow in a loop, until the repeat mode is satisfied or a stop
+    //!  is requested on the given token. With a timed repeat mode, the wait between two
+    //!  iterations is interrupted as soon as the stop is requested.
     //!
-    //! \return true if the workflow was executed successfully, false if the workflow
-    //!  returned false or an error occurred.
+    //! \param stopToken The token used to stop the loop from the outside.
+    //! \return true if the workflow was executed successfully or the loop was stopped,
+    //!  false if the workflow returned false or an error occurred.
     //!
-    [[nodiscard]] bool loopWorkflow() noexcept {
-        while (m_repeatMode.canRepeat()) {
-            if (!m_workflow.execute()) {
+    [[nodiscard]] bool loopWorkflow(std::stop_token stopToken = {}) noexcept {
+        while (!stopToken.stop_requested() && m_repeatMode.canRepeat()) {
+            if constexpr (TimedRepeatMode<repeat_mode>) {
+                if (!m_repeatMode.waitNextIteration(stopToken)) {
+                    break;
+                }
+            }
+
+            if (!executeIteration()) {
                 return false;
             }
+        }
+        return true;
+    }
 
-            // Notify the repeat mode so that it can update its state
-            m_repeatMode.iterationDone();
+    //!!
+    //! \brief Executes a single iteration of the workflow without waiting for it to be due.
+    //!  Used by the schedulers that multiplex many loops, like WorkflowRunner.
+    //!
+    //! \return true if the workflow was executed successfully, false otherwise.
+    //!
+    [[nodiscard]] bool executeIteration() noexcept {
+        if constexpr (ScheduledRepeatMode<repeat_mode>) {
+            m_repeatMode.iterationStarted();
+        }
+
+        if (!m_workflow.execute()) {
+            return false;
         }
+
+        // Notify the repeat mode so that it can update its state
+        m_repeatMode.iterationDone();
         return true;
     }
 
+    [[nodiscard]] bool canRepeat() noexcept {
+        return m_repeatMode.canRepeat();
+    }
+
+    //!!
+    //! \brief Retrieves when the next iteration is due.
+    //!
+    [[nodiscard]] clock_type::time_point getNextIterationTime() noexcept
+        requires ScheduledRepeatMode<repeat_mode>
+    {
+        return m_repeatMode.getNextIterationTime();
+    }
+
+    [[nodiscard]] const repeat_mode& getRepeatMode() const noexcept {
+        return m_repeatMode;
+    }
+
 private:
-    Workflow& m_workflow;
+    workflow_type& m_workflow;
     repeat_mode m_repeatMode;
 };
 
@@ -0,0 +1,128 @@
+// Copyright (c) 2023 Andrea Ballestrazzi
+#pragma once
+
+#include "workflows/latency-histogram.hpp"
+
+// C++ STL
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <ostream>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+namespace gc::workflows {
+
+//!!
+//! \brief The statistics of a profiled step, merged from all the threads that executed it.
+//!
+struct StepProfile {
+    std::string name{};
+    std::uint64_t callsCount{};
+    std::uint64_t failuresCount{};
+    LatencyHistogram latency{};
+};
+
+//!!
+//! \brief Collects the call count, the failure count and the latency histogram of the steps
+//!  of the workflows attached to it (see Workflow::setProfiler()).
+//!
+//!  All the counters are allocated when the profiler is constructed: every thread that
+//!  records a sample takes one of the slots and then updates its own counters without
+//!  contention. Samples recorded by threads that find no free slot are dropped and counted.
+//!
+class WorkflowProfiler final {
+public:
+    using step_index_type = std::size_t;
+    using clock_type = std::chrono::steady_clock;
+
+    //!!
+    //! \brief Construct a new profiler and preallocate its counters.
+    //!
+    //! \param[in] maxStepsCount The maximum number of steps that can be registered.
+    //! \param[in] maxThreadsCount The maximum number of threads that can record samples.
+    //!
+    explicit WorkflowProfiler(std::size_t maxStepsCount,
+                              std::size_t maxThreadsCount = std::thread::hardware_concurrency());
+
+    WorkflowProfiler(const WorkflowProfiler&) = delete;
+    WorkflowProfiler& operator=(const WorkflowProfiler&) = delete;
+
+    //!!
+    //! \brief Register a step, or find it if a step with the same name has already been
+    //!  registered. Steps with the same name share their statistics.
+    //!
+    //! \param[in] name The name of the step.
+    //! \return The index of the step, or no value if the maximum number of steps has
+    //!  been reached.
+    //!
+    [[nodiscard]] std::optional<step_index_type> registerStep(std::string_view name);
+
+    //!!
+    //! \brief Record an execution of the given step in the counters of the calling thread.
+    //!
+    void record(step_index_type stepIndex, clock_type::duration elapsedTime,
+                bool bSucceeded) noexcept;
+
+    //!!
+    //! \brief Merge the counters of all the threads. It can be called while the steps
+    //!  are executing: the samples recorded concurrently may be partially included.
+    //!
+    //! \return The profiles of the registered steps, in registration order.
+    //!
+    [[nodiscard]] std::vector<StepProfile> getProfiles() const;
+
+    [[nodiscard]] std::uint64_t getDroppedSamplesCount() const noexcept {
+        return m_droppedSamplesCount.load(std::memory_order_relaxed);
+    }
+
+private:
+    using counter_type = std::atomic<std::uint64_t>;
+
+    // Counters are written by a single thread, so they're updated with a relaxed load and
+    // store instead of a read-modify-write. They're atomic only to be read by getProfiles().
+    struct StepCounters {
+        counter_type callsCount{};
+        counter_type failuresCount{};
+        counter_type totalTime{};
+        counter_type maxTime{};
+        std::array<counter_type, LatencyHistogram::BUCKETS_COUNT> buckets{};
+    };
+
+    struct alignas(64) ThreadSlot {
+        std::atomic<std::thread::id> owner{};
+        std::unique_ptr<StepCounters[]> steps{};
+    };
+
+    std::uint64_t m_profilerId;
+    std::size_t m_maxStepsCount;
+    std::vector<ThreadSlot> m_threadSlots;
+    std::atomic<std::size_t> m_usedThreadSlots{};
+    std::atomic<std::uint64_t> m_droppedSamplesCount{};
+
+    mutable std::mutex m_namesMutex{};
+    std::vector<std::string> m_stepNames{};
+
+    [[nodiscard]] ThreadSlot* acquire_thread_slot() noexcept;
+};
+
+//!!
+//! \brief Prints the given profiles as a table, one step per line, with the latency
+//!  percentiles in microseconds.
+//!
+void PrintProfilesTable(std::ostream& ost, const std::vector<StepProfile>& profiles);
+
+//!!
+//! \brief Writes the given profiles as a JSON array. Every object contains the counts, the
+//!  latency percentiles in nanoseconds and the non-empty histogram buckets.
+//!
+void WriteProfilesJson(std::ostream& ost, const std::vector<StepProfile>& profiles);
+
+} // namespace gc::workflows
@@ -0,0 +1,273 @@
+// Copyright (c) 2023 Andrea Ballestrazzi
+#pragma once
+
+#include "workflows/work-stealing-thread-pool.hpp"
+#include "workflows/workflow-loop.hpp"
+
+// C++ STL
+#include <array>
+#include <concepts>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <queue>
+#include <stop_token>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace gc::workflows {
+
+//!!
+//! \brief The priority of a loop inside a WorkflowRunner. When the workers are all busy,
+//!  the ready loops are served with a weighted round robin: a high priority loop gets more
+//!  iterations than a low priority one, but no loop starves.
+//!
+enum class LoopPriority : std::uint8_t { Low, Normal, High };
+
+//!!
+//! \brief The state of a loop inside a WorkflowRunner.
+//!
+enum class LoopState : std::uint8_t {
+    //! Added but not started yet.
+    Idle,
+    //! Waiting for its next iteration to be due or for a free worker.
+    Scheduled,
+    //! An iteration is being executed.
+    Running,
+    Paused,
+    //! Stopped by the user. A stopped loop can't be started again.
+    Stopped,
+    //! The repeat mode has been satisfied.
+    Completed,
+    //! The workflow has failed.
+    Failed
+};
+
+//!!
+//! \brief A snapshot of the load of a WorkflowRunner.
+//!
+struct WorkflowRunnerMetrics {
+    //! Loops that are due and wait for a free worker, by priority (low, normal, high).
+    std::array<std::size_t, 3> readyLoopsCount{};
+    //! Loops whose next iteration isn't due yet.
+    std::size_t waitingLoopsCount{};
+    std::size_t runningLoopsCount{};
+    std::size_t workersCount{};
+    std::uint64_t iterationsCount{};
+    //! Time spent executing iterations by all the workers.
+    clock_type::duration busyTime{};
+    //! Time elapsed since the runner has been constructed.
+    clock_type::duration uptime{};
+
+    //!!
+    //! \brief Computes the average fraction of the workers that have been busy since the
+    //!  runner has been constructed.
+    //!
+    [[nodiscard]] double getUtilization() const noexcept {
+        const auto availableTime{uptime * static_cast<clock_type::rep>(workersCount)};
+        return availableTime.count() <= 0
+                   ? 0.0
+                   : static_cast<double>(busyTime.count()) /
+                         static_cast<double>(availableTime.count());
+    }
+};
+
+//!!
+//! \brief A concept that defines the requirements for a loop to be run by a WorkflowRunner.
+//!  WorkflowLoop satisfies it with any repeat mode.
+//!
+template <typename L>
+concept RunnableWorkflowLoop = requires(L l) {
+    { l.canRepeat() } -> std::convertible_to<bool>;
+    { l.executeIteration() } -> std::convertible_to<bool>;
+};
+
+namespace details {
+
+//!!
+//! \brief The type-erased interface of the loops owned by a WorkflowRunner.
+//!
+struct RunnableLoop {
+    virtual ~RunnableLoop() noexcept = default;
+
+    [[nodiscard]] virtual bool canRepeat() noexcept = 0;
+    [[nodiscard]] virtual bool executeIteration() noexcept = 0;
+
+    //!!
+    //! \brief Retrieves when the next iteration is due, or no value if the loop can
+    //!  iterate as soon as a worker is free.
+    //!
+    [[nodiscard]] virtual std::optional<clock_type::time_point> getNextIterationTime() noexcept = 0;
+};
+
+template <RunnableWorkflowLoop L>
+class RunnableLoopAdapter final : public RunnableLoop {
+public:
+    explicit RunnableLoopAdapter(L loop) noexcept(std::is_nothrow_move_constructible_v<L>)
+        : m_loop{std::move(loop)} {}
+
+    [[nodiscard]] bool canRepeat() noexcept override {
+        return m_loop.canRepeat();
+    }
+
+    [[nodiscard]] bool executeIteration() noexcept override {
+        return m_loop.executeIteration();
+    }
+
+    [[nodiscard]] std::optional<clock_type::time_point> getNextIterationTime() noexcept override {
+        if constexpr (requires { m_loop.getNextIterationTime(); }) {
+            return m_loop.getNextIterationTime();
+        } else {
+            return std::nullopt;
+        }
+    }
+
+private:
+    L m_loop;
+};
+
+} // namespace details
+
+//!!
+//! \brief Runs many independent workflow loops on a fixed number of threads. Instead of
+//!  blocking a thread per loop, the runner executes one iteration at a time: a loop whose
+//!  next iteration isn't due waits in a timer queue, and the due loops are dispatched to a
+//!  work-stealing pool following their priority.
+//!
+class WorkflowRunner final {
+public:
+    using loop_id_type = std::size_t;
+
+    //!!
+    //! \brief Construct a new runner and start its workers.
+    //!
+    //! \param[in] workersCount The number of threads that execute the iterations.
+    //!
+    explicit WorkflowRunner(std::size_t workersCount = std::thread::hardware_concurrency());
+
+    //!!
+    //! \brief Stop all the loops and wait for the running iterations to complete.
+    //!
+    ~WorkflowRunner() noexcept;
+
+    WorkflowRunner(const WorkflowRunner&) = delete;
+    WorkflowRunner& operator=(const WorkflowRunner&) = delete;
+
+    //!!
+    //! \brief Add a loop to the runner. The loop is idle until it's started.
+    //!
+    //! \param[in] loop The loop to run. Its workflow must outlive the runner.
+    //! \param[in] priority The priority of the loop.
+    //! \return The id of the loop inside the runner.
+    //!
+    template <RunnableWorkflowLoop L>
+    loop_id_type addLoop(L loop, LoopPriority priority = LoopPriority::Normal) {
+        return add_loop(std::make_unique<details::RunnableLoopAdapter<L>>(std::move(loop)),
+                        priority);
+    }
+
+    //!!
+    //! \brief Start an idle loop or resume a paused one.
+    //!
+    //! \return True if the loop has been started, false if it's in another state.
+    //!
+    bool start(loop_id_type loopId);
+
+    //!!
+    //! \brief Pause a loop. A running iteration completes before the loop is paused.
+    //!
+    //! \return True if the loop will be paused, false if it isn't scheduled or running.
+    //!
+    bool pause(loop_id_type loopId);
+
+    //!!
+    //! \brief Stop a loop for good. A running iteration completes before the loop is stopped.
+    //!
+    //! \return True if the loop will be stopped, false if it has already terminated.
+    //!
+    bool stop(loop_id_type loopId);
+
+    [[nodiscard]] LoopState getState(loop_id_type loopId) const;
+
+    //!!
+    //! \brief Block until the loop has stopped, completed or failed.
+    //!
+    //! \return The final state of the loop.
+    //!
+    LoopState wait(loop_id_type loopId);
+
+    [[nodiscard]] WorkflowRunnerMetrics getMetrics() const;
+
+private:
+    static constexpr std::size_t PRIORITIES_COUNT{3};
+    //! Iterations a priority level gets in a round, from low to high.
+    static constexpr std::array<std::size_t, PRIORITIES_COUNT> PRIORITY_WEIGHTS{1, 2, 4};
+
+    struct LoopEntry {
+        std::unique_ptr<details::RunnableLoop> loop;
+        LoopPriority priority;
+        LoopState state{LoopState::Idle};
+        // Increased when the loop leaves the queues, to discard its stale queue entries.
+        std::uint64_t generation{};
+        bool bPauseRequested{};
+        bool bStopRequested{};
+    };
+
+    struct QueueEntry {
+        loop_id_type loopId;
+        std::uint64_t generation;
+    };
+
+    struct TimerEntry {
+        clock_type::time_point dueTime;
+        std::uint64_t sequence;
+        QueueEntry entry;
+
+        [[nodiscard]] bool operator>(const TimerEntry& other) const noexcept {
+            return dueTime != other.dueTime ? dueTime > other.dueTime
+                                            : sequence > other.sequence;
+        }
+    };
+
+    const clock_type::time_point m_creationTime{clock_type::now()};
+
+    mutable std::mutex m_mutex{};
+    std::condition_variable_any m_dispatchCondition{};
+    std::condition_variable m_loopsCondition{};
+    bool m_bDispatchNeeded{};
+
+    std::vector<std::unique_ptr<LoopEntry>> m_loops{};
+    std::array<std::deque<QueueEntry>, PRIORITIES_COUNT> m_readyQueues{};
+    std::array<std::size_t, PRIORITIES_COUNT> m_credits{PRIORITY_WEIGHTS};
+    std::priority_queue<TimerEntry, std::vector<TimerEntry>, std::greater<>> m_timers{};
+    std::uint64_t m_timersSequence{};
+
+    std::size_t m_runningLoopsCount{};
+    std::uint64_t m_iterationsCount{};
+    clock_type::duration m_busyTime{};
+
+    WorkStealingThreadPool m_threadPool;
+    // The dispatcher is the last member so it's stopped before the rest is destroyed.
+    std::jthread m_dispatcher{};
+
+    loop_id_type add_loop(std::unique_ptr<details::RunnableLoop> loop, LoopPriority priority);
+
+    void dispatcher_loop(std::stop_token stopToken);
+    void run_iteration(loop_id_type loopId, LoopEntry& entry);
+
+    // The following methods must be called with the mutex held.
+    void schedule_loop(loop_id_type loopId);
+    void enqueue_ready_loop(loop_id_type loopId);
+    void dispatch_expired_timers(clock_type::time_point now);
+    [[nodiscard]] std::optional<loop_id_type> pop_next_ready_loop();
+    [[nodiscard]] bool is_current(const QueueEntry& entry) const noexcept;
+    void notify_dispatcher() noexcept;
+};
+
+} // namespace gc::workflows
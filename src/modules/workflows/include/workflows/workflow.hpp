@@ -5,10 +5,14 @@
 #include <functional>
 #include <list>
 #include <memory>
+#include <optional>
 #include <string>
+#include <vector>
 
 namespace gc::workflows {
 
+class WorkflowProfiler;
+
 using IdType = std::string;
 using IdView = std::string_view;
 
@@ -37,7 +41,8 @@ struct WorkflowStep {
 };
 
 //!!
-//! \brief A workflow is a set of tasks that can be executed in parallel or in sequence.
+//! \brief A workflow is a set of tasks that are executed in sequence. Use WorkflowGraph
+//!  for tasks with dependencies that can be executed in parallel.
 //!
 class Workflow final {
 public:
@@ -66,18 +71,29 @@ public:
     [[nodiscard]] bool execute() noexcept;
 
     //!!
-    //! \brief Add a task to the workflow
+    //! \brief Attach a profiler that records the executions of every step and of the whole
+    //!  workflow. The steps are registered as "<workflow-id>/<step-id>". Without a profiler
+    //!  the execution costs a single extra branch.
+    //!
+    //! \param[in] profiler The profiler, or nullptr to disable the profiling. It must
+    //!  outlive the workflow or be detached before being destroyed.
+    //!
+    void setProfiler(WorkflowProfiler* profiler);
+
+    //!!
+    //! \brief Add a task to the workflow. If the task can't be registered to the profiler,
+    //!  the exception is propagated and the workflow is left unchanged.
     //!
     //! \param[in] step The task to add
     //!
-    void addStep(std::unique_ptr<WorkflowStep> step) noexcept;
+    void addStep(std::unique_ptr<WorkflowStep> step);
 
     //!!
     //! \brief Remove a task from the workflow
     //!
     //! \param[in] stepId The id of the task to remove
     //!
-    void removeStep(IdView stepId) noexcept;
+    void removeStep(IdView stepId);
 
     // Getters
 
@@ -100,8 +116,18 @@ public:
     }
 
 private:
+    using profiler_index_type = std::optional<std::size_t>;
+
     id_type m_id;
     flow_type m_flow{};
+
+    WorkflowProfiler* m_profiler{};
+    // The index of the whole workflow and of every step inside the profiler, in flow order.
+    profiler_index_type m_profilerIndex{};
+    std::vector<profiler_index_type> m_stepProfilerIndices{};
+
+    [[nodiscard]] bool execute_profiled() noexcept;
+    void register_profiled_steps();
 };
 
 namespace steps {
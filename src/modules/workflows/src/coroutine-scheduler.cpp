@@ -0,0 +1,191 @@
+// Copyright (c) 2023 Andrea Ballestrazzi
+#include "workflows/coroutine-scheduler.hpp"
+
+// C++ STL
+#include <algorithm>
+#include <stdexcept>
+#include <utility>
+
+namespace gc::workflows::coroutines {
+
+std::coroutine_handle<> Task::promise_type::FinalAwaiter::await_suspend(
+    std::coroutine_handle<promise_type> handle) const noexcept {
+    promise_type& promise{handle.promise()};
+    if (promise.m_continuation) {
+        return promise.m_continuation;
+    }
+
+    // Only root tasks don't have a continuation. The frame can't be destroyed here as
+    // the coroutine is still running: the scheduler destroys it after the resume.
+    if (promise.m_scheduler != nullptr) {
+        promise.m_scheduler->root_task_completed(handle);
+    }
+
+    return std::noop_coroutine();
+}
+
+Scheduler::~Scheduler() noexcept {
+    // Child tasks are owned by the frames of their parents, so destroying the roots
+    // releases all the frames.
+    for (Task::handle_type handle : m_rootTasks) {
+        handle.destroy();
+    }
+
+    destroy_completed_tasks();
+}
+
+void Scheduler::spawn(Task task) {
+    // An empty (moved-from) or completed task has no frame that can be resumed.
+    if (task.done())
+        throw std::invalid_argument{"Only a task that hasn't completed can be spawned."};
+
+    m_readyQueue.push_back(task.m_handle);
+
+    try {
+        m_rootTasks.push_back(task.m_handle);
+    } catch (...) {
+        m_readyQueue.pop_back();
+        throw;
+    }
+
+    Task::handle_type handle{task.release()};
+    handle.promise().m_scheduler = this;
+    handle.promise().m_rootIndex = m_rootTasks.size() - 1;
+}
+
+std::size_t Scheduler::run(std::stop_token stopToken) {
+    std::size_t completedTasksCount{};
+
+    while (!m_rootTasks.empty() && !stopToken.stop_requested()) {
+        dispatch_pending_edges();
+        dispatch_expired_timers(clock_type::now());
+
+        if (m_readyQueue.empty()) {
+            wait_for_events(stopToken);
+            continue;
+        }
+
+        // Only the coroutines that are ready now are resumed, so that the timers and the
+        // edges are dispatched regularly even when the tasks keep yielding.
+        for (std::size_t readyCount{m_readyQueue.size()}; readyCount > 0; --readyCount) {
+            std::coroutine_handle<> handle{m_readyQueue.front()};
+            m_readyQueue.pop_front();
+            handle.resume();
+        }
+
+        completedTasksCount += m_completedTasks.size();
+        destroy_completed_tasks();
+    }
+
+    return completedTasksCount;
+}
+
+void Scheduler::notifyPinEdge(pin_offset_type pinOffset, EdgeType edge) {
+    {
+        std::lock_guard lock{m_eventsMutex};
+        m_pendingEdges.push_back(PinEdgeEvent{pinOffset, edge});
+    }
+
+    m_eventsCondition.notify_one();
+}
+
+void Scheduler::resumeAt(clock_type::time_point deadline, std::coroutine_handle<> handle) {
+    m_timers.push(TimerEntry{deadline, m_timersSequence++, handle, 0});
+}
+
+void Scheduler::resumeOnPinEdge(pin_offset_type pinOffset, EdgeType edge,
+                                std::optional<clock_type::time_point> deadline,
+                                std::coroutine_handle<> handle, bool& bEdgeDetected) {
+    const wait_id_type waitId{++m_lastWaitId};
+    m_pinEdgeWaits.push_back(PinEdgeWait{waitId, pinOffset, edge, handle, &bEdgeDetected});
+
+    if (deadline.has_value()) {
+        m_timers.push(TimerEntry{*deadline, m_timersSequence++, handle, waitId});
+    }
+}
+
+void Scheduler::root_task_completed(Task::handle_type handle) noexcept {
+    // Swap and pop, keeping the index of the moved task up to date.
+    const std::size_t index{handle.promise().m_rootIndex};
+    m_rootTasks[index] = m_rootTasks.back();
+    m_rootTasks[index].promise().m_rootIndex = index;
+    m_rootTasks.pop_back();
+
+    if (!handle.promise().m_bResult) {
+        ++m_failedTasksCount;
+    }
+
+    m_completedTasks.push_back(handle);
+}
+
+void Scheduler::destroy_completed_tasks() noexcept {
+    for (Task::handle_type handle : m_completedTasks) {
+        handle.destroy();
+    }
+
+    m_completedTasks.clear();
+}
+
+void Scheduler::dispatch_pending_edges() {
+    std::vector<PinEdgeEvent> edges{};
+    {
+        std::lock_guard lock{m_eventsMutex};
+        edges.swap(m_pendingEdges);
+    }
+
+    for (const PinEdgeEvent& event : edges) {
+        const auto matchesEvent{[&event](const PinEdgeWait& wait) {
+            return wait.pinOffset == event.pinOffset &&
+                   (wait.edge == EdgeType::Both || wait.edge == event.edge);
+        }};
+
+        const auto firstMatchIt{
+            std::stable_partition(m_pinEdgeWaits.begin(), m_pinEdgeWaits.end(),
+                                  [&matchesEvent](const PinEdgeWait& wait) {
+                                      return !matchesEvent(wait);
+                                  })};
+
+        for (auto it{firstMatchIt}; it != m_pinEdgeWaits.end(); ++it) {
+            *it->bEdgeDetected = true;
+            m_readyQueue.push_back(it->handle);
+        }
+
+        m_pinEdgeWaits.erase(firstMatchIt, m_pinEdgeWaits.end());
+    }
+}
+
+void Scheduler::dispatch_expired_timers(clock_type::time_point now) {
+    while (!m_timers.empty() && m_timers.top().deadline <= now) {
+        const TimerEntry timer{m_timers.top()};
+        m_timers.pop();
+
+        if (timer.waitId != 0) {
+            // The timeout of a pin edge wait: it's ignored if the edge came first.
+            const auto waitIt{std::ranges::find(m_pinEdgeWaits, timer.waitId,
+                                                &PinEdgeWait::waitId)};
+            if (waitIt == m_pinEdgeWaits.end()) {
+                continue;
+            }
+
+            m_pinEdgeWaits.erase(waitIt);
+        }
+
+        m_readyQueue.push_back(timer.handle);
+    }
+}
+
+void Scheduler::wait_for_events(const std::stop_token& stopToken) {
+    std::unique_lock lock{m_eventsMutex};
+    const auto hasPendingEdges{[this] {
+        return !m_pendingEdges.empty();
+    }};
+
+    if (m_timers.empty()) {
+        static_cast<void>(m_eventsCondition.wait(lock, stopToken, hasPendingEdges));
+    } else {
+        static_cast<void>(m_eventsCondition.wait_until(lock, stopToken, m_timers.top().deadline,
+                                                       hasPendingEdges));
+    }
+}
+
+} // namespace gc::workflows::coroutines
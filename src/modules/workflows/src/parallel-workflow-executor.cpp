@@ -0,0 +1,96 @@
+// Copyright (c) 2023 Andrea Ballestrazzi
+#include "workflows/parallel-workflow-executor.hpp"
+
+// C++ STL
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <vector>
+
+namespace gc::workflows {
+
+namespace details {
+
+//!!
+//! \brief The state shared by the tasks of a single graph execution. It lives on the stack
+//!  of ParallelWorkflowExecutor::execute(), which doesn't return until every task is done.
+//!
+class GraphExecution final {
+public:
+    using step_index = WorkflowGraph::step_index;
+
+    GraphExecution(WorkflowGraph& graph, WorkStealingThreadPool& threadPool)
+        : m_graph{graph},
+          m_threadPool{threadPool},
+          m_remainingDependencies(graph.size()) {
+        for (step_index i{}; i < graph.size(); ++i)
+            m_remainingDependencies[i].store(graph.getDependenciesCount(i));
+    }
+
+    [[nodiscard]] bool run() {
+        for (step_index i{}; i < m_graph.size(); ++i) {
+            if (m_graph.getDependenciesCount(i) == 0)
+                schedule(i);
+        }
+
+        std::unique_lock lock{m_mutex};
+        m_completionCondition.wait(lock, [this] {
+            return m_inFlightSteps == 0;
+        });
+
+        return !m_bFailed.load() && m_executedSteps.load() == m_graph.size();
+    }
+
+private:
+    WorkflowGraph& m_graph;
+    WorkStealingThreadPool& m_threadPool;
+    std::vector<std::atomic<std::size_t>> m_remainingDependencies;
+    std::atomic<bool> m_bFailed{};
+    std::atomic<std::size_t> m_executedSteps{};
+
+    std::mutex m_mutex{};
+    std::condition_variable m_completionCondition{};
+    std::size_t m_inFlightSteps{};
+
+    void schedule(step_index index) {
+        {
+            std::lock_guard lock{m_mutex};
+            ++m_inFlightSteps;
+        }
+
+        m_threadPool.submit([this, index] {
+            execute_step(index);
+        });
+    }
+
+    void execute_step(step_index index) {
+        // A failed step cancels all the steps that haven't been started yet.
+        if (!m_bFailed.load()) {
+            if (m_graph.getStep(index).execute()) {
+                m_executedSteps.fetch_add(1);
+
+                // The dependents are scheduled before this step is marked as done,
+                // so the number of in-flight steps can't reach zero too early.
+                for (const step_index dependent : m_graph.getDependents(index)) {
+                    if (m_remainingDependencies[dependent].fetch_sub(1) == 1)
+                        schedule(dependent);
+                }
+            } else {
+                m_bFailed.store(true);
+            }
+        }
+
+        std::lock_guard lock{m_mutex};
+        if (--m_inFlightSteps == 0)
+            m_completionCondition.notify_all();
+    }
+};
+
+} // namespace details
+
+bool ParallelWorkflowExecutor::execute(WorkflowGraph& graph) noexcept {
+    details::GraphExecution execution{graph, m_threadPool};
+    return execution.run();
+}
+
+} // namespace gc::workflows
@@ -0,0 +1,107 @@
+// Copyright (c) 2023 Andrea Ballestrazzi
+#include "workflows/timed-repeat-modes.hpp"
+
+// C++ STL
+#include <algorithm>
+#include <condition_variable>
+#include <mutex>
+
+namespace gc::workflows {
+
+bool SleepUntil(clock_type::time_point deadline, std::stop_token stopToken) noexcept {
+    // The condition variable is only used to wait: the stop callback registered by
+    // wait_until() wakes it up as soon as the stop is requested.
+    std::mutex sleepMutex{};
+    std::condition_variable_any sleepCondition{};
+
+    std::unique_lock lock{sleepMutex};
+    static_cast<void>(sleepCondition.wait_until(lock, stopToken, deadline, [] {
+        return false;
+    }));
+
+    return !stopToken.stop_requested();
+}
+
+namespace repeat_modes {
+
+namespace {
+
+void RecordLateness(TimingStatistics& statistics, clock_type::time_point scheduledTime,
+                    clock_type::time_point startTime) noexcept {
+    statistics.worstLateness = std::max(statistics.worstLateness, startTime - scheduledTime);
+}
+
+} // namespace
+
+bool FixedRate::waitNextIteration(std::stop_token stopToken) noexcept {
+    // The iteration start is notified by the loop, right before the execution.
+    return SleepUntil(getNextIterationTime(), std::move(stopToken));
+}
+
+clock_type::time_point FixedRate::getNextIterationTime() noexcept {
+    // The schedule starts with the first iteration.
+    if (!m_nextActivation.has_value())
+        m_nextActivation = clock_type::now();
+
+    return *m_nextActivation;
+}
+
+void FixedRate::iterationStarted() noexcept {
+    m_currentActivation = getNextIterationTime();
+    RecordLateness(m_statistics, m_currentActivation, clock_type::now());
+}
+
+void FixedRate::iterationDone() noexcept {
+    --m_remainingIterations;
+    ++m_statistics.iterations;
+
+    const clock_type::time_point now{clock_type::now()};
+    clock_type::time_point nextActivation{m_currentActivation + m_period};
+
+    if (now > nextActivation) {
+        ++m_statistics.overruns;
+
+        switch (m_policy) {
+        case MissedDeadlinePolicy::Skip: {
+            // First activation of the original schedule that is still in the future.
+            const auto elapsedPeriods{(now - m_currentActivation) / m_period};
+            nextActivation = m_currentActivation + (elapsedPeriods + 1) * m_period;
+            break;
+        }
+        case MissedDeadlinePolicy::Restart:
+            nextActivation = now;
+            break;
+        case MissedDeadlinePolicy::CatchUp:
+        default:
+            break;
+        }
+    }
+
+    m_nextActivation = nextActivation;
+}
+
+bool FixedDelay::waitNextIteration(std::stop_token stopToken) noexcept {
+    // The iteration start is notified by the loop, right before the execution.
+    return SleepUntil(getNextIterationTime(), std::move(stopToken));
+}
+
+clock_type::time_point FixedDelay::getNextIterationTime() noexcept {
+    // The first iteration starts immediately.
+    return m_nextActivation.value_or(clock_type::now());
+}
+
+void FixedDelay::iterationStarted() noexcept {
+    if (m_nextActivation.has_value())
+        RecordLateness(m_statistics, *m_nextActivation, clock_type::now());
+}
+
+void FixedDelay::iterationDone() noexcept {
+    --m_remainingIterations;
+    ++m_statistics.iterations;
+
+    m_nextActivation = clock_type::now() + m_delay;
+}
+
+} // namespace repeat_modes
+
+} // namespace gc::workflows
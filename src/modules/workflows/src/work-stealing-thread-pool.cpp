@@ -0,0 +1,109 @@
+// Copyright (c) 2023 Andrea Ballestrazzi
+#include "workflows/work-stealing-thread-pool.hpp"
+
+// C++ STL
+#include <algorithm>
+
+namespace gc::workflows {
+
+namespace details {
+
+// The pool and the index of the worker running on the current thread, if any.
+// They let submit() push the tasks spawned by a task to the queue of its worker.
+thread_local const WorkStealingThreadPool* tl_currentPool{};
+thread_local std::size_t tl_currentWorkerIndex{};
+
+} // namespace details
+
+WorkStealingThreadPool::WorkStealingThreadPool(std::size_t workersCount) {
+    const std::size_t finalWorkersCount{std::max<std::size_t>(workersCount, 1)};
+
+    m_queues.reserve(finalWorkersCount);
+    for (std::size_t i{}; i < finalWorkersCount; ++i)
+        m_queues.push_back(std::make_unique<WorkerQueue>());
+
+    m_workers.reserve(finalWorkersCount);
+    for (std::size_t i{}; i < finalWorkersCount; ++i) {
+        m_workers.emplace_back([this, i](std::stop_token stopToken) {
+            worker_loop(std::move(stopToken), i);
+        });
+    }
+}
+
+WorkStealingThreadPool::~WorkStealingThreadPool() noexcept {
+    for (auto& worker : m_workers)
+        worker.request_stop();
+
+    m_wakeUpCondition.notify_all();
+    m_workers.clear();
+}
+
+void WorkStealingThreadPool::submit(task_type task) {
+    const std::size_t queueIndex{details::tl_currentPool == this
+                                     ? details::tl_currentWorkerIndex
+                                     : m_nextQueue.fetch_add(1) % m_queues.size()};
+
+    // The counter is increased before the task is visible, so a worker that takes the task
+    // can never bring it below zero.
+    {
+        std::lock_guard lock{m_wakeUpMutex};
+        m_queuedTasks.fetch_add(1);
+    }
+
+    {
+        std::lock_guard lock{m_queues[queueIndex]->mutex};
+        m_queues[queueIndex]->tasks.push_back(std::move(task));
+    }
+    m_wakeUpCondition.notify_one();
+}
+
+void WorkStealingThreadPool::worker_loop(std::stop_token stopToken,
+                                         std::size_t workerIndex) noexcept {
+    details::tl_currentPool = this;
+    details::tl_currentWorkerIndex = workerIndex;
+
+    while (!stopToken.stop_requested()) {
+        if (std::optional<task_type> task{try_take_task(workerIndex)}; task.has_value()) {
+            (*task)();
+            continue;
+        }
+
+        std::unique_lock lock{m_wakeUpMutex};
+        m_wakeUpCondition.wait(lock, stopToken, [this] {
+            return m_queuedTasks.load() > 0;
+        });
+    }
+}
+
+auto WorkStealingThreadPool::try_take_task(std::size_t workerIndex) noexcept
+    -> std::optional<task_type> {
+    const auto takeTask{[this](WorkerQueue& queue, bool bNewest) -> std::optional<task_type> {
+        std::lock_guard lock{queue.mutex};
+        if (queue.tasks.empty())
+            return std::nullopt;
+
+        task_type task{bNewest ? std::move(queue.tasks.back()) : std::move(queue.tasks.front())};
+        if (bNewest)
+            queue.tasks.pop_back();
+        else
+            queue.tasks.pop_front();
+
+        m_queuedTasks.fetch_sub(1);
+        return task;
+    }};
+
+    // Own queue first, newest task first: it's the one with the hottest data.
+    if (auto task{takeTask(*m_queues[workerIndex], true)}; task.has_value())
+        return task;
+
+    // Then steal the oldest task from the other workers.
+    for (std::size_t offset{1}; offset < m_queues.size(); ++offset) {
+        const std::size_t victimIndex{(workerIndex + offset) % m_queues.size()};
+        if (auto task{takeTask(*m_queues[victimIndex], false)}; task.has_value())
+            return task;
+    }
+
+    return std::nullopt;
+}
+
+} // namespace gc::workflows
@@ -0,0 +1,53 @@
+// Copyright (c) 2023 Andrea Ballestrazzi
+#include "workflows/workflow-graph.hpp"
+
+// C++ STL
+#include <algorithm>
+
+namespace gc::workflows {
+
+bool WorkflowGraph::addStep(step_pointer step, const std::vector<IdView>& dependencies) noexcept {
+    if (!step)
+        return false;
+
+    id_type stepId{step->id()};
+    if (m_indices.contains(stepId))
+        return false;
+
+    std::vector<step_index> dependencyIndices{};
+    dependencyIndices.reserve(dependencies.size());
+
+    for (const IdView dependency : dependencies) {
+        const std::optional<step_index> dependencyIndex{findStep(dependency)};
+        if (!dependencyIndex.has_value())
+            return false;
+
+        // Duplicated dependencies would be counted twice and the step would never be ready.
+        if (std::ranges::find(dependencyIndices, *dependencyIndex) == dependencyIndices.end())
+            dependencyIndices.push_back(*dependencyIndex);
+    }
+
+    const step_index newIndex{m_nodes.size()};
+    for (const step_index dependencyIndex : dependencyIndices)
+        m_nodes[dependencyIndex].dependents.push_back(newIndex);
+
+    m_indices.emplace(std::move(stepId), newIndex);
+    m_nodes.push_back(Node{std::move(step), dependencyIndices.size(), {}});
+    return true;
+}
+
+bool WorkflowGraph::execute() noexcept {
+    return std::ranges::all_of(m_nodes, [](Node& node) {
+        return node.step->execute();
+    });
+}
+
+std::optional<WorkflowGraph::step_index> WorkflowGraph::findStep(IdView stepId) const noexcept {
+    const auto indexIt{m_indices.find(stepId)};
+    if (indexIt == m_indices.end())
+        return std::nullopt;
+
+    return indexIt->second;
+}
+
+} // namespace gc::workflows
@@ -0,0 +1,248 @@
+// Copyright (c) 2023 Andrea Ballestrazzi
+#include "workflows/workflow-profiler.hpp"
+
+// C++ STL
+#include <algorithm>
+#include <array>
+#include <iomanip>
+#include <utility>
+
+namespace gc::workflows {
+
+namespace {
+
+// Profilers are identified by a unique id instead of their address, so that a thread
+// can't reuse the cached slot of a destroyed profiler.
+std::atomic<std::uint64_t> g_nextProfilerId{1};
+
+void IncrementCounter(std::atomic<std::uint64_t>& counter, std::uint64_t value = 1) noexcept {
+    counter.store(counter.load(std::memory_order_relaxed) + value, std::memory_order_relaxed);
+}
+
+constexpr std::array<double, 3> PERCENTILES{0.5, 0.9, 0.99};
+
+void WriteJsonString(std::ostream& ost, std::string_view value) {
+    ost << '"';
+    for (const char c : value) {
+        switch (c) {
+        case '"':
+            ost << "\\\"";
+            break;
+        case '\\':
+            ost << "\\\\";
+            break;
+        default:
+            if (static_cast<unsigned char>(c) < 0x20) {
+                ost << "\\u" << std::hex << std::setw(4) << std::setfill('0')
+                    << static_cast<int>(c) << std::dec << std::setfill(' ');
+            } else {
+                ost << c;
+            }
+            break;
+        }
+    }
+    ost << '"';
+}
+
+} // namespace
+
+WorkflowProfiler::WorkflowProfiler(std::size_t maxStepsCount, std::size_t maxThreadsCount)
+    : m_profilerId{g_nextProfilerId.fetch_add(1, std::memory_order_relaxed)},
+      m_maxStepsCount{maxStepsCount},
+      m_threadSlots(std::max<std::size_t>(maxThreadsCount, 1)) {
+    for (ThreadSlot& slot : m_threadSlots) {
+        slot.steps = std::make_unique<StepCounters[]>(m_maxStepsCount);
+    }
+
+    m_stepNames.reserve(m_maxStepsCount);
+}
+
+std::optional<WorkflowProfiler::step_index_type> WorkflowProfiler::registerStep(
+    std::string_view name) {
+    std::lock_guard lock{m_namesMutex};
+
+    const auto stepIt{std::ranges::find(m_stepNames, name)};
+    if (stepIt != m_stepNames.end()) {
+        return static_cast<step_index_type>(std::distance(m_stepNames.begin(), stepIt));
+    }
+
+    if (m_stepNames.size() >= m_maxStepsCount) {
+        return std::nullopt;
+    }
+
+    m_stepNames.emplace_back(name);
+    return m_stepNames.size() - 1;
+}
+
+void WorkflowProfiler::record(step_index_type stepIndex, clock_type::duration elapsedTime,
+                              bool bSucceeded) noexcept {
+    ThreadSlot* const slot{acquire_thread_slot()};
+    if (slot == nullptr || stepIndex >= m_maxStepsCount) {
+        m_droppedSamplesCount.fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
+
+    const auto nanoseconds{static_cast<std::uint64_t>(
+        std::max<std::chrono::nanoseconds::rep>(
+            std::chrono::duration_cast<std::chrono::nanoseconds>(elapsedTime).count(), 0))};
+
+    StepCounters& counters{slot->steps[stepIndex]};
+    IncrementCounter(counters.callsCount);
+    if (!bSucceeded) {
+        IncrementCounter(counters.failuresCount);
+    }
+
+    IncrementCounter(counters.totalTime, nanoseconds);
+    if (nanoseconds > counters.maxTime.load(std::memory_order_relaxed)) {
+        counters.maxTime.store(nanoseconds, std::memory_order_relaxed);
+    }
+
+    IncrementCounter(counters.buckets[LatencyHistogram::GetBucketIndex(nanoseconds)]);
+}
+
+std::vector<StepProfile> WorkflowProfiler::getProfiles() const {
+    std::vector<StepProfile> profiles{};
+    {
+        std::lock_guard lock{m_namesMutex};
+        profiles.resize(m_stepNames.size());
+        for (std::size_t i{}; i < m_stepNames.size(); ++i) {
+            profiles[i].name = m_stepNames[i];
+        }
+    }
+
+    const std::size_t usedSlotsCount{
+        std::min(m_usedThreadSlots.load(std::memory_order_acquire), m_threadSlots.size())};
+    for (std::size_t slotIndex{}; slotIndex < usedSlotsCount; ++slotIndex) {
+        const ThreadSlot& slot{m_threadSlots[slotIndex]};
+
+        for (std::size_t stepIndex{}; stepIndex < profiles.size(); ++stepIndex) {
+            const StepCounters& counters{slot.steps[stepIndex]};
+            StepProfile& profile{profiles[stepIndex]};
+
+            profile.callsCount += counters.callsCount.load(std::memory_order_relaxed);
+            profile.failuresCount += counters.failuresCount.load(std::memory_order_relaxed);
+            profile.latency.addSum(counters.totalTime.load(std::memory_order_relaxed),
+                                   counters.maxTime.load(std::memory_order_relaxed));
+
+            for (std::size_t bucket{}; bucket < LatencyHistogram::BUCKETS_COUNT; ++bucket) {
+                const std::uint64_t count{
+                    counters.buckets[bucket].load(std::memory_order_relaxed)};
+                if (count != 0) {
+                    profile.latency.addToBucket(bucket, count);
+                }
+            }
+        }
+    }
+
+    return profiles;
+}
+
+WorkflowProfiler::ThreadSlot* WorkflowProfiler::acquire_thread_slot() noexcept {
+    struct CachedSlot {
+        std::uint64_t profilerId{};
+        ThreadSlot* slot{};
+    };
+
+    thread_local CachedSlot cachedSlot{};
+    if (cachedSlot.profilerId == m_profilerId) {
+        return cachedSlot.slot;
+    }
+
+    // The thread may already own a slot of this profiler if it has recorded samples for
+    // another profiler in the meantime.
+    const std::thread::id threadId{std::this_thread::get_id()};
+    const std::size_t usedSlotsCount{
+        std::min(m_usedThreadSlots.load(std::memory_order_acquire), m_threadSlots.size())};
+
+    ThreadSlot* slot{};
+    for (std::size_t i{}; i < usedSlotsCount && slot == nullptr; ++i) {
+        if (m_threadSlots[i].owner.load(std::memory_order_relaxed) == threadId) {
+            slot = &m_threadSlots[i];
+        }
+    }
+
+    if (slot == nullptr) {
+        // When all the slots are taken the null slot is cached too, so the thread doesn't
+        // search again at every sample.
+        const std::size_t slotIndex{m_usedThreadSlots.fetch_add(1, std::memory_order_acq_rel)};
+        if (slotIndex < m_threadSlots.size()) {
+            slot = &m_threadSlots[slotIndex];
+            slot->owner.store(threadId, std::memory_order_relaxed);
+        }
+    }
+
+    cachedSlot = CachedSlot{m_profilerId, slot};
+    return slot;
+}
+
+void PrintProfilesTable(std::ostream& ost, const std::vector<StepProfile>& profiles) {
+    constexpr int NAME_WIDTH{40};
+    constexpr int COLUMN_WIDTH{12};
+
+    const auto toMicroseconds{[](LatencyHistogram::value_type nanoseconds) {
+        return static_cast<double>(nanoseconds) / 1e3;
+    }};
+
+    const auto previousFlags{ost.flags()};
+    const auto previousPrecision{ost.precision()};
+
+    ost << std::left << std::setw(NAME_WIDTH) << "step" << std::right
+        << std::setw(COLUMN_WIDTH) << "calls" << std::setw(COLUMN_WIDTH) << "failures"
+        << std::setw(COLUMN_WIDTH) << "mean[us]" << std::setw(COLUMN_WIDTH) << "p50[us]"
+        << std::setw(COLUMN_WIDTH) << "p90[us]" << std::setw(COLUMN_WIDTH) << "p99[us]"
+        << std::setw(COLUMN_WIDTH) << "max[us]" << '\n';
+
+    ost << std::fixed << std::setprecision(2);
+
+    for (const StepProfile& profile : profiles) {
+        ost << std::left << std::setw(NAME_WIDTH) << profile.name << std::right
+            << std::setw(COLUMN_WIDTH) << profile.callsCount << std::setw(COLUMN_WIDTH)
+            << profile.failuresCount << std::setw(COLUMN_WIDTH)
+            << profile.latency.getMean() / 1e3;
+
+        for (const double percentile : PERCENTILES) {
+            ost << std::setw(COLUMN_WIDTH)
+                << toMicroseconds(profile.latency.getValueAtQuantile(percentile));
+        }
+
+        ost << std::setw(COLUMN_WIDTH) << toMicroseconds(profile.latency.getMax()) << '\n';
+    }
+
+    ost.flags(previousFlags);
+    ost.precision(previousPrecision);
+}
+
+void WriteProfilesJson(std::ostream& ost, const std::vector<StepProfile>& profiles) {
+    ost << '[';
+    for (std::size_t i{}; i < profiles.size(); ++i) {
+        const StepProfile& profile{profiles[i]};
+        const LatencyHistogram& latency{profile.latency};
+
+        ost << (i == 0 ? "" : ",") << "{\"name\":";
+        WriteJsonString(ost, profile.name);
+        ost << ",\"calls\":" << profile.callsCount << ",\"failures\":" << profile.failuresCount
+            << ",\"meanNs\":" << static_cast<std::uint64_t>(latency.getMean())
+            << ",\"p50Ns\":" << latency.getValueAtQuantile(PERCENTILES[0])
+            << ",\"p90Ns\":" << latency.getValueAtQuantile(PERCENTILES[1])
+            << ",\"p99Ns\":" << latency.getValueAtQuantile(PERCENTILES[2])
+            << ",\"maxNs\":" << latency.getMax() << ",\"buckets\":[";
+
+        // Only the non-empty buckets, as [lower bound, upper bound, count] triples.
+        bool bFirstBucket{true};
+        for (std::size_t bucket{}; bucket < LatencyHistogram::BUCKETS_COUNT; ++bucket) {
+            const LatencyHistogram::count_type count{latency.getBuckets()[bucket]};
+            if (count == 0) {
+                continue;
+            }
+
+            ost << (bFirstBucket ? "" : ",") << '[' << LatencyHistogram::GetBucketLowerBound(bucket)
+                << ',' << LatencyHistogram::GetBucketUpperBound(bucket) << ',' << count << ']';
+            bFirstBucket = false;
+        }
+
+        ost << "]}";
+    }
+    ost << ']';
+}
+
+} // namespace gc::workflows
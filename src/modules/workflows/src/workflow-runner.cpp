@@ -0,0 +1,286 @@
+// Copyright (c) 2023 Andrea Ballestrazzi
+#include "workflows/workflow-runner.hpp"
+
+// C++ STL
+#include <algorithm>
+
+namespace gc::workflows {
+
+namespace {
+
+[[nodiscard]] constexpr bool IsTerminal(LoopState state) noexcept {
+    return state == LoopState::Stopped || state == LoopState::Completed ||
+           state == LoopState::Failed;
+}
+
+} // namespace
+
+WorkflowRunner::WorkflowRunner(std::size_t workersCount) : m_threadPool{workersCount} {
+    m_dispatcher = std::jthread{[this](std::stop_token stopToken) {
+        dispatcher_loop(std::move(stopToken));
+    }};
+}
+
+WorkflowRunner::~WorkflowRunner() noexcept {
+    m_dispatcher.request_stop();
+    m_dispatcher.join();
+
+    // The iterations already submitted to the pool use the loops, so they must complete
+    // before the members are destroyed.
+    std::unique_lock lock{m_mutex};
+    m_loopsCondition.wait(lock, [this] {
+        return m_runningLoopsCount == 0;
+    });
+}
+
+bool WorkflowRunner::start(loop_id_type loopId) {
+    std::lock_guard lock{m_mutex};
+    LoopEntry& entry{*m_loops.at(loopId)};
+
+    if (entry.state == LoopState::Running && entry.bPauseRequested) {
+        // Resumed before the running iteration has completed.
+        entry.bPauseRequested = false;
+        return true;
+    }
+
+    if (entry.state != LoopState::Idle && entry.state != LoopState::Paused) {
+        return false;
+    }
+
+    schedule_loop(loopId);
+    return true;
+}
+
+bool WorkflowRunner::pause(loop_id_type loopId) {
+    std::lock_guard lock{m_mutex};
+    LoopEntry& entry{*m_loops.at(loopId)};
+
+    switch (entry.state) {
+    case LoopState::Scheduled:
+        entry.state = LoopState::Paused;
+        ++entry.generation;
+        m_loopsCondition.notify_all();
+        return true;
+    case LoopState::Running:
+        entry.bPauseRequested = true;
+        return true;
+    default:
+        return false;
+    }
+}
+
+bool WorkflowRunner::stop(loop_id_type loopId) {
+    std::lock_guard lock{m_mutex};
+    LoopEntry& entry{*m_loops.at(loopId)};
+
+    if (IsTerminal(entry.state)) {
+        return false;
+    }
+
+    if (entry.state == LoopState::Running) {
+        entry.bStopRequested = true;
+        return true;
+    }
+
+    entry.state = LoopState::Stopped;
+    ++entry.generation;
+    m_loopsCondition.notify_all();
+    return true;
+}
+
+LoopState WorkflowRunner::getState(loop_id_type loopId) const {
+    std::lock_guard lock{m_mutex};
+    return m_loops.at(loopId)->state;
+}
+
+LoopState WorkflowRunner::wait(loop_id_type loopId) {
+    std::unique_lock lock{m_mutex};
+    const LoopEntry& entry{*m_loops.at(loopId)};
+
+    m_loopsCondition.wait(lock, [&entry] {
+        return IsTerminal(entry.state);
+    });
+
+    return entry.state;
+}
+
+WorkflowRunnerMetrics WorkflowRunner::getMetrics() const {
+    std::lock_guard lock{m_mutex};
+
+    WorkflowRunnerMetrics metrics{};
+    metrics.workersCount = m_threadPool.getWorkersCount();
+    metrics.runningLoopsCount = m_runningLoopsCount;
+    metrics.iterationsCount = m_iterationsCount;
+    metrics.busyTime = m_busyTime;
+    metrics.uptime = clock_type::now() - m_creationTime;
+
+    // The queues may contain stale entries, so only the current ones are counted.
+    for (std::size_t priority{}; priority < PRIORITIES_COUNT; ++priority) {
+        metrics.readyLoopsCount[priority] = static_cast<std::size_t>(
+            std::ranges::count_if(m_readyQueues[priority], [this](const QueueEntry& entry) {
+                return is_current(entry);
+            }));
+    }
+
+    const std::size_t readyLoopsCount{metrics.readyLoopsCount[0] + metrics.readyLoopsCount[1] +
+                                      metrics.readyLoopsCount[2]};
+    const std::size_t scheduledLoopsCount{
+        static_cast<std::size_t>(std::ranges::count_if(m_loops, [](const auto& entry) {
+            return entry->state == LoopState::Scheduled;
+        }))};
+    metrics.waitingLoopsCount = scheduledLoopsCount - readyLoopsCount;
+
+    return metrics;
+}
+
+WorkflowRunner::loop_id_type WorkflowRunner::add_loop(std::unique_ptr<details::RunnableLoop> loop,
+                                                      LoopPriority priority) {
+    std::lock_guard lock{m_mutex};
+    m_loops.push_back(std::make_unique<LoopEntry>(LoopEntry{std::move(loop), priority}));
+    return m_loops.size() - 1;
+}
+
+void WorkflowRunner::dispatcher_loop(std::stop_token stopToken) {
+    std::unique_lock lock{m_mutex};
+
+    while (!stopToken.stop_requested()) {
+        m_bDispatchNeeded = false;
+        dispatch_expired_timers(clock_type::now());
+
+        // Only as many iterations as the workers are submitted, so that the priorities
+        // decide which loop runs next instead of the order of the pool queues.
+        while (m_runningLoopsCount < m_threadPool.getWorkersCount()) {
+            const std::optional<loop_id_type> loopId{pop_next_ready_loop()};
+            if (!loopId.has_value()) {
+                break;
+            }
+
+            LoopEntry* const entry{m_loops[*loopId].get()};
+            entry->state = LoopState::Running;
+            ++m_runningLoopsCount;
+            m_threadPool.submit([this, id = *loopId, entry] {
+                run_iteration(id, *entry);
+            });
+        }
+
+        const auto needsDispatch{[this] {
+            return m_bDispatchNeeded;
+        }};
+
+        if (m_timers.empty()) {
+            m_dispatchCondition.wait(lock, stopToken, needsDispatch);
+        } else {
+            m_dispatchCondition.wait_until(lock, stopToken, m_timers.top().dueTime,
+                                           needsDispatch);
+        }
+    }
+}
+
+void WorkflowRunner::run_iteration(loop_id_type loopId, LoopEntry& entry) {
+    // The loop isn't used by the other threads while it's running: they only change the
+    // request flags, which are read under the mutex.
+    const clock_type::time_point startTime{clock_type::now()};
+    const bool bSucceeded{entry.loop->executeIteration()};
+    const bool bCanRepeat{bSucceeded && entry.loop->canRepeat()};
+    const clock_type::time_point endTime{clock_type::now()};
+
+    std::lock_guard lock{m_mutex};
+    --m_runningLoopsCount;
+    ++m_iterationsCount;
+    m_busyTime += endTime - startTime;
+    ++entry.generation;
+
+    if (!bSucceeded) {
+        entry.state = LoopState::Failed;
+    } else if (entry.bStopRequested) {
+        entry.state = LoopState::Stopped;
+    } else if (!bCanRepeat) {
+        entry.state = LoopState::Completed;
+    } else if (entry.bPauseRequested) {
+        entry.state = LoopState::Paused;
+    } else {
+        schedule_loop(loopId);
+    }
+
+    entry.bPauseRequested = false;
+    entry.bStopRequested = false;
+
+    notify_dispatcher();
+    m_loopsCondition.notify_all();
+}
+
+void WorkflowRunner::schedule_loop(loop_id_type loopId) {
+    LoopEntry& entry{*m_loops[loopId]};
+    entry.state = LoopState::Scheduled;
+    ++entry.generation;
+
+    if (!entry.loop->canRepeat()) {
+        entry.state = LoopState::Completed;
+        m_loopsCondition.notify_all();
+        return;
+    }
+
+    const std::optional<clock_type::time_point> dueTime{entry.loop->getNextIterationTime()};
+    if (dueTime.has_value() && *dueTime > clock_type::now()) {
+        m_timers.push(TimerEntry{*dueTime, m_timersSequence++, {loopId, entry.generation}});
+    } else {
+        enqueue_ready_loop(loopId);
+    }
+
+    notify_dispatcher();
+}
+
+void WorkflowRunner::enqueue_ready_loop(loop_id_type loopId) {
+    const LoopEntry& entry{*m_loops[loopId]};
+    m_readyQueues[static_cast<std::size_t>(entry.priority)].push_back(
+        QueueEntry{loopId, entry.generation});
+}
+
+void WorkflowRunner::dispatch_expired_timers(clock_type::time_point now) {
+    while (!m_timers.empty() && m_timers.top().dueTime <= now) {
+        const QueueEntry entry{m_timers.top().entry};
+        m_timers.pop();
+
+        if (is_current(entry)) {
+            enqueue_ready_loop(entry.loopId);
+        }
+    }
+}
+
+std::optional<WorkflowRunner::loop_id_type> WorkflowRunner::pop_next_ready_loop() {
+    // Weighted round robin: every level can be served as many times as its weight, then
+    // the credits of all the levels are refilled.
+    for (int round{}; round < 2; ++round) {
+        for (std::size_t level{PRIORITIES_COUNT}; level-- > 0;) {
+            std::deque<QueueEntry>& queue{m_readyQueues[level]};
+            while (!queue.empty() && !is_current(queue.front())) {
+                queue.pop_front();
+            }
+
+            if (queue.empty() || m_credits[level] == 0) {
+                continue;
+            }
+
+            const loop_id_type loopId{queue.front().loopId};
+            queue.pop_front();
+            --m_credits[level];
+            return loopId;
+        }
+
+        m_credits = PRIORITY_WEIGHTS;
+    }
+
+    return std::nullopt;
+}
+
+bool WorkflowRunner::is_current(const QueueEntry& entry) const noexcept {
+    const LoopEntry& loopEntry{*m_loops[entry.loopId]};
+    return loopEntry.state == LoopState::Scheduled && loopEntry.generation == entry.generation;
+}
+
+void WorkflowRunner::notify_dispatcher() noexcept {
+    m_bDispatchNeeded = true;
+    m_dispatchCondition.notify_one();
+}
+
+} // namespace gc::workflows
@@ -1,9 +1,14 @@
 // Copyright (c) 2023 Andrea Ballestrazzi
 #include "workflows/workflow.hpp"
+#include "workflows/workflow-profiler.hpp"
 
 namespace gc::workflows {
 
 bool Workflow::execute() noexcept {
+    if (m_profiler != nullptr) [[unlikely]] {
+        return execute_profiled();
+    }
+
     for (auto& step : m_flow) {
         if (!step->execute()) {
             return false;
@@ -12,14 +17,82 @@ bool Workflow::execute() noexcept {
     return true;
 }
 
-void Workflow::addStep(std::unique_ptr<WorkflowStep> step) noexcept {
-    m_flow.push_back(std::move(step));
+void Workflow::setProfiler(WorkflowProfiler* profiler) {
+    m_profiler = profiler;
+    register_profiled_steps();
+}
+
+void Workflow::addStep(std::unique_ptr<WorkflowStep> step) {
+    if (m_profiler == nullptr) {
+        m_flow.push_back(std::move(step));
+        return;
+    }
+
+    // The step is registered first, so a failure leaves the workflow unchanged.
+    m_stepProfilerIndices.push_back(m_profiler->registerStep(m_id + "/" + step->id()));
+    try {
+        m_flow.push_back(std::move(step));
+    } catch (...) {
+        m_stepProfilerIndices.pop_back();
+        throw;
+    }
 }
 
-void Workflow::removeStep(IdView stepId) noexcept {
+void Workflow::removeStep(IdView stepId) {
     m_flow.remove_if([&stepId](const auto& step) {
         return step->id() == stepId;
     });
+
+    register_profiled_steps();
+}
+
+bool Workflow::execute_profiled() noexcept {
+    using clock_type = WorkflowProfiler::clock_type;
+
+    const auto record{[this](const profiler_index_type& index, clock_type::time_point startTime,
+                             bool bSucceeded) {
+        if (index.has_value()) {
+            m_profiler->record(*index, clock_type::now() - startTime, bSucceeded);
+        }
+    }};
+
+    const clock_type::time_point workflowStartTime{clock_type::now()};
+    auto indexIt{m_stepProfilerIndices.cbegin()};
+    bool bSucceeded{true};
+
+    for (auto& step : m_flow) {
+        const clock_type::time_point stepStartTime{clock_type::now()};
+        bSucceeded = step->execute();
+        record(*indexIt++, stepStartTime, bSucceeded);
+
+        if (!bSucceeded) {
+            break;
+        }
+    }
+
+    record(m_profilerIndex, workflowStartTime, bSucceeded);
+    return bSucceeded;
+}
+
+void Workflow::register_profiled_steps() {
+    if (m_profiler == nullptr) {
+        m_profilerIndex.reset();
+        m_stepProfilerIndices.clear();
+        return;
+    }
+
+    // The indices are replaced only once every step is registered, so they always
+    // match the flow even if the registration fails.
+    std::vector<profiler_index_type> stepProfilerIndices{};
+    stepProfilerIndices.reserve(m_flow.size());
+
+    const profiler_index_type profilerIndex{m_profiler->registerStep(m_id)};
+    for (const auto& step : m_flow) {
+        stepProfilerIndices.push_back(m_profiler->registerStep(m_id + "/" + step->id()));
+    }
+
+    m_profilerIndex = profilerIndex;
+    m_stepProfilerIndices = std::move(stepProfilerIndices);
 }
 
 } // namespace gc::workflows
@@ -13,7 +13,8 @@ public:
 
     //!!
     //! \brief Notifies the system that an emergency is under way and
-    //!  it must shutdown immediately.
+    //!  it must shutdown immediately. It doesn't wait for the system workers, which may be
+    //!  hung: it's called by the watchdog too.
     virtual void emergencyAbort() noexcept = 0;
 };
 
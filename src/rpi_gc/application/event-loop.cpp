@@ -0,0 +1,330 @@
+// Copyright (C) 2023 Andrea Ballestrazzi
+#include <application/event-loop.hpp>
+
+#include <posix-io/system-error.hpp>
+
+// C++ STL
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <cerrno>
+#include <stdexcept>
+#include <utility>
+
+// POSIX
+#include <csignal>
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <sys/signalfd.h>
+#include <sys/timerfd.h>
+#include <unistd.h>
+
+namespace rpi_gc {
+
+namespace {
+
+using gc::posix_io::ThrowSystemError;
+
+[[nodiscard]] timespec ToTimespec(EventLoop::clock_type::duration duration) noexcept {
+    const auto seconds{std::chrono::duration_cast<std::chrono::seconds>(duration)};
+    const auto nanoseconds{
+        std::chrono::duration_cast<std::chrono::nanoseconds>(duration - seconds)};
+
+    return timespec{static_cast<time_t>(seconds.count()),
+                    static_cast<long>(nanoseconds.count())};
+}
+
+//!!
+//! \brief Read the 8 bytes counter of an eventfd or a timerfd.
+//!
+std::uint64_t ReadCounter(int fileDescriptor) noexcept {
+    std::uint64_t counter{};
+    const ssize_t bytesRead{::read(fileDescriptor, &counter, sizeof(counter))};
+    return bytesRead == sizeof(counter) ? counter : 0;
+}
+
+//! \return True if the signal was blocked already.
+[[nodiscard]] bool BlockSignal(int signalNumber) noexcept {
+    sigset_t signalSet{};
+    sigemptyset(&signalSet);
+    sigaddset(&signalSet, signalNumber);
+
+    sigset_t previousSignalSet{};
+    pthread_sigmask(SIG_BLOCK, &signalSet, &previousSignalSet);
+    return sigismember(&previousSignalSet, signalNumber) == 1;
+}
+
+void UnblockSignal(int signalNumber) noexcept {
+    sigset_t signalSet{};
+    sigemptyset(&signalSet);
+    sigaddset(&signalSet, signalNumber);
+    pthread_sigmask(SIG_UNBLOCK, &signalSet, nullptr);
+}
+
+} // namespace
+
+EventLoop::EventLoop() {
+    m_epollFileDescriptor = epoll_create1(EPOLL_CLOEXEC);
+    if (m_epollFileDescriptor < 0) {
+        ThrowSystemError("epoll_create1");
+    }
+
+    m_wakeUpFileDescriptor = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+    if (m_wakeUpFileDescriptor < 0) {
+        const int error{errno};
+        ::close(m_epollFileDescriptor);
+        errno = error;
+        ThrowSystemError("eventfd");
+    }
+
+    epoll_event event{};
+    event.events = EPOLLIN;
+    event.data.u64 = WAKE_UP_SOURCE_ID;
+    if (epoll_ctl(m_epollFileDescriptor, EPOLL_CTL_ADD, m_wakeUpFileDescriptor, &event) != 0) {
+        const int error{errno};
+        ::close(m_wakeUpFileDescriptor);
+        ::close(m_epollFileDescriptor);
+        errno = error;
+        ThrowSystemError("epoll_ctl");
+    }
+}
+
+EventLoop::~EventLoop() noexcept {
+    while (!m_sources.empty()) {
+        removeSource(m_sources.begin()->first);
+    }
+
+    ::close(m_wakeUpFileDescriptor);
+    ::close(m_epollFileDescriptor);
+}
+
+EventLoop::source_id EventLoop::addReadableSource(int fileDescriptor, callback_type callback) {
+    assert(static_cast<bool>(callback));
+    return add_source(Source{fileDescriptor, false, std::nullopt, std::move(callback)});
+}
+
+bool EventLoop::setWritableWatched(source_id sourceId, bool bWatched) noexcept {
+    const auto sourceIt{m_sources.find(sourceId)};
+    if (sourceIt == m_sources.end()) {
+        return false;
+    }
+
+    epoll_event event{};
+    event.events = bWatched ? (EPOLLIN | EPOLLOUT) : EPOLLIN;
+    event.data.u64 = sourceId;
+    return epoll_ctl(m_epollFileDescriptor, EPOLL_CTL_MOD, sourceIt->second->fileDescriptor,
+                     &event) == 0;
+}
+
+EventLoop::source_id EventLoop::addTimer(clock_type::duration firstExpiration,
+                                         clock_type::duration period, callback_type callback) {
+    assert(static_cast<bool>(callback));
+
+    const int timerFileDescriptor{timerfd_create(CLOCK_MONOTONIC, TFD_NONBLOCK | TFD_CLOEXEC)};
+    if (timerFileDescriptor < 0) {
+        ThrowSystemError("timerfd_create");
+    }
+
+    // A zero expiration would disarm the timer instead of making it expire immediately.
+    itimerspec timerSpec{};
+    timerSpec.it_value = ToTimespec(std::max(firstExpiration, clock_type::duration{1}));
+    timerSpec.it_interval = ToTimespec(std::max(period, clock_type::duration::zero()));
+    if (timerfd_settime(timerFileDescriptor, 0, &timerSpec, nullptr) != 0) {
+        const int error{errno};
+        ::close(timerFileDescriptor);
+        errno = error;
+        ThrowSystemError("timerfd_settime");
+    }
+
+    const source_id sourceId{add_source(Source{timerFileDescriptor, true, std::nullopt, {}})};
+    const bool bOneShot{period <= clock_type::duration::zero()};
+
+    m_sources.at(sourceId)->handler = [this, sourceId, timerFileDescriptor, bOneShot,
+                                       callback = std::move(callback)] {
+        if (ReadCounter(timerFileDescriptor) == 0) {
+            return;
+        }
+
+        if (bOneShot) {
+            // The dispatch keeps the source alive until the callback returns.
+            removeSource(sourceId);
+        }
+
+        callback();
+    };
+
+    return sourceId;
+}
+
+EventLoop::source_id EventLoop::addSignalHandler(int signalNumber, signal_callback_type callback) {
+    assert(static_cast<bool>(callback));
+
+    for (const auto& [sourceId, source] : m_sources) {
+        if (source->signalNumber == signalNumber) {
+            throw std::invalid_argument{"The signal is already handled by the event loop."};
+        }
+    }
+
+    // The signal must be blocked, otherwise its default disposition would be applied
+    // instead of queuing it for the signalfd. The mask is restored only if the signal can't
+    // be handled.
+    const bool bWasBlocked{BlockSignal(signalNumber)};
+    const auto restoreSignalMask{[signalNumber, bWasBlocked] {
+        if (!bWasBlocked) {
+            UnblockSignal(signalNumber);
+        }
+    }};
+
+    sigset_t signalSet{};
+    sigemptyset(&signalSet);
+    sigaddset(&signalSet, signalNumber);
+
+    const int signalFileDescriptor{signalfd(-1, &signalSet, SFD_NONBLOCK | SFD_CLOEXEC)};
+    if (signalFileDescriptor < 0) {
+        const int error{errno};
+        restoreSignalMask();
+        errno = error;
+        ThrowSystemError("signalfd");
+    }
+
+    source_id sourceId{};
+    try {
+        sourceId = add_source(Source{signalFileDescriptor, true, signalNumber, {}});
+    } catch (...) {
+        restoreSignalMask();
+        throw;
+    }
+
+    m_sources.at(sourceId)->handler = [signalFileDescriptor, callback = std::move(callback)] {
+        signalfd_siginfo signalInfo{};
+        while (::read(signalFileDescriptor, &signalInfo, sizeof(signalInfo)) ==
+               sizeof(signalInfo)) {
+            callback(static_cast<int>(signalInfo.ssi_signo));
+        }
+    };
+
+    return sourceId;
+}
+
+bool EventLoop::removeSource(source_id sourceId) noexcept {
+    const auto sourceIt{m_sources.find(sourceId)};
+    if (sourceIt == m_sources.end()) {
+        return false;
+    }
+
+    const Source& source{*sourceIt->second};
+
+    // Removing a descriptor that has already been closed by its owner fails harmlessly.
+    epoll_ctl(m_epollFileDescriptor, EPOLL_CTL_DEL, source.fileDescriptor, nullptr);
+
+    if (source.bOwnsFileDescriptor) {
+        ::close(source.fileDescriptor);
+    }
+
+    // The signal stays blocked: once unblocked, a signal received while the application is
+    // shutting down would terminate it with its default disposition.
+    m_sources.erase(sourceIt);
+    return true;
+}
+
+void EventLoop::post(callback_type task) {
+    assert(static_cast<bool>(task));
+    {
+        std::lock_guard lock{m_tasksMutex};
+        m_postedTasks.push_back(std::move(task));
+    }
+
+    wake_up();
+}
+
+void EventLoop::run() {
+    while (!m_bStopRequested.load(std::memory_order_acquire)) {
+        runOnce();
+    }
+
+    m_bStopRequested.store(false, std::memory_order_release);
+}
+
+std::size_t EventLoop::runOnce(std::optional<std::chrono::milliseconds> timeout) {
+    std::array<epoll_event, MAX_EVENTS_PER_WAIT> events{};
+    const int timeoutMs{timeout.has_value() ? static_cast<int>(timeout->count()) : -1};
+
+    const int eventsCount{epoll_wait(m_epollFileDescriptor, events.data(),
+                                     static_cast<int>(events.size()), timeoutMs)};
+    if (eventsCount < 0) {
+        if (errno == EINTR) {
+            return 0;
+        }
+
+        ThrowSystemError("epoll_wait");
+    }
+
+    std::size_t dispatchedEventsCount{};
+    for (int i{}; i < eventsCount; ++i) {
+        const source_id sourceId{events[i].data.u64};
+
+        if (sourceId == WAKE_UP_SOURCE_ID) {
+            ReadCounter(m_wakeUpFileDescriptor);
+            run_posted_tasks();
+            ++dispatchedEventsCount;
+            continue;
+        }
+
+        // A previous callback of this batch may have removed the source.
+        const auto sourceIt{m_sources.find(sourceId)};
+        if (sourceIt == m_sources.end()) {
+            continue;
+        }
+
+        const std::shared_ptr<Source> source{sourceIt->second};
+        source->handler();
+        ++dispatchedEventsCount;
+    }
+
+    return dispatchedEventsCount;
+}
+
+void EventLoop::stop() noexcept {
+    m_bStopRequested.store(true, std::memory_order_release);
+    wake_up();
+}
+
+EventLoop::source_id EventLoop::add_source(Source source) {
+    const source_id sourceId{m_nextSourceId++};
+
+    epoll_event event{};
+    event.events = EPOLLIN;
+    event.data.u64 = sourceId;
+    if (epoll_ctl(m_epollFileDescriptor, EPOLL_CTL_ADD, source.fileDescriptor, &event) != 0) {
+        const int error{errno};
+        if (source.bOwnsFileDescriptor) {
+            ::close(source.fileDescriptor);
+        }
+
+        errno = error;
+        ThrowSystemError("epoll_ctl");
+    }
+
+    m_sources.emplace(sourceId, std::make_shared<Source>(std::move(source)));
+    return sourceId;
+}
+
+void EventLoop::wake_up() noexcept {
+    const std::uint64_t increment{1};
+    [[maybe_unused]] const ssize_t bytesWritten{
+        ::write(m_wakeUpFileDescriptor, &increment, sizeof(increment))};
+}
+
+void EventLoop::run_posted_tasks() {
+    std::vector<callback_type> tasks{};
+    {
+        std::lock_guard lock{m_tasksMutex};
+        tasks.swap(m_postedTasks);
+    }
+
+    for (callback_type& task : tasks) {
+        task();
+    }
+}
+
+} // namespace rpi_gc
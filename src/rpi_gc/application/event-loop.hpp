@@ -0,0 +1,164 @@
+// Copyright (C) 2023 Andrea Ballestrazzi
+#ifndef RPI_GC_EVENT_LOOP_HPP
+#define RPI_GC_EVENT_LOOP_HPP
+
+// C++ STL
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <unordered_map>
+#include <vector>
+
+namespace rpi_gc {
+
+//!!
+//! \brief A single-threaded event loop built on epoll. File descriptors, timers (timerfd) and
+//!  POSIX signals (signalfd) are registered as sources and their callbacks are invoked on the
+//!  thread that runs the loop, so the subsystems that share it don't need to synchronize with
+//!  each other.
+//!
+//!  Sources must be added and removed on the thread that runs the loop (or before it runs):
+//!  only post() and stop() can be called from other threads. The callbacks can add and remove
+//!  sources, including their own.
+//!
+class EventLoop final {
+public:
+    using source_id = std::uint64_t;
+    using clock_type = std::chrono::steady_clock;
+    using callback_type = std::function<void()>;
+    using signal_callback_type = std::function<void(int)>;
+
+    //!!
+    //! \brief Construct a new event loop.
+    //!
+    //! \throw std::system_error if the epoll instance can't be created.
+    //!
+    EventLoop();
+    ~EventLoop() noexcept;
+
+    EventLoop(const EventLoop&) = delete;
+    EventLoop& operator=(const EventLoop&) = delete;
+
+    //!!
+    //! \brief Watch a file descriptor for reading. The callback is invoked every time the
+    //!  descriptor is readable, hung up or in error, and it's responsible of reading the data.
+    //!  The loop doesn't take the ownership of the descriptor.
+    //!
+    //! \param[in] fileDescriptor The descriptor to watch. Regular files can't be watched.
+    //! \param[in] callback The callback invoked when the descriptor is readable.
+    //! \return The id of the new source.
+    //! \throw std::system_error if the descriptor can't be watched.
+    //!
+    source_id addReadableSource(int fileDescriptor, callback_type callback);
+
+    //!!
+    //! \brief Watch, or stop watching, a readable source for writing too. While it's watched,
+    //!  the callback of the source is also invoked when the descriptor is writable, e.g. to
+    //!  flush the data that couldn't be written without blocking.
+    //!
+    //! \return True if the source has been updated, false if it doesn't exist.
+    //!
+    bool setWritableWatched(source_id sourceId, bool bWatched) noexcept;
+
+    //!!
+    //! \brief Add a timer. If the loop falls behind, the missed expirations of a periodic
+    //!  timer are coalesced into a single callback invocation.
+    //!
+    //! \param[in] firstExpiration The time after which the timer expires the first time.
+    //! \param[in] period The period of the timer, or zero for a one-shot timer. One-shot
+    //!  timers are removed right before their callback is invoked.
+    //! \param[in] callback The callback invoked when the timer expires.
+    //! \return The id of the new source.
+    //! \throw std::system_error if the timer can't be created.
+    //!
+    source_id addTimer(clock_type::duration firstExpiration, clock_type::duration period,
+                       callback_type callback);
+
+    //!!
+    //! \brief Handle a signal on the loop instead of with an asynchronous handler. The signal
+    //!  is blocked on the calling thread, and on the threads it creates from then on, so it
+    //!  should be registered before the other threads are spawned.
+    //!
+    //! \param[in] signalNumber The signal to handle, e.g. SIGINT.
+    //! \param[in] callback The callback invoked with the received signal.
+    //! \return The id of the new source.
+    //! \throw std::invalid_argument if the signal is already handled by the loop.
+    //! \throw std::system_error if the signal can't be handled.
+    //!
+    source_id addSignalHandler(int signalNumber, signal_callback_type callback);
+
+    //!!
+    //! \brief Remove a source. The descriptors created by the loop are closed. The handled
+    //!  signals stay blocked, so the ones received afterwards are left pending instead of
+    //!  terminating the application.
+    //!
+    //! \return True if the source has been removed, false if it doesn't exist.
+    //!
+    bool removeSource(source_id sourceId) noexcept;
+
+    //!!
+    //! \brief Enqueue a task that will be executed by the loop. Thread-safe.
+    //!
+    void post(callback_type task);
+
+    //!!
+    //! \brief Dispatch the events until stop() is called. If stop() has already been called,
+    //!  it returns immediately.
+    //!
+    void run();
+
+    //!!
+    //! \brief Wait for the events and dispatch them once.
+    //!
+    //! \param[in] timeout The maximum time to wait for an event, or no value to wait
+    //!  indefinitely.
+    //! \return The number of dispatched events, the posted tasks batch counting as one.
+    //!
+    std::size_t runOnce(std::optional<std::chrono::milliseconds> timeout = std::nullopt);
+
+    //!!
+    //! \brief Make run() return after the events being dispatched. Thread-safe.
+    //!
+    void stop() noexcept;
+
+    [[nodiscard]] std::size_t getSourcesCount() const noexcept {
+        return m_sources.size();
+    }
+
+private:
+    static constexpr std::size_t MAX_EVENTS_PER_WAIT{16};
+    //! The id of the wake-up eventfd, which is never given to a source.
+    static constexpr source_id WAKE_UP_SOURCE_ID{0};
+
+    struct Source {
+        int fileDescriptor{-1};
+        //! True if the descriptor has been created by the loop and must be closed.
+        bool bOwnsFileDescriptor{};
+        std::optional<int> signalNumber{};
+        callback_type handler{};
+    };
+
+    int m_epollFileDescriptor{-1};
+    int m_wakeUpFileDescriptor{-1};
+    source_id m_nextSourceId{WAKE_UP_SOURCE_ID + 1};
+
+    // The sources are shared with the dispatch, so a callback can remove its own source.
+    std::unordered_map<source_id, std::shared_ptr<Source>> m_sources{};
+
+    std::mutex m_tasksMutex{};
+    std::vector<callback_type> m_postedTasks{};
+    std::atomic<bool> m_bStopRequested{};
+
+    source_id add_source(Source source);
+    void wake_up() noexcept;
+    void run_posted_tasks();
+};
+
+} // namespace rpi_gc
+
+#endif // !RPI_GC_EVENT_LOOP_HPP
@@ -3,14 +3,22 @@
 
 #include <common/types.hpp>
 
+#include <metrics/metrics-registry.hpp>
+#include <project-management/schema/project-schema.hpp>
+
 // C++ STL
 #include <algorithm>
 #include <array>
 #include <cassert>
 #include <chrono>
+#include <cstdint>
+#include <exception>
+#include <optional>
+#include <ratio>
 #include <stdexcept> // for std::range_error
 #include <string_view>
-#include <variant> // for std::bad_variant_access
+#include <utility>
+#include <vector>
 #include <version>
 
 #ifdef __cpp_lib_format
@@ -36,17 +44,58 @@ constexpr StringViewType SYSTEM_NOT_RUNNING{"The system is not running."};
 constexpr StringViewType AUTOMATIC_WATERING_SYSTEM_LOG_NAME{"Automatic Watering System"};
 } // namespace strings
 
+namespace {
+
+//!!
+//! \brief The metrics shared by all the automatic watering systems. Unlike the cycles
+//!  counter of a system, they are never reset.
+//!
+struct AutomaticWateringMetrics {
+    gc::metrics::Counter& completedCycles;
+    gc::metrics::Counter& irrigations;
+    gc::metrics::Gauge& runningJobs;
+    gc::metrics::Histogram& wakeUpLateness;
+};
+
+//!!
+//! \brief Gets the metrics, registering them the first time.
+//!
+//! \throws std::invalid_argument if a metric with the same name is already registered with
+//!  another kind.
+[[nodiscard]] AutomaticWateringMetrics& GetAutomaticWateringMetrics() {
+    static AutomaticWateringMetrics automaticWateringMetrics{
+        gc::metrics::GetDefaultRegistry().counter(
+            "gc_aws_cycles_total", "Number of completed automatic watering cycles."),
+        gc::metrics::GetDefaultRegistry().counter(
+            "gc_aws_irrigations_total",
+            "Number of times the watering hardware has been activated."),
+        gc::metrics::GetDefaultRegistry().gauge("gc_aws_running_jobs",
+                                                "Number of running automatic watering jobs."),
+        gc::metrics::GetDefaultRegistry().histogram(
+            "gc_aws_wakeup_lateness_ns",
+            "Delay between the end of an activation or deactivation period and the wake-up.")};
+
+    return automaticWateringMetrics;
+}
+
+} // namespace
+
 DailyCycleAutomaticWateringSystem::DailyCycleAutomaticWateringSystem(
     hardware_access_mutex_reference hardwareMutex, logger_pointer mainLogger,
     logger_pointer userLogger, hardware_controller_atomic_ref hardwareController,
-    time_provider_atomic_ref timeProvider) noexcept
+    time_provider_atomic_ref timeProvider, water_usage_ledgers_pointer waterUsageLedgers)
     : m_mainLogger{std::move(mainLogger)},
       m_userLogger{std::move(userLogger)},
       m_hardwareController{hardwareController},
       m_timeProvider{timeProvider},
-      m_hardwareAccessMutex{hardwareMutex} {
+      m_hardwareAccessMutex{hardwareMutex},
+      m_waterUsageLedgers{std::move(waterUsageLedgers)} {
     assert(m_mainLogger != nullptr);
     assert(m_userLogger != nullptr);
+
+    // The metrics are registered here, so a registration failure reaches the caller instead
+    // of terminating the worker.
+    static_cast<void>(GetAutomaticWateringMetrics());
 }
 
 void DailyCycleAutomaticWateringSystem::requestShutdown() noexcept {
@@ -66,20 +115,7 @@ void DailyCycleAutomaticWateringSystem::requestShutdown() noexcept {
         return;
     }
 
-    {
-        std::lock_guard<stop_event_mutex> stopLock{m_stopMutex};
-
-        [[maybe_unused]] const bool bRequestStopSucceded{m_workerThread.request_stop()};
-        assert(bRequestStopSucceded);
-    }
-
-    m_stopListener.notify_one();
-    m_workerThread.join();
-
-    m_state.store(EDailyCycleAWSState::Disabled);
-    // We reset the cycles counter because it starts when a new
-    // cycle is activated.
-    m_cyclesCounter.store(0);
+    join_worker();
 }
 
 void DailyCycleAutomaticWateringSystem::emergencyAbort() noexcept {
@@ -100,24 +136,35 @@ void DailyCycleAutomaticWateringSystem::emergencyAbort() noexcept {
         return;
     }
 
-    {
-        std::lock_guard<stop_event_mutex> stopLock{m_stopMutex};
+    // The abort may be issued by the watchdog while the worker is hung in a hardware call,
+    // holding the stop mutex: the stop is requested without it and wakes the worker up from
+    // its waits, but the worker isn't joined here.
+    std::lock_guard stopSourceLock{m_workerStopSourceMutex};
+    static_cast<void>(m_workerStopSource.request_stop());
+}
 
-        // For now we simply request the thread shutdown.
-        [[maybe_unused]] const bool bRequestStopSucceded{m_workerThread.request_stop()};
-        assert(bRequestStopSucceded);
+void DailyCycleAutomaticWateringSystem::join_worker() noexcept {
+    // The stop may have been requested by an emergency abort already.
+    static_cast<void>(m_workerThread.request_stop());
+    {
+        std::lock_guard diagnosticLock{m_diagnosticMutex};
+        m_workerThread.join();
     }
-    m_stopListener.notify_one();
-    m_workerThread.join();
 
     m_state.store(EDailyCycleAWSState::Disabled);
     // We reset the cycles counter because it starts when a new
     // cycle is activated.
     m_cyclesCounter.store(0);
+    m_changeNotifier.notifyChanged();
 }
 
 void DailyCycleAutomaticWateringSystem::startAutomaticWatering(
     std::optional<name_type> awsName) noexcept {
+    // A worker that has been aborted, or that has ended by itself, is joined before starting
+    // a new one.
+    if (m_state.load() == EDailyCycleAWSState::TearingDown)
+        join_worker();
+
     if (isRunning()) {
         const StringType formattedErrorString{
             format_log_string("Automatic watering system already running. Stop the previous "
@@ -132,8 +179,10 @@ void DailyCycleAutomaticWateringSystem::startAutomaticWatering(
     // Set the name of the flow.
     // If the name is equal to the default value, then we can set the name
     // to the AWS name given by the user. Otherwise we keep the name as it is.
-    if (awsName.has_value())
+    if (awsName.has_value()) {
+        std::lock_guard diagnosticLock{m_diagnosticMutex};
         m_name = awsName.value();
+    }
 
     // If the user disactivated both the water pump and the water valve then there is no
     // need to proceed and activate the watering system
@@ -162,14 +211,28 @@ void DailyCycleAutomaticWateringSystem::startAutomaticWatering(
     // We also notify the user for this action.
     m_userLogger->logInfo(formattedLogString);
 
-    m_workerThread = thread_type{[this](std::stop_token stopToken, const logger_pointer& logger) {
-                                     run_automatic_watering(std::move(stopToken), logger);
-                                 },
-                                 m_mainLogger};
+    {
+        std::lock_guard diagnosticLock{m_diagnosticMutex};
+        std::lock_guard stopSourceLock{m_workerStopSourceMutex};
+
+        // The system is running as soon as the worker exists, even if its cycles don't
+        // activate the hardware, so that it can be stopped and aborted. The state is set
+        // before the worker starts changing it. The name can't change while the worker runs,
+        // so it accounts the water of the flow it has been started for.
+        m_state.store(EDailyCycleAWSState::Idling);
+        m_workerThread = thread_type{
+            [this, flowName = m_name](std::stop_token stopToken, const logger_pointer& logger) {
+                run_automatic_watering(std::move(stopToken), logger, flowName);
+            },
+            m_mainLogger};
+        m_workerStopSource = m_workerThread.get_stop_source();
+    }
+
+    m_changeNotifier.notifyChanged();
 }
 
 void DailyCycleAutomaticWateringSystem::run_automatic_watering(
-    std::stop_token stopToken, const logger_pointer& logger) noexcept {
+    std::stop_token stopToken, const logger_pointer& logger, const name_type& flowName) noexcept {
     const time_provider_pointer::value_type timeProvider{m_timeProvider.get().load()};
     assert(timeProvider != nullptr);
 
@@ -178,6 +241,10 @@ void DailyCycleAutomaticWateringSystem::run_automatic_watering(
     bool bWasValveEnabled{m_bWaterValveEnabled.load()};
     bool bWasPumpEnabled{m_bWaterPumpEnabled.load()};
 
+    AutomaticWateringMetrics& automaticWateringMetrics{GetAutomaticWateringMetrics()};
+    automaticWateringMetrics.runningJobs.add(1);
+
+    m_heartbeat.beat();
     logger->logInfo(format_log_string(strings::feedbacks::AUTOMATIC_WATERING_JOB_START));
     if (stopToken.stop_requested()) {
         logger->logInfo(
@@ -185,25 +252,56 @@ void DailyCycleAutomaticWateringSystem::run_automatic_watering(
     }
 
     std::unique_lock<stop_event_mutex> stopLock{m_stopMutex};
+    const auto waitForStopRequest{[this, &stopLock, &stopToken, &automaticWateringMetrics](
+                                      const WateringSystemTimeProvider::time_unit waitTime) {
+        const auto wakeUpTime{std::chrono::steady_clock::now() + waitTime};
+        m_heartbeat.beatFor(waitTime);
+        // The stop request wakes the worker up by itself, without any notification.
+        static_cast<void>(m_stopListener.wait_for(stopLock, stopToken, waitTime, [] {
+            return false;
+        }));
+        m_heartbeat.beat();
+
+        // The waits interrupted by a stop request aren't late.
+        if (!stopToken.stop_requested()) {
+            const auto lateness{std::chrono::duration_cast<std::chrono::nanoseconds>(
+                std::chrono::steady_clock::now() - wakeUpTime)};
+            const std::int64_t latenessNs{std::max<std::int64_t>(lateness.count(), 0)};
+            automaticWateringMetrics.wakeUpLateness.record(
+                static_cast<gc::metrics::Histogram::value_type>(latenessNs));
+        }
+    }};
+
     while (!stopToken.stop_requested()) {
         // It may be possible that the user updated the times, so we need to read them every loop.
         const WateringSystemTimeProvider::time_unit hardwareActivationTime{
             timeProvider->getWateringSystemActivationDuration()};
 
+        // Nothing has to be delivered in this cycle, e.g. the soil is already wet: the hardware
+        // isn't touched, so the cycle isn't recorded as an irrigation.
+        if (hardwareActivationTime == WateringSystemTimeProvider::time_unit::zero()) {
+            waitForStopRequest(timeProvider->getWateringSystemDeactivationDuration());
+
+            m_cyclesCounter++;
+            automaticWateringMetrics.completedCycles.increment();
+            m_changeNotifier.notifyChanged();
+            continue;
+        }
+
         // We start the automatic watering system cycle with the watering on.
         // The watering system lasts for 6 seconds as per requirements.
         activate_watering_hardware();
-        m_stopListener.wait_for(stopLock, hardwareActivationTime, [&stopToken]() {
-            return stopToken.stop_requested();
-        });
+        waitForStopRequest(hardwareActivationTime);
 
         m_state.store(EDailyCycleAWSState::Idling);
+        m_changeNotifier.notifyChanged();
 
         if (stopToken.stop_requested()) {
             // If the user requested an abort during th hardware activation
             // we need to deactivate it and exit asap. The watering cycle
             // is interrupted.
             disable_watering_hardware();
+            record_water_usage(flowName);
             break;
         }
 
@@ -222,6 +320,7 @@ void DailyCycleAutomaticWateringSystem::run_automatic_watering(
             m_userLogger->logWarning(format_log_string(FEEDBACK_MESSAGE));
             m_mainLogger->logWarning(format_log_string(FEEDBACK_MESSAGE));
 
+            record_water_usage(flowName);
             break;
         }
 
@@ -230,14 +329,19 @@ void DailyCycleAutomaticWateringSystem::run_automatic_watering(
 
         // Now we can shut off the hardware.
         disable_watering_hardware();
-        m_stopListener.wait_for(stopLock, hardwareDeactivationTime, [&stopToken]() {
-            return stopToken.stop_requested();
-        });
+        record_water_usage(flowName);
+        waitForStopRequest(hardwareDeactivationTime);
 
         m_cyclesCounter++;
+        automaticWateringMetrics.completedCycles.increment();
+        m_changeNotifier.notifyChanged();
     }
 
+    automaticWateringMetrics.runningJobs.sub(1);
+    m_heartbeat.stop();
+
     m_state.store(EDailyCycleAWSState::TearingDown);
+    m_changeNotifier.notifyChanged();
     logger->logInfo(format_log_string(strings::feedbacks::AUTOMATIC_WATERING_JOB_END));
 }
 
@@ -256,6 +360,7 @@ std::pair<bool, bool> DailyCycleAutomaticWateringSystem::update_devices_status(
         m_mainLogger->logWarning(
             format_log_string("Deactivating the water valve digital out as it has been disabled."));
         waterValveDigitalOut->deactivate();
+        stop_device_stopwatch(m_valveActivationTime, m_actuationUsage.valveOpenTime);
     }
 
     const bool bIsPumpEnabled{m_bWaterPumpEnabled.load()};
@@ -268,6 +373,7 @@ std::pair<bool, bool> DailyCycleAutomaticWateringSystem::update_devices_status(
         m_mainLogger->logWarning(
             format_log_string("Deactivating the water pump digital out as it has been disabled."));
         waterPumpDigitalOut->deactivate();
+        stop_device_stopwatch(m_pumpActivationTime, m_actuationUsage.pumpOnTime);
     }
 
     return std::make_pair(bIsValveEnabled, bIsPumpEnabled);
@@ -291,6 +397,7 @@ StringType DailyCycleAutomaticWateringSystem::format_log_string(StringViewType m
 void DailyCycleAutomaticWateringSystem::activate_watering_hardware() noexcept {
     std::lock_guard<std::mutex> hardwareLock{m_hardwareAccessMutex};
     m_state.store(EDailyCycleAWSState::Irrigating);
+    m_changeNotifier.notifyChanged();
 
     WateringSystemHardwareController::digital_output_type* const waterValveDigitalOut{
         m_hardwareController.get().load()->getWaterValveDigitalOut()};
@@ -309,6 +416,7 @@ void DailyCycleAutomaticWateringSystem::activate_watering_hardware() noexcept {
         logStream << "[VALVE DIG-OUT] => " << *waterValveDigitalOut;
         m_mainLogger->logInfo(logStream.str());
         waterValveDigitalOut->activate();
+        m_valveActivationTime = std::chrono::steady_clock::now();
     }
 
     if (m_bWaterPumpEnabled.load()) {
@@ -317,6 +425,13 @@ void DailyCycleAutomaticWateringSystem::activate_watering_hardware() noexcept {
         logStream << "[PUMP DIG-OUT] => " << *waterPumpDigitalOut;
         m_mainLogger->logInfo(logStream.str());
         waterPumpDigitalOut->activate();
+        m_pumpActivationTime = std::chrono::steady_clock::now();
+    }
+
+    // With both the devices disabled no water is delivered, so there is no irrigation.
+    if (m_valveActivationTime.has_value() || m_pumpActivationTime.has_value()) {
+        GetAutomaticWateringMetrics().irrigations.increment();
+        m_actuationUsage.actuations = 1;
     }
 }
 
@@ -348,10 +463,14 @@ void DailyCycleAutomaticWateringSystem::disable_watering_hardware() noexcept {
         logStream << "[VALVE DIG-OUT] => " << *waterValveDigitalOut;
         m_mainLogger->logInfo(logStream.str());
         waterValveDigitalOut->deactivate();
+        stop_device_stopwatch(m_valveActivationTime, m_actuationUsage.valveOpenTime);
     }
 
-    if (bValveEnabled && bPumpEnabled)
+    if (bValveEnabled && bPumpEnabled) {
+        m_heartbeat.beatFor(valvePumpSeparationTime);
         std::this_thread::sleep_for(valvePumpSeparationTime);
+        m_heartbeat.beat();
+    }
 
     if (bPumpEnabled) {
         logStream.str("");
@@ -359,15 +478,74 @@ void DailyCycleAutomaticWateringSystem::disable_watering_hardware() noexcept {
         logStream << "[PUMP DIG-OUT] => " << *waterPumpDigitalOut;
         m_mainLogger->logInfo(logStream.str());
         waterPumpDigitalOut->deactivate();
+        stop_device_stopwatch(m_pumpActivationTime, m_actuationUsage.pumpOnTime);
     }
 }
 
+void DailyCycleAutomaticWateringSystem::stop_device_stopwatch(
+    std::optional<std::chrono::steady_clock::time_point>& activationTime,
+    std::chrono::milliseconds& activeTime) noexcept {
+    if (!activationTime.has_value())
+        return;
+
+    activeTime += std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::steady_clock::now() - activationTime.value());
+    activationTime.reset();
+}
+
+void DailyCycleAutomaticWateringSystem::record_water_usage(const name_type& flowName) noexcept {
+    // A device that has been disabled during an aborted activation is still active, so its
+    // time is accounted until now.
+    stop_device_stopwatch(m_valveActivationTime, m_actuationUsage.valveOpenTime);
+    stop_device_stopwatch(m_pumpActivationTime, m_actuationUsage.pumpOnTime);
+
+    WaterUsage actuationUsage{std::exchange(m_actuationUsage, WaterUsage{})};
+    if (m_waterUsageLedgers == nullptr || actuationUsage.actuations == 0)
+        return;
+
+    // The water flows while the valve is open. Without the valve, it flows while the
+    // pump is on.
+    const std::chrono::milliseconds deliveryTime{
+        actuationUsage.valveOpenTime > std::chrono::milliseconds::zero()
+            ? actuationUsage.valveOpenTime
+            : actuationUsage.pumpOnTime};
+    actuationUsage.litres =
+        m_flowRate.load() * std::chrono::duration<double, std::ratio<60>>{deliveryTime}.count();
+
+    try {
+        m_waterUsageLedgers->getFlowLedger(flowName).recordActuation(
+            std::chrono::system_clock::now(), actuationUsage);
+    } catch (const std::exception& exc) {
+        m_mainLogger->logError(
+            format_log_string(StringType{"Unable to record the water usage: "} + exc.what()));
+    }
+
+    m_changeNotifier.notifyChanged();
+}
+
 void DailyCycleAutomaticWateringSystem::setWaterValveEnabled(const bool bEnabled) noexcept {
     m_bWaterValveEnabled.store(bEnabled);
+    m_changeNotifier.notifyChanged();
 }
 
 void DailyCycleAutomaticWateringSystem::setWaterPumpEnabled(const bool bEnabled) noexcept {
     m_bWaterPumpEnabled.store(bEnabled);
+    m_changeNotifier.notifyChanged();
+}
+
+void DailyCycleAutomaticWateringSystem::setFlowRate(const double litresPerMinute) noexcept {
+    // The negated comparison also rejects the NaNs.
+    if (!(litresPerMinute >= 0.0)) {
+        const StringType formattedErrorString{
+            format_log_string("The flow rate must be a non-negative number of litres per minute. "
+                              "The flow rate won't be changed.")};
+        m_mainLogger->logError(formattedErrorString);
+        m_userLogger->logError(formattedErrorString);
+        return;
+    }
+
+    m_flowRate.store(litresPerMinute);
+    m_changeNotifier.notifyChanged();
 }
 
 namespace details {
@@ -395,169 +573,238 @@ struct AWSStateDiagnosticConverter final {
     }
 };
 
-std::string ActivationStateToString(
-    const WateringSystemHardwareController::activation_state activationState) noexcept {
-    using namespace gh_hal::hardware_access;
+using activation_state = WateringSystemHardwareController::activation_state;
 
-    switch (activationState) {
-        case WateringSystemHardwareController::activation_state::ActiveHigh:
-            return "Active High";
-        case WateringSystemHardwareController::activation_state::ActiveLow:
-            return "Active Low";
-        default:
-            assert(false);
-            return "Unknown";
+constexpr std::array<std::pair<std::string_view, activation_state>, 2> ACTIVATION_STATE_NAMES{
+    std::pair{std::string_view{"Active High"}, activation_state::ActiveHigh},
+    std::pair{std::string_view{"Active Low"},  activation_state::ActiveLow }
+};
+
+std::string ActivationStateToString(const activation_state activationState) noexcept {
+    for (const auto& [name, state] : ACTIVATION_STATE_NAMES) {
+        if (state == activationState)
+            return std::string{name};
     }
+
+    assert(false);
+    return "Unknown";
 }
 
+//!!
+//! \brief Project representation of a device of the AWS flow.
+//!
+struct AWSDeviceConfig {
+    StringType name{};
+    std::uint64_t pinID{};
+    activation_state activationState{activation_state::ActiveLow};
+    bool bEnabled{};
+
+    static constexpr auto schema() noexcept {
+        using namespace gc::project_management::schema;
+        return MakeSchema(
+            MakeField("name", &AWSDeviceConfig::name), MakeField("pinID", &AWSDeviceConfig::pinID),
+            MakeEnumField("activationState", &AWSDeviceConfig::activationState,
+                          ACTIVATION_STATE_NAMES),
+            MakeField("enabled", &AWSDeviceConfig::bEnabled));
+    }
+};
+
+//!!
+//! \brief Project representation of the AWS flow.
+//!
+struct AWSFlowConfig {
+    std::vector<AWSDeviceConfig> devices{};
+    WateringSystemTimeProvider::time_unit activationTime{};
+    WateringSystemTimeProvider::time_unit deactivationTime{};
+    WateringSystemTimeProvider::time_unit deactivationSepTime{};
+    //! The flow rate in litres per minute. Missing in the projects saved before the water
+    //! usage accounting.
+    std::optional<double> flowRate{};
+
+    static constexpr auto schema() noexcept {
+        using namespace gc::project_management::schema;
+        return MakeSchema(MakeField("devices", &AWSFlowConfig::devices),
+                          MakeField("activationTime", &AWSFlowConfig::activationTime),
+                          MakeField("deactivationTime", &AWSFlowConfig::deactivationTime),
+                          MakeField("deactivationSepTime", &AWSFlowConfig::deactivationSepTime),
+                          MakeField("flowRate", &AWSFlowConfig::flowRate));
+    }
+};
+
+//!!
+//! \brief Project representation of the AWS, stored under the "automaticWateringSystem" object.
+//!
+struct AWSConfig {
+    StringType mode{};
+    std::optional<StringType> name{};
+    std::optional<AWSFlowConfig> flow{};
+
+    static constexpr auto schema() noexcept {
+        using namespace gc::project_management::schema;
+        return MakeSchema(MakeField("mode", &AWSConfig::mode), MakeField("name", &AWSConfig::name),
+                          MakeField("flow", &AWSConfig::flow));
+    }
+};
+
 } // namespace details
 
-void DailyCycleAutomaticWateringSystem::printDiagnostic(std::ostream& ost) const noexcept {
-    ost << std::endl;
-    ost << " [Diagnostic]:\tAutomatic watering system (AWS)" << std::endl;
-    ost << " [AWS Name]:\t" << m_name << std::endl;
-    ost << " [AWS Mode]:\tCycled" << std::endl;
+diagnostics::DiagnosticSnapshot DailyCycleAutomaticWateringSystem::captureDiagnostic() const {
+    using diagnostics::DiagnosticField;
+
+    diagnostics::DiagnosticSnapshot snapshot{.system = "automatic-watering",
+                                             .title = "Automatic watering system (AWS)"};
+    snapshot.fields.reserve(4);
+    std::unique_lock diagnosticLock{m_diagnosticMutex};
+    const name_type flowName{m_name};
+    snapshot.fields.push_back(DiagnosticField{"name", "AWS Name", flowName});
+    snapshot.fields.push_back(DiagnosticField{"mode", "AWS Mode", std::string{"Cycled"}});
+
+    const EDailyCycleAWSState state{m_state.load()};
     try {
-        const std::string_view statusStr{
-            details::AWSStateDiagnosticConverter::convertStateToString(m_state.load())};
+        snapshot.fields.push_back(DiagnosticField{
+            "status", "Status",
+            std::string{details::AWSStateDiagnosticConverter::convertStateToString(state)}});
+    } catch ([[maybe_unused]] const std::range_error& rangeError) {
+        snapshot.fields.push_back(DiagnosticField{"status", "Status", std::string{"Unknown"}});
+    }
 
-        ost << " [Status]:\t" << statusStr << std::endl;
-    } catch (const std::range_error& rangeError) {
-        ost << "[ERROR] => " << rangeError.what() << std::endl;
+    if (state != EDailyCycleAWSState::Disabled) {
+        std::ostringstream threadIdStream{};
+        threadIdStream << m_workerThread.get_id();
+        snapshot.fields.push_back(DiagnosticField{"threadId", "Thread ID", threadIdStream.str()});
     }
 
-    if (isRunning())
-        ost << " [Thread ID]:\t" << m_workerThread.get_id() << std::endl;
+    diagnosticLock.unlock();
 
-    ost << " {AWS Flow}" << std::endl;
+    // The controllers can be swapped while the snapshot is taken, so they are
+    // loaded only once.
+    WateringSystemHardwareController* const hardwareController{m_hardwareController.get().load()};
+    const WateringSystemTimeProvider* const timeProvider{m_timeProvider.get().load()};
     const bool bValveEnabled{m_bWaterValveEnabled.load()};
     const bool bPumpEnabled{m_bWaterPumpEnabled.load()};
 
-    ost << "\t [Completed cycles]: " << m_cyclesCounter.load() << std::endl;
-
-    auto getDeviceStatusStr = [](const bool bEnabled) noexcept -> std::string_view {
-        if (bEnabled)
-            return "Enabled";
+    diagnostics::DiagnosticSection flowSection{.key = "flow", .title = "AWS Flow"};
+    flowSection.fields.reserve(10);
+    flowSection.fields.push_back(
+        DiagnosticField{"completedCycles", "Completed cycles", m_cyclesCounter.load()});
+    flowSection.fields.push_back(
+        DiagnosticField{"waterValveEnabled", "Water valve status", bValveEnabled});
+    flowSection.fields.push_back(
+        DiagnosticField{"waterPumpEnabled", "Water pump status", bPumpEnabled});
+
+    // The pins can be changed by the user while the snapshot is taken from another thread.
+    std::unique_lock hardwareLock{m_hardwareAccessMutex.get()};
+    if (bValveEnabled) {
+        const auto* const valveDigitalOut{hardwareController->getWaterValveDigitalOut()};
+        flowSection.fields.push_back(
+            DiagnosticField{"waterValvePin", "Water valve output PIN",
+                            static_cast<std::uint64_t>(valveDigitalOut->getOffset())});
+        flowSection.fields.push_back(DiagnosticField{
+            "valveActivationState", "Valve Activation State",
+            details::ActivationStateToString(valveDigitalOut->getActivationState())});
+    }
 
-        return "Disabled";
-    };
+    if (bPumpEnabled) {
+        const auto* const pumpDigitalOut{hardwareController->getWaterPumpDigitalOut()};
+        flowSection.fields.push_back(
+            DiagnosticField{"waterPumpPin", "Water pump output PIN",
+                            static_cast<std::uint64_t>(pumpDigitalOut->getOffset())});
+        flowSection.fields.push_back(DiagnosticField{
+            "pumpActivationState", "Pump Activation State",
+            details::ActivationStateToString(pumpDigitalOut->getActivationState())});
+    }
 
-    ost << "\t [Water valve status]: " << getDeviceStatusStr(bValveEnabled) << std::endl;
-    ost << "\t [Water pump status]: " << getDeviceStatusStr(bPumpEnabled) << std::endl;
+    const auto toMilliseconds{[](const WateringSystemTimeProvider::time_unit duration) {
+        return static_cast<std::int64_t>(duration.count());
+    }};
+
+    flowSection.fields.push_back(DiagnosticField{
+        "activationTimeMs", "Activation time",
+        toMilliseconds(timeProvider->getWateringSystemActivationDuration()), "ms"});
+    flowSection.fields.push_back(DiagnosticField{
+        "deactivationTimeMs", "Deactivation time",
+        toMilliseconds(timeProvider->getWateringSystemDeactivationDuration()), "ms"});
+    flowSection.fields.push_back(DiagnosticField{
+        "pumpValveSeparationTimeMs", "Pump-valve sep time",
+        toMilliseconds(timeProvider->getPumpValveDeactivationTimeSeparation()), "ms"});
+    flowSection.fields.push_back(
+        DiagnosticField{"flowRateLpm", "Flow rate", m_flowRate.load(), "L/min"});
+
+    snapshot.sections.push_back(std::move(flowSection));
+    hardwareLock.unlock();
+
+    // The ledger keeps the counters of the current day, so no history is read here. A ledger
+    // that can't be opened is reported when an actuation is recorded, so its section is
+    // just left out.
+    const WaterUsageLedger* flowLedger{};
+    if (m_waterUsageLedgers != nullptr) {
+        try {
+            flowLedger = &m_waterUsageLedgers->getFlowLedger(flowName);
+        } catch ([[maybe_unused]] const std::exception& ledgerError) {
+            flowLedger = nullptr;
+        }
+    }
 
-    if (bValveEnabled) {
-        ost << "\t [Water valve output PIN]: "
-            << m_hardwareController.get().load()->getWaterValveDigitalOut()->getOffset()
-            << std::endl
-            << "\t [Valve Activation State:] "
-            << details::ActivationStateToString(m_hardwareController.get()
-                                                    .load()
-                                                    ->getWaterValveDigitalOut()
-                                                    ->getActivationState())
-            << std::endl;
+    if (flowLedger != nullptr) {
+        const WaterUsage todayUsage{flowLedger->getDayUsage(WaterUsageLedger::clock_type::now())};
+
+        diagnostics::DiagnosticSection waterSection{.key = "water", .title = "AWS Water Usage"};
+        waterSection.fields.reserve(6);
+        waterSection.fields.push_back(
+            DiagnosticField{"todayLitres", "Today's water", todayUsage.litres, "L"});
+        waterSection.fields.push_back(
+            DiagnosticField{"todayIrrigations", "Today's irrigations", todayUsage.actuations});
+        waterSection.fields.push_back(
+            DiagnosticField{"todayValveOpenTimeMs", "Today's valve open time",
+                            toMilliseconds(todayUsage.valveOpenTime), "ms"});
+        waterSection.fields.push_back(
+            DiagnosticField{"todayPumpOnTimeMs", "Today's pump on time",
+                            toMilliseconds(todayUsage.pumpOnTime), "ms"});
+        waterSection.fields.push_back(
+            DiagnosticField{"lastIrrigationLitres", "Last irrigation water",
+                            flowLedger->getLastActuationUsage().litres, "L"});
+        waterSection.fields.push_back(DiagnosticField{
+            "totalLitres", "Total water", flowLedger->getTotalUsage().litres, "L"});
+
+        snapshot.sections.push_back(std::move(waterSection));
     }
 
-    if (bPumpEnabled) {
-        ost << "\t [Water pump output PIN]: "
-            << m_hardwareController.get().load()->getWaterPumpDigitalOut()->getOffset() << std::endl
-            << "\t [Pump Activation State:] "
-            << details::ActivationStateToString(m_hardwareController.get()
-                                                    .load()
-                                                    ->getWaterPumpDigitalOut()
-                                                    ->getActivationState())
-            << std::endl;
-    }
-
-    ost << "\t [Activation time]:\t"
-        << std::chrono::milliseconds{m_timeProvider.get()
-                                         .load()
-                                         ->getWateringSystemActivationDuration()}
-               .count()
-        << "ms" << std::endl;
-    ost << "\t [Deactivation time]:\t"
-        << std::chrono::milliseconds{m_timeProvider.get()
-                                         .load()
-                                         ->getWateringSystemDeactivationDuration()}
-               .count()
-        << "ms" << std::endl;
-    ost << "\t [Pump-valve sep time]:\t"
-        << std::chrono::milliseconds{m_timeProvider.get()
-                                         .load()
-                                         ->getPumpValveDeactivationTimeSeparation()}
-               .count()
-        << "ms" << std::endl;
+    return snapshot;
 }
 
 void DailyCycleAutomaticWateringSystem::saveToProject(gc::project_management::Project& project) {
     using namespace gc::project_management;
     using namespace std::string_literals;
-    ProjectNode awsNode{};
-    awsNode.addValue("mode"s, "cycled"s);
-    awsNode.addValue("name"s, m_name);
-
-    const bool bValveEnabled{m_bWaterValveEnabled.load()};
-    const bool bPumpEnabled{m_bWaterPumpEnabled.load()};
-
-    ProjectNode flowNode{};
-    std::array<ProjectNode, 2> devicesNodes{};
 
-    ProjectNode valveNode{};
+    WateringSystemHardwareController* const hardwareController{m_hardwareController.get().load()};
+    WateringSystemTimeProvider* const timeProvider{m_timeProvider.get().load()};
 
-    // We need to put the valve ID and the valve activation
-    // state inside the object node.
-    valveNode.addValue("name"s, "waterValve"s);
+    details::AWSFlowConfig flowConfig{};
+    flowConfig.devices.reserve(2);
 
-    valveNode.addValue(
-        "pinID"s, static_cast<std::uint64_t>(
-                      m_hardwareController.get().load()->getWaterValveDigitalOut()->getOffset()));
+    // We need to put the valve and the pump IDs and their activation
+    // states inside the devices nodes.
+    flowConfig.devices.push_back(details::AWSDeviceConfig{
+        "waterValve"s,
+        static_cast<std::uint64_t>(hardwareController->getWaterValveDigitalOut()->getOffset()),
+        hardwareController->getWaterValveDigitalOut()->getActivationState(),
+        m_bWaterValveEnabled.load()});
 
-    valveNode.addValue(
-        "activationState"s,
-        details::ActivationStateToString(
-            m_hardwareController.get().load()->getWaterValveDigitalOut()->getActivationState()));
+    flowConfig.devices.push_back(details::AWSDeviceConfig{
+        "waterPump"s,
+        static_cast<std::uint64_t>(hardwareController->getWaterPumpDigitalOut()->getOffset()),
+        hardwareController->getWaterPumpDigitalOut()->getActivationState(),
+        m_bWaterPumpEnabled.load()});
 
-    valveNode.addValue("enabled"s, bValveEnabled);
+    flowConfig.activationTime = timeProvider->getWateringSystemActivationDuration();
+    flowConfig.deactivationTime = timeProvider->getWateringSystemDeactivationDuration();
+    flowConfig.deactivationSepTime = timeProvider->getPumpValveDeactivationTimeSeparation();
+    flowConfig.flowRate = m_flowRate.load();
 
-    devicesNodes[0] = std::move(valveNode);
-
-    // We need to put the pump ID and the pump activation
-    // state inside the object node.
-    ProjectNode pumpNode{};
-
-    pumpNode.addValue("name"s, "waterPump"s);
-
-    pumpNode.addValue(
-        "pinID"s, static_cast<std::uint64_t>(
-                      m_hardwareController.get().load()->getWaterPumpDigitalOut()->getOffset()));
-
-    pumpNode.addValue(
-        "activationState"s,
-        details::ActivationStateToString(
-            m_hardwareController.get().load()->getWaterPumpDigitalOut()->getActivationState()));
-
-    pumpNode.addValue("enabled"s, bPumpEnabled);
-
-    devicesNodes[1] = std::move(pumpNode);
-
-    // Now we need to put the devices nodes inside the flow node.
-    flowNode.addObjectArray("devices"s, std::move(devicesNodes));
-
-    flowNode.addValue("activationTime"s,
-                      std::chrono::milliseconds{
-                          m_timeProvider.get().load()->getWateringSystemActivationDuration()}
-                          .count());
-    flowNode.addValue("deactivationTime"s,
-                      std::chrono::milliseconds{
-                          m_timeProvider.get().load()->getWateringSystemDeactivationDuration()}
-                          .count());
-    flowNode.addValue("deactivationSepTime"s,
-                      std::chrono::milliseconds{
-                          m_timeProvider.get().load()->getPumpValveDeactivationTimeSeparation()}
-                          .count());
+    const details::AWSConfig awsConfig{"cycled"s, m_name, std::move(flowConfig)};
 
     // Now we can put the nodes inside the project.
-    awsNode.addObject("flow"s, std::move(flowNode));
-    project.addObject("automaticWateringSystem"s, std::move(awsNode));
+    project.addObject("automaticWateringSystem"s, schema::Encode(awsConfig));
 }
 
 void DailyCycleAutomaticWateringSystem::loadConfigFromProject(
@@ -570,22 +817,81 @@ void DailyCycleAutomaticWateringSystem::loadConfigFromProject(
     if (!prj.containsObject("automaticWateringSystem"s))
         return;
 
-    const ProjectNode& awsNode{prj.getObject("automaticWateringSystem"s)};
+    // The whole configuration is decoded and validated before touching the running
+    // system, so a wrong configuration never stops it.
+    details::AWSConfig awsConfig{};
+    schema::DecodeResult decodeResult{};
+    try {
+        decodeResult = schema::Decode(prj.getObject("automaticWateringSystem"s), awsConfig);
+    } catch (const std::exception& exc) {
+        // Only reading a malformed project section can throw here.
+        m_userLogger->logError(
+            format_log_string("Error while loading the AWS configuration. No AWS configuration "
+                              "will be loaded. See log for more."));
+        m_mainLogger->logError(format_log_string(
+            "Error while loading the AWS configuration. No AWS configuration will be loaded."));
+        m_mainLogger->logError(format_log_string("Error message: "s + exc.what()));
+        return;
+    }
 
-    if (awsNode.getValue<StringType>("mode"s) != "cycled"s) {
+    if (!decodeResult) {
+        m_userLogger->logError(
+            format_log_string("The given AWS configuration contains a JSON format not recognized. "
+                              "No AWS configuration will be loaded."));
+        m_userLogger->logWarning(
+            format_log_string("Have you entered wrong values in the configuration?"));
+        m_mainLogger->logError(format_log_string(
+            "AWS configuration field \""s + StringType{decodeResult.key} + "\": "s +
+            StringType{schema::DecodeErrorToString(decodeResult.error)}));
+        return;
+    }
+
+    if (awsConfig.mode != "cycled"s) {
         m_userLogger->logError(
             format_log_string("The given project contains an automatic watering system but the "
                               "mode isn\'t recognized. No AWS configuration will be loaded."));
         return;
     }
 
-    if (!awsNode.containsObject("flow"s)) {
+    if (!awsConfig.flow.has_value()) {
         m_userLogger->logWarning(
             format_log_string("The given project doesn\'t contain the flow configuration. Skipping "
                               "configuration loading."));
         return;
     }
 
+    const details::AWSFlowConfig& flowConfig{awsConfig.flow.value()};
+
+    // Empty arrays aren't stored by the project readers, so the schema can't require the
+    // devices: a flow without them is rejected here.
+    if (flowConfig.devices.empty()) {
+        m_userLogger->logError(
+            format_log_string("The given AWS configuration doesn\'t contain the devices. No AWS "
+                              "configuration will be loaded."));
+        m_mainLogger->logError(format_log_string(
+            "AWS configuration field \"devices\": "s +
+            StringType{schema::DecodeErrorToString(schema::DecodeError::MissingField)}));
+        return;
+    }
+
+    // We need to associate the devices to the water valve and water pump objects.
+    const details::AWSDeviceConfig* valveConfig{};
+    const details::AWSDeviceConfig* pumpConfig{};
+    for (const details::AWSDeviceConfig& deviceConfig : flowConfig.devices) {
+        if (deviceConfig.name == "waterValve"s) {
+            valveConfig = &deviceConfig;
+        } else if (deviceConfig.name == "waterPump"s) {
+            pumpConfig = &deviceConfig;
+        } else {
+            m_userLogger->logError(
+                format_log_string("The given AWS configuration contains a device name not "
+                                  "recognized. No AWS configuration will be loaded."));
+            m_userLogger->logWarning(
+                format_log_string("Have you entered wrong values in the configuration?"));
+            return;
+        }
+    }
+
     // If the AWS is running we need to stop it before loading the new configuration.
     const bool bWasRunning{isRunning()};
     if (bWasRunning) {
@@ -598,133 +904,35 @@ void DailyCycleAutomaticWateringSystem::loadConfigFromProject(
         requestShutdown();
     }
 
-    const ProjectNode& flowNode{awsNode.getObject("flow"s)};
-
-    bool bValveEnabled{}, bPumpEnabled{};
-    std::uint64_t valvePinID{}, pumpPinID{};
-    automatic_watering::WateringSystemHardwareController::activation_state valveActivationState{},
-        pumpActivationState{};
-    WateringSystemTimeProvider::time_unit activationTime{}, deactivationTime{},
-        deactivationSepTime{};
-
-    try {
-        // We need to read the devices and associate them to water valve and water pump
-        // objects.
-        const std::vector<ProjectNode>& devicesNodes{flowNode.getObjectArray("devices"s)};
-        for (const ProjectNode& deviceNode : devicesNodes) {
-            const StringType deviceName{deviceNode.getValue<StringType>("name"s)};
-            if (deviceName == "waterValve"s) {
-                bValveEnabled = deviceNode.getValue<bool>("enabled"s);
-                valvePinID = deviceNode.getValue<std::uint64_t>("pinID"s);
-
-                // Read the activation state
-                const StringType activationStateStr{
-                    deviceNode.getValue<StringType>("activationState"s)};
-                if (activationStateStr == "Active High"s) {
-                    valveActivationState = automatic_watering::WateringSystemHardwareController::
-                        activation_state::ActiveHigh;
-                } else if (activationStateStr == "Active Low"s) {
-                    valveActivationState = automatic_watering::WateringSystemHardwareController::
-                        activation_state::ActiveLow;
-                }
-            } else if (deviceName == "waterPump"s) {
-                bPumpEnabled = deviceNode.getValue<bool>("enabled"s);
-                pumpPinID = deviceNode.getValue<std::uint64_t>("pinID"s);
-
-                // Read the activation state
-                const StringType activationStateStr{
-                    deviceNode.getValue<StringType>("activationState"s)};
-                if (activationStateStr == "Active High"s) {
-                    pumpActivationState = automatic_watering::WateringSystemHardwareController::
-                        activation_state::ActiveHigh;
-                } else if (activationStateStr == "Active Low"s) {
-                    pumpActivationState = automatic_watering::WateringSystemHardwareController::
-                        activation_state::ActiveLow;
-                }
-            } else {
-                m_userLogger->logError(
-                    format_log_string("The given AWS configuration contains a device name not "
-                                      "recognized. No AWS configuration will be loaded."));
-                m_userLogger->logWarning(
-                    format_log_string("Have you entered wrong values in the configuration?"));
-
-                if (bWasRunning) {
-                    const StringType formattedLogString{format_log_string(
-                        "Automatic watering system was running. Restoring the old configuration.")};
-                    m_mainLogger->logWarning(formattedLogString);
-                    m_userLogger->logWarning(formattedLogString);
-
-                    startAutomaticWatering({});
-                }
-
-                return;
-            }
-        }
-
-        activationTime =
-            std::chrono::milliseconds{flowNode.getValue<std::uint64_t>("activationTime"s)};
-        deactivationTime =
-            std::chrono::milliseconds{flowNode.getValue<std::uint64_t>("deactivationTime"s)};
-        deactivationSepTime =
-            std::chrono::milliseconds{flowNode.getValue<std::uint64_t>("deactivationSepTime"s)};
-    } catch (const std::bad_variant_access& exc) {
-        m_userLogger->logError(
-            format_log_string("The given AWS configuration contains a JSON format not recognized. "
-                              "No AWS configuration will be loaded."));
-        m_userLogger->logWarning(
-            format_log_string("Have you entered wrong values in the configuration?"));
-
-        if (bWasRunning) {
-            const StringType formattedLogString{format_log_string(
-                "Automatic watering system was running. Restoring the old configuration.")};
-            m_mainLogger->logWarning(formattedLogString);
-            m_userLogger->logWarning(formattedLogString);
-
-            startAutomaticWatering({});
-        }
-
-        return;
-    } catch (const std::exception& exc) {
-        m_userLogger->logError(
-            format_log_string("Error while loading the AWS configuration. No AWS configuration "
-                              "will be loaded. See log for more."));
-        m_mainLogger->logError(format_log_string(
-            "Error while loading the AWS configuration. No AWS configuration will be loaded."));
-        m_mainLogger->logError(format_log_string("Error message: "s + exc.what()));
-
-        if (bWasRunning) {
-            const StringType formattedLogString{format_log_string(
-                "Automatic watering system was running. Restoring the old configuration.")};
-            m_mainLogger->logWarning(formattedLogString);
-            m_userLogger->logWarning(formattedLogString);
-
-            startAutomaticWatering({});
-        }
-
-        return;
-    }
+    const bool bValveEnabled{valveConfig != nullptr && valveConfig->bEnabled};
+    const bool bPumpEnabled{pumpConfig != nullptr && pumpConfig->bEnabled};
 
     m_bWaterValveEnabled.store(bValveEnabled);
     m_bWaterPumpEnabled.store(bPumpEnabled);
 
     if (bValveEnabled) {
-        m_hardwareController.get().load()->setWaterValveDigitalOutputID(valvePinID,
-                                                                        valveActivationState);
+        m_hardwareController.get().load()->setWaterValveDigitalOutputID(
+            valveConfig->pinID, valveConfig->activationState);
     }
 
     if (bPumpEnabled) {
-        m_hardwareController.get().load()->setWaterPumpDigitalOutputID(pumpPinID,
-                                                                       pumpActivationState);
+        m_hardwareController.get().load()->setWaterPumpDigitalOutputID(
+            pumpConfig->pinID, pumpConfig->activationState);
     }
 
-    m_timeProvider.get().load()->setWateringSystemActivationDuration(activationTime);
-    m_timeProvider.get().load()->setWateringSystemDeactivationDuration(deactivationTime);
-    m_timeProvider.get().load()->setPumpValveDeactivationTimeSeparation(deactivationSepTime);
+    m_timeProvider.get().load()->setWateringSystemActivationDuration(flowConfig.activationTime);
+    m_timeProvider.get().load()->setWateringSystemDeactivationDuration(
+        flowConfig.deactivationTime);
+    m_timeProvider.get().load()->setPumpValveDeactivationTimeSeparation(
+        flowConfig.deactivationSepTime);
+    m_flowRate.store(std::max(flowConfig.flowRate.value_or(0.0), 0.0));
+
+    {
+        std::lock_guard diagnosticLock{m_diagnosticMutex};
+        m_name = awsConfig.name.value_or("Unnamed-flow-1"s);
+    }
 
-    if (awsNode.containsValue("name"s))
-        m_name = awsNode.getValue<StringType>("name"s);
-    else
-        m_name = "Unnamed-flow-1";
+    m_changeNotifier.notifyChanged();
 
     if (bWasRunning) {
         const StringType formattedLogString{
@@ -4,11 +4,14 @@
 #include <automatic-watering/automatic-watering-system.hpp>
 #include <automatic-watering/hardware-controllers/watering-system-hardware-controller.hpp>
 #include <automatic-watering/time-providers/watering-system-time-provider.hpp>
+#include <automatic-watering/water-usage/water-usage-ledger-folder.hpp>
 
 #include <abort-system/emergency-stoppable-system.hpp>
 #include <abort-system/terminable-system.hpp>
+#include <diagnostics/diagnostic-change-notifier.hpp>
 #include <diagnostics/diagnostic-status-probeable.hpp>
 #include <gc-project/project-component.hpp>
+#include <watchdog/heartbeat.hpp>
 
 #include <gh_log/logger.hpp>
 
@@ -16,11 +19,14 @@
 
 // C++ STL
 #include <atomic>
+#include <chrono>
 #include <condition_variable>
 #include <cstdint>
 #include <functional>
 #include <memory>
 #include <mutex>
+#include <optional>
+#include <stop_token>
 #include <thread>
 #include <tuple>
 
@@ -53,9 +59,10 @@ public:
     using hardware_controller_atomic_ref = std::reference_wrapper<hardware_controller_pointer>;
     using time_provider_pointer = std::atomic<WateringSystemTimeProvider*>;
     using time_provider_atomic_ref = std::reference_wrapper<time_provider_pointer>;
-    using stop_event_listener = std::condition_variable;
+    using stop_event_listener = std::condition_variable_any;
     using stop_event_mutex = std::mutex;
     using hardware_access_mutex_reference = std::reference_wrapper<std::mutex>;
+    using water_usage_ledgers_pointer = std::shared_ptr<WaterUsageLedgerFolder>;
 
     ~DailyCycleAutomaticWateringSystem() noexcept override = default;
 
@@ -66,10 +73,14 @@ public:
     //! \param[in] mainLogger The logger that writes to the application main log file
     //! \param[in] userLog The logger that prints the messages to the preferred user display device
     //! (std::cout mainly)
-    DailyCycleAutomaticWateringSystem(hardware_access_mutex_reference hardwareMutex,
-                                      main_logger_pointer mainLogger, user_logger_pointer userLog,
-                                      hardware_controller_atomic_ref hardwareController,
-                                      time_provider_atomic_ref timeProvider) noexcept;
+    //! \param[in] waterUsageLedgers The ledgers where the water delivered by every cycle is
+    //!  recorded, in the one of the current flow name. If null, the water usage isn't accounted.
+    //! \throws std::invalid_argument if the metrics of the system can't be registered.
+    DailyCycleAutomaticWateringSystem(
+        hardware_access_mutex_reference hardwareMutex, main_logger_pointer mainLogger,
+        user_logger_pointer userLog, hardware_controller_atomic_ref hardwareController,
+        time_provider_atomic_ref timeProvider,
+        water_usage_ledgers_pointer waterUsageLedgers = nullptr);
 
     //!!
     //! \brief Requests the automatic watering system to shutdown if the worker thread is running.
@@ -78,8 +89,9 @@ public:
     void requestShutdown() noexcept override;
 
     //!!
-    //! \brief (FOR NOW) Same as requestShutdown.
-    //! \note Possibly a blocking call.
+    //! \brief Requests the worker thread to stop without waiting for it, as the worker may be
+    //!  hung in a hardware call. The worker is joined by requestShutdown(), or by the next
+    //!  startAutomaticWatering().
     void emergencyAbort() noexcept override;
 
     //!!
@@ -102,11 +114,31 @@ public:
     //! \param bEnabled True if the water valve need to be enabled.
     void setWaterValveEnabled(const bool bEnabled) noexcept;
 
-    void printDiagnostic(std::ostream& ost) const noexcept override;
+    //!!
+    //! \brief Set the water flowing through the flow while it's irrigating, used to convert
+    //!  the actuation times to litres.
+    //!
+    //! \param litresPerMinute The flow rate, in litres per minute.
+    void setFlowRate(const double litresPerMinute) noexcept;
+
+    [[nodiscard]] diagnostics::DiagnosticSnapshot captureDiagnostic() const override;
+
+    [[nodiscard]] diagnostics::DiagnosticChangeNotifier* getChangeNotifier()
+        const noexcept override {
+        return &m_changeNotifier;
+    }
 
     void saveToProject(gc::project_management::Project& project) override;
     void loadConfigFromProject(const gc::project_management::Project& project) override;
 
+    //!!
+    //! \brief Retrieves the heartbeat of the worker thread, which beats at every step of the
+    //!  cycle and announces the waits between them.
+    //!
+    [[nodiscard]] const watchdog::Heartbeat& getHeartbeat() const noexcept {
+        return m_heartbeat;
+    }
+
     [[nodiscard]] inline bool isRunning() const noexcept {
         return (m_state.load() != EDailyCycleAWSState::Disabled);
     }
@@ -119,15 +151,34 @@ private:
     time_provider_atomic_ref m_timeProvider;
     stop_event_listener m_stopListener{};
     stop_event_mutex m_stopMutex{};
+    // The stop source of the running worker, used by the emergency abort. Its mutex is never
+    // held while waiting for the worker, so the abort can't block on a hung worker.
+    std::mutex m_workerStopSourceMutex{};
+    std::stop_source m_workerStopSource{std::nostopstate};
     hardware_access_mutex_reference m_hardwareAccessMutex;
     std::atomic_bool m_bWaterPumpEnabled{true};
     std::atomic_bool m_bWaterValveEnabled{true};
     std::atomic<EDailyCycleAWSState> m_state{EDailyCycleAWSState::Disabled};
     std::atomic<std::uint64_t> m_cyclesCounter{};
+    std::atomic<double> m_flowRate{};
+    water_usage_ledgers_pointer m_waterUsageLedgers{};
+    // The activation times of the devices and the usage of the running actuation. They are
+    // accessed by the worker thread only.
+    std::optional<std::chrono::steady_clock::time_point> m_valveActivationTime{};
+    std::optional<std::chrono::steady_clock::time_point> m_pumpActivationTime{};
+    WaterUsage m_actuationUsage{};
+    // Guards the name and the worker thread assignment, which can be captured by a status
+    // watcher on another thread.
+    mutable std::mutex m_diagnosticMutex{};
     name_type m_name{"Unnamed-flow-1"};
+    mutable diagnostics::DiagnosticChangeNotifier m_changeNotifier{};
+    watchdog::Heartbeat m_heartbeat{};
 
-    void run_automatic_watering(std::stop_token stopToken,
-                                const main_logger_pointer& logger) noexcept;
+    void run_automatic_watering(std::stop_token stopToken, const main_logger_pointer& logger,
+                                const name_type& flowName) noexcept;
+
+    // Stops the worker thread, waits for it and disables the system.
+    void join_worker() noexcept;
 
     // Updates the status of the valve and pump devices according to the given
     // initial status. If the initial status of a device was "enabled" then this will
@@ -138,6 +189,15 @@ private:
     void activate_watering_hardware() noexcept;
     void disable_watering_hardware() noexcept;
 
+    // Adds the time elapsed since the activation of a device to the given active time.
+    static void stop_device_stopwatch(
+        std::optional<std::chrono::steady_clock::time_point>& activationTime,
+        std::chrono::milliseconds& activeTime) noexcept;
+
+    // Stops the devices stopwatches and records the water delivered by the actuation in the
+    // ledger of the given flow, if a device has been activated.
+    void record_water_usage(const name_type& flowName) noexcept;
+
     [[nodiscard]] static StringType format_log_string(StringViewType message) noexcept;
 };
 
@@ -0,0 +1,108 @@
+// Copyright (c) 2023 Andrea Ballestrazzi
+#include <automatic-watering/time-providers/moisture-controlled-aws-time-provider.hpp>
+
+// C++ STL
+#include <chrono>
+#include <cmath>
+
+namespace rpi_gc::automatic_watering {
+
+MoistureControlledAWSTimeProvider::MoistureControlledAWSTimeProvider(
+    const sensors::SensorSampleRing& moistureSamples, fallback_provider_ref fallbackTimeProvider,
+    const MoistureControlParameters& controlParameters, const MoistureWateringLimits& limits)
+    : m_moistureSamples{moistureSamples},
+      m_fallbackTimeProvider{fallbackTimeProvider},
+      m_limits{limits},
+      m_controller{controlParameters} {
+    // The ring never returns more samples than its capacity, so the updates don't allocate.
+    m_newSamples.reserve(m_moistureSamples.getCapacity());
+}
+
+auto MoistureControlledAWSTimeProvider::getWateringSystemActivationDuration() const noexcept
+    -> time_unit {
+    std::lock_guard controlLock{m_controlMutex};
+    if (!update_controller())
+        return m_fallbackTimeProvider.get().getWateringSystemActivationDuration();
+
+    const MoistureControlOutput& controlOutput{m_controller.getOutput()};
+    if (!controlOutput.bWatering)
+        return time_unit::zero();
+
+    return time_unit{static_cast<time_unit::rep>(std::lround(
+        controlOutput.demand * static_cast<double>(m_limits.maxActivationTime.count())))};
+}
+
+auto MoistureControlledAWSTimeProvider::getWateringSystemDeactivationDuration() const noexcept
+    -> time_unit {
+    std::lock_guard controlLock{m_controlMutex};
+    if (!update_controller())
+        return m_fallbackTimeProvider.get().getWateringSystemDeactivationDuration();
+
+    const MoistureControlOutput& controlOutput{m_controller.getOutput()};
+    if (!controlOutput.bWatering)
+        return m_limits.maxDeactivationTime;
+
+    const double deactivationRange{static_cast<double>(
+        (m_limits.maxDeactivationTime - m_limits.minDeactivationTime).count())};
+    return m_limits.maxDeactivationTime -
+           time_unit{static_cast<time_unit::rep>(
+               std::lround(controlOutput.demand * deactivationRange))};
+}
+
+auto MoistureControlledAWSTimeProvider::getPumpValveDeactivationTimeSeparation() const noexcept
+    -> time_unit {
+    return m_fallbackTimeProvider.get().getPumpValveDeactivationTimeSeparation();
+}
+
+void MoistureControlledAWSTimeProvider::setWateringSystemActivationDuration(
+    const time_unit duration) noexcept {
+    m_fallbackTimeProvider.get().setWateringSystemActivationDuration(duration);
+}
+
+void MoistureControlledAWSTimeProvider::setWateringSystemDeactivationDuration(
+    const time_unit duration) noexcept {
+    m_fallbackTimeProvider.get().setWateringSystemDeactivationDuration(duration);
+}
+
+void MoistureControlledAWSTimeProvider::setPumpValveDeactivationTimeSeparation(
+    const time_unit duration) noexcept {
+    m_fallbackTimeProvider.get().setPumpValveDeactivationTimeSeparation(duration);
+}
+
+MoistureControlOutput MoistureControlledAWSTimeProvider::getControlOutput() const noexcept {
+    std::lock_guard controlLock{m_controlMutex};
+    update_controller();
+    return m_controller.getOutput();
+}
+
+bool MoistureControlledAWSTimeProvider::isUsingFallback() const noexcept {
+    std::lock_guard controlLock{m_controlMutex};
+    return !update_controller();
+}
+
+bool MoistureControlledAWSTimeProvider::update_controller() const noexcept {
+    m_newSamples.clear();
+    m_samplesPosition = m_moistureSamples.readFrom(m_samplesPosition, m_newSamples);
+
+    if (!m_newSamples.empty()) {
+        // The readings since the last update are averaged, which filters the sensor noise.
+        double moistureSum{};
+        for (const sensors::SensorSample& sample : m_newSamples)
+            moistureSum += sample.value;
+
+        const std::int64_t sampleTimestamp{m_newSamples.back().timestamp};
+        const std::chrono::milliseconds stepTime{
+            m_lastSampleTimestamp.has_value() ? sampleTimestamp - *m_lastSampleTimestamp : 0};
+        m_controller.step(moistureSum / static_cast<double>(m_newSamples.size()), stepTime);
+        m_lastSampleTimestamp = sampleTimestamp;
+    }
+
+    if (!m_lastSampleTimestamp.has_value())
+        return false;
+
+    const auto now{std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::system_clock::now().time_since_epoch())};
+    return now.count() - *m_lastSampleTimestamp <= m_limits.readingsTimeout.count();
+}
+
+} // namespace rpi_gc::automatic_watering
@@ -0,0 +1,100 @@
+// Copyright (c) 2023 Andrea Ballestrazzi
+#ifndef MOISTURE_CONTROLLED_AWS_TIME_PROVIDER_HPP
+#define MOISTURE_CONTROLLED_AWS_TIME_PROVIDER_HPP
+
+#include <automatic-watering/time-providers/moisture-controller.hpp>
+#include <automatic-watering/time-providers/watering-system-time-provider.hpp>
+#include <sensors/sensor-sample-ring.hpp>
+
+// C++ STL
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <optional>
+#include <vector>
+
+namespace rpi_gc::automatic_watering {
+
+//!!
+//! \brief The bounds of the durations computed from the moisture.
+//!
+struct MoistureWateringLimits {
+    using time_unit = WateringSystemTimeProvider::time_unit;
+
+    //! The activation time when the watering demand is full.
+    time_unit maxActivationTime{20'000};
+    //! The deactivation time when the watering demand is full.
+    time_unit minDeactivationTime{300'000};
+    //! The deactivation time when the soil doesn't need water.
+    time_unit maxDeactivationTime{1'800'000};
+    //! The age after which the last reading is too old to control the watering.
+    time_unit readingsTimeout{900'000};
+};
+
+//!!
+//! \brief A time provider that waters according to the soil moisture. The new moisture
+//!  readings are averaged and fed to a MoistureController, whose demand sets the durations:
+//!  the drier the soil, the longer the activation and the shorter the deactivation. When the
+//!  soil is wet the activation is zero and the deactivation is the longest one.
+//!
+//!  The controller is updated only when a duration is requested and new readings are
+//!  available, and it integrates over the time between the readings, so the status requests
+//!  don't change its decisions. Without recent readings, e.g. if the sensor is broken, the
+//!  durations of the fallback provider are used, which are also the ones set by the users.
+//!
+class MoistureControlledAWSTimeProvider final : public WateringSystemTimeProvider {
+public:
+    using fallback_provider_ref = std::reference_wrapper<WateringSystemTimeProvider>;
+
+    //!!
+    //! \brief Construct a new moisture controlled time provider.
+    //!
+    //! \param[in] moistureSamples The ring of the moisture sensor samples.
+    //! \param[in] fallbackTimeProvider The provider used without recent readings.
+    //! \param[in] controlParameters The tuning of the controller.
+    //! \param[in] limits The bounds of the computed durations.
+    //!
+    MoistureControlledAWSTimeProvider(const sensors::SensorSampleRing& moistureSamples,
+                                      fallback_provider_ref fallbackTimeProvider,
+                                      const MoistureControlParameters& controlParameters = {},
+                                      const MoistureWateringLimits& limits = {});
+
+    [[nodiscard]] time_unit getWateringSystemActivationDuration() const noexcept override;
+
+    [[nodiscard]] time_unit getWateringSystemDeactivationDuration() const noexcept override;
+
+    [[nodiscard]] time_unit getPumpValveDeactivationTimeSeparation() const noexcept override;
+
+    //! \note The durations set by the users are used only without recent readings.
+    void setWateringSystemActivationDuration(const time_unit duration) noexcept override;
+    void setWateringSystemDeactivationDuration(const time_unit duration) noexcept override;
+    void setPumpValveDeactivationTimeSeparation(const time_unit duration) noexcept override;
+
+    //! \return The state of the controller after the last update.
+    [[nodiscard]] MoistureControlOutput getControlOutput() const noexcept;
+
+    //! \return True if there are no recent readings and the fallback durations are used.
+    [[nodiscard]] bool isUsingFallback() const noexcept;
+
+private:
+    const sensors::SensorSampleRing& m_moistureSamples;
+    fallback_provider_ref m_fallbackTimeProvider;
+    MoistureWateringLimits m_limits{};
+
+    mutable std::mutex m_controlMutex{};
+    mutable MoistureController m_controller;
+    mutable std::uint64_t m_samplesPosition{};
+    mutable std::optional<std::int64_t> m_lastSampleTimestamp{};
+    mutable std::vector<sensors::SensorSample> m_newSamples{};
+
+    //!!
+    //! \brief Feeds the new readings to the controller. Must be called with the control mutex.
+    //!
+    //! \return True if the controller can be used, false if the fallback must be used.
+    //!
+    bool update_controller() const noexcept;
+};
+
+} // namespace rpi_gc::automatic_watering
+
+#endif // !MOISTURE_CONTROLLED_AWS_TIME_PROVIDER_HPP
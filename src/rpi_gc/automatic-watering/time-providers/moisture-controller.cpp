@@ -0,0 +1,46 @@
+// Copyright (c) 2023 Andrea Ballestrazzi
+#include <automatic-watering/time-providers/moisture-controller.hpp>
+
+// C++ STL
+#include <algorithm>
+
+namespace rpi_gc::automatic_watering {
+
+MoistureControlOutput MoistureController::step(const double moisture,
+                                               const std::chrono::milliseconds stepTime) noexcept {
+    // The hysteresis decides whether there is anything to control.
+    if (moisture >= m_parameters.setpoint + m_parameters.hysteresis) {
+        m_output.bWatering = false;
+    } else if (moisture <= m_parameters.setpoint - m_parameters.hysteresis) {
+        m_output.bWatering = true;
+    }
+
+    if (!m_output.bWatering) {
+        m_output.demand = 0.0;
+        return m_output;
+    }
+
+    const double error{m_parameters.setpoint - moisture};
+    const double stepSeconds{
+        std::chrono::duration<double>{std::clamp(stepTime, std::chrono::milliseconds::zero(),
+                                                 std::chrono::milliseconds{
+                                                     m_parameters.maxStepTime})}
+            .count()};
+
+    // Anti-windup: the error is integrated only if the demand it produces isn't pushed
+    // further into the saturation.
+    const double candidateIntegral{m_output.integral + error * stepSeconds};
+    const double candidateDemand{m_parameters.proportionalGain * error +
+                                 m_parameters.integralGain * candidateIntegral};
+    const bool bSaturatedHigh{candidateDemand > 1.0 && error > 0.0};
+    const bool bSaturatedLow{candidateDemand < 0.0 && error < 0.0};
+    if (!bSaturatedHigh && !bSaturatedLow)
+        m_output.integral = candidateIntegral;
+
+    m_output.demand = std::clamp(m_parameters.proportionalGain * error +
+                                     m_parameters.integralGain * m_output.integral,
+                                 0.0, 1.0);
+    return m_output;
+}
+
+} // namespace rpi_gc::automatic_watering
@@ -0,0 +1,82 @@
+// Copyright (c) 2023 Andrea Ballestrazzi
+#ifndef MOISTURE_CONTROLLER_HPP
+#define MOISTURE_CONTROLLER_HPP
+
+// C++ STL
+#include <chrono>
+
+namespace rpi_gc::automatic_watering {
+
+//!!
+//! \brief The tuning of the moisture controller. The moistures are in the unit of the sensor,
+//!  usually the volumetric water content in percent.
+//!
+struct MoistureControlParameters {
+    //! The moisture the controller keeps the soil at.
+    double setpoint{35.0};
+    //! Half the width of the band around the setpoint in which the watering doesn't change
+    //! state: it stops above setpoint + hysteresis and restarts below setpoint - hysteresis.
+    double hysteresis{3.0};
+    //! The watering demand, from 0 to 1, for every unit of moisture below the setpoint.
+    double proportionalGain{0.05};
+    //! The watering demand for every unit of moisture below the setpoint held for a second.
+    double integralGain{0.0001};
+    //! The longest time the integral term accumulates over in a single step, so that a long
+    //! gap between two readings doesn't make the controller jump.
+    std::chrono::seconds maxStepTime{3600};
+};
+
+//!!
+//! \brief The state of the moisture controller after a step.
+//!
+struct MoistureControlOutput {
+    //! The watering demand, from 0 (no water) to 1 (as much water as allowed).
+    double demand{};
+    //! The sum of the errors over time, in moisture units times seconds.
+    double integral{};
+    //! Whether the soil is dry enough to be watered, according to the hysteresis.
+    bool bWatering{};
+};
+
+//!!
+//! \brief A PI controller with hysteresis that turns the soil moisture into a watering demand.
+//!
+//!  The hysteresis decides whether the soil needs water at all: the watering stops when the
+//!  moisture rises above the band around the setpoint and restarts when it falls below it.
+//!  While watering, the demand is the proportional and integral terms of the moisture error,
+//!  clamped between 0 and 1. The integral is frozen when the demand is saturated in the
+//!  direction of the error (anti-windup) and while the watering is stopped, so the controller
+//!  doesn't accumulate a demand it can't act on.
+//!
+//!  A step is a handful of floating point operations, with no allocation and no lock.
+//!
+class MoistureController final {
+public:
+    explicit constexpr MoistureController(const MoistureControlParameters& parameters) noexcept
+        : m_parameters{parameters} {}
+
+    //!!
+    //! \brief Updates the controller with a new moisture reading.
+    //!
+    //! \param[in] moisture The filtered moisture of the soil.
+    //! \param[in] stepTime The time elapsed since the previous reading.
+    //! \return The new state of the controller.
+    //!
+    MoistureControlOutput step(double moisture, std::chrono::milliseconds stepTime) noexcept;
+
+    [[nodiscard]] constexpr const MoistureControlOutput& getOutput() const noexcept {
+        return m_output;
+    }
+
+    [[nodiscard]] constexpr const MoistureControlParameters& getParameters() const noexcept {
+        return m_parameters;
+    }
+
+private:
+    MoistureControlParameters m_parameters{};
+    MoistureControlOutput m_output{};
+};
+
+} // namespace rpi_gc::automatic_watering
+
+#endif // !MOISTURE_CONTROLLER_HPP
@@ -0,0 +1,53 @@
+// Copyright (c) 2023 Andrea Ballestrazzi
+#include <automatic-watering/water-usage/water-usage-ledger-folder.hpp>
+
+// C++ STL
+#include <cctype>
+#include <utility>
+
+namespace rpi_gc::automatic_watering {
+
+namespace {
+
+constexpr std::string_view LEDGER_FILE_EXTENSION{".gcwu"};
+
+} // namespace
+
+WaterUsageLedgerFolder::WaterUsageLedgerFolder(std::filesystem::path folderPath)
+    : m_folderPath{std::move(folderPath)} {
+    std::filesystem::create_directories(m_folderPath);
+}
+
+WaterUsageLedger& WaterUsageLedgerFolder::getFlowLedger(const std::string_view flowName) {
+    std::lock_guard folderLock{m_mutex};
+    const auto ledgerIt{m_flowLedgers.find(flowName)};
+    if (ledgerIt != m_flowLedgers.end())
+        return *ledgerIt->second;
+
+    auto flowLedger{
+        std::make_unique<WaterUsageLedger>(m_folderPath / GetFlowLedgerFileName(flowName))};
+    return *m_flowLedgers.emplace(std::string{flowName}, std::move(flowLedger)).first->second;
+}
+
+std::filesystem::path WaterUsageLedgerFolder::GetFlowLedgerFileName(
+    const std::string_view flowName) {
+    constexpr std::string_view HEX_DIGITS{"0123456789ABCDEF"};
+
+    std::string fileName{};
+    fileName.reserve(flowName.size() + LEDGER_FILE_EXTENSION.size());
+    for (const char character : flowName) {
+        const auto byte{static_cast<unsigned char>(character)};
+        if (std::isalnum(byte) != 0 || character == '-' || character == '_') {
+            fileName.push_back(character);
+            continue;
+        }
+
+        fileName.push_back('%');
+        fileName.push_back(HEX_DIGITS[byte >> 4]);
+        fileName.push_back(HEX_DIGITS[byte & 0x0F]);
+    }
+
+    return fileName.append(LEDGER_FILE_EXTENSION);
+}
+
+} // namespace rpi_gc::automatic_watering
@@ -0,0 +1,61 @@
+// Copyright (c) 2023 Andrea Ballestrazzi
+#pragma once
+
+#include <automatic-watering/water-usage/water-usage-ledger.hpp>
+
+// C++ STL
+#include <filesystem>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+
+namespace rpi_gc::automatic_watering {
+
+//!!
+//! \brief The water usage ledgers of the flows, one file per flow inside a folder. The ledger
+//!  of a flow is opened the first time it's requested, so the flows that are renamed or loaded
+//!  from another project start accounting in their own file.
+//!
+//! \note The folder can be used from multiple threads.
+//!
+class WaterUsageLedgerFolder final {
+public:
+    //!!
+    //! \brief Opens the ledgers folder, creating it if it doesn't exist. The ledger files
+    //!  aren't opened here.
+    //!
+    //! \param[in] folderPath The path of the ledgers folder.
+    //! \throw std::filesystem::filesystem_error if the folder can't be created.
+    //!
+    explicit WaterUsageLedgerFolder(std::filesystem::path folderPath);
+
+    WaterUsageLedgerFolder(const WaterUsageLedgerFolder&) = delete;
+    WaterUsageLedgerFolder& operator=(const WaterUsageLedgerFolder&) = delete;
+
+    //!!
+    //! \brief Retrieves the ledger of a flow, opening or creating its file if needed. The
+    //!  ledger lives as long as the folder.
+    //!
+    //! \param[in] flowName The name of the flow.
+    //! \throw std::system_error if the file can't be opened or read.
+    //! \throw std::runtime_error if the file isn't a ledger file.
+    //!
+    [[nodiscard]] WaterUsageLedger& getFlowLedger(std::string_view flowName);
+
+    //!!
+    //! \brief Retrieves the name of the ledger file of a flow. The characters that aren't
+    //!  letters, digits, '-' or '_' are percent-encoded, so every name maps to its own file
+    //!  and no name can escape the folder.
+    //!
+    [[nodiscard]] static std::filesystem::path GetFlowLedgerFileName(std::string_view flowName);
+
+private:
+    std::filesystem::path m_folderPath;
+    std::mutex m_mutex{};
+    std::map<std::string, std::unique_ptr<WaterUsageLedger>, std::less<>> m_flowLedgers{};
+};
+
+} // namespace rpi_gc::automatic_watering
@@ -0,0 +1,185 @@
+// Copyright (c) 2023 Andrea Ballestrazzi
+#include <automatic-watering/water-usage/water-usage-ledger.hpp>
+
+#include <posix-io/file-io.hpp>
+#include <posix-io/system-error.hpp>
+
+// C++ STL
+#include <array>
+#include <cstddef>
+#include <stdexcept>
+
+// POSIX
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <sys/types.h>
+#include <unistd.h>
+
+namespace rpi_gc::automatic_watering {
+
+namespace {
+
+constexpr std::uint32_t LEDGER_MAGIC{0x55574347}; // "GCWU"
+constexpr std::uint16_t LEDGER_VERSION{1};
+
+// The header stores the magic, the version and the size of the records. The 16 bits after
+// the version and the last 32 bits are reserved.
+constexpr std::size_t HEADER_SIZE{16};
+constexpr std::size_t MAGIC_OFFSET{0};
+constexpr std::size_t VERSION_OFFSET{4};
+constexpr std::size_t RECORD_SIZE_OFFSET{8};
+
+// Every record stores the day, the usage of the day and the running total.
+constexpr std::size_t USAGE_SIZE{32};
+constexpr std::size_t RECORD_SIZE{8 + 2 * USAGE_SIZE};
+constexpr std::size_t DAY_OFFSET{0};
+constexpr std::size_t DAY_USAGE_OFFSET{8};
+constexpr std::size_t TOTAL_USAGE_OFFSET{DAY_USAGE_OFFSET + USAGE_SIZE};
+
+constexpr const char* LEDGER_WRITE_ERROR{"Unable to write the water usage ledger"};
+constexpr const char* LEDGER_READ_ERROR{"Unable to read the water usage ledger"};
+
+using header_bytes = std::array<std::uint8_t, HEADER_SIZE>;
+using record_bytes = std::array<std::uint8_t, RECORD_SIZE>;
+
+using gc::posix_io::LoadField;
+using gc::posix_io::ReadAll;
+using gc::posix_io::StoreField;
+using gc::posix_io::ThrowSystemError;
+using gc::posix_io::WriteAll;
+
+void StoreUsage(record_bytes& bytes, const std::size_t offset, const WaterUsage& usage) noexcept {
+    StoreField(bytes, offset, static_cast<std::int64_t>(usage.valveOpenTime.count()));
+    StoreField(bytes, offset + 8, static_cast<std::int64_t>(usage.pumpOnTime.count()));
+    StoreField(bytes, offset + 16, usage.litres);
+    StoreField(bytes, offset + 24, usage.actuations);
+}
+
+[[nodiscard]] WaterUsage LoadUsage(const record_bytes& bytes, const std::size_t offset) noexcept {
+    WaterUsage usage{};
+    usage.valveOpenTime = std::chrono::milliseconds{LoadField<std::int64_t>(bytes, offset)};
+    usage.pumpOnTime = std::chrono::milliseconds{LoadField<std::int64_t>(bytes, offset + 8)};
+    usage.litres = LoadField<double>(bytes, offset + 16);
+    usage.actuations = LoadField<std::uint64_t>(bytes, offset + 24);
+    return usage;
+}
+
+[[nodiscard]] off_t GetRecordOffset(const std::uint64_t recordIndex) noexcept {
+    return static_cast<off_t>(HEADER_SIZE + recordIndex * RECORD_SIZE);
+}
+
+} // namespace
+
+WaterUsageLedger::WaterUsageLedger(const std::filesystem::path& filePath)
+    : m_fileDescriptor{::open(filePath.c_str(), O_RDWR | O_CREAT | O_CLOEXEC, 0644)} {
+    if (m_fileDescriptor < 0)
+        ThrowSystemError("Unable to open the water usage ledger");
+
+    try {
+        struct stat fileStatus {};
+        if (::fstat(m_fileDescriptor, &fileStatus) != 0)
+            ThrowSystemError("Unable to read the size of the water usage ledger");
+
+        const auto fileSize{static_cast<std::uint64_t>(fileStatus.st_size)};
+        header_bytes headerBytes{};
+        if (fileSize == 0) {
+            StoreField(headerBytes, MAGIC_OFFSET, LEDGER_MAGIC);
+            StoreField(headerBytes, VERSION_OFFSET, LEDGER_VERSION);
+            StoreField(headerBytes, RECORD_SIZE_OFFSET, static_cast<std::uint32_t>(RECORD_SIZE));
+            WriteAll(m_fileDescriptor, headerBytes.data(), headerBytes.size(), 0,
+                     LEDGER_WRITE_ERROR);
+            return;
+        }
+
+        if (!ReadAll(m_fileDescriptor, headerBytes.data(), headerBytes.size(), 0,
+                     LEDGER_READ_ERROR) ||
+            LoadField<std::uint32_t>(headerBytes, MAGIC_OFFSET) != LEDGER_MAGIC)
+            throw std::runtime_error{"The file is not a water usage ledger."};
+
+        if (LoadField<std::uint16_t>(headerBytes, VERSION_OFFSET) != LEDGER_VERSION ||
+            LoadField<std::uint32_t>(headerBytes, RECORD_SIZE_OFFSET) != RECORD_SIZE)
+            throw std::runtime_error{"The water usage ledger version is not supported."};
+
+        // A record written partially by an interrupted append is ignored, and overwritten by
+        // the next one.
+        m_recordsCount = (fileSize - HEADER_SIZE) / RECORD_SIZE;
+        if (m_recordsCount == 0)
+            return;
+
+        record_bytes lastRecordBytes{};
+        if (!ReadAll(m_fileDescriptor, lastRecordBytes.data(), lastRecordBytes.size(),
+                     GetRecordOffset(m_recordsCount - 1), LEDGER_READ_ERROR))
+            throw std::runtime_error{"The water usage ledger is truncated."};
+
+        m_lastDay = LoadField<day_type>(lastRecordBytes, DAY_OFFSET);
+        m_lastDayUsage = LoadUsage(lastRecordBytes, DAY_USAGE_OFFSET);
+        m_totalUsage = LoadUsage(lastRecordBytes, TOTAL_USAGE_OFFSET);
+    } catch (...) {
+        ::close(m_fileDescriptor);
+        throw;
+    }
+}
+
+WaterUsageLedger::~WaterUsageLedger() noexcept {
+    ::close(m_fileDescriptor);
+}
+
+void WaterUsageLedger::recordActuation(const clock_type::time_point actuationEnd,
+                                       const WaterUsage& usage) {
+    const day_type actuationDay{GetDay(actuationEnd)};
+
+    std::lock_guard ledgerLock{m_mutex};
+    const bool bNewDay{m_recordsCount == 0 || actuationDay > m_lastDay};
+    const day_type day{bNewDay ? actuationDay : m_lastDay};
+    const std::uint64_t recordIndex{bNewDay ? m_recordsCount : m_recordsCount - 1};
+
+    WaterUsage dayUsage{bNewDay ? WaterUsage{} : m_lastDayUsage};
+    dayUsage += usage;
+    WaterUsage totalUsage{m_totalUsage};
+    totalUsage += usage;
+
+    // The counters are updated only once the record has been written, so that they never
+    // account for an actuation that isn't in the file.
+    write_record(recordIndex, day, dayUsage, totalUsage);
+
+    m_recordsCount = recordIndex + 1;
+    m_lastDay = day;
+    m_lastDayUsage = dayUsage;
+    m_totalUsage = totalUsage;
+    m_lastActuationUsage = usage;
+}
+
+WaterUsage WaterUsageLedger::getDayUsage(const clock_type::time_point time) const {
+    const day_type day{GetDay(time)};
+
+    std::lock_guard ledgerLock{m_mutex};
+    return m_recordsCount > 0 && day == m_lastDay ? m_lastDayUsage : WaterUsage{};
+}
+
+WaterUsage WaterUsageLedger::getTotalUsage() const {
+    std::lock_guard ledgerLock{m_mutex};
+    return m_totalUsage;
+}
+
+WaterUsage WaterUsageLedger::getLastActuationUsage() const {
+    std::lock_guard ledgerLock{m_mutex};
+    return m_lastActuationUsage;
+}
+
+WaterUsageLedger::day_type WaterUsageLedger::GetDay(const clock_type::time_point time) noexcept {
+    return std::chrono::floor<std::chrono::days>(time.time_since_epoch()).count();
+}
+
+void WaterUsageLedger::write_record(const std::uint64_t recordIndex, const day_type day,
+                                    const WaterUsage& dayUsage,
+                                    const WaterUsage& totalUsage) const {
+    record_bytes recordBytes{};
+    StoreField(recordBytes, DAY_OFFSET, day);
+    StoreUsage(recordBytes, DAY_USAGE_OFFSET, dayUsage);
+    StoreUsage(recordBytes, TOTAL_USAGE_OFFSET, totalUsage);
+
+    WriteAll(m_fileDescriptor, recordBytes.data(), recordBytes.size(),
+             GetRecordOffset(recordIndex), LEDGER_WRITE_ERROR);
+}
+
+} // namespace rpi_gc::automatic_watering
@@ -0,0 +1,95 @@
+// Copyright (c) 2023 Andrea Ballestrazzi
+#pragma once
+
+// C++ STL
+#include <chrono>
+#include <cstdint>
+#include <filesystem>
+#include <mutex>
+
+namespace rpi_gc::automatic_watering {
+
+//!!
+//! \brief The water delivered by a flow over a period, e.g. a cycle or a day.
+//!
+struct WaterUsage {
+    std::chrono::milliseconds valveOpenTime{};
+    std::chrono::milliseconds pumpOnTime{};
+    double litres{};
+    std::uint64_t actuations{};
+
+    WaterUsage& operator+=(const WaterUsage& other) noexcept {
+        valveOpenTime += other.valveOpenTime;
+        pumpOnTime += other.pumpOnTime;
+        litres += other.litres;
+        actuations += other.actuations;
+        return *this;
+    }
+};
+
+//!!
+//! \brief Accumulates the water usage of a flow in per-day buckets persisted to a file, so
+//!  that the counters survive the restarts of the application.
+//!
+//!  The file is a header followed by a fixed size record for every day with actuations,
+//!  in chronological order. Every record stores the usage of its day and the running total,
+//!  so only the last record is read when the file is opened and every actuation rewrites
+//!  or appends a single record. The days are counted in UTC.
+//!
+//! \note The ledger can be used from multiple threads.
+//!
+class WaterUsageLedger final {
+public:
+    using clock_type = std::chrono::system_clock;
+    //! The days since the epoch.
+    using day_type = std::int64_t;
+
+    //!!
+    //! \brief Opens the ledger file, creating it if it doesn't exist.
+    //!
+    //! \param[in] filePath The path of the ledger file. The parent folder must exist.
+    //! \throw std::system_error if the file can't be opened or read.
+    //! \throw std::runtime_error if the file isn't a ledger file.
+    //!
+    explicit WaterUsageLedger(const std::filesystem::path& filePath);
+    ~WaterUsageLedger() noexcept;
+
+    WaterUsageLedger(const WaterUsageLedger&) = delete;
+    WaterUsageLedger& operator=(const WaterUsageLedger&) = delete;
+
+    //!!
+    //! \brief Adds the usage of an actuation to the bucket of the day it ended in. The
+    //!  actuations must be recorded in chronological order: the ones that end before the last
+    //!  bucket are added to it.
+    //!
+    //! \param[in] actuationEnd The time the devices have been turned off.
+    //! \param[in] usage The water delivered by the actuation.
+    //! \throw std::system_error if the bucket can't be written.
+    //!
+    void recordActuation(clock_type::time_point actuationEnd, const WaterUsage& usage);
+
+    //! \return The usage of the day of the given time, empty if nothing has been recorded.
+    [[nodiscard]] WaterUsage getDayUsage(clock_type::time_point time) const;
+
+    //! \return The usage since the ledger file has been created.
+    [[nodiscard]] WaterUsage getTotalUsage() const;
+
+    //! \return The usage of the last recorded actuation, empty after a restart.
+    [[nodiscard]] WaterUsage getLastActuationUsage() const;
+
+    [[nodiscard]] static day_type GetDay(clock_type::time_point time) noexcept;
+
+private:
+    int m_fileDescriptor{-1};
+    std::uint64_t m_recordsCount{};
+    mutable std::mutex m_mutex{};
+    day_type m_lastDay{};
+    WaterUsage m_lastDayUsage{};
+    WaterUsage m_totalUsage{};
+    WaterUsage m_lastActuationUsage{};
+
+    void write_record(std::uint64_t recordIndex, day_type day, const WaterUsage& dayUsage,
+                      const WaterUsage& totalUsage) const;
+};
+
+} // namespace rpi_gc::automatic_watering
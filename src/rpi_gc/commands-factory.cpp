@@ -33,7 +33,8 @@ ProjectCommandFactory::ProjectCommandFactory(
       m_projectController{projectController} {}
 
 auto ProjectCommandFactory::create() -> std::unique_ptr<command_type> {
-    return std::make_unique<command_type>(create_option_parser(), create_event_handler_map());
+    return std::make_unique<command_type>(create_option_parser(), create_event_handler_map(),
+                                          m_outputStream);
 }
 
 auto ProjectCommandFactory::create_option_parser() const -> command_type::option_parser_pointer {
@@ -66,111 +67,126 @@ auto ProjectCommandFactory::create_option_parser() const -> command_type::option
     return optionParser;
 }
 
-auto ProjectCommandFactory::create_event_handler_map() -> command_type::event_handler_map {
+auto ProjectCommandFactory::create_event_handler_map() const -> command_type::event_handler_map {
     command_type::event_handler_map eventHandlerMap{};
 
+    // The handlers don't refer to the factory, so a factory can be dropped once the command is
+    // created, e.g. the ones of the remote clients.
+    const auto saveCurrentProject{[projectController = m_projectController,
+                                   userLogger = m_userLogger,
+                                   mainLogger = m_mainLogger](const std::string& customMessage) {
+        utils::SaveProjectAndUpdateConfigFile(projectController.get(), userLogger, mainLogger,
+                                              customMessage);
+    }};
+
     eventHandlerMap.emplace(
         std::string{details::PROJECT_CMD_CREATE_OPTION_LONG_NAME},
-        [this](const command_type::option_parser::const_option_pointer& ptr) {
+        [projectController = m_projectController, userLogger = m_userLogger,
+         mainLogger = m_mainLogger,
+         saveCurrentProject](const command_type::option_parser::const_option_pointer& ptr) {
             const auto& valueOption{dynamic_cast<const gh_cmd::Value<char, std::string>&>(*ptr)};
 
             // If there is an open project we need to save it before proceeding.
-            if (m_projectController.get().hasProject())
-                save_current_project("Saving old project before switching to new project.");
+            if (projectController.get().hasProject())
+                saveCurrentProject("Saving old project before switching to new project.");
 
-            m_projectController.get().setCurrentProject(gc::project_management::Project{
+            projectController.get().setCurrentProject(gc::project_management::Project{
                 std::chrono::system_clock::now(), valueOption.value(),
                 version::getApplicationVersion()});
 
-            m_userLogger->logInfo("Switched to new project " + valueOption.value());
-            m_mainLogger->logInfo("Switched to new project " + valueOption.value());
+            userLogger->logInfo("Switched to new project " + valueOption.value());
+            mainLogger->logInfo("Switched to new project " + valueOption.value());
+            return true;
         });
 
     eventHandlerMap.emplace(
-        "save", [this](const command_type::option_parser::const_option_pointer& ptr) {
+        "save", [projectController = m_projectController, userLogger = m_userLogger,
+                 saveCurrentProject](const command_type::option_parser::const_option_pointer& ptr) {
             // If there isn't any valid project loaded, there is no need
             // to save it to file.
-            if (!m_projectController.get().hasProject()) {
-                m_userLogger->logWarning("No project is loaded. Nothing will be saved.");
-                return;
+            if (!projectController.get().hasProject()) {
+                userLogger->logWarning("No project is loaded. Nothing will be saved.");
+                return true;
             }
 
-            save_current_project();
+            saveCurrentProject({});
+            return true;
         });
 
     eventHandlerMap.emplace(
-        "save-to", [this](const command_type::option_parser::const_option_pointer& ptr) {
+        "save-to",
+        [projectController = m_projectController, userLogger = m_userLogger,
+         saveCurrentProject](const command_type::option_parser::const_option_pointer& ptr) {
             // If there isn't any valid project loaded, there is no need
             // to save it to file.
-            if (!m_projectController.get().hasProject()) {
-                m_userLogger->logWarning("No project is loaded. Nothing will be saved.");
-                return;
+            if (!projectController.get().hasProject()) {
+                userLogger->logWarning("No project is loaded. Nothing will be saved.");
+                return true;
             }
 
             const auto& valueOption(dynamic_cast<const gh_cmd::Value<char, std::string>&>(*ptr));
             const std::filesystem::path outputFilePath{valueOption.value()};
 
-            m_projectController.get().setCurrentProjectFilePath(outputFilePath);
-            save_current_project();
+            projectController.get().setCurrentProjectFilePath(outputFilePath);
+            saveCurrentProject({});
+            return true;
         });
 
     eventHandlerMap.emplace(
-        "load", [this](const command_type::option_parser::const_option_pointer& ptr) {
+        "load", [projectController = m_projectController, userLogger = m_userLogger,
+                 mainLogger = m_mainLogger,
+                 saveCurrentProject](const command_type::option_parser::const_option_pointer& ptr) {
             const auto& valueOption(dynamic_cast<const gh_cmd::Value<char, std::string>&>(*ptr));
 
             // If there is an open project we need to save it before proceeding.
-            if (m_projectController.get().hasProject()) {
-                save_current_project("Saving old project before switching to new project.");
+            if (projectController.get().hasProject()) {
+                saveCurrentProject("Saving old project before switching to new project.");
             }
 
             try {
                 std::optional inputProjectOpt{
-                    LoadProjectAndCheckIntegrity(valueOption.value(), *m_userLogger)};
+                    LoadProjectAndCheckIntegrity(valueOption.value(), *userLogger)};
 
                 auto& inputProject = inputProjectOpt.value();
 
                 // Now we can set the new project in the project controller.
-                m_projectController.get().setCurrentProject(std::move(inputProject));
-                m_projectController.get().setCurrentProjectFilePath(valueOption.value());
+                projectController.get().setCurrentProject(std::move(inputProject));
+                projectController.get().setCurrentProjectFilePath(valueOption.value());
 
                 // Now we make all components load the configuration from the project.
-                m_projectController.get().loadProjectData();
+                projectController.get().loadProjectData();
 
-                m_userLogger->logInfo("Switched to new project " + valueOption.value());
-                m_mainLogger->logInfo("Switched to new project " + valueOption.value());
+                userLogger->logInfo("Switched to new project " + valueOption.value());
+                mainLogger->logInfo("Switched to new project " + valueOption.value());
+                return true;
             } catch (const std::invalid_argument& exc) {
                 const std::string errorString{
                     std::string{"Invalid argument. Cannot load the requested project. Message: "} +
                     exc.what()};
 
-                m_userLogger->logError(errorString);
-                m_mainLogger->logError(errorString);
-                return;
+                userLogger->logError(errorString);
+                mainLogger->logError(errorString);
+                return false;
             } catch (const std::exception& exc) {
                 const std::string errorString{
                     std::string{"Generic error. Cannot load the requested project. Message: "} +
                     exc.what()};
 
-                m_userLogger->logError(errorString);
-                m_mainLogger->logError(errorString);
-                return;
+                userLogger->logError(errorString);
+                mainLogger->logError(errorString);
+                return false;
             } catch (...) {
                 const std::string errorString{"Unknown error. Cannot load the requested project."};
 
-                m_userLogger->logError(errorString);
-                m_mainLogger->logError(errorString);
-                return;
+                userLogger->logError(errorString);
+                mainLogger->logError(errorString);
+                return false;
             }
         });
 
     return eventHandlerMap;
 }
 
-void ProjectCommandFactory::save_current_project(const std::string& customMessage) {
-    utils::SaveProjectAndUpdateConfigFile(m_projectController.get(), m_userLogger, m_mainLogger,
-                                          customMessage);
-}
-
 namespace utils {
 
 void SaveProjectAndUpdateConfigFile(gc_project::ProjectController& projectController,
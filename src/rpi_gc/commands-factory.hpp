@@ -37,7 +37,7 @@ struct CommandFactory {
 
 //!!
 //! \brief Factory of the ProjectCommand. Configures the options and the event handlers
-//!  for this command.
+//!  for this command. The created commands don't refer to the factory.
 class ProjectCommandFactory final : public CommandFactory<commands::ProjectCommand> {
 public:
     explicit ProjectCommandFactory(std::ostream& ost, std::istream& ist,
@@ -66,9 +66,7 @@ private:
 
     [[nodiscard]] command_type::option_parser_pointer create_option_parser() const;
 
-    void save_current_project(const std::string& customMessage = {});
-
-    [[nodiscard]] command_type::event_handler_map create_event_handler_map();
+    [[nodiscard]] command_type::event_handler_map create_event_handler_map() const;
 };
 
 namespace utils {
@@ -5,8 +5,6 @@
 #include <cassert>
 #include <version>
 
-#include <iostream> // TODO: This is terrible. Need to be refactored once the commands are refactored.
-
 #ifdef __cpp_lib_format
 #include <format>
 #else
@@ -17,10 +15,11 @@ namespace rpi_gc::commands {
 
 AbortCommand::AbortCommand(logger_pointer mainLogger,
                            std::vector<emergency_stoppable_system_pointer> systems,
-                           option_parser_pointer optionParser) noexcept
+                           option_parser_pointer optionParser, std::ostream& outputStream) noexcept
     : m_mainLogger{std::move(mainLogger)},
       m_stoppableSystems{std::move(systems)},
-      m_optionParser{std::move(optionParser)} {
+      m_optionParser{std::move(optionParser)},
+      m_outputStream{outputStream} {
     assert(static_cast<bool>(m_mainLogger));
     assert(static_cast<bool>(m_optionParser));
 }
@@ -40,7 +39,7 @@ bool AbortCommand::execute() noexcept {
                                });
 
     if (helpIt != options.end() && (*helpIt)->isSet()) {
-        printHelp(std::cout);
+        printHelp(m_outputStream);
         for (auto& option : options)
             option->clear();
 
@@ -11,7 +11,9 @@
 #include <user-interface/commands-strings.hpp>
 
 // C++ STL
+#include <functional>
 #include <memory>
+#include <ostream>
 #include <vector>
 
 namespace rpi_gc::commands {
@@ -32,10 +34,11 @@ public:
     //!!
     //! \brief Construct a new Abort Command object taking the specified main logger and the
     //! abortable
-    //!  systems that will be aborted during the "execute()" command.
+    //!  systems that will be aborted during the "execute()" command. The help page is printed
+    //!  to the given output stream.
     explicit AbortCommand(logger_pointer mainLogger,
                           std::vector<emergency_stoppable_system_pointer> systems,
-                          option_parser_pointer optionParser) noexcept;
+                          option_parser_pointer optionParser, std::ostream& outputStream) noexcept;
 
     [[nodiscard]] constexpr name_type getName() const noexcept override {
         return strings::commands::ABORT;
@@ -56,6 +59,7 @@ private:
     option_parser_pointer m_optionParser{};
 
     std::vector<emergency_stoppable_system_pointer> m_stoppableSystems{};
+    std::reference_wrapper<std::ostream> m_outputStream;
 
     [[nodiscard]] StringType static format_log_message(StringViewType message) noexcept;
 };
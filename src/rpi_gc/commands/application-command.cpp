@@ -4,6 +4,7 @@
 // C++ STL
 #include <algorithm> // for std::find_if
 #include <cassert>
+#include <utility>
 
 namespace rpi_gc {
 
@@ -22,7 +23,7 @@ bool ApplicationCommand::execute() noexcept {
     using OptionPointer = std::shared_ptr<const option_type>;
 
     // For each option we check if a bivalent command is set as an option.
-    // For now we only have bivalent commands
+    // The application options are read by the application itself, so they are skipped.
     bool bCanContinue{true};
     const auto commandOptions{m_optionParser.get().getOptions()};
 
@@ -47,6 +48,9 @@ bool ApplicationCommand::execute() noexcept {
         assert(option != nullptr);
 
         const auto longName = option->getLongName();
+        if (m_applicationOptions.contains(longName))
+            continue;
+
         assert(m_bivalentCommands.contains(longName));
 
         if (option->isSet()) {
@@ -71,4 +75,13 @@ void ApplicationCommand::addBivalentCommand(bivalent_command_ref bivalentCommand
     m_bivalentCommands.emplace(asOption->getLongName(), bivalentCommand);
 }
 
+void ApplicationCommand::addApplicationOption(std::shared_ptr<option_type> option) noexcept {
+    assert(option != nullptr);
+    assert(!m_bivalentCommands.contains(option->getLongName()));
+    assert(!m_applicationOptions.contains(option->getLongName()));
+
+    m_applicationOptions.insert(option->getLongName());
+    m_optionParser.get().addOption(std::move(option));
+}
+
 } // namespace rpi_gc
@@ -10,6 +10,7 @@
 #include <functional>
 #include <map>
 #include <memory>
+#include <set>
 
 namespace rpi_gc {
 
@@ -32,6 +33,12 @@ public:
 
     void addBivalentCommand(bivalent_command_ref bivalentCommand) noexcept;
 
+    //!!
+    //! \brief Adds an option that is read by the application itself after the parsing, e.g.
+    //!  the script to run, instead of being executed by a bivalent command.
+    //!
+    void addApplicationOption(std::shared_ptr<option_type> option) noexcept;
+
     void printHelp(help_ostream_type outputStream) const noexcept override {}
 
 private:
@@ -39,6 +46,7 @@ private:
     option_parser_ref m_optionParser;
 
     std::map<option_type::long_name_type, bivalent_command_ref> m_bivalentCommands{};
+    std::set<option_type::long_name_type> m_applicationOptions{};
 };
 
 } // namespace rpi_gc
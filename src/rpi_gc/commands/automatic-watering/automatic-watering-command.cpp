@@ -9,9 +9,13 @@ namespace rpi_gc {
 
 namespace details {
 
-static void TriggerOptionEventIfBound(auto&& optionMap, auto&& option) noexcept {
+//!!
+//! \brief Triggers the events bound to the given option.
+//!
+//! \return False if one of the events failed, true otherwise.
+static bool TriggerOptionEventIfBound(auto&& optionMap, auto&& option) noexcept {
     if (!optionMap.contains(option->getLongName()))
-        return;
+        return true;
 
     // We retrieve all the events in the map.
     auto iteratorPair = optionMap.equal_range(option->getLongName());
@@ -21,8 +25,11 @@ static void TriggerOptionEventIfBound(auto&& optionMap, auto&& option) noexcept
         assert(static_cast<bool>(event));
 
         // We trigger the event.
-        event(option);
+        if (!event(option))
+            return false;
     }
+
+    return true;
 }
 
 } // namespace details
@@ -79,23 +86,28 @@ bool AutomaticWateringCommand::execute() noexcept {
                                      });
 
     if (stopOptionIt != options.end() && (*stopOptionIt)->isSet()) {
-        details::TriggerOptionEventIfBound(m_optionsEvents, *stopOptionIt);
+        const bool bStopped{details::TriggerOptionEventIfBound(m_optionsEvents, *stopOptionIt)};
         gh_cmd::utility::ClearAllOptions(options);
-        return true;
+        return bStopped;
     }
 
+    bool bSucceeded{true};
     for (auto& option : options) {
         assert(option != nullptr);
 
-        if (option->isSet())
-            details::TriggerOptionEventIfBound(m_optionsEvents, option);
+        // The options after a failed one aren't handled, e.g. the system isn't started
+        // with a configuration that wasn't applied.
+        if (option->isSet() && !details::TriggerOptionEventIfBound(m_optionsEvents, option)) {
+            bSucceeded = false;
+            break;
+        }
     }
 
     // We need to reset the state of the option otherwise the next time the
     // user types it, it will execute all of the previous options.
     gh_cmd::utility::ClearAllOptions(options);
 
-    return true;
+    return bSucceeded;
 }
 
 void AutomaticWateringCommand::printHelp(help_ostream_type outputStream) const noexcept {
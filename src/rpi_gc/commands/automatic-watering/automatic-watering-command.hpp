@@ -20,7 +20,7 @@ public:
     using option_parser = gh_cmd::OptionParser<char_type>;
     using option_parser_pointer = std::unique_ptr<option_parser>;
     using ostream_ref = std::reference_wrapper<std::basic_ostream<char_type>>;
-    using option_event = std::function<void(const option_parser::const_option_pointer&)>;
+    using option_event = std::function<bool(const option_parser::const_option_pointer&)>;
     using option_type = gh_cmd::CommandOption<char_type>;
 
     //!!
@@ -41,7 +41,8 @@ public:
 
     //!!
     //! \brief Registers a callback that will be executed when an option with the same name
-    //!  as "optionName" is set during the command execution.
+    //!  as "optionName" is set during the command execution. The callback returns false if it
+    //!  fails, and then the command execution fails.
     //! \note The callback must be valid.
     void registerOptionEvent(option_type::long_name_type optionName, option_event event) noexcept;
 
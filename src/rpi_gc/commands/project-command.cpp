@@ -4,14 +4,15 @@
 // C++ STL
 #include <algorithm>
 #include <cassert>
-#include <iostream> // TODO: Remove this
 
 namespace rpi_gc::commands {
 
 ProjectCommand::ProjectCommand(option_parser_pointer optionParser,
-                               event_handler_map eventHandlerMap) noexcept
+                               event_handler_map eventHandlerMap,
+                               std::ostream& outputStream) noexcept
     : m_optionParser{std::move(optionParser)},
-      m_eventHandlerMap{std::move(eventHandlerMap)} {
+      m_eventHandlerMap{std::move(eventHandlerMap)},
+      m_outputStream{outputStream} {
     assert(static_cast<bool>(m_optionParser));
 }
 
@@ -29,16 +30,22 @@ bool ProjectCommand::execute() noexcept {
 
     if (optionIt != std::end(options)) {
         // The help option is typed, let's display it.
-        printHelp(std::cout);
+        printHelp(m_outputStream);
         gh_cmd::utility::ClearAllOptions(options);
         return true;
     }
 
     bool bIsSomeSet{};
+    bool bSucceeded{true};
     for (auto& option : options) {
         if (option->isSet() && m_eventHandlerMap.contains(option->getLongName())) {
-            m_eventHandlerMap[option->getLongName()](option);
             bIsSomeSet = true;
+
+            // The options after a failed one aren't handled, as they may depend on it.
+            if (!m_eventHandlerMap[option->getLongName()](option)) {
+                bSucceeded = false;
+                break;
+            }
         }
     }
 
@@ -46,13 +53,12 @@ bool ProjectCommand::execute() noexcept {
         // This means that no option is given, the user typed only the command
         // without option.
         // In this case we want to display the help page.
-        // TODO: THIS IS HARD-CODED DEPENDENCY, REMOVE THIS.
-        printHelp(std::cout);
+        printHelp(m_outputStream);
     }
 
     gh_cmd::utility::ClearAllOptions(options);
 
-    return true;
+    return bSucceeded;
 }
 
 bool ProjectCommand::processInputOptions(const std::vector<string_type>& inputTokens) {
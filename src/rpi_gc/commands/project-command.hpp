@@ -6,8 +6,10 @@
 #include <user-interface/commands-strings.hpp>
 
 // C++ STL
+#include <functional>
 #include <map>
 #include <memory>
+#include <ostream>
 #include <vector>
 
 namespace rpi_gc::commands {
@@ -19,11 +21,20 @@ class ProjectCommand final : public TerminalCommandType {
 public:
     using option_parser = gh_cmd::OptionParser<CharType>;
     using option_parser_pointer = std::unique_ptr<option_parser>;
+    //!!
+    //! \brief The handlers of the options. A handler returns false if it fails to handle its
+    //!  option, so that the command execution fails.
     using event_handler_map =
-        std::map<string_type, std::function<void(const option_parser::const_option_pointer&)>>;
+        std::map<string_type, std::function<bool(const option_parser::const_option_pointer&)>>;
 
-    explicit ProjectCommand(option_parser_pointer optionParser,
-                            event_handler_map eventHandlerMap) noexcept;
+    //!!
+    //! \brief Construct a new project command.
+    //!
+    //! \param optionParser The parser of the command options.
+    //! \param eventHandlerMap The handlers of the options, by long name.
+    //! \param outputStream The stream where the help page is printed.
+    explicit ProjectCommand(option_parser_pointer optionParser, event_handler_map eventHandlerMap,
+                            std::ostream& outputStream) noexcept;
 
     //!!
     //! \brief Retrieves the name of this command: project.
@@ -41,6 +52,7 @@ public:
 private:
     option_parser_pointer m_optionParser{};
     event_handler_map m_eventHandlerMap{};
+    std::reference_wrapper<std::ostream> m_outputStream;
 };
 
 } // namespace rpi_gc::commands
@@ -1,8 +1,17 @@
 // Copyright (c) 2023 Andrea Ballestrazzi
 #include <commands/status-command.hpp>
 
+#include <diagnostics/diagnostic-snapshot.hpp>
+
 // C++ STL
+#include <algorithm>
 #include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <string>
+#include <string_view>
+#include <utility>
 
 namespace rpi_gc::commands {
 
@@ -17,32 +26,104 @@ StatusCommand::StatusCommand(option_parser_ptr optionParser,
 
 bool StatusCommand::execute() noexcept {
     const auto options{m_optionParser->getOptions()};
+    const auto findOption{
+        [&options](std::string_view longName) -> option_parser::option_pointer {
+            auto optionIt = std::find_if(options.begin(), options.end(),
+                                         [longName](const option_parser::option_pointer& option) {
+                                             return option->getLongName() == longName;
+                                         });
 
-    // If the --help option is selected we need to print the help.
-    auto helpIt = std::find_if(options.begin(), options.end(),
-                               [](const option_parser::option_pointer& option) -> bool {
-                                   return option->getLongName() == "help";
-                               });
+            return optionIt != options.end() ? *optionIt : nullptr;
+        }};
+    const auto isOptionSet{[&findOption](std::string_view longName) -> bool {
+        const option_parser::option_pointer option{findOption(longName)};
+        return option != nullptr && option->isSet();
+    }};
 
-    if (helpIt != options.end() && (*helpIt)->isSet()) {
-        printHelp(m_outputStream);
-        for (auto& option : options)
-            option->clear();
+    const bool bHelpRequested{isOptionSet("help")};
+    const bool bJsonRequested{isOptionSet("json")};
+    const bool bWatchRequested{isOptionSet("watch")};
+    const bool bUnwatchRequested{isOptionSet("unwatch")};
 
+    // The refresh rate must be read before the options are cleared.
+    diagnostics::DiagnosticWatcher::refresh_period refreshPeriod{DEFAULT_REFRESH_PERIOD};
+    if (const auto refreshRateOption{std::dynamic_pointer_cast<refresh_rate_option_type>(
+            findOption("refresh-rate"))};
+        refreshRateOption != nullptr && refreshRateOption->isSet()) {
+        refreshPeriod = diagnostics::DiagnosticWatcher::refresh_period{
+            std::max<std::uint64_t>(refreshRateOption->value(), 1)};
+    }
+
+    for (auto& option : options)
+        option->clear();
+
+    // If the --help option is selected we need to print the help.
+    if (bHelpRequested) {
+        printHelp(m_outputStream);
         return true;
     }
 
-    if (m_diagnosticsObjects.empty()) {
-        m_outputStream.get() << "No relevant diagnostic found." << std::endl;
+    if (bUnwatchRequested) {
+        const bool bWasWatching{m_watcher != nullptr};
+        m_watcher.reset();
+
+        m_outputStream.get() << (bWasWatching ? "Status watch stopped." : "No status watch active.")
+                             << std::endl;
         return true;
     }
 
-    // Otherwise we can print all the diagnostics.
-    for (const auto& diagnosticObj : m_diagnosticsObjects) {
-        m_outputStream.get() << "<Diagnostic section start>" << std::endl;
-        diagnosticObj.get().printDiagnostic(m_outputStream.get());
-        m_outputStream.get() << std::endl;
-        m_outputStream.get() << "<section end>" << std::endl;
+    if (bWatchRequested)
+        return start_watch(refreshPeriod);
+
+    // The whole output is built first and then written with a single flush.
+    std::string output{};
+    try {
+        if (bJsonRequested) {
+            output.append("{\"systems\":[");
+            for (std::size_t i{}; i < m_diagnosticsObjects.size(); ++i) {
+                if (i > 0)
+                    output.push_back(',');
+
+                diagnostics::AppendDiagnosticJson(
+                    output, m_diagnosticsObjects[i].get().captureDiagnostic());
+            }
+            output.append("]}\n");
+        } else if (m_diagnosticsObjects.empty()) {
+            output.append("No relevant diagnostic found.\n");
+        } else {
+            for (const auto& diagnosticObj : m_diagnosticsObjects) {
+                output.append("<Diagnostic section start>\n");
+                diagnostics::AppendDiagnosticText(output,
+                                                  diagnosticObj.get().captureDiagnostic());
+                output.append("\n<section end>\n");
+            }
+        }
+    } catch (const std::exception& exc) {
+        m_outputStream.get() << "[ERROR] => Unable to capture the diagnostics: " << exc.what()
+                             << std::endl;
+        return false;
+    }
+
+    m_outputStream.get() << output << std::flush;
+    return true;
+}
+
+bool StatusCommand::start_watch(
+    const diagnostics::DiagnosticWatcher::refresh_period refreshPeriod) noexcept {
+    // Only one watch is active at a time: the previous one is replaced.
+    m_watcher.reset();
+
+    m_outputStream.get() << "Watching the status every " << refreshPeriod.count()
+                         << "ms. Run \"" << strings::commands::STATUS
+                         << " --unwatch\" to stop." << std::endl;
+
+    try {
+        m_watcher = std::make_unique<diagnostics::DiagnosticWatcher>(
+            m_diagnosticsObjects, m_outputStream.get(), refreshPeriod);
+    } catch (const std::exception& exc) {
+        m_outputStream.get() << "[ERROR] => Unable to watch the status: " << exc.what()
+                             << std::endl;
+        return false;
     }
 
     return true;
@@ -72,6 +153,13 @@ void StatusCommand::printHelp(help_ostream_type outputStream) const noexcept {
     outputStream.get()
         << "\tand it displays them in a structured way, every system separated by a section."
         << std::endl;
+    outputStream.get()
+        << "\tWith the --json option the same status is printed as a single line of JSON."
+        << std::endl;
+    outputStream.get()
+        << "\tWith the --watch option the status is printed again, limited to the changed fields,"
+        << std::endl;
+    outputStream.get() << "\tevery time a system changes, until --unwatch is given." << std::endl;
     outputStream.get() << std::endl;
 
     m_optionParser->printHelp(outputStream);
@@ -6,10 +6,14 @@
 
 #include <common/types.hpp> // For CharType
 #include <diagnostics/diagnostic-status-probeable.hpp>
+#include <diagnostics/diagnostic-watcher.hpp>
 #include <gh_cmd/gh_cmd.hpp>
 
 // C++ STL
+#include <chrono>
+#include <cstdint>
 #include <functional>
+#include <memory>
 #include <vector>
 
 namespace rpi_gc::commands {
@@ -20,6 +24,11 @@ public:
         std::reference_wrapper<const diagnostics::DiagnosticStatusProbeable>;
     using option_parser = gh_cmd::OptionParser<CharType>;
     using option_parser_ptr = std::unique_ptr<option_parser>;
+    using refresh_rate_option_type = gh_cmd::Value<CharType, std::uint64_t>;
+
+    //! The refresh period of the watch mode when no "refresh-rate" option is given.
+    static constexpr diagnostics::DiagnosticWatcher::refresh_period DEFAULT_REFRESH_PERIOD{
+        std::chrono::milliseconds{500}};
 
     explicit StatusCommand(option_parser_ptr optionParser,
                            std::vector<diagnostic_probeable_ref> objs,
@@ -41,6 +50,14 @@ private:
     option_parser_ptr m_optionParser{};
     std::vector<diagnostic_probeable_ref> m_diagnosticsObjects{};
     std::reference_wrapper<std::ostream> m_outputStream;
+    std::unique_ptr<diagnostics::DiagnosticWatcher> m_watcher{};
+
+    //!!
+    //! \brief Starts watching the diagnostic objects, replacing the active watch if any.
+    //!
+    //! \return True if the watch has been started, false otherwise.
+    //!
+    bool start_watch(diagnostics::DiagnosticWatcher::refresh_period refreshPeriod) noexcept;
 };
 
 } // namespace rpi_gc::commands
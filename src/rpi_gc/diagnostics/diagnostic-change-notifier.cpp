@@ -0,0 +1,33 @@
+// Copyright (c) 2023 Andrea Ballestrazzi
+#include <diagnostics/diagnostic-change-notifier.hpp>
+
+namespace rpi_gc::diagnostics {
+
+DiagnosticChangeNotifier::subscription_id DiagnosticChangeNotifier::subscribe(
+    listener_type listener) {
+    std::lock_guard listenersLock{m_listenersMutex};
+
+    const subscription_id subscriptionId{m_nextSubscriptionId++};
+    m_listeners.emplace_back(subscriptionId, std::move(listener));
+    m_subscribersCount.store(m_listeners.size());
+
+    return subscriptionId;
+}
+
+void DiagnosticChangeNotifier::unsubscribe(const subscription_id subscriptionId) noexcept {
+    std::lock_guard listenersLock{m_listenersMutex};
+
+    std::erase_if(m_listeners, [subscriptionId](const auto& listener) {
+        return listener.first == subscriptionId;
+    });
+    m_subscribersCount.store(m_listeners.size());
+}
+
+void DiagnosticChangeNotifier::notify_subscribers() const noexcept {
+    std::lock_guard listenersLock{m_listenersMutex};
+
+    for (const auto& [subscriptionId, listener] : m_listeners)
+        listener();
+}
+
+} // namespace rpi_gc::diagnostics
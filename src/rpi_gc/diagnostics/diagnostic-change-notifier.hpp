@@ -0,0 +1,60 @@
+// Copyright (c) 2023 Andrea Ballestrazzi
+#pragma once
+
+// C++ STL
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+namespace rpi_gc::diagnostics {
+
+//!!
+//! \brief Notifies the subscribers when the diagnostic status of an object changes, so
+//!  they can capture a new snapshot instead of polling the object.
+//!
+//!  While nobody is subscribed, notifyChanged() only loads an atomic counter.
+//!
+class DiagnosticChangeNotifier final {
+public:
+    using listener_type = std::function<void()>;
+    using subscription_id = std::uint64_t;
+
+    //!!
+    //! \brief Registers a listener invoked after every change. The listener is invoked on
+    //!  the thread that changed the status, so it must be short, must not throw and must
+    //!  not subscribe or unsubscribe from this notifier.
+    //!
+    //! \param[in] listener The listener to invoke.
+    //! \return The id used to unsubscribe the listener.
+    //!
+    subscription_id subscribe(listener_type listener);
+
+    //!!
+    //! \brief Removes a listener. After this call the listener won't be invoked anymore.
+    //!
+    void unsubscribe(subscription_id subscriptionId) noexcept;
+
+    //!!
+    //! \brief Notifies the subscribers that the status has changed. Thread-safe.
+    //!
+    inline void notifyChanged() const noexcept {
+        if (m_subscribersCount.load() == 0)
+            return;
+
+        notify_subscribers();
+    }
+
+private:
+    mutable std::mutex m_listenersMutex{};
+    std::vector<std::pair<subscription_id, listener_type>> m_listeners{};
+    std::atomic<std::size_t> m_subscribersCount{};
+    subscription_id m_nextSubscriptionId{};
+
+    void notify_subscribers() const noexcept;
+};
+
+} // namespace rpi_gc::diagnostics
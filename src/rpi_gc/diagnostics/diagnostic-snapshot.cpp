@@ -0,0 +1,220 @@
+// Copyright (c) 2023 Andrea Ballestrazzi
+#include <diagnostics/diagnostic-snapshot.hpp>
+
+// C++ STL
+#include <algorithm>
+#include <array>
+#include <charconv>
+#include <cmath>
+#include <type_traits>
+
+namespace rpi_gc::diagnostics {
+
+namespace {
+
+template <typename NumberType>
+void AppendNumber(std::string& output, const NumberType number) {
+    std::array<char, 32> buffer{};
+    const auto [end, errorCode]{
+        std::to_chars(buffer.data(), buffer.data() + buffer.size(), number)};
+    output.append(buffer.data(), errorCode == std::errc{} ? end : buffer.data());
+}
+
+void AppendTextValue(std::string& output, const diagnostic_value& value) {
+    std::visit(
+        [&output](const auto& alternative) {
+            using value_type = std::decay_t<decltype(alternative)>;
+
+            if constexpr (std::is_same_v<value_type, bool>) {
+                output.append(alternative ? "Enabled" : "Disabled");
+            } else if constexpr (std::is_same_v<value_type, std::string>) {
+                output.append(alternative);
+            } else {
+                AppendNumber(output, alternative);
+            }
+        },
+        value);
+}
+
+void AppendTextField(std::string& output, const DiagnosticField& field) {
+    output.append(" [").append(field.label).append("]:\t");
+    AppendTextValue(output, field.value);
+    output.append(field.unit).push_back('\n');
+}
+
+void AppendTextSectionField(std::string& output, const DiagnosticField& field) {
+    output.append("\t [").append(field.label).append("]: ");
+    AppendTextValue(output, field.value);
+    output.append(field.unit).push_back('\n');
+}
+
+template <typename ElementType>
+[[nodiscard]] const ElementType* FindByKey(const std::vector<ElementType>& elements,
+                                           std::string_view key) noexcept {
+    const auto elementIt{std::find_if(elements.begin(), elements.end(),
+                                      [key](const ElementType& element) {
+                                          return element.key == key;
+                                      })};
+
+    return elementIt != elements.end() ? &(*elementIt) : nullptr;
+}
+
+//!!
+//! \brief Collects the fields of the current list that differ from the previous one, followed
+//!  by the removed fields with a "n/a" value.
+//!
+[[nodiscard]] std::vector<DiagnosticField> CollectChangedFields(
+    const std::vector<DiagnosticField>& previousFields,
+    const std::vector<DiagnosticField>& currentFields) {
+    std::vector<DiagnosticField> changedFields{};
+
+    for (const DiagnosticField& field : currentFields) {
+        const DiagnosticField* const previousField{FindByKey(previousFields, field.key)};
+        if (previousField == nullptr || previousField->value != field.value)
+            changedFields.push_back(field);
+    }
+
+    for (const DiagnosticField& field : previousFields) {
+        if (FindByKey(currentFields, field.key) == nullptr)
+            changedFields.push_back(DiagnosticField{field.key, field.label, std::string{"n/a"}});
+    }
+
+    return changedFields;
+}
+
+void AppendJsonString(std::string& output, std::string_view str) {
+    constexpr std::string_view HEX_DIGITS{"0123456789abcdef"};
+
+    output.push_back('"');
+    for (const char c : str) {
+        switch (c) {
+            case '"':
+                output.append("\\\"");
+                break;
+            case '\\':
+                output.append("\\\\");
+                break;
+            case '\n':
+                output.append("\\n");
+                break;
+            case '\t':
+                output.append("\\t");
+                break;
+            default:
+                if (static_cast<unsigned char>(c) < 0x20) {
+                    output.append("\\u00");
+                    output.push_back(HEX_DIGITS[(c >> 4) & 0xF]);
+                    output.push_back(HEX_DIGITS[c & 0xF]);
+                } else {
+                    output.push_back(c);
+                }
+        }
+    }
+
+    output.push_back('"');
+}
+
+void AppendJsonValue(std::string& output, const diagnostic_value& value) {
+    std::visit(
+        [&output](const auto& alternative) {
+            using value_type = std::decay_t<decltype(alternative)>;
+
+            if constexpr (std::is_same_v<value_type, bool>) {
+                output.append(alternative ? "true" : "false");
+            } else if constexpr (std::is_same_v<value_type, std::string>) {
+                AppendJsonString(output, alternative);
+            } else if constexpr (std::is_same_v<value_type, double>) {
+                // JSON has no representation for infinities and NaNs.
+                if (std::isfinite(alternative)) {
+                    AppendNumber(output, alternative);
+                } else {
+                    output.append("null");
+                }
+            } else {
+                AppendNumber(output, alternative);
+            }
+        },
+        value);
+}
+
+void AppendJsonFields(std::string& output, const std::vector<DiagnosticField>& fields) {
+    for (const DiagnosticField& field : fields) {
+        output.push_back(',');
+        AppendJsonString(output, field.key);
+        output.push_back(':');
+        AppendJsonValue(output, field.value);
+    }
+}
+
+} // namespace
+
+void AppendDiagnosticText(std::string& output, const DiagnosticSnapshot& snapshot) {
+    output.append("\n [Diagnostic]:\t").append(snapshot.title).push_back('\n');
+
+    for (const DiagnosticField& field : snapshot.fields)
+        AppendTextField(output, field);
+
+    for (const DiagnosticSection& section : snapshot.sections) {
+        output.append(" {").append(section.title).append("}\n");
+
+        for (const DiagnosticField& field : section.fields)
+            AppendTextSectionField(output, field);
+    }
+}
+
+bool AppendDiagnosticTextChanges(std::string& output, const DiagnosticSnapshot& previous,
+                                 const DiagnosticSnapshot& current) {
+    const std::size_t initialSize{output.size()};
+    output.append("\n [Diagnostic]:\t").append(current.title).push_back('\n');
+    const std::size_t headerSize{output.size()};
+
+    for (const DiagnosticField& field : CollectChangedFields(previous.fields, current.fields))
+        AppendTextField(output, field);
+
+    static const std::vector<DiagnosticField> NO_FIELDS{};
+    for (const DiagnosticSection& section : current.sections) {
+        const DiagnosticSection* const previousSection{FindByKey(previous.sections, section.key)};
+        const std::vector<DiagnosticField> changedFields{CollectChangedFields(
+            previousSection != nullptr ? previousSection->fields : NO_FIELDS, section.fields)};
+
+        if (changedFields.empty())
+            continue;
+
+        output.append(" {").append(section.title).append("}\n");
+        for (const DiagnosticField& field : changedFields)
+            AppendTextSectionField(output, field);
+    }
+
+    // Only the header has been appended: nothing has changed.
+    if (output.size() == headerSize) {
+        output.resize(initialSize);
+        return false;
+    }
+
+    return true;
+}
+
+void AppendDiagnosticJson(std::string& output, const DiagnosticSnapshot& snapshot) {
+    output.append("{\"system\":");
+    AppendJsonString(output, snapshot.system);
+    AppendJsonFields(output, snapshot.fields);
+
+    for (const DiagnosticSection& section : snapshot.sections) {
+        output.push_back(',');
+        AppendJsonString(output, section.key);
+        output.append(":{");
+
+        // The section fields are appended with a leading comma, which is dropped here.
+        const std::size_t sectionStart{output.size()};
+        AppendJsonFields(output, section.fields);
+        if (output.size() > sectionStart) {
+            output.erase(sectionStart, 1);
+        }
+
+        output.push_back('}');
+    }
+
+    output.push_back('}');
+}
+
+} // namespace rpi_gc::diagnostics
@@ -0,0 +1,73 @@
+// Copyright (c) 2023 Andrea Ballestrazzi
+#pragma once
+
+// C++ STL
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <variant>
+#include <vector>
+
+namespace rpi_gc::diagnostics {
+
+using diagnostic_value = std::variant<bool, std::int64_t, std::uint64_t, double, std::string>;
+
+//!!
+//! \brief A value of a diagnostic. The key, the label and the unit must refer to string
+//!  literals, so that capturing a snapshot only copies the values.
+//!
+struct DiagnosticField {
+    //! The name of the field in the JSON output, e.g. "completedCycles".
+    std::string_view key{};
+    //! The name of the field in the text output, e.g. "Completed cycles".
+    std::string_view label{};
+    diagnostic_value value{};
+    //! The unit appended to the value, e.g. "ms". Empty if the value has no unit.
+    std::string_view unit{};
+};
+
+//!!
+//! \brief A group of related fields, e.g. the ones of a flow.
+//!
+struct DiagnosticSection {
+    std::string_view key{};
+    std::string_view title{};
+    std::vector<DiagnosticField> fields{};
+};
+
+//!!
+//! \brief The state of a system captured at once, so that it can be rendered in different
+//!  formats without reading the system again.
+//!
+struct DiagnosticSnapshot {
+    //! The kind of the system in the JSON output, e.g. "automatic-watering".
+    std::string_view system{};
+    //! The description of the system in the text output.
+    std::string_view title{};
+    std::vector<DiagnosticField> fields{};
+    std::vector<DiagnosticSection> sections{};
+};
+
+//!!
+//! \brief Appends the text rendering of a snapshot to a buffer, one field per line. The
+//!  boolean values are rendered as "Enabled" or "Disabled".
+//!
+void AppendDiagnosticText(std::string& output, const DiagnosticSnapshot& snapshot);
+
+//!!
+//! \brief Appends the text rendering of the fields that differ between two snapshots of the
+//!  same system, in the same layout of AppendDiagnosticText(). The fields are matched by key
+//!  and the removed ones are rendered as "n/a".
+//!
+//! \return True if at least one field has changed, false if nothing has been appended.
+//!
+bool AppendDiagnosticTextChanges(std::string& output, const DiagnosticSnapshot& previous,
+                                 const DiagnosticSnapshot& current);
+
+//!!
+//! \brief Appends the compact JSON rendering of a snapshot to a buffer: an object with the
+//!  "system" key, the fields as members and the sections as nested objects.
+//!
+void AppendDiagnosticJson(std::string& output, const DiagnosticSnapshot& snapshot);
+
+} // namespace rpi_gc::diagnostics
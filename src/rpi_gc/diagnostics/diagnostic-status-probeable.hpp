@@ -1,8 +1,13 @@
 // Copyright (c) 2023 Andrea Ballestrazzi
 #pragma once
 
+#include <diagnostics/diagnostic-change-notifier.hpp>
+#include <diagnostics/diagnostic-snapshot.hpp>
+
 // C++ STL
+#include <exception>
 #include <ostream>
+#include <string>
 
 namespace rpi_gc::diagnostics {
 
@@ -12,11 +17,33 @@ namespace rpi_gc::diagnostics {
 struct DiagnosticStatusProbeable {
     virtual ~DiagnosticStatusProbeable() noexcept = default;
 
+    //!!
+    //! \brief Captures the current status of the object. Every piece of state
+    //!  is read once, so the snapshot can be rendered in any format later.
+    //! \return The snapshot of the object status.
+    [[nodiscard]] virtual DiagnosticSnapshot captureDiagnostic() const = 0;
+
+    //!!
+    //! \brief Gets the notifier of the status changes, used to watch the object without
+    //!  polling it.
+    //! \return The change notifier, or nullptr if the object doesn't notify its changes.
+    [[nodiscard]] virtual DiagnosticChangeNotifier* getChangeNotifier() const noexcept {
+        return nullptr;
+    }
+
     //!!
     //! \brief Prints the diagnostics of the object status to the given
-    //!  output stream.
+    //!  output stream, in the human readable format.
     //! \param ost The stream that will receive the diagnostic messages.
-    virtual void printDiagnostic(std::ostream& ost) const noexcept = 0;
+    virtual void printDiagnostic(std::ostream& ost) const noexcept {
+        try {
+            std::string diagnosticText{};
+            AppendDiagnosticText(diagnosticText, captureDiagnostic());
+            ost << diagnosticText;
+        } catch (const std::exception& exc) {
+            ost << "[ERROR] => " << exc.what() << '\n';
+        }
+    }
 };
 
 } // namespace rpi_gc::diagnostics
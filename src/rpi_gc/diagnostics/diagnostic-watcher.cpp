@@ -0,0 +1,128 @@
+// Copyright (c) 2023 Andrea Ballestrazzi
+#include <diagnostics/diagnostic-watcher.hpp>
+
+// C++ STL
+#include <cassert>
+#include <exception>
+#include <string>
+
+namespace rpi_gc::diagnostics {
+
+DiagnosticWatcher::DiagnosticWatcher(std::vector<diagnostic_probeable_ref> objs,
+                                     std::ostream& outputStream,
+                                     const refresh_period refreshPeriod)
+    : m_diagnosticsObjects{std::move(objs)},
+      m_outputStream{std::ref(outputStream)},
+      m_refreshPeriod{refreshPeriod} {
+    assert(m_refreshPeriod.count() > 0);
+
+    const auto changeListener{[this]() {
+        {
+            std::lock_guard changeLock{m_changeMutex};
+            m_bChangeNotified = true;
+        }
+
+        m_changeListener.notify_one();
+    }};
+
+    m_subscriptions.reserve(m_diagnosticsObjects.size());
+    try {
+        for (const auto& diagnosticObj : m_diagnosticsObjects) {
+            DiagnosticChangeNotifier* const changeNotifier{
+                diagnosticObj.get().getChangeNotifier()};
+            if (changeNotifier == nullptr) {
+                m_bPeriodicCaptureNeeded = true;
+                continue;
+            }
+
+            m_subscriptions.emplace_back(changeNotifier,
+                                         changeNotifier->subscribe(changeListener));
+        }
+    } catch (...) {
+        unsubscribe_all();
+        throw;
+    }
+
+    // The subscriptions are made before the first capture, so no change can be lost
+    // between the two.
+    try {
+        m_watcherThread = std::jthread{[this](std::stop_token stopToken) {
+            run_watch_loop(std::move(stopToken));
+        }};
+    } catch (...) {
+        unsubscribe_all();
+        throw;
+    }
+}
+
+DiagnosticWatcher::~DiagnosticWatcher() noexcept {
+    if (m_watcherThread.joinable()) {
+        m_watcherThread.request_stop();
+        m_watcherThread.join();
+    }
+
+    unsubscribe_all();
+}
+
+void DiagnosticWatcher::run_watch_loop(std::stop_token stopToken) noexcept {
+    try {
+        std::vector<DiagnosticSnapshot> previousSnapshots{capture_all()};
+
+        std::string frame{};
+        for (const DiagnosticSnapshot& snapshot : previousSnapshots)
+            AppendDiagnosticText(frame, snapshot);
+
+        m_outputStream.get() << frame << std::flush;
+
+        auto lastFrameTime{clock_type::now()};
+        while (wait_for_changes(stopToken, lastFrameTime + m_refreshPeriod)) {
+            lastFrameTime = clock_type::now();
+            std::vector<DiagnosticSnapshot> currentSnapshots{capture_all()};
+
+            frame.clear();
+            for (std::size_t i{}; i < currentSnapshots.size(); ++i)
+                AppendDiagnosticTextChanges(frame, previousSnapshots[i], currentSnapshots[i]);
+
+            if (!frame.empty())
+                m_outputStream.get() << frame << std::flush;
+
+            previousSnapshots = std::move(currentSnapshots);
+        }
+    } catch (const std::exception& exc) {
+        m_outputStream.get() << "[ERROR] => The status watch has been interrupted: "
+                             << exc.what() << std::endl;
+    }
+}
+
+bool DiagnosticWatcher::wait_for_changes(std::stop_token stopToken,
+                                         const clock_type::time_point nextFrameTime) {
+    std::unique_lock changeLock{m_changeMutex};
+
+    if (!m_bPeriodicCaptureNeeded)
+        m_changeListener.wait(changeLock, stopToken, [this] { return m_bChangeNotified; });
+
+    // The changes notified before the next frame are coalesced into it.
+    m_changeListener.wait_until(changeLock, stopToken, nextFrameTime, [] { return false; });
+
+    m_bChangeNotified = false;
+    return !stopToken.stop_requested();
+}
+
+std::vector<DiagnosticSnapshot> DiagnosticWatcher::capture_all() const {
+    std::vector<DiagnosticSnapshot> snapshots{};
+    snapshots.reserve(m_diagnosticsObjects.size());
+
+    for (const auto& diagnosticObj : m_diagnosticsObjects)
+        snapshots.push_back(diagnosticObj.get().captureDiagnostic());
+
+    return snapshots;
+}
+
+void DiagnosticWatcher::unsubscribe_all() noexcept {
+    for (const auto& [changeNotifier, subscriptionId] : m_subscriptions)
+        changeNotifier->unsubscribe(subscriptionId);
+
+    m_subscriptions.clear();
+}
+
+} // namespace rpi_gc::diagnostics
@@ -0,0 +1,91 @@
+// Copyright (c) 2023 Andrea Ballestrazzi
+#pragma once
+
+#include <diagnostics/diagnostic-change-notifier.hpp>
+#include <diagnostics/diagnostic-snapshot.hpp>
+#include <diagnostics/diagnostic-status-probeable.hpp>
+
+// C++ STL
+#include <chrono>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <ostream>
+#include <stop_token>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace rpi_gc::diagnostics {
+
+//!!
+//! \brief Streams the status of a set of objects for as long as it's alive. The full status
+//!  is printed once, then a frame with only the changed fields is printed after the objects
+//!  notify a change, at most once per refresh period.
+//!
+//!  The watcher sleeps until a change is notified. The objects without a change notifier
+//!  are captured once per refresh period instead.
+//!
+class DiagnosticWatcher final {
+public:
+    using diagnostic_probeable_ref = std::reference_wrapper<const DiagnosticStatusProbeable>;
+    using refresh_period = std::chrono::milliseconds;
+    using clock_type = std::chrono::steady_clock;
+
+    //!!
+    //! \brief Subscribes to the objects and starts watching them on a new thread.
+    //!
+    //! \param[in] objs The objects to watch. They must outlive the watcher.
+    //! \param[in] outputStream The stream that receives the frames. It must outlive the
+    //!  watcher and it's written from the watcher thread, one frame at a time.
+    //! \param[in] refreshPeriod The minimum time between two frames.
+    //!
+    DiagnosticWatcher(std::vector<diagnostic_probeable_ref> objs, std::ostream& outputStream,
+                      refresh_period refreshPeriod);
+
+    //!!
+    //! \brief Stops the watcher thread and unsubscribes from the objects.
+    //!
+    ~DiagnosticWatcher() noexcept;
+
+    DiagnosticWatcher(const DiagnosticWatcher&) = delete;
+    DiagnosticWatcher& operator=(const DiagnosticWatcher&) = delete;
+
+    [[nodiscard]] refresh_period getRefreshPeriod() const noexcept {
+        return m_refreshPeriod;
+    }
+
+private:
+    using subscription =
+        std::pair<DiagnosticChangeNotifier*, DiagnosticChangeNotifier::subscription_id>;
+
+    std::vector<diagnostic_probeable_ref> m_diagnosticsObjects;
+    std::reference_wrapper<std::ostream> m_outputStream;
+    refresh_period m_refreshPeriod;
+    std::vector<subscription> m_subscriptions{};
+    //! True if some objects can't notify their changes and must be captured every period.
+    bool m_bPeriodicCaptureNeeded{};
+
+    std::mutex m_changeMutex{};
+    std::condition_variable_any m_changeListener{};
+    bool m_bChangeNotified{};
+
+    // Declared last, so it's stopped before the members it uses are destroyed.
+    std::jthread m_watcherThread{};
+
+    void run_watch_loop(std::stop_token stopToken) noexcept;
+
+    //!!
+    //! \brief Waits for a change notification, unless some objects must be captured
+    //!  periodically, and then for the time of the next frame.
+    //!
+    //! \return False if the stop has been requested.
+    //!
+    [[nodiscard]] bool wait_for_changes(std::stop_token stopToken,
+                                        clock_type::time_point nextFrameTime);
+
+    [[nodiscard]] std::vector<DiagnosticSnapshot> capture_all() const;
+    void unsubscribe_all() noexcept;
+};
+
+} // namespace rpi_gc::diagnostics
@@ -1,15 +1,22 @@
 // Copyright (C) 2023 Andrea Ballestrazzi
 #include <greenhouse-controller-application.hpp>
 
+#include <application/event-loop.hpp>
 #include <initial-project-loader.hpp>
+#include <remote/command-server.hpp>
+#include <remote/metrics-server.hpp>
+#include <watchdog/watchdog-supervisor.hpp>
 
 #include <automatic-watering/daily-cycle-automatic-watering-system.hpp>
 #include <automatic-watering/hardware-controllers/daily-cycle-aws-hardware-controller.hpp>
 #include <automatic-watering/time-providers/configurable-daily-cycle-aws-time-provider.hpp>
 #include <automatic-watering/time-providers/daily-cycle-aws-time-provider.hpp>
+#include <automatic-watering/water-usage/water-usage-ledger-folder.hpp>
 #include <gh_log/logger.hpp>
 #include <gh_log/spl-logger.hpp>
 
+#include <gh_hal/hardware-access/output-cutoff.hpp>
+
 #include <hardware-management/hardware-chip-initializer.hpp>
 
 #include <gc-project/project-controller.hpp>
@@ -26,18 +33,27 @@
 #include <common/types.hpp>
 #include <folder-provider/folder-provider.hpp>
 #include <gh_cmd/gh_cmd.hpp>
+#include <metrics/metrics-registry.hpp>
 
 #include <gsl/gsl>
 
 // C++ STL
 #include <algorithm>
 #include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
 #include <filesystem>
+#include <fstream>
 #include <iostream>
 #include <limits>
 #include <memory>
 #include <mutex>
 
+// POSIX
+#include <csignal>
+#include <unistd.h>
+
 namespace automatic_watering {
 
 std::shared_ptr<rpi_gc::automatic_watering::ConfigurableDailyCycleAWSTimeProvider>
@@ -65,7 +81,7 @@ namespace commands_factory {
 
 template <typename WateringSystemPointer, typename OptionParserType>
 [[nodiscard]] static std::unique_ptr<rpi_gc::AutomaticWateringCommand>
-CreateAutomaticWateringCommand(WateringSystemPointer wateringSystem) {
+CreateAutomaticWateringCommand(WateringSystemPointer wateringSystem, std::ostream& outputStream) {
     using rpi_gc::AutomaticWateringCommand;
     using rpi_gc::CharType;
 
@@ -130,6 +146,11 @@ CreateAutomaticWateringCommand(WateringSystemPointer wateringSystem) {
             "will power up the water pump.",
             constants::WATER_PUMP_PIN_ID));
 
+    autoWateringOptionParser->addOption(std::make_shared<gh_cmd::Value<CharType, double>>(
+        'R', "flow-rate",
+        "Sets the water flowing through the flow while it's irrigating (expressed in litres "
+        "per minute), used to account the water usage."));
+
     autoWateringOptionParser->addOption(std::make_shared<gh_cmd::Switch<CharType>>(
         'o', "disable-pump", "Disables the pump in the automatic watering system cycles."));
 
@@ -143,7 +164,8 @@ CreateAutomaticWateringCommand(WateringSystemPointer wateringSystem) {
         'G', "enable-valve", "Enables the water valve in the automatic watering system cycles."));
 
     std::unique_ptr<AutomaticWateringCommand> autoWateringCommand{
-        std::make_unique<AutomaticWateringCommand>(std::cout, std::move(autoWateringOptionParser))};
+        std::make_unique<AutomaticWateringCommand>(outputStream,
+                                                   std::move(autoWateringOptionParser))};
     autoWateringCommand->registerOptionEvent(
         "start",
         [wateringSystem](
@@ -161,12 +183,28 @@ CreateAutomaticWateringCommand(WateringSystemPointer wateringSystem) {
             }
 
             wateringSystem->startAutomaticWatering(std::move(flowName));
+
+            return true;
         });
     autoWateringCommand->registerOptionEvent(
         "stop",
         [wateringSystem](
             [[maybe_unused]] const AutomaticWateringCommand::option_parser::const_option_pointer&) {
             wateringSystem->requestShutdown();
+
+            return true;
+        });
+
+    autoWateringCommand->registerOptionEvent(
+        "flow-rate",
+        [wateringSystem](
+            const AutomaticWateringCommand::option_parser::const_option_pointer& option) {
+            const gsl::not_null valueOption{
+                std::static_pointer_cast<const gh_cmd::Value<CharType, double>>(option)};
+
+            wateringSystem->setFlowRate(valueOption->value());
+
+            return true;
         });
 
     autoWateringCommand->registerOptionEvent(
@@ -174,6 +212,8 @@ CreateAutomaticWateringCommand(WateringSystemPointer wateringSystem) {
         [wateringSystem](
             [[maybe_unused]] const AutomaticWateringCommand::option_parser::const_option_pointer&) {
             wateringSystem->setWaterPumpEnabled(false);
+
+            return true;
         });
 
     autoWateringCommand->registerOptionEvent(
@@ -181,6 +221,8 @@ CreateAutomaticWateringCommand(WateringSystemPointer wateringSystem) {
         [wateringSystem](
             [[maybe_unused]] const AutomaticWateringCommand::option_parser::const_option_pointer&) {
             wateringSystem->setWaterValveEnabled(false);
+
+            return true;
         });
 
     autoWateringCommand->registerOptionEvent(
@@ -188,6 +230,8 @@ CreateAutomaticWateringCommand(WateringSystemPointer wateringSystem) {
         [wateringSystem](
             [[maybe_unused]] const AutomaticWateringCommand::option_parser::const_option_pointer&) {
             wateringSystem->setWaterPumpEnabled(true);
+
+            return true;
         });
 
     autoWateringCommand->registerOptionEvent(
@@ -195,6 +239,8 @@ CreateAutomaticWateringCommand(WateringSystemPointer wateringSystem) {
         [wateringSystem](
             [[maybe_unused]] const AutomaticWateringCommand::option_parser::const_option_pointer&) {
             wateringSystem->setWaterValveEnabled(true);
+
+            return true;
         });
 
     return autoWateringCommand;
@@ -202,19 +248,32 @@ CreateAutomaticWateringCommand(WateringSystemPointer wateringSystem) {
 
 template <typename WateringSystemPointer, typename OptionParserType>
 [[nodiscard]] static std::unique_ptr<rpi_gc::commands::StatusCommand> CreateStatusCommand(
-    WateringSystemPointer wateringSystem) {
+    WateringSystemPointer wateringSystem, std::ostream& outputStream, const bool bWatchSupported) {
     using namespace rpi_gc::commands;
     assert(static_cast<bool>(wateringSystem));
 
     auto optionParserPtr{std::make_unique<OptionParserType>("[OPTIONS] => status")};
     optionParserPtr->addSwitch(std::make_shared<gh_cmd::Switch<rpi_gc::CharType>>(
         'h', "help", "Displays this help page."));
+    optionParserPtr->addSwitch(std::make_shared<gh_cmd::Switch<rpi_gc::CharType>>(
+        'j', "json", "Prints the status of the systems as a single line of JSON."));
+
+    // The watch mode streams the changes after the command has returned, so it's available
+    // only where the output stream outlives the command execution.
+    if (bWatchSupported) {
+        optionParserPtr->addSwitch(std::make_shared<gh_cmd::Switch<rpi_gc::CharType>>(
+            'w', "watch", "Prints the changed status fields every time a system changes."));
+        optionParserPtr->addSwitch(std::make_shared<gh_cmd::Switch<rpi_gc::CharType>>(
+            'u', "unwatch", "Stops the active status watch."));
+        optionParserPtr->addOption(std::make_shared<StatusCommand::refresh_rate_option_type>(
+            'r', "refresh-rate", "Minimum time between two watch frames, in milliseconds."));
+    }
 
     std::vector<StatusCommand::diagnostic_probeable_ref> diagnosticables = {
         std::cref(*wateringSystem)};
 
     return std::make_unique<StatusCommand>(std::move(optionParserPtr), std::move(diagnosticables),
-                                           std::cout);
+                                           outputStream);
 }
 
 } // namespace commands_factory
@@ -240,104 +299,24 @@ T ClampWithError(const T value, const T minVal, const T maxVal, gh_log::Logger&
 
 } // namespace details
 
-// This is the entry point of the application. Here, it starts
-// the main execution of the greenhouse controller.
-int main(int argc, char* argv[]) {
-    using namespace rpi_gc;
-
-    using DefaultOptionParser = gh_cmd::DefaultOptionParser<CharType>;
-    using ApplicationOptionParser = DefaultOptionParser;
-    using LoggerPointer = std::shared_ptr<gh_log::Logger>;
-
-    LoggerPointer mainLogger{
-        gh_log::SPLLogger::createDailyRotatingLogger(StringType{strings::application::NAME})};
-    mainLogger->setAutomaticFlushLevel(gh_log::ELoggingLevel::Info);
-    mainLogger->logInfo("Initiating system: starting log now.");
-
-    LoggerPointer userLogger{gh_log::SPLLogger::createColoredStdOutLogger("Reporter")};
-    userLogger->setAutomaticFlushLevel(gh_log::ELoggingLevel::Info);
-
-    mainLogger->logInfo("Trying loading the configuration file.");
-    // We try to load the configuration file that contains the eventual
-    // last loaded project.
-    std::optional<std::pair<gc::project_management::Project, std::filesystem::path>>
-        lastLoadedProject{};
-    {
-        auto folderProvider{gc::folder_provider::FolderProvider::create()};
-        InitialProjectLoader projectLoader{*mainLogger, *folderProvider};
-
-        lastLoadedProject = projectLoader.tryLoadCachedProject();
-    }
-
-    gc_project::ProjectController projectController{};
-    if (lastLoadedProject.has_value()) {
-        // If the project has been successfully loaded we need to retrieve the
-        // various configurations.
-        mainLogger->logInfo("Project loaded successfully. Loading flows configurations.");
-
-        // If the project have been loaded successfully, we need to set it inside the
-        // project controller.
-        projectController.setCurrentProject(std::move(std::get<0>(lastLoadedProject.value())));
-        projectController.setCurrentProjectFilePath(std::get<1>(lastLoadedProject.value()));
-    }
-
-    mainLogger->logInfo("Initiating hardware abstraction layer.");
-    rpi_gc::hardware_management::HardwareInitializer<gh_hal::hardware_access::BoardChipFactory>
-        hardwareInitializer{mainLogger};
-
-    std::unique_ptr<gh_hal::hardware_access::BoardChip> boardChip{};
-    try {
-        // We try to initialize the board chip. If this doesn't go well we can't
-        // proceed with the application process.
-        boardChip = hardwareInitializer.initializeBoardChip(
-            std::filesystem::path{hardware_chip_paths::RASPBERRY_PI_3B_PLUS_CHIP_PATH_GPIO0});
-    } catch (const std::exception& hardwareInitializationError) {
-        constexpr std::string_view ABORTING_MESSAGE{"Aborting the process. Return code: -1."};
-
-        std::ostringstream userFeedbackStream{};
-        userFeedbackStream << "Failed to initialize the hardware abstraction layer. ";
-        userFeedbackStream << "Message: " << hardwareInitializationError.what() << ' ';
-
-        userLogger->logError(userFeedbackStream.str());
-        userLogger->logWarning("See the log file for more details.");
-        userLogger->logInfo(std::string{ABORTING_MESSAGE});
-        mainLogger->logInfo(std::string{ABORTING_MESSAGE});
-
-        return -1;
-    }
-
-    auto awsTimeProviderSmartPtr{::automatic_watering::CreateConfigurableAWSTimeProvider()};
-    std::mutex awsHardwareAccessMutex{};
-    rpi_gc::automatic_watering::DailyCycleAutomaticWateringSystem::time_provider_pointer
-        awsTimeProvider{awsTimeProviderSmartPtr.get()};
-
-    using AutomaticWateringSystemPointer =
-        std::shared_ptr<rpi_gc::automatic_watering::DailyCycleAutomaticWateringSystem>;
-    std::unique_ptr<rpi_gc::automatic_watering::DailyCycleAWSHardwareController>
-        awsHardwareController{};
-
-    mainLogger->logInfo("Initiating the automatic watering hardware controller.");
-    awsHardwareController =
-        std::make_unique<rpi_gc::automatic_watering::DailyCycleAWSHardwareController>(
-            std::ref(awsHardwareAccessMutex), std::ref(*boardChip), constants::WATER_VALVE_PIN_ID,
-            constants::WATER_PUMP_PIN_ID);
-
-    std::atomic<rpi_gc::automatic_watering::WateringSystemHardwareController*>
-        hardwareControllerAtomic{awsHardwareController.get()};
-
-    mainLogger->logInfo("Initiating the automatic watering system.");
-    AutomaticWateringSystemPointer automaticWateringSystem{
-        std::make_shared<rpi_gc::automatic_watering::DailyCycleAutomaticWateringSystem>(
-            std::ref(awsHardwareAccessMutex), mainLogger, userLogger,
-            std::ref(hardwareControllerAtomic), std::ref(awsTimeProvider))};
-
-    mainLogger->logInfo("Initiating application commands and user interface...");
-    auto versionCommand = std::make_unique<VersionCommand>(std::cout);
+namespace commands_factory {
 
-    auto autoWateringCommand = ::commands_factory::CreateAutomaticWateringCommand<
-        AutomaticWateringSystemPointer, DefaultOptionParser>(automaticWateringSystem);
+//!!
+//! \brief Registers the events of the options that change the configuration of the automatic
+//!  watering system.
+//!
+static void RegisterAutomaticWateringConfigurationEvents(
+    rpi_gc::AutomaticWateringCommand& autoWateringCommand,
+    rpi_gc::automatic_watering::DailyCycleAutomaticWateringSystem::time_provider_pointer&
+        awsTimeProvider,
+    std::atomic<rpi_gc::automatic_watering::WateringSystemHardwareController*>&
+        hardwareControllerAtomic,
+    const std::shared_ptr<gh_log::Logger>& mainLogger,
+    const std::shared_ptr<gh_log::Logger>& userLogger) {
+    using rpi_gc::AutomaticWateringCommand;
+    using rpi_gc::CharType;
 
-    autoWateringCommand->registerOptionEvent(
+    autoWateringCommand.registerOptionEvent(
         "activation-time",
         [&awsTimeProvider, mainLogger,
          userLogger](const AutomaticWateringCommand::option_parser::const_option_pointer& option) {
@@ -366,9 +345,11 @@ int main(int argc, char* argv[]) {
 
             userLogger->logInfo(formatString.str());
             mainLogger->logInfo(formatString.str());
+
+            return true;
         });
 
-    autoWateringCommand->registerOptionEvent(
+    autoWateringCommand.registerOptionEvent(
         "deactivation-time",
         [&awsTimeProvider, mainLogger,
          userLogger](const AutomaticWateringCommand::option_parser::const_option_pointer& option) {
@@ -397,9 +378,11 @@ int main(int argc, char* argv[]) {
 
             userLogger->logInfo(formatString.str());
             mainLogger->logInfo(formatString.str());
+
+            return true;
         });
 
-    autoWateringCommand->registerOptionEvent(
+    autoWateringCommand.registerOptionEvent(
         "pumpvalve-deactsep-time",
         [&awsTimeProvider, mainLogger,
          userLogger](const AutomaticWateringCommand::option_parser::const_option_pointer& option) {
@@ -428,9 +411,11 @@ int main(int argc, char* argv[]) {
 
             userLogger->logWarning(formatString.str());
             mainLogger->logWarning(formatString.str());
+
+            return true;
         });
 
-    autoWateringCommand->registerOptionEvent(
+    autoWateringCommand.registerOptionEvent(
         "valve-pin-id",
         [&hardwareControllerAtomic, mainLogger,
          userLogger](const AutomaticWateringCommand::option_parser::const_option_pointer& option) {
@@ -452,9 +437,11 @@ int main(int argc, char* argv[]) {
 
             userLogger->logWarning(formatString.str());
             mainLogger->logWarning(formatString.str());
+
+            return true;
         });
 
-    autoWateringCommand->registerOptionEvent(
+    autoWateringCommand.registerOptionEvent(
         "pump-pin-id",
         [&hardwareControllerAtomic, mainLogger,
          userLogger](const AutomaticWateringCommand::option_parser::const_option_pointer& option) {
@@ -476,21 +463,212 @@ int main(int argc, char* argv[]) {
 
             userLogger->logWarning(formatString.str());
             mainLogger->logWarning(formatString.str());
+
+            return true;
+        });
+}
+
+} // namespace commands_factory
+
+namespace remote_commands {
+
+constexpr std::string_view SOCKET_PATH_VARIABLE{"RPI_GC_SOCKET_PATH"};
+constexpr std::string_view SOCKET_FILE_NAME{"rpi_gc.sock"};
+
+//!!
+//! \brief Retrieves the path of the command server socket. It can be set through the
+//!  RPI_GC_SOCKET_PATH variable, otherwise the socket is created in the runtime directory
+//!  given by systemd or by the session, or in the temporary directory as a last resort.
+//!
+[[nodiscard]] std::filesystem::path GetCommandSocketPath() {
+    if (const char* socketPath{std::getenv(SOCKET_PATH_VARIABLE.data())};
+        socketPath != nullptr && *socketPath != '\0') {
+        return std::filesystem::path{socketPath};
+    }
+
+    for (const char* runtimeDirectoryVariable : {"RUNTIME_DIRECTORY", "XDG_RUNTIME_DIR"}) {
+        if (const char* runtimeDirectory{std::getenv(runtimeDirectoryVariable)};
+            runtimeDirectory != nullptr && *runtimeDirectory != '\0') {
+            return std::filesystem::path{runtimeDirectory} / SOCKET_FILE_NAME;
+        }
+    }
+
+    std::error_code errorCode{};
+    return std::filesystem::temp_directory_path(errorCode) / SOCKET_FILE_NAME;
+}
+
+} // namespace remote_commands
+
+namespace water_usage {
+
+constexpr std::string_view LEDGERS_FOLDER_NAME{"water-usage"};
+
+//!!
+//! \brief Retrieves the path of the folder of the water usage ledgers, inside the application
+//!  data folder.
+//!
+[[nodiscard]] std::filesystem::path GetWaterUsageLedgersPath() {
+    const auto folderProvider{gc::folder_provider::FolderProvider::create()};
+    return folderProvider->getAppDataFolder() / "FishAndPlants" / "rpi_gc" / LEDGERS_FOLDER_NAME;
+}
+
+} // namespace water_usage
+
+// This is the entry point of the application. Here, it starts
+// the main execution of the greenhouse controller.
+int main(int argc, char* argv[]) {
+    using namespace rpi_gc;
+
+    using DefaultOptionParser = gh_cmd::DefaultOptionParser<CharType>;
+    using ApplicationOptionParser = DefaultOptionParser;
+    using LoggerPointer = std::shared_ptr<gh_log::Logger>;
+
+    LoggerPointer mainLogger{
+        gh_log::SPLLogger::createDailyRotatingLogger(StringType{strings::application::NAME})};
+    mainLogger->setAutomaticFlushLevel(gh_log::ELoggingLevel::Info);
+    mainLogger->logInfo("Initiating system: starting log now.");
+
+    LoggerPointer userLogger{gh_log::SPLLogger::createColoredStdOutLogger("Reporter")};
+    userLogger->setAutomaticFlushLevel(gh_log::ELoggingLevel::Info);
+
+    // The event loop drives the user input and the termination signals. The signals must be
+    // handled before any other thread is spawned, so that they inherit the blocked mask.
+    EventLoop eventLoop{};
+    for (const int signalNumber : {SIGINT, SIGTERM}) {
+        eventLoop.addSignalHandler(signalNumber, [&eventLoop, mainLogger](const int signal) {
+            mainLogger->logInfo("Received termination signal " + std::to_string(signal) + ".");
+            eventLoop.stop();
         });
+    }
 
-    auto abortCommandOptionParser{
-        std::make_unique<gh_cmd::DefaultOptionParser<CharType>>("[OPTIONS] => abort")};
-    abortCommandOptionParser->addSwitch(
-        std::make_shared<gh_cmd::Switch<CharType>>('h', "help", "Displays this help page."));
-    auto abortCommand = std::make_unique<commands::AbortCommand>(
-        mainLogger,
-        std::vector<commands::AbortCommand::emergency_stoppable_system_pointer>{
-            automaticWateringSystem},
-        std::move(abortCommandOptionParser));
+    mainLogger->logInfo("Trying loading the configuration file.");
+    // We try to load the configuration file that contains the eventual
+    // last loaded project.
+    std::optional<std::pair<gc::project_management::Project, std::filesystem::path>>
+        lastLoadedProject{};
+    {
+        auto folderProvider{gc::folder_provider::FolderProvider::create()};
+        InitialProjectLoader projectLoader{*mainLogger, *folderProvider};
+
+        lastLoadedProject = projectLoader.tryLoadCachedProject();
+    }
+
+    gc_project::ProjectController projectController{};
+    if (lastLoadedProject.has_value()) {
+        // If the project has been successfully loaded we need to retrieve the
+        // various configurations.
+        mainLogger->logInfo("Project loaded successfully. Loading flows configurations.");
+
+        // If the project have been loaded successfully, we need to set it inside the
+        // project controller.
+        projectController.setCurrentProject(std::move(std::get<0>(lastLoadedProject.value())));
+        projectController.setCurrentProjectFilePath(std::get<1>(lastLoadedProject.value()));
+    }
+
+    mainLogger->logInfo("Initiating hardware abstraction layer.");
+    rpi_gc::hardware_management::HardwareInitializer<gh_hal::hardware_access::BoardChipFactory>
+        hardwareInitializer{mainLogger};
+
+    std::unique_ptr<gh_hal::hardware_access::BoardChip> boardChip{};
+    try {
+        // We try to initialize the board chip. If this doesn't go well we can't
+        // proceed with the application process.
+        boardChip = hardwareInitializer.initializeBoardChip(
+            std::filesystem::path{hardware_chip_paths::RASPBERRY_PI_3B_PLUS_CHIP_PATH_GPIO0});
+    } catch (const std::exception& hardwareInitializationError) {
+        constexpr std::string_view ABORTING_MESSAGE{"Aborting the process. Return code: -1."};
+
+        std::ostringstream userFeedbackStream{};
+        userFeedbackStream << "Failed to initialize the hardware abstraction layer. ";
+        userFeedbackStream << "Message: " << hardwareInitializationError.what() << ' ';
+
+        userLogger->logError(userFeedbackStream.str());
+        userLogger->logWarning("See the log file for more details.");
+        userLogger->logInfo(std::string{ABORTING_MESSAGE});
+        mainLogger->logInfo(std::string{ABORTING_MESSAGE});
+
+        return -1;
+    }
+
+    auto awsTimeProviderSmartPtr{::automatic_watering::CreateConfigurableAWSTimeProvider()};
+    std::mutex awsHardwareAccessMutex{};
+    rpi_gc::automatic_watering::DailyCycleAutomaticWateringSystem::time_provider_pointer
+        awsTimeProvider{awsTimeProviderSmartPtr.get()};
+
+    using AutomaticWateringSystemPointer =
+        std::shared_ptr<rpi_gc::automatic_watering::DailyCycleAutomaticWateringSystem>;
+    std::unique_ptr<rpi_gc::automatic_watering::DailyCycleAWSHardwareController>
+        awsHardwareController{};
+
+    mainLogger->logInfo("Initiating the automatic watering hardware controller.");
+    awsHardwareController =
+        std::make_unique<rpi_gc::automatic_watering::DailyCycleAWSHardwareController>(
+            std::ref(awsHardwareAccessMutex), std::ref(*boardChip), constants::WATER_VALVE_PIN_ID,
+            constants::WATER_PUMP_PIN_ID);
 
-    auto statusCommand =
-        ::commands_factory::CreateStatusCommand<AutomaticWateringSystemPointer,
-                                                DefaultOptionParser>(automaticWateringSystem);
+    std::atomic<rpi_gc::automatic_watering::WateringSystemHardwareController*>
+        hardwareControllerAtomic{awsHardwareController.get()};
+
+    mainLogger->logInfo("Opening the water usage ledgers.");
+    std::shared_ptr<rpi_gc::automatic_watering::WaterUsageLedgerFolder> waterUsageLedgers{};
+    try {
+        waterUsageLedgers = std::make_shared<rpi_gc::automatic_watering::WaterUsageLedgerFolder>(
+            ::water_usage::GetWaterUsageLedgersPath());
+    } catch (const std::exception& ledgerError) {
+        // The system can still irrigate without accounting the water.
+        const std::string message{StringType{"Unable to open the water usage ledgers: "} +
+                                  ledgerError.what()};
+        mainLogger->logWarning(message);
+        userLogger->logWarning(message);
+    }
+
+    mainLogger->logInfo("Initiating the automatic watering system.");
+    AutomaticWateringSystemPointer automaticWateringSystem{
+        std::make_shared<rpi_gc::automatic_watering::DailyCycleAutomaticWateringSystem>(
+            std::ref(awsHardwareAccessMutex), mainLogger, userLogger,
+            std::ref(hardwareControllerAtomic), std::ref(awsTimeProvider),
+            std::move(waterUsageLedgers))};
+
+    mainLogger->logInfo("Initiating application commands and user interface...");
+    auto versionCommand = std::make_unique<VersionCommand>(std::cout);
+
+    // The commands are created by functions, so that every client of the command server
+    // gets its own instances writing to its own output.
+    const auto createAutoWateringCommand{[&awsTimeProvider, &hardwareControllerAtomic, mainLogger,
+                                          automaticWateringSystem](
+                                             std::ostream& outputStream,
+                                             const LoggerPointer& commandUserLogger) {
+        auto command{::commands_factory::CreateAutomaticWateringCommand<
+            AutomaticWateringSystemPointer, DefaultOptionParser>(automaticWateringSystem,
+                                                                 outputStream)};
+        ::commands_factory::RegisterAutomaticWateringConfigurationEvents(
+            *command, awsTimeProvider, hardwareControllerAtomic, mainLogger, commandUserLogger);
+        return command;
+    }};
+
+    const auto createAbortCommand{[mainLogger, automaticWateringSystem](
+                                      std::ostream& outputStream) {
+        auto abortCommandOptionParser{
+            std::make_unique<gh_cmd::DefaultOptionParser<CharType>>("[OPTIONS] => abort")};
+        abortCommandOptionParser->addSwitch(
+            std::make_shared<gh_cmd::Switch<CharType>>('h', "help", "Displays this help page."));
+        return std::make_unique<commands::AbortCommand>(
+            mainLogger,
+            std::vector<commands::AbortCommand::emergency_stoppable_system_pointer>{
+                automaticWateringSystem},
+            std::move(abortCommandOptionParser), outputStream);
+    }};
+
+    const auto createStatusCommand{
+        [automaticWateringSystem](std::ostream& outputStream, const bool bWatchSupported) {
+            return ::commands_factory::CreateStatusCommand<AutomaticWateringSystemPointer,
+                                                           DefaultOptionParser>(
+                automaticWateringSystem, outputStream, bWatchSupported);
+        }};
+
+    auto autoWateringCommand{createAutoWateringCommand(std::cout, userLogger)};
+    auto abortCommand{createAbortCommand(std::cout)};
+    auto statusCommand{createStatusCommand(std::cout, true)};
 
     projectController.registerProjectComponent(*automaticWateringSystem);
 
@@ -506,6 +684,38 @@ int main(int argc, char* argv[]) {
     auto projectCommand =
         projectCommandFactory.setMainLogger(mainLogger).setUserLogger(userLogger).create();
 
+    rpi_gc::remote::CommandServer commandServer{
+        eventLoop,
+        [&createAutoWateringCommand, &createAbortCommand, &createStatusCommand,
+         &projectController, mainLogger](std::ostream& outputStream) {
+            // The user feedback of the client commands goes back to the client.
+            const LoggerPointer clientUserLogger{
+                gh_log::SPLLogger::createStreamLogger("Reporter", outputStream)};
+
+            rpi_gc::commands_factory::ProjectCommandFactory clientProjectCommandFactory{
+                outputStream, std::cin, projectController};
+            clientProjectCommandFactory.setMainLogger(mainLogger).setUserLogger(clientUserLogger);
+
+            std::vector<rpi_gc::remote::CommandServer::command_pointer> commands{};
+            commands.push_back(createAutoWateringCommand(outputStream, clientUserLogger));
+            commands.push_back(createAbortCommand(outputStream));
+            // The remote responses are sent when the command returns, so they can't be watched.
+            commands.push_back(createStatusCommand(outputStream, false));
+            commands.push_back(clientProjectCommandFactory.create());
+            return commands;
+        },
+        mainLogger};
+
+    rpi_gc::remote::MetricsServer metricsServer{eventLoop, gc::metrics::GetDefaultRegistry(),
+                                                mainLogger};
+
+    // The watchdog turns the outputs off without going through the supervised systems, so it
+    // works even if a hung worker holds the hardware access mutex.
+    rpi_gc::watchdog::WatchdogSupervisor watchdogSupervisor{
+        &gh_hal::hardware_access::ForceAllOutputsInactive, mainLogger};
+    watchdogSupervisor.supervise("automatic watering", automaticWateringSystem->getHeartbeat(),
+                                 automaticWateringSystem);
+
     auto helpCommand = std::make_unique<HelpCommand>(
         std::cout,
         std::vector<HelpCommand::terminal_command_const_ref>{
@@ -519,6 +729,27 @@ int main(int argc, char* argv[]) {
     applicationCommand->addBivalentCommand(*versionCommand);
     applicationCommand->addBivalentCommand(*helpCommand);
 
+    // The script options are read by the application after the parsing.
+    const auto scriptOption{std::make_shared<gh_cmd::Value<CharType, std::string>>(
+        's', "script",
+        "Runs the commands of the given file, one per line, without the prompt and exits.")};
+    const auto continueOnErrorSwitch{std::make_shared<gh_cmd::Switch<CharType>>(
+        'k', "continue-on-error",
+        "Keeps running the script after a failed command instead of stopping.")};
+    applicationCommand->addApplicationOption(scriptOption);
+    applicationCommand->addApplicationOption(continueOnErrorSwitch);
+
+    // The metrics server is optional: it's started only if a port is given.
+    const auto metricsPortOption{std::make_shared<gh_cmd::Value<CharType, std::uint16_t>>(
+        'm', "metrics-port",
+        "Serves the metrics in the Prometheus format on the given loopback port.")};
+    applicationCommand->addApplicationOption(metricsPortOption);
+
+    const auto watchdogTimeoutOption{std::make_shared<gh_cmd::Value<CharType, std::uint64_t>>(
+        'w', "watchdog-timeout",
+        "Aborts a worker that is late for the given milliseconds (min: 100, default: 1000).")};
+    applicationCommand->addApplicationOption(watchdogTimeoutOption);
+
     OutputStringStream applicationHelpStream{};
     applicationOptionParser->printHelp(applicationHelpStream);
     helpCommand->setApplicationHelp(applicationHelpStream.str());
@@ -535,6 +766,7 @@ int main(int argc, char* argv[]) {
     mainApplication.setApplicationCommand(std::move(applicationCommand));
 
     mainApplication.addTerminableSystem(std::move(automaticWateringSystem));
+    mainApplication.useEventLoop(eventLoop, STDIN_FILENO);
 
     std::vector<std::string> inputArgs{};
     std::transform(argv, argv + argc, std::back_inserter(inputArgs), [](const char* str) {
@@ -544,8 +776,66 @@ int main(int argc, char* argv[]) {
     if (!mainApplication.processInputOptions(inputArgs))
         return 1;
 
+    watchdogSupervisor.start(
+        watchdogTimeoutOption->isSet()
+            ? std::chrono::milliseconds{watchdogTimeoutOption->value()}
+            : rpi_gc::watchdog::WatchdogSupervisor::DEFAULT_TIMEOUT);
+
+    if (scriptOption->isSet()) {
+        // The script mode is not interactive: the commands are read from the file and the
+        // application exits when they have been executed.
+        const std::filesystem::path scriptPath{scriptOption->value()};
+        std::ifstream scriptStream{scriptPath};
+        if (!scriptStream.is_open()) {
+            userLogger->logError("Unable to open the script file " + scriptPath.string() + ".");
+            mainLogger->logError("Unable to open the script file " + scriptPath.string() + ".");
+            return 1;
+        }
+
+        mainLogger->logInfo("Running the script " + scriptPath.string() + ".");
+        const bool bScriptSucceeded{mainApplication.runScript(
+            scriptStream,
+            continueOnErrorSwitch->isSet()
+                ? GreenhouseControllerApplication::ScriptErrorPolicy::ContinueOnError
+                : GreenhouseControllerApplication::ScriptErrorPolicy::FailFast)};
+        watchdogSupervisor.stop();
+
+        mainLogger->logInfo("Saving last project data.");
+        rpi_gc::commands_factory::utils::SaveProjectAndUpdateConfigFile(
+            projectController, userLogger, mainLogger,
+            "Saving last loaded project and updating application config file.");
+
+        const int scriptResult{bScriptSucceeded ? 0 : 1};
+        mainLogger->logInfo("Exiting now [Result: " + std::to_string(scriptResult) + "].");
+        return scriptResult;
+    }
+
+    try {
+        commandServer.start(::remote_commands::GetCommandSocketPath());
+    } catch (const std::exception& commandServerError) {
+        // The greenhouse can still be controlled through the terminal.
+        const std::string message{StringType{"Unable to start the command server: "} +
+                                  commandServerError.what()};
+        mainLogger->logWarning(message);
+        userLogger->logWarning(message);
+    }
+
+    if (metricsPortOption->isSet()) {
+        try {
+            metricsServer.start(metricsPortOption->value());
+        } catch (const std::exception& metricsServerError) {
+            const std::string message{StringType{"Unable to start the metrics server: "} +
+                                      metricsServerError.what()};
+            mainLogger->logWarning(message);
+            userLogger->logWarning(message);
+        }
+    }
+
     mainLogger->logInfo("Starting application loop.");
     mainApplication.run();
+    watchdogSupervisor.stop();
+    metricsServer.stop();
+    commandServer.stop();
 
     mainLogger->logInfo("Saving last project data.");
     rpi_gc::commands_factory::utils::SaveProjectAndUpdateConfigFile(
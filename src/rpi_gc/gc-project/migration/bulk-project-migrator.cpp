@@ -0,0 +1,156 @@
+// Copyright (c) 2023 Andrea Ballestrazzi
+#include <gc-project/migration/bulk-project-migrator.hpp>
+
+#include <gc-project/upgraders/project-upgraders.hpp>
+
+#include <project-management/project-io/project-reader.hpp>
+#include <project-management/project-io/project-writer.hpp>
+
+// C++ STL
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <iterator>
+#include <stdexcept>
+#include <thread>
+
+namespace rpi_gc::gc_project::migration {
+
+namespace details {
+
+[[nodiscard]] std::vector<std::filesystem::path> CollectProjectFiles(
+    const std::filesystem::path& directory) {
+    std::vector<std::filesystem::path> projectFiles{};
+
+    for (const auto& entry : std::filesystem::directory_iterator{directory}) {
+        if (entry.is_regular_file() && entry.path().extension() == ".json")
+            projectFiles.push_back(entry.path());
+    }
+
+    // Sorting keeps the report order stable between runs.
+    std::ranges::sort(projectFiles);
+    return projectFiles;
+}
+
+[[nodiscard]] double PerSecond(double amount,
+                               std::chrono::steady_clock::duration elapsedTime) noexcept {
+    const double seconds{std::chrono::duration<double>{elapsedTime}.count()};
+    return seconds > 0.0 ? amount / seconds : 0.0;
+}
+
+} // namespace details
+
+double MigrationReport::getProjectsPerSecond() const noexcept {
+    return details::PerSecond(static_cast<double>(getProcessedProjects()), elapsedTime);
+}
+
+double MigrationReport::getBytesPerSecond() const noexcept {
+    return details::PerSecond(static_cast<double>(processedBytes), elapsedTime);
+}
+
+BulkProjectMigrator::BulkProjectMigrator(const upgrader_registry& registry,
+                                         semver::version targetVersion,
+                                         std::size_t workersCount) noexcept
+    : m_registry{registry},
+      m_targetVersion{targetVersion},
+      m_workersCount{std::max<std::size_t>(workersCount, 1)} {}
+
+MigrationReport BulkProjectMigrator::migrateDirectory(
+    const std::filesystem::path& inputDirectory,
+    const std::optional<std::filesystem::path>& outputDirectory) const {
+    const auto startTime{std::chrono::steady_clock::now()};
+    const std::vector<std::filesystem::path> projectFiles{
+        details::CollectProjectFiles(inputDirectory)};
+
+    // Every worker fills its own report, so the hot path doesn't need any lock:
+    // the only shared state is the index of the next file to migrate.
+    std::vector<MigrationReport> workerReports(
+        std::min(m_workersCount, std::max<std::size_t>(projectFiles.size(), 1)));
+    std::atomic<std::size_t> nextFileIndex{};
+
+    {
+        std::vector<std::jthread> workers{};
+        workers.reserve(workerReports.size());
+
+        for (MigrationReport& workerReport : workerReports) {
+            workers.emplace_back([&, this, report = &workerReport] {
+                for (std::size_t fileIndex{nextFileIndex.fetch_add(1)};
+                     fileIndex < projectFiles.size(); fileIndex = nextFileIndex.fetch_add(1)) {
+                    const std::filesystem::path& projectPath{projectFiles[fileIndex]};
+
+                    try {
+                        const std::uintmax_t fileSize{std::filesystem::file_size(projectPath)};
+                        const ProjectOutcome outcome{migrate_project(projectPath, outputDirectory)};
+
+                        report->processedBytes += fileSize;
+                        if (outcome == ProjectOutcome::Migrated)
+                            ++report->migratedProjects;
+                        else
+                            ++report->upToDateProjects;
+                    } catch (const std::exception& e) {
+                        report->failures.push_back(MigrationFailure{projectPath, e.what()});
+                    }
+                }
+            });
+        }
+    }
+
+    MigrationReport report{};
+    for (MigrationReport& workerReport : workerReports) {
+        report.migratedProjects += workerReport.migratedProjects;
+        report.upToDateProjects += workerReport.upToDateProjects;
+        report.processedBytes += workerReport.processedBytes;
+        std::ranges::move(workerReport.failures, std::back_inserter(report.failures));
+    }
+
+    std::ranges::sort(report.failures, {}, &MigrationFailure::projectPath);
+    report.elapsedTime = std::chrono::steady_clock::now() - startTime;
+
+    return report;
+}
+
+auto BulkProjectMigrator::migrate_project(
+    const std::filesystem::path& projectPath,
+    const std::optional<std::filesystem::path>& outputDirectory) const -> ProjectOutcome {
+    using namespace gc::project_management;
+
+    const std::filesystem::path outputPath{
+        outputDirectory ? *outputDirectory / projectPath.filename() : projectPath};
+
+    // The lazy reader parses the project header and only scans the structure of the other
+    // sections, so up-to-date projects are detected without parsing their sections. The file
+    // is still read whole: the header fields can be anywhere in the root object, e.g. the
+    // writer puts the version after the sections.
+    Project project{};
+    *project_io::CreateLazyJsonProjectFileReader(projectPath) >> project;
+
+    if (project.getVersion() >= m_targetVersion && !project.getTitle().empty()) {
+        if (outputPath != projectPath) {
+            std::filesystem::create_directories(outputPath.parent_path());
+            std::filesystem::copy_file(projectPath, outputPath,
+                                       std::filesystem::copy_options::overwrite_existing);
+        }
+
+        return ProjectOutcome::UpToDate;
+    }
+
+    if (!upgraders::UpgradeProject(project, m_registry, m_targetVersion))
+        throw std::runtime_error{"The project upgraders couldn't be applied"};
+
+    std::filesystem::path temporaryPath{outputPath};
+    temporaryPath += ".migrating";
+
+    try {
+        // The writer must be destroyed before the rename so the file is flushed and closed.
+        *project_io::createJsonProjectFileWriter(temporaryPath) << project;
+        std::filesystem::rename(temporaryPath, outputPath);
+    } catch (...) {
+        std::error_code errorCode{};
+        std::filesystem::remove(temporaryPath, errorCode);
+        throw;
+    }
+
+    return ProjectOutcome::Migrated;
+}
+
+} // namespace rpi_gc::gc_project::migration
@@ -0,0 +1,99 @@
+// Copyright (c) 2023 Andrea Ballestrazzi
+#pragma once
+
+#include <project-management/integrity-check/project-upgrader-registry.hpp>
+
+// Third-party
+#include <semver.hpp>
+
+// C++ STL
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace rpi_gc::gc_project::migration {
+
+//!!
+//! \brief Represents a project file that couldn't be migrated and the reason why.
+//!
+struct MigrationFailure {
+    std::filesystem::path projectPath{};
+    std::string reason{};
+};
+
+//!!
+//! \brief Represents the outcome of a bulk migration.
+//!
+struct MigrationReport {
+    std::size_t migratedProjects{};
+    std::size_t upToDateProjects{};
+    std::uintmax_t processedBytes{};
+    std::chrono::steady_clock::duration elapsedTime{};
+    std::vector<MigrationFailure> failures{};
+
+    [[nodiscard]] constexpr std::size_t getProcessedProjects() const noexcept {
+        return migratedProjects + upToDateProjects + failures.size();
+    }
+
+    [[nodiscard]] double getProjectsPerSecond() const noexcept;
+    [[nodiscard]] double getBytesPerSecond() const noexcept;
+};
+
+//!!
+//! \brief Upgrades all the projects inside a directory to a target version, spreading the
+//!  project files over a fixed pool of worker threads.
+//!
+class BulkProjectMigrator final {
+public:
+    using upgrader_registry = gc::project_management::integrity_check::ProjectUpgraderRegistry;
+
+    //!!
+    //! \brief Constructs a new migrator. The registry must outlive the migrator and must not be
+    //!  modified while a migration is running.
+    //!
+    //! \param registry The registry with the upgraders to apply.
+    //! \param targetVersion The version the projects will have after the migration.
+    //! \param workersCount The number of worker threads. Zero means one worker.
+    BulkProjectMigrator(const upgrader_registry& registry, semver::version targetVersion,
+                        std::size_t workersCount) noexcept;
+
+    //!!
+    //! \brief Migrates all the project files (*.json) in the given directory. Every project is
+    //!  loaded, upgraded and written back on its own, so only one project per worker is in
+    //!  memory at any time. Projects are written to a temporary file first and then renamed,
+    //!  so a failure never leaves a half-written project behind.
+    //!
+    //! \note The projects aren't streamed: the upgraders work on a whole Project, so every
+    //!  project file is read in one buffer and written from the upgraded project. Only its
+    //!  header is parsed before the version check, and the up-to-date projects are copied
+    //!  file to file without being parsed or serialized.
+    //!
+    //! \param inputDirectory The directory with the projects to migrate.
+    //! \param outputDirectory The directory where the migrated projects are written. If empty,
+    //!  the projects are migrated in place.
+    //! \return The report of the migration.
+    //! \throws std::filesystem::filesystem_error if the input directory cannot be listed.
+    [[nodiscard]] MigrationReport migrateDirectory(
+        const std::filesystem::path& inputDirectory,
+        const std::optional<std::filesystem::path>& outputDirectory = std::nullopt) const;
+
+private:
+    enum class ProjectOutcome {
+        Migrated,
+        UpToDate
+    };
+
+    const upgrader_registry& m_registry;
+    const semver::version m_targetVersion;
+    const std::size_t m_workersCount;
+
+    [[nodiscard]] ProjectOutcome migrate_project(
+        const std::filesystem::path& projectPath,
+        const std::optional<std::filesystem::path>& outputDirectory) const;
+};
+
+} // namespace rpi_gc::gc_project::migration
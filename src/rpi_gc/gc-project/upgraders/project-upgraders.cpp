@@ -1,8 +1,12 @@
 // Copyright (c) 2023 Andrea Ballestrazzi
 #include "gc-project/upgraders/project-upgraders.hpp"
 
+#include <project-management/integrity-check/title-integrity-checker.hpp>
+#include <project-management/integrity-check/version-integrity-checker.hpp>
+
 // C++ STL
 #include <array>
+#include <memory>
 
 namespace rpi_gc::gc_project::upgraders {
 
@@ -71,4 +75,39 @@ bool ProjectUpgrader_V1_1ToV1_2::tryApplyIntegrityFixes(gc::project_management::
     return true;
 }
 
+gc::project_management::integrity_check::ProjectUpgraderRegistry CreateProjectUpgraderRegistry() {
+    gc::project_management::integrity_check::ProjectUpgraderRegistry registry{};
+
+    // Projects were introduced with the 1.1 version: older versions only come from files
+    // without a version string, which share the 1.1 layout.
+    registry.registerUpgrader(semver::version{0, 0, 0}, semver::version{1, 2, 0},
+                              [] { return std::make_unique<ProjectUpgrader_V1_1ToV1_2>(); });
+
+    return registry;
+}
+
+bool UpgradeProject(
+    gc::project_management::Project& project,
+    const gc::project_management::integrity_check::ProjectUpgraderRegistry& registry,
+    semver::version targetVersion) {
+    using namespace gc::project_management;
+
+    integrity_check::TitleIntegrityChecker titleIntegrityChecker{"unknown-project"};
+    // If the project title need an integrity update we perform it.
+    if (!titleIntegrityChecker.checkIntegrity(project)) {
+        [[maybe_unused]] const bool bRes{titleIntegrityChecker.tryApplyIntegrityFixes(project)};
+    }
+
+    if (!registry.migrate(project, targetVersion))
+        return false;
+
+    integrity_check::VersionIntegrityChecker versionIntegrityChecker{targetVersion};
+    // If the project version need an integrity update we perform it.
+    if (!versionIntegrityChecker.checkIntegrity(project)) {
+        [[maybe_unused]] const bool bRes{versionIntegrityChecker.tryApplyIntegrityFixes(project)};
+    }
+
+    return true;
+}
+
 } // namespace rpi_gc::gc_project::upgraders
@@ -2,6 +2,7 @@
 #pragma once
 
 #include <project-management/integrity-check/project-integrity-checker.hpp>
+#include <project-management/integrity-check/project-upgrader-registry.hpp>
 #include <project-management/project.hpp>
 
 namespace rpi_gc::gc_project::upgraders {
@@ -32,4 +33,27 @@ public:
     [[nodiscard]] bool tryApplyIntegrityFixes(gc::project_management::Project& project) override;
 };
 
+//!!
+//! \brief Creates the registry with all the project upgraders known by the application.
+//!
+//! \return The registry of the project upgraders.
+//!
+[[nodiscard]] gc::project_management::integrity_check::ProjectUpgraderRegistry
+CreateProjectUpgraderRegistry();
+
+//!!
+//! \brief Applies the standard integrity checks to the given project: the title check, the
+//!  upgraders along the migration path and the final version update. Upgraders may throw
+//!  exceptions if a project section cannot be read.
+//!
+//! \param project The project to upgrade.
+//! \param registry The registry with the upgraders to apply.
+//! \param targetVersion The version the project will have after the upgrade.
+//! \return True if the project has been fully upgraded, false otherwise.
+//!
+[[nodiscard]] bool UpgradeProject(
+    gc::project_management::Project& project,
+    const gc::project_management::integrity_check::ProjectUpgraderRegistry& registry,
+    semver::version targetVersion);
+
 } // namespace rpi_gc::gc_project::upgraders
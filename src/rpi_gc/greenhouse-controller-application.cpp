@@ -1,17 +1,34 @@
 // Copyright (C) 2023 Andrea Ballestrazzi
 #include <greenhouse-controller-application.hpp>
 
+#include <gh_cmd/command-schema.hpp>
+
 // Resources
 #include <user-interface/commands-strings.hpp>
 #include <version/version-numbers.hpp>
 
 // C++ STL
+#include <array>
 #include <cassert>
+#include <cerrno>
+#include <exception>
+#include <string>
+#include <string_view>
+#include <system_error>
 #include <utility>
 #include <vector>
 
+// POSIX
+#include <unistd.h>
+
 namespace rpi_gc {
 
+namespace {
+
+constexpr std::size_t INPUT_BUFFER_SIZE{4096};
+
+} // namespace
+
 GreenhouseControllerApplication::GreenhouseControllerApplication(
     ostream_ref outputStream, istream_ref inputStream, logger_pointer mainLogger,
     gc_project::ProjectController& projectController) noexcept
@@ -40,81 +57,206 @@ bool GreenhouseControllerApplication::processInputOptions(
     return true;
 }
 
+bool GreenhouseControllerApplication::execute_application_command() noexcept {
+    if (!m_bCanApplicationCommandExecute) {
+        return true;
+    }
+
+    assert(m_applicationCommand != nullptr);
+    return m_applicationCommand->execute();
+}
+
 void GreenhouseControllerApplication::run() noexcept {
     // Firstly we run the the application command if the user
     // typed some options during the application launching.
-    if (m_bCanApplicationCommandExecute) {
-        assert(m_applicationCommand != nullptr);
-
-        // If the execution is already satisfied the we can safely exit
-        // the execution (maybe the user typed --help or similar).
-        const bool bCanProceed{m_applicationCommand->execute()};
-        if (!bCanProceed) {
-            teardown();
-            return;
-        }
+    // If the execution is already satisfied the we can safely exit
+    // the execution (maybe the user typed --help or similar).
+    if (!execute_application_command()) {
+        teardown();
+        return;
     }
 
     // The first thing we do is to print the application header,
     // i.e. the first few lines of the application presentation.
     print_app_header();
 
+    m_outputStream.get() << strings::commands::feedbacks::TYPE_HELP << std::endl;
+
     // Now we begin the user input loop.
-    std::string inputLine{};
+    if (m_eventLoop != nullptr) {
+        run_event_input_loop();
+    } else {
+        run_stream_input_loop();
+    }
 
-    m_outputStream.get() << strings::commands::feedbacks::TYPE_HELP << std::endl;
+    m_outputStream.get() << strings::commands::feedbacks::TEARING_DOWN << std::endl;
+    m_mainLogger->logInfo(StringType{strings::commands::feedbacks::TEARING_DOWN});
+    teardown();
+    m_outputStream.get() << strings::commands::feedbacks::GOODBYE << std::endl;
+}
 
-    while (inputLine != strings::commands::EXIT && m_inputStream.get().good()) {
+void GreenhouseControllerApplication::run_stream_input_loop() {
+    std::string inputLine{};
+    bool bContinue{true};
+
+    while (bContinue && m_inputStream.get().good()) {
         print_project_path();
 
         std::getline(m_inputStream.get(), inputLine);
+        bContinue = process_input_line(inputLine) != LineResult::ExitRequested;
+    }
+}
 
-        // Empty line: we can skip this iteration as the user hasn't typed
-        // anything.
-        if (inputLine.empty())
-            continue;
+void GreenhouseControllerApplication::run_event_input_loop() {
+    EventLoop& eventLoop{*m_eventLoop};
+    StringType pendingInput{};
 
-        InputStringStream inputLineStream{inputLine};
-        std::vector<StringType> lineTokens{};
-        for (StringType currentToken{}; inputLineStream >> currentToken;)
-            lineTokens.push_back(std::move(currentToken));
+    const auto onInputReadable{[this, &eventLoop, &pendingInput] {
+        std::array<char, INPUT_BUFFER_SIZE> buffer{};
+        const ssize_t bytesRead{::read(m_inputFileDescriptor, buffer.data(), buffer.size())};
+        if (bytesRead < 0 && (errno == EINTR || errno == EAGAIN)) {
+            return;
+        }
 
-        assert(lineTokens.size() > 0);
-        const StringType commandName{lineTokens[0]};
+        if (bytesRead <= 0) {
+            // The input has been closed: the last line may not be terminated.
+            if (!pendingInput.empty()) {
+                process_input_line(pendingInput);
+            }
 
-        // If the user requested to exit the program we can exit the
-        // execution.
-        if (commandName == strings::commands::EXIT) {
-            m_mainLogger->logInfo("EXIT COMMAND ISSUED.");
-            continue;
+            eventLoop.stop();
+            return;
         }
 
-        if (!m_commands.contains(commandName)) {
-            // The user typed an unknown command.
-            m_outputStream.get() << commandName << ": "
-                                 << strings::commands::feedbacks::UNRECOGNIZED_COMMAND << " "
-                                 << strings::commands::feedbacks::TYPE_HELP << std::endl
-                                 << std::endl;
+        pendingInput.append(buffer.data(), static_cast<std::size_t>(bytesRead));
+
+        // The data may contain partial lines: only the complete ones are processed.
+        for (std::size_t lineEnd{pendingInput.find('\n')}; lineEnd != StringType::npos;
+             lineEnd = pendingInput.find('\n')) {
+            const StringType inputLine{pendingInput.substr(0, lineEnd)};
+            pendingInput.erase(0, lineEnd + 1);
+
+            if (process_input_line(inputLine) == LineResult::ExitRequested) {
+                eventLoop.stop();
+                return;
+            }
+
+            print_project_path();
+            m_outputStream.get() << std::flush;
+        }
+    }};
+
+    EventLoop::source_id inputSourceId{};
+    try {
+        inputSourceId = eventLoop.addReadableSource(m_inputFileDescriptor, onInputReadable);
+    } catch (const std::system_error& error) {
+        m_mainLogger->logWarning(StringType{"Unable to watch the input with the event loop: "} +
+                                 error.what() + ". Falling back to the input stream.");
+        run_stream_input_loop();
+        return;
+    }
+
+    print_project_path();
+    m_outputStream.get() << std::flush;
+
+    try {
+        eventLoop.run();
+    } catch (const std::system_error& error) {
+        m_mainLogger->logError(StringType{"The event loop has failed: "} + error.what());
+    }
+
+    eventLoop.removeSource(inputSourceId);
+}
+
+bool GreenhouseControllerApplication::runScript(InputStream& scriptStream,
+                                                ScriptErrorPolicy errorPolicy) noexcept {
+    if (!execute_application_command()) {
+        teardown();
+        return true;
+    }
+
+    std::size_t failedCommandsCount{};
+    std::size_t lineNumber{};
+    for (StringType scriptLine{}; std::getline(scriptStream, scriptLine);) {
+        ++lineNumber;
+
+        const auto firstCharacter{scriptLine.find_first_not_of(" \t\r")};
+        if (firstCharacter == StringType::npos || scriptLine[firstCharacter] == '#') {
             continue;
         }
 
-        try {
-            if (m_commands.at(commandName)->processInputOptions(lineTokens)) {
-                m_commands[commandName]->execute();
-            }
-        } catch (const popl::invalid_option& ioexc) {
-            m_outputStream.get() << "[ERROR] => Invalid option: " << ioexc.what() << std::endl;
+        const LineResult lineResult{process_input_line(scriptLine)};
+        if (lineResult == LineResult::ExitRequested) {
+            break;
         }
 
-        // We add a new line after the command execution so the user feedback
-        // is more clean.
-        m_outputStream.get() << std::endl;
+        if (lineResult == LineResult::Failed) {
+            ++failedCommandsCount;
+
+            const StringType failureMessage{"Script line " + std::to_string(lineNumber) +
+                                            " failed: " + scriptLine};
+            m_outputStream.get() << "[ERROR] => " << failureMessage << std::endl;
+            m_mainLogger->logError(failureMessage);
+
+            if (errorPolicy == ScriptErrorPolicy::FailFast) {
+                break;
+            }
+        }
     }
 
-    m_outputStream.get() << strings::commands::feedbacks::TEARING_DOWN << std::endl;
     m_mainLogger->logInfo(StringType{strings::commands::feedbacks::TEARING_DOWN});
     teardown();
-    m_outputStream.get() << strings::commands::feedbacks::GOODBYE << std::endl;
+
+    return failedCommandsCount == 0;
+}
+
+GreenhouseControllerApplication::LineResult GreenhouseControllerApplication::process_input_line(
+    const StringType& inputLine) {
+    // The line is split into views, so that the empty lines and the exit command don't
+    // allocate anything.
+    const gh_cmd::schema::TokenRange lineTokenRange{gh_cmd::schema::Tokenize(inputLine)};
+
+    // Empty line: we can skip it as the user hasn't typed anything.
+    if (lineTokenRange.empty())
+        return LineResult::Succeeded;
+
+    const std::string_view commandName{*lineTokenRange.begin()};
+
+    // If the user requested to exit the program we can exit the
+    // execution.
+    if (commandName == strings::commands::EXIT) {
+        m_mainLogger->logInfo("EXIT COMMAND ISSUED.");
+        return LineResult::ExitRequested;
+    }
+
+    const auto commandIt{m_commands.find(commandName)};
+    if (commandIt == m_commands.end()) {
+        // The user typed an unknown command.
+        m_outputStream.get() << commandName << ": "
+                             << strings::commands::feedbacks::UNRECOGNIZED_COMMAND << " "
+                             << strings::commands::feedbacks::TYPE_HELP << std::endl
+                             << std::endl;
+        return LineResult::Failed;
+    }
+
+    // The commands parse their options with popl, which needs owned strings.
+    const std::vector<StringType> lineTokens{lineTokenRange.begin(), lineTokenRange.end()};
+
+    bool bSucceeded{};
+    try {
+        if (commandIt->second->processInputOptions(lineTokens)) {
+            bSucceeded = commandIt->second->execute();
+        }
+    } catch (const popl::invalid_option& ioexc) {
+        m_outputStream.get() << "[ERROR] => Invalid option: " << ioexc.what() << std::endl;
+    } catch (const std::exception& exc) {
+        m_outputStream.get() << "[ERROR] => " << exc.what() << std::endl;
+    }
+
+    // We add a new line after the command execution so the user feedback
+    // is more clean.
+    m_outputStream.get() << std::endl;
+    return bSucceeded ? LineResult::Succeeded : LineResult::Failed;
 }
 
 void GreenhouseControllerApplication::addSupportedCommand(
@@ -174,6 +316,12 @@ void GreenhouseControllerApplication::addEmergencyStoppableSystem(
     m_emergencyStoppableSystems.push_back(std::move(system));
 }
 
+void GreenhouseControllerApplication::useEventLoop(EventLoop& eventLoop,
+                                                   int inputFileDescriptor) noexcept {
+    m_eventLoop = &eventLoop;
+    m_inputFileDescriptor = inputFileDescriptor;
+}
+
 void GreenhouseControllerApplication::addTerminableSystem(
     std::shared_ptr<abort_system::TerminableSystem> system) noexcept {
     m_terminableSystems.push_back(std::move(system));
@@ -3,6 +3,7 @@
 #define GREENHOUSE_CONTROLLER_APPLICATION_HPP
 
 #include <application/application.hpp>
+#include <application/event-loop.hpp>
 #include <commands/terminal-command.hpp>
 #include <common/types.hpp>
 #include <gc-project/project-controller.hpp>
@@ -16,6 +17,7 @@
 #include <gh_log/logger.hpp>
 
 // C++ STL
+#include <cstdint>
 #include <functional>
 #include <map>
 #include <memory>
@@ -30,6 +32,16 @@ public:
     using istream_ref = std::reference_wrapper<InputStream>;
     using logger_pointer = std::shared_ptr<gh_log::Logger>;
 
+    //!!
+    //! \brief Tells how a script reacts to a command that fails.
+    //!
+    enum class ScriptErrorPolicy : std::uint8_t {
+        //! The script stops at the first failed command.
+        FailFast,
+        //! The failed commands are reported and the script goes on.
+        ContinueOnError
+    };
+
     GreenhouseControllerApplication(ostream_ref outputStream, istream_ref inputStream,
                                     logger_pointer mainLogger,
                                     gc_project::ProjectController& projectController) noexcept;
@@ -39,6 +51,18 @@ public:
 
     bool processInputOptions(const std::vector<std::string>& inputArgs) noexcept override;
 
+    //!!
+    //! \brief Runs the commands of a script, one per line, through the same dispatcher of the
+    //!  interactive loop but without printing the header and the prompt. Empty lines and the
+    //!  lines starting with '#' are skipped, and an "exit" line ends the script. As in run(),
+    //!  the application command is executed first and the systems are terminated at the end.
+    //!
+    //! \param[in] scriptStream The stream the script is read from.
+    //! \param[in] errorPolicy Whether the script stops at the first failed command.
+    //! \return True if every command of the script succeeded, false otherwise.
+    //!
+    bool runScript(InputStream& scriptStream, ScriptErrorPolicy errorPolicy) noexcept;
+
     //! \brief Adds a command that can be executed during the application loop.
     //!  The command MUST not exist inside the internal pool.
     void addSupportedCommand(std::unique_ptr<TerminalCommandType> command) noexcept;
@@ -53,21 +77,55 @@ public:
         std::shared_ptr<abort_system::EmergencyStoppableSystem> system) noexcept;
     void addTerminableSystem(std::shared_ptr<abort_system::TerminableSystem> system) noexcept;
 
+    //!!
+    //! \brief Makes the application read the user commands from the given file descriptor
+    //!  through the event loop, instead of blocking on the input stream, so that the other
+    //!  sources registered on the loop are dispatched while the user is idle. The application
+    //!  loop ends when the user exits, the input is closed or the event loop is stopped.
+    //!  If the descriptor can't be watched (e.g. it's a regular file) the input stream is used.
+    //!
+    //! \param[in] eventLoop The loop that will be run by the application. It must outlive it.
+    //! \param[in] inputFileDescriptor The descriptor of the input stream, e.g. STDIN_FILENO.
+    //!
+    void useEventLoop(EventLoop& eventLoop, int inputFileDescriptor) noexcept;
+
 private:
     ostream_ref m_outputStream;
     istream_ref m_inputStream;
     logger_pointer m_mainLogger{};
     std::reference_wrapper<gc_project::ProjectController> m_projectController;
 
-    std::map<StringType, std::unique_ptr<TerminalCommandType>> m_commands{};
+    std::map<StringType, std::unique_ptr<TerminalCommandType>, std::less<>> m_commands{};
     std::unique_ptr<TerminalCommandType> m_applicationCommand{};
 
     std::vector<std::shared_ptr<abort_system::EmergencyStoppableSystem>>
         m_emergencyStoppableSystems{};
     std::vector<std::shared_ptr<abort_system::TerminableSystem>> m_terminableSystems{};
 
+    EventLoop* m_eventLoop{};
+    int m_inputFileDescriptor{-1};
+
     bool m_bCanApplicationCommandExecute{};
 
+    enum class LineResult : std::uint8_t { Succeeded, Failed, ExitRequested };
+
+    //!!
+    //! \brief Executes the application command, if the user typed some options.
+    //!
+    //! \return False if the application must not proceed (e.g. the help has been printed).
+    //!
+    bool execute_application_command() noexcept;
+
+    void run_stream_input_loop();
+    void run_event_input_loop();
+
+    //!!
+    //! \brief Executes a command line typed by the user or read from a script.
+    //!
+    //! \return If the command succeeded, failed or requested to exit the application.
+    //!
+    LineResult process_input_line(const StringType& inputLine);
+
     void print_app_header() noexcept;
     void teardown() noexcept;
 
@@ -6,8 +6,7 @@
 
 #include <version/version-numbers.hpp>
 
-#include <project-management/integrity-check/title-integrity-checker.hpp>
-#include <project-management/integrity-check/version-integrity-checker.hpp>
+#include <project-management/integrity-check/project-upgrader-registry.hpp>
 #include <project-management/project-io/project-reader.hpp>
 
 namespace rpi_gc {
@@ -25,9 +24,10 @@ std::optional<gc::project_management::Project> LoadProjectAndCheckIntegrity(
 
     logger.logInfo("Loading project from path: " + projectPath.string());
 
-    // Load the project from the given path.
+    // Load the project from the given path. Top-level sections are parsed only when
+    // a component asks for them, so disabled components don't pay for their sections.
     auto projectReader{
-        gc::project_management::project_io::CreateJsonProjectFileReader(projectPath)};
+        gc::project_management::project_io::CreateLazyJsonProjectFileReader(projectPath)};
 
     Project project{};
     try {
@@ -37,28 +37,20 @@ std::optional<gc::project_management::Project> LoadProjectAndCheckIntegrity(
         return std::nullopt;
     }
 
-    integrity_check::TitleIntegrityChecker titleIntegrityChecker{"unknown-project"};
-    // If the project title need an integrity update we perform it.
-    if (!titleIntegrityChecker.checkIntegrity(project)) {
-        [[maybe_unused]] const bool bRes{titleIntegrityChecker.tryApplyIntegrityFixes(project)};
-    }
-
-    // Custom upgraders
-    std::array<std::unique_ptr<integrity_check::ProjectIntegrityChecker>, 1> upgraders{
-        std::make_unique<gc_project::upgraders::ProjectUpgrader_V1_1ToV1_2>()};
+    // Apply the upgraders. The sections are parsed by their first access, so a malformed
+    // section is reported here if an upgrader touches it, or by the component that loads it.
+    try {
+        const integrity_check::ProjectUpgraderRegistry upgraderRegistry{
+            gc_project::upgraders::CreateProjectUpgraderRegistry()};
 
-    // Apply the upgraders.
-    for (auto& upgrader : upgraders) {
-        if (!upgrader->checkIntegrity(project)) {
-            [[maybe_unused]] const bool bRes{upgrader->tryApplyIntegrityFixes(project)};
+        if (!gc_project::upgraders::UpgradeProject(project, upgraderRegistry,
+                                                   version::getApplicationVersion())) {
+            logger.logError("Unable to upgrade the project to the current version");
+            return std::nullopt;
         }
-    }
-
-    integrity_check::VersionIntegrityChecker versionIntegrityChecker{
-        version::getApplicationVersion()};
-    // If the project version need an integrity update we perform it.
-    if (!versionIntegrityChecker.checkIntegrity(project)) {
-        [[maybe_unused]] const bool bRes{versionIntegrityChecker.tryApplyIntegrityFixes(project)};
+    } catch (const std::exception& e) {
+        logger.logError("Error while trying to upgrade project: " + std::string{e.what()});
+        return std::nullopt;
     }
 
     return project;
@@ -0,0 +1,136 @@
+// Copyright (C) 2023 Andrea Ballestrazzi
+#include <remote/command-client.hpp>
+
+#include <posix-io/system-error.hpp>
+
+// C++ STL
+#include <array>
+#include <cerrno>
+#include <cstring>
+#include <stdexcept>
+#include <system_error>
+
+// POSIX
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+namespace rpi_gc::remote {
+
+namespace {
+
+using gc::posix_io::ThrowSystemError;
+
+} // namespace
+
+CommandClient::~CommandClient() noexcept {
+    disconnect();
+}
+
+void CommandClient::connect(const std::filesystem::path& socketPath) {
+    disconnect();
+
+    sockaddr_un address{};
+    address.sun_family = AF_UNIX;
+
+    const std::string socketPathString{socketPath.string()};
+    if (socketPathString.empty() || socketPathString.size() >= sizeof(address.sun_path)) {
+        throw std::invalid_argument{"The command socket path is empty or too long."};
+    }
+
+    std::memcpy(address.sun_path, socketPathString.c_str(), socketPathString.size() + 1);
+
+    const int clientSocket{::socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0)};
+    if (clientSocket < 0) {
+        ThrowSystemError("socket");
+    }
+
+    if (::connect(clientSocket, reinterpret_cast<const sockaddr*>(&address), sizeof(address)) !=
+        0) {
+        const int error{errno};
+        ::close(clientSocket);
+        errno = error;
+        ThrowSystemError("connect");
+    }
+
+    m_socket = clientSocket;
+}
+
+void CommandClient::disconnect() noexcept {
+    if (m_socket >= 0) {
+        ::close(m_socket);
+        m_socket = -1;
+    }
+
+    m_pendingInput.clear();
+}
+
+StringType CommandClient::execute(std::string_view commandLine) {
+    send(commandLine);
+    return receiveResponse();
+}
+
+void CommandClient::send(std::string_view commandLine) {
+    StringType request{commandLine};
+    request.push_back('\n');
+
+    std::size_t sentSize{};
+    while (sentSize < request.size()) {
+        const ssize_t bytesSent{::send(m_socket, request.data() + sentSize,
+                                       request.size() - sentSize, MSG_NOSIGNAL)};
+        if (bytesSent < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+
+            ThrowSystemError("send");
+        }
+
+        sentSize += static_cast<std::size_t>(bytesSent);
+    }
+}
+
+StringType CommandClient::receiveResponse() {
+    StringType response{};
+    std::size_t lineStart{};
+
+    while (true) {
+        // The response ends with a line containing a single dot, the other lines that start
+        // with a dot have been escaped with an additional one.
+        for (std::size_t lineEnd{m_pendingInput.find('\n', lineStart)};
+             lineEnd != StringType::npos; lineEnd = m_pendingInput.find('\n', lineStart)) {
+            const std::string_view line{m_pendingInput.data() + lineStart, lineEnd - lineStart};
+            lineStart = lineEnd + 1;
+
+            if (line == ".") {
+                m_pendingInput.erase(0, lineStart);
+                return response;
+            }
+
+            response.append(line.starts_with('.') ? line.substr(1) : line);
+            response.push_back('\n');
+        }
+
+        m_pendingInput.erase(0, lineStart);
+        lineStart = 0;
+
+        std::array<char, 4096> buffer{};
+        const ssize_t bytesRead{::recv(m_socket, buffer.data(), buffer.size(), 0)};
+        if (bytesRead < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+
+            ThrowSystemError("recv");
+        }
+
+        if (bytesRead == 0) {
+            throw std::system_error{std::make_error_code(std::errc::connection_reset),
+                                    "The command server has closed the connection"};
+        }
+
+        m_pendingInput.append(buffer.data(), static_cast<std::size_t>(bytesRead));
+    }
+}
+
+} // namespace rpi_gc::remote
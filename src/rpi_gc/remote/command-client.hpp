@@ -0,0 +1,68 @@
+// Copyright (C) 2023 Andrea Ballestrazzi
+#ifndef RPI_GC_COMMAND_CLIENT_HPP
+#define RPI_GC_COMMAND_CLIENT_HPP
+
+#include <common/types.hpp>
+
+// C++ STL
+#include <filesystem>
+#include <string_view>
+
+namespace rpi_gc::remote {
+
+//!!
+//! \brief A blocking client of the CommandServer. The requests can be pipelined by sending
+//!  many command lines before receiving their responses, which arrive in the same order.
+//!
+class CommandClient final {
+public:
+    CommandClient() noexcept = default;
+    ~CommandClient() noexcept;
+
+    CommandClient(const CommandClient&) = delete;
+    CommandClient& operator=(const CommandClient&) = delete;
+
+    //!!
+    //! \brief Connect to a command server.
+    //!
+    //! \throw std::invalid_argument if the path is too long for a Unix domain socket.
+    //! \throw std::system_error if the connection fails.
+    //!
+    void connect(const std::filesystem::path& socketPath);
+    void disconnect() noexcept;
+
+    [[nodiscard]] bool isConnected() const noexcept {
+        return m_socket >= 0;
+    }
+
+    //!!
+    //! \brief Send a command line and wait for its response.
+    //!
+    //! \return The output of the command, without the end of response line.
+    //! \throw std::system_error if the connection fails or is closed by the server.
+    //!
+    StringType execute(std::string_view commandLine);
+
+    //!!
+    //! \brief Send a command line without waiting for its response.
+    //!
+    //! \throw std::system_error if the connection fails.
+    //!
+    void send(std::string_view commandLine);
+
+    //!!
+    //! \brief Wait for the response of the oldest command that has been sent.
+    //!
+    //! \return The output of the command, without the end of response line.
+    //! \throw std::system_error if the connection fails or is closed by the server.
+    //!
+    StringType receiveResponse();
+
+private:
+    int m_socket{-1};
+    StringType m_pendingInput{};
+};
+
+} // namespace rpi_gc::remote
+
+#endif // !RPI_GC_COMMAND_CLIENT_HPP
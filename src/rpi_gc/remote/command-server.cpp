@@ -0,0 +1,212 @@
+// Copyright (C) 2023 Andrea Ballestrazzi
+#include <remote/command-server.hpp>
+
+#include <user-interface/commands-strings.hpp>
+
+#include <gh_cmd/command-schema.hpp>
+
+#include <posix-io/system-error.hpp>
+
+// C++ STL
+#include <cassert>
+#include <cerrno>
+#include <cstring>
+#include <stdexcept>
+#include <string_view>
+#include <utility>
+
+// POSIX
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+namespace rpi_gc::remote {
+
+namespace {
+
+using gc::posix_io::ThrowSystemError;
+
+constexpr std::string_view TOO_MANY_CLIENTS_MESSAGE{"Too many clients, retry later.\n.\n"};
+constexpr std::string_view LINE_TOO_LONG_MESSAGE{"The command line is too long.\n.\n"};
+
+//!!
+//! \brief Appends the output of a command to a response, escaping the lines that start with a
+//!  dot and terminating it with the end of response line.
+//!
+void AppendResponse(StringType& response, std::string_view commandOutput) {
+    bool bLineStart{true};
+    for (const char c : commandOutput) {
+        if (bLineStart && c == '.') {
+            response.push_back('.');
+        }
+
+        response.push_back(c);
+        bLineStart = c == '\n';
+    }
+
+    if (!bLineStart) {
+        response.push_back('\n');
+    }
+
+    response.append(".\n");
+}
+
+} // namespace
+
+CommandServer::CommandServer(EventLoop& eventLoop, commands_factory commandsFactory,
+                             logger_pointer mainLogger, std::size_t maxClientsCount) noexcept
+    : StreamServer{eventLoop, std::move(mainLogger), maxClientsCount, MAX_PENDING_OUTPUT_SIZE,
+                   "command"},
+      m_commandsFactory{std::move(commandsFactory)} {
+    assert(static_cast<bool>(m_commandsFactory));
+}
+
+CommandServer::~CommandServer() noexcept {
+    stop();
+}
+
+void CommandServer::start(const std::filesystem::path& socketPath) {
+    assert(!isListening());
+
+    sockaddr_un address{};
+    address.sun_family = AF_UNIX;
+
+    const std::string socketPathString{socketPath.string()};
+    if (socketPathString.empty() || socketPathString.size() >= sizeof(address.sun_path)) {
+        throw std::invalid_argument{"The command socket path is empty or too long."};
+    }
+
+    std::memcpy(address.sun_path, socketPathString.c_str(), socketPathString.size() + 1);
+
+    // A socket file left by a process that hasn't terminated cleanly would make bind fail.
+    std::error_code errorCode{};
+    if (std::filesystem::is_socket(socketPath, errorCode)) {
+        std::filesystem::remove(socketPath, errorCode);
+    }
+
+    const int listeningSocket{::socket(AF_UNIX, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0)};
+    if (listeningSocket < 0) {
+        ThrowSystemError("socket");
+    }
+
+    const auto closeAndThrow{[listeningSocket](const char* what) {
+        const int error{errno};
+        ::close(listeningSocket);
+        errno = error;
+        ThrowSystemError(what);
+    }};
+
+    if (::bind(listeningSocket, reinterpret_cast<const sockaddr*>(&address), sizeof(address)) !=
+        0) {
+        closeAndThrow("bind");
+    }
+
+    // Only the user and the group of the process can control the greenhouse.
+    ::chmod(socketPathString.c_str(), S_IRUSR | S_IWUSR | S_IRGRP | S_IWGRP);
+
+    if (::listen(listeningSocket, SOMAXCONN) != 0) {
+        ::unlink(socketPathString.c_str());
+        closeAndThrow("listen");
+    }
+
+    try {
+        listen_on(listeningSocket);
+    } catch (...) {
+        ::unlink(socketPathString.c_str());
+        ::close(listeningSocket);
+        throw;
+    }
+
+    m_socketPath = socketPath;
+    get_main_logger()->logInfo("Command server listening on " + socketPathString + ".");
+}
+
+void CommandServer::stop() noexcept {
+    if (!isListening()) {
+        return;
+    }
+
+    stop_listening();
+
+    std::error_code errorCode{};
+    std::filesystem::remove(m_socketPath, errorCode);
+}
+
+auto CommandServer::create_client() -> std::unique_ptr<StreamServer::Client> {
+    auto client{std::make_unique<Client>()};
+    for (command_pointer& command : m_commandsFactory(client->commandOutput)) {
+        const StringType commandName{command->getName()};
+        client->commands.emplace(commandName, std::move(command));
+    }
+
+    return client;
+}
+
+void CommandServer::process_input(StreamServer::Client& streamClient) {
+    auto& client{static_cast<Client&>(streamClient)};
+
+    // The lines are executed in place: the pending input isn't changed by the commands.
+    const std::string_view pendingInput{client.pendingInput};
+    std::size_t lineStart{};
+    for (std::size_t lineEnd{pendingInput.find('\n')};
+         lineEnd != std::string_view::npos && !client.bClosing;
+         lineEnd = pendingInput.find('\n', lineStart)) {
+        execute_line(client, pendingInput.substr(lineStart, lineEnd - lineStart));
+        lineStart = lineEnd + 1;
+    }
+
+    client.pendingInput.erase(0, lineStart);
+    if (client.pendingInput.size() > MAX_LINE_LENGTH) {
+        client.pendingOutput.append(LINE_TOO_LONG_MESSAGE);
+        client.bClosing = true;
+    }
+}
+
+void CommandServer::reject_client(int clientSocket) noexcept {
+    [[maybe_unused]] const ssize_t bytesSent{::send(clientSocket, TOO_MANY_CLIENTS_MESSAGE.data(),
+                                                    TOO_MANY_CLIENTS_MESSAGE.size(),
+                                                    MSG_NOSIGNAL)};
+}
+
+void CommandServer::execute_line(Client& client, std::string_view line) {
+    const gh_cmd::schema::TokenRange lineTokenRange{gh_cmd::schema::Tokenize(line)};
+    if (lineTokenRange.empty()) {
+        AppendResponse(client.pendingOutput, {});
+        return;
+    }
+
+    const std::string_view commandName{*lineTokenRange.begin()};
+    if (commandName == strings::commands::EXIT) {
+        client.bClosing = true;
+        return;
+    }
+
+    client.commandOutput.str({});
+    client.commandOutput.clear();
+
+    const auto commandIt{client.commands.find(commandName)};
+    if (commandIt == client.commands.end()) {
+        client.commandOutput << commandName << ": "
+                             << strings::commands::feedbacks::UNRECOGNIZED_COMMAND << '\n';
+    } else {
+        // The commands parse their options with popl, which needs owned strings.
+        const std::vector<StringType> lineTokens{lineTokenRange.begin(), lineTokenRange.end()};
+
+        try {
+            if (commandIt->second->processInputOptions(lineTokens)) {
+                commandIt->second->execute();
+            }
+        } catch (const popl::invalid_option& ioexc) {
+            client.commandOutput << "[ERROR] => Invalid option: " << ioexc.what() << '\n';
+        } catch (const std::exception& exc) {
+            client.commandOutput << "[ERROR] => " << exc.what() << '\n';
+        }
+
+        ++m_executedCommandsCount;
+    }
+
+    AppendResponse(client.pendingOutput, client.commandOutput.view());
+}
+
+} // namespace rpi_gc::remote
@@ -0,0 +1,115 @@
+// Copyright (C) 2023 Andrea Ballestrazzi
+#ifndef RPI_GC_COMMAND_SERVER_HPP
+#define RPI_GC_COMMAND_SERVER_HPP
+
+#include <application/event-loop.hpp>
+#include <commands/terminal-command.hpp>
+#include <common/types.hpp>
+#include <remote/stream-server.hpp>
+
+#include <gh_log/logger.hpp>
+
+// C++ STL
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <functional>
+#include <map>
+#include <memory>
+#include <ostream>
+#include <sstream>
+#include <string_view>
+#include <vector>
+
+namespace rpi_gc::remote {
+
+//!!
+//! \brief Serves the terminal commands to other processes through a Unix domain socket.
+//!
+//!  The protocol is line based: a client sends a command line, e.g. "status --help", and
+//!  receives the output of the command followed by a line containing a single dot. Output
+//!  lines that start with a dot are escaped with an additional one. The "exit" command
+//!  closes the connection.
+//!
+//!  Every client gets its own instances of the commands, created by the given factory and
+//!  writing to the client output. All the commands are executed on the event loop thread,
+//!  one at a time, so the commands that change the state of the systems are serialized with
+//!  the ones issued by the other clients and through the terminal.
+//!
+class CommandServer final : public StreamServer {
+public:
+    using command_pointer = std::unique_ptr<TerminalCommandType>;
+    using commands_factory = std::function<std::vector<command_pointer>(std::ostream&)>;
+
+    static constexpr std::size_t DEFAULT_MAX_CLIENTS_COUNT{64};
+    //! Clients that send longer lines are disconnected.
+    static constexpr std::size_t MAX_LINE_LENGTH{4096};
+    //! Clients that don't read their responses are disconnected when the output that is still
+    //! waiting to be sent exceeds this size.
+    static constexpr std::size_t MAX_PENDING_OUTPUT_SIZE{1024 * 1024};
+
+    //!!
+    //! \brief Construct a new command server. It doesn't accept any client until it's started.
+    //!
+    //! \param[in] eventLoop The loop that dispatches the clients. It must outlive the server.
+    //! \param[in] commandsFactory The factory of the commands of a client, called once for
+    //!  every new client with the client output stream.
+    //! \param[in] mainLogger The logger of the connections and of the errors.
+    //! \param[in] maxClientsCount The number of clients that can be connected at once.
+    //!
+    CommandServer(EventLoop& eventLoop, commands_factory commandsFactory,
+                  logger_pointer mainLogger,
+                  std::size_t maxClientsCount = DEFAULT_MAX_CLIENTS_COUNT) noexcept;
+
+    ~CommandServer() noexcept;
+
+    CommandServer(const CommandServer&) = delete;
+    CommandServer& operator=(const CommandServer&) = delete;
+
+    //!!
+    //! \brief Start listening on the given socket path. A stale socket left by a previous
+    //!  process is replaced. Must be called on the event loop thread, or before the loop runs.
+    //!
+    //! \param[in] socketPath The path of the socket file.
+    //! \throw std::invalid_argument if the path is too long for a Unix domain socket.
+    //! \throw std::system_error if the socket can't be created.
+    //!
+    void start(const std::filesystem::path& socketPath);
+
+    //!!
+    //! \brief Disconnect all the clients and remove the socket file.
+    //!
+    void stop() noexcept;
+
+    [[nodiscard]] std::uint64_t getExecutedCommandsCount() const noexcept {
+        return m_executedCommandsCount;
+    }
+
+private:
+    struct Client final : StreamServer::Client {
+        OutputStringStream commandOutput{};
+        std::map<StringType, command_pointer, std::less<>> commands{};
+    };
+
+    commands_factory m_commandsFactory;
+    std::filesystem::path m_socketPath{};
+    std::uint64_t m_executedCommandsCount{};
+
+    [[nodiscard]] std::unique_ptr<StreamServer::Client> create_client() override;
+
+    //!!
+    //! \brief Executes the complete command lines of a client.
+    //!
+    void process_input(StreamServer::Client& client) override;
+
+    void reject_client(int clientSocket) noexcept override;
+
+    //!!
+    //! \brief Executes a command line and appends its response to the pending output.
+    //!
+    void execute_line(Client& client, std::string_view line);
+};
+
+} // namespace rpi_gc::remote
+
+#endif // !RPI_GC_COMMAND_SERVER_HPP
@@ -0,0 +1,249 @@
+// Copyright (C) 2023 Andrea Ballestrazzi
+#include <remote/metrics-server.hpp>
+
+#include <posix-io/system-error.hpp>
+
+// C++ STL
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <cctype>
+#include <cerrno>
+#include <charconv>
+#include <string>
+#include <utility>
+
+// POSIX
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+namespace rpi_gc::remote {
+
+namespace {
+
+using gc::posix_io::ThrowSystemError;
+
+constexpr std::string_view HEADER_END{"\r\n\r\n"};
+constexpr std::string_view METRICS_PATH{"/metrics"};
+constexpr std::string_view TEXT_CONTENT_TYPE{"text/plain; charset=utf-8"};
+
+[[nodiscard]] bool EqualsIgnoreCase(std::string_view lhs, std::string_view rhs) noexcept {
+    return std::ranges::equal(lhs, rhs, [](const char l, const char r) {
+        return std::tolower(static_cast<unsigned char>(l)) ==
+               std::tolower(static_cast<unsigned char>(r));
+    });
+}
+
+[[nodiscard]] std::string_view Trim(std::string_view text) noexcept {
+    const std::size_t first{text.find_first_not_of(" \t")};
+    if (first == std::string_view::npos)
+        return {};
+
+    return text.substr(first, text.find_last_not_of(" \t") - first + 1);
+}
+
+//!!
+//! \brief The parts of a request the server needs.
+//!
+struct RequestInfo {
+    std::string_view method{};
+    std::string_view path{};
+    bool bValid{};
+    bool bCloseRequested{};
+};
+
+[[nodiscard]] RequestInfo ParseRequestHeader(std::string_view requestHeader) noexcept {
+    RequestInfo request{};
+
+    const std::size_t requestLineEnd{std::min(requestHeader.find("\r\n"), requestHeader.size())};
+    const std::string_view requestLine{requestHeader.substr(0, requestLineEnd)};
+
+    // Request line: METHOD SP target SP HTTP-version
+    const std::size_t methodEnd{requestLine.find(' ')};
+    const std::size_t targetEnd{requestLine.rfind(' ')};
+    if (methodEnd == std::string_view::npos || targetEnd <= methodEnd + 1)
+        return request;
+
+    const std::string_view target{requestLine.substr(methodEnd + 1, targetEnd - methodEnd - 1)};
+    const std::string_view version{requestLine.substr(targetEnd + 1)};
+    if (!version.starts_with("HTTP/1.") || target.find(' ') != std::string_view::npos)
+        return request;
+
+    request.method = requestLine.substr(0, methodEnd);
+    request.path = target.substr(0, target.find('?'));
+    request.bValid = true;
+
+    // The HTTP/1.0 connections are closed after the response.
+    request.bCloseRequested = version == "HTTP/1.0";
+
+    std::string_view fields{requestHeader.substr(requestLineEnd)};
+    while (!fields.empty()) {
+        fields.remove_prefix(std::min(fields.size(), std::size_t{2}));
+        const std::size_t lineEnd{std::min(fields.find("\r\n"), fields.size())};
+        const std::string_view fieldLine{fields.substr(0, lineEnd)};
+        fields.remove_prefix(lineEnd);
+
+        const std::size_t colonPosition{fieldLine.find(':')};
+        if (colonPosition == std::string_view::npos)
+            continue;
+
+        const std::string_view fieldName{Trim(fieldLine.substr(0, colonPosition))};
+        const std::string_view fieldValue{Trim(fieldLine.substr(colonPosition + 1))};
+
+        if (EqualsIgnoreCase(fieldName, "connection")) {
+            request.bCloseRequested = EqualsIgnoreCase(fieldValue, "close");
+        } else if (EqualsIgnoreCase(fieldName, "transfer-encoding") ||
+                   (EqualsIgnoreCase(fieldName, "content-length") && fieldValue != "0")) {
+            // The request bodies aren't read, so the connection can't be reused.
+            request.bCloseRequested = true;
+        }
+    }
+
+    return request;
+}
+
+void AppendResponse(StringType& output, std::string_view status, std::string_view contentType,
+                    std::string_view body, const bool bIncludeBody, const bool bClose,
+                    std::string_view extraFields = {}) {
+    std::array<char, 24> lengthBuffer{};
+    const auto [lengthEnd, errorCode]{
+        std::to_chars(lengthBuffer.data(), lengthBuffer.data() + lengthBuffer.size(),
+                      body.size())};
+
+    output.append("HTTP/1.1 ").append(status).append("\r\n");
+    output.append("Content-Type: ").append(contentType).append("\r\n");
+    output.append("Content-Length: ").append(lengthBuffer.data(), lengthEnd).append("\r\n");
+    output.append(extraFields);
+    if (bClose)
+        output.append("Connection: close\r\n");
+
+    output.append("\r\n");
+    if (bIncludeBody)
+        output.append(body);
+}
+
+} // namespace
+
+MetricsServer::MetricsServer(EventLoop& eventLoop, const gc::metrics::MetricsRegistry& registry,
+                             logger_pointer mainLogger, std::size_t maxClientsCount) noexcept
+    : StreamServer{eventLoop, std::move(mainLogger), maxClientsCount, MAX_PENDING_OUTPUT_SIZE,
+                   "metrics"},
+      m_exporter{registry} {}
+
+MetricsServer::~MetricsServer() noexcept {
+    stop();
+}
+
+void MetricsServer::start(const port_type port) {
+    assert(!isListening());
+
+    const int listeningSocket{::socket(AF_INET, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0)};
+    if (listeningSocket < 0) {
+        ThrowSystemError("socket");
+    }
+
+    const auto closeAndThrow{[listeningSocket](const char* what) {
+        const int error{errno};
+        ::close(listeningSocket);
+        errno = error;
+        ThrowSystemError(what);
+    }};
+
+    // The port can be reused right after a restart, while the old connections time out.
+    const int reuseAddress{1};
+    ::setsockopt(listeningSocket, SOL_SOCKET, SO_REUSEADDR, &reuseAddress, sizeof(reuseAddress));
+
+    // The metrics are exposed on the loopback interface only: a remote Prometheus reaches
+    // them through a local agent or a tunnel.
+    sockaddr_in address{};
+    address.sin_family = AF_INET;
+    address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    address.sin_port = htons(port);
+
+    if (::bind(listeningSocket, reinterpret_cast<const sockaddr*>(&address), sizeof(address)) !=
+        0) {
+        closeAndThrow("bind");
+    }
+
+    if (::listen(listeningSocket, SOMAXCONN) != 0) {
+        closeAndThrow("listen");
+    }
+
+    socklen_t addressSize{sizeof(address)};
+    if (::getsockname(listeningSocket, reinterpret_cast<sockaddr*>(&address), &addressSize) !=
+        0) {
+        closeAndThrow("getsockname");
+    }
+
+    try {
+        listen_on(listeningSocket);
+    } catch (...) {
+        ::close(listeningSocket);
+        throw;
+    }
+
+    m_port = ntohs(address.sin_port);
+    get_main_logger()->logInfo("Metrics server listening on 127.0.0.1:" + std::to_string(m_port) +
+                          ".");
+}
+
+void MetricsServer::stop() noexcept {
+    stop_listening();
+    m_port = 0;
+}
+
+auto MetricsServer::create_client() -> std::unique_ptr<Client> {
+    return std::make_unique<Client>();
+}
+
+void MetricsServer::process_input(Client& client) {
+    const std::string_view pendingInput{client.pendingInput};
+    std::size_t requestStart{};
+    for (std::size_t headerEnd{pendingInput.find(HEADER_END)};
+         headerEnd != std::string_view::npos && !client.bClosing;
+         headerEnd = pendingInput.find(HEADER_END, requestStart)) {
+        answer_request(client, pendingInput.substr(requestStart, headerEnd - requestStart));
+        requestStart = headerEnd + HEADER_END.size();
+    }
+
+    client.pendingInput.erase(0, requestStart);
+    if (!client.bClosing && client.pendingInput.size() > MAX_REQUEST_SIZE) {
+        AppendResponse(client.pendingOutput, "431 Request Header Fields Too Large",
+                       TEXT_CONTENT_TYPE, {}, true, true);
+        client.bClosing = true;
+    }
+}
+
+void MetricsServer::answer_request(Client& client, std::string_view requestHeader) {
+    const RequestInfo request{ParseRequestHeader(requestHeader)};
+    if (!request.bValid) {
+        AppendResponse(client.pendingOutput, "400 Bad Request", TEXT_CONTENT_TYPE,
+                       "Bad Request\n", true, true);
+        client.bClosing = true;
+        return;
+    }
+
+    client.bClosing = request.bCloseRequested;
+
+    const bool bHead{request.method == "HEAD"};
+    if (request.method != "GET" && !bHead) {
+        AppendResponse(client.pendingOutput, "405 Method Not Allowed", TEXT_CONTENT_TYPE,
+                       "Method Not Allowed\n", true, client.bClosing, "Allow: GET, HEAD\r\n");
+        return;
+    }
+
+    if (request.path != METRICS_PATH) {
+        AppendResponse(client.pendingOutput, "404 Not Found", TEXT_CONTENT_TYPE, "Not Found\n",
+                       !bHead, client.bClosing);
+        return;
+    }
+
+    AppendResponse(client.pendingOutput, "200 OK",
+                   gc::metrics::PrometheusTextExporter::CONTENT_TYPE, m_exporter.render(), !bHead,
+                   client.bClosing);
+    ++m_scrapesCount;
+}
+
+} // namespace rpi_gc::remote
@@ -0,0 +1,106 @@
+// Copyright (C) 2023 Andrea Ballestrazzi
+#ifndef RPI_GC_METRICS_SERVER_HPP
+#define RPI_GC_METRICS_SERVER_HPP
+
+#include <application/event-loop.hpp>
+#include <common/types.hpp>
+#include <remote/stream-server.hpp>
+
+#include <gh_log/logger.hpp>
+
+#include <metrics/metrics-registry.hpp>
+#include <metrics/prometheus-text-exporter.hpp>
+
+// C++ STL
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string_view>
+
+namespace rpi_gc::remote {
+
+//!!
+//! \brief A minimal HTTP/1.1 server that exposes the metrics to Prometheus. It listens on the
+//!  loopback interface only and serves "GET /metrics" (and HEAD) with the metrics rendered in
+//!  the Prometheus text format. The other paths are answered with 404 and the other methods
+//!  with 405. The connections are kept alive unless the client asks to close them.
+//!
+//!  The clients are dispatched on the event loop thread, like the command server ones. The
+//!  metrics are rendered into buffers owned by the server, so a scrape doesn't allocate once
+//!  the buffers have grown.
+//!
+class MetricsServer final : public StreamServer {
+public:
+    using port_type = std::uint16_t;
+
+    static constexpr std::size_t DEFAULT_MAX_CLIENTS_COUNT{8};
+    //! Clients that send longer request headers are answered with 431 and disconnected.
+    static constexpr std::size_t MAX_REQUEST_SIZE{8192};
+    //! Clients that don't read their responses are disconnected when the output that is still
+    //! waiting to be sent exceeds this size.
+    static constexpr std::size_t MAX_PENDING_OUTPUT_SIZE{4 * 1024 * 1024};
+
+    //!!
+    //! \brief Construct a new metrics server. It doesn't accept any client until it's started.
+    //!
+    //! \param[in] eventLoop The loop that dispatches the clients. It must outlive the server.
+    //! \param[in] registry The registry of the exposed metrics. It must outlive the server.
+    //! \param[in] mainLogger The logger of the errors.
+    //! \param[in] maxClientsCount The number of clients that can be connected at once.
+    //!
+    MetricsServer(EventLoop& eventLoop, const gc::metrics::MetricsRegistry& registry,
+                  logger_pointer mainLogger,
+                  std::size_t maxClientsCount = DEFAULT_MAX_CLIENTS_COUNT) noexcept;
+
+    ~MetricsServer() noexcept;
+
+    MetricsServer(const MetricsServer&) = delete;
+    MetricsServer& operator=(const MetricsServer&) = delete;
+
+    //!!
+    //! \brief Start listening on the given loopback port. Must be called on the event loop
+    //!  thread, or before the loop runs.
+    //!
+    //! \param[in] port The TCP port, or zero to let the system choose a free one.
+    //! \throw std::system_error if the socket can't be created or bound.
+    //!
+    void start(port_type port);
+
+    //!!
+    //! \brief Disconnect all the clients and stop listening.
+    //!
+    void stop() noexcept;
+
+    //! \return The port the server is listening on, or zero if it isn't listening.
+    [[nodiscard]] port_type getPort() const noexcept {
+        return m_port;
+    }
+
+    [[nodiscard]] std::uint64_t getScrapesCount() const noexcept {
+        return m_scrapesCount;
+    }
+
+private:
+    gc::metrics::PrometheusTextExporter m_exporter;
+    port_type m_port{};
+    std::uint64_t m_scrapesCount{};
+
+    [[nodiscard]] std::unique_ptr<Client> create_client() override;
+
+    //!!
+    //! \brief Answers the complete requests of a client.
+    //!
+    void process_input(Client& client) override;
+
+    //!!
+    //! \brief Answers a request and appends the response to the pending output.
+    //!
+    //! \param[in] requestHeader The request line and the header fields, without the empty
+    //!  line that ends them.
+    //!
+    void answer_request(Client& client, std::string_view requestHeader);
+};
+
+} // namespace rpi_gc::remote
+
+#endif // !RPI_GC_METRICS_SERVER_HPP
@@ -0,0 +1,193 @@
+// Copyright (C) 2023 Andrea Ballestrazzi
+#include <remote/stream-server.hpp>
+
+// C++ STL
+#include <array>
+#include <cassert>
+#include <cerrno>
+#include <cstring>
+#include <exception>
+#include <utility>
+
+// POSIX
+#include <sys/socket.h>
+#include <unistd.h>
+
+namespace rpi_gc::remote {
+
+StreamServer::StreamServer(EventLoop& eventLoop, logger_pointer mainLogger,
+                           std::size_t maxClientsCount, std::size_t maxPendingOutputSize,
+                           std::string_view clientsName) noexcept
+    : m_eventLoop{eventLoop},
+      m_mainLogger{std::move(mainLogger)},
+      m_maxClientsCount{maxClientsCount},
+      m_maxPendingOutputSize{maxPendingOutputSize},
+      m_clientsName{clientsName} {
+    assert(static_cast<bool>(m_mainLogger));
+}
+
+StreamServer::~StreamServer() noexcept {
+    stop_listening();
+}
+
+void StreamServer::listen_on(int listeningSocket) {
+    assert(!isListening());
+
+    m_listeningSourceId = m_eventLoop.get().addReadableSource(listeningSocket, [this] {
+        accept_clients();
+    });
+
+    m_listeningSocket = listeningSocket;
+}
+
+void StreamServer::stop_listening() noexcept {
+    while (!m_clients.empty()) {
+        close_client(m_clients.begin()->first);
+    }
+
+    if (!isListening()) {
+        return;
+    }
+
+    m_eventLoop.get().removeSource(m_listeningSourceId);
+    ::close(m_listeningSocket);
+    m_listeningSocket = -1;
+}
+
+void StreamServer::accept_clients() {
+    while (true) {
+        const int clientSocket{
+            ::accept4(m_listeningSocket, nullptr, nullptr, SOCK_NONBLOCK | SOCK_CLOEXEC)};
+        if (clientSocket < 0) {
+            if (errno != EAGAIN && errno != EWOULDBLOCK && errno != EINTR) {
+                m_mainLogger->logError(StringType{"Unable to accept a "}
+                                           .append(m_clientsName)
+                                           .append(" client: ")
+                                           .append(std::strerror(errno)));
+            }
+
+            return;
+        }
+
+        if (m_clients.size() >= m_maxClientsCount) {
+            reject_client(clientSocket);
+            ::close(clientSocket);
+            continue;
+        }
+
+        add_client(clientSocket);
+    }
+}
+
+void StreamServer::add_client(int clientSocket) {
+    const client_id clientId{m_nextClientId++};
+
+    try {
+        std::unique_ptr<Client> client{create_client()};
+        client->socket = clientSocket;
+        client->sourceId = m_eventLoop.get().addReadableSource(clientSocket, [this, clientId] {
+            dispatch_client(clientId);
+        });
+
+        m_clients.emplace(clientId, std::move(client));
+    } catch (const std::exception& error) {
+        m_mainLogger->logError(StringType{"Unable to serve a "}
+                                   .append(m_clientsName)
+                                   .append(" client: ")
+                                   .append(error.what()));
+        ::close(clientSocket);
+    }
+}
+
+void StreamServer::close_client(client_id clientId) noexcept {
+    const auto clientIt{m_clients.find(clientId)};
+    if (clientIt == m_clients.end()) {
+        return;
+    }
+
+    m_eventLoop.get().removeSource(clientIt->second->sourceId);
+    ::close(clientIt->second->socket);
+    m_clients.erase(clientIt);
+}
+
+void StreamServer::dispatch_client(client_id clientId) {
+    Client& client{*m_clients.at(clientId)};
+
+    // The output is sent first, as the client may be waiting for it before sending the
+    // next requests.
+    if (!flush_output(client)) {
+        close_client(clientId);
+        return;
+    }
+
+    std::array<char, 4096> buffer{};
+    std::size_t readSize{};
+    while (!client.bClosing && readSize < MAX_READ_SIZE_PER_DISPATCH) {
+        const ssize_t bytesRead{::recv(client.socket, buffer.data(), buffer.size(), 0)};
+        if (bytesRead < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+
+            if (errno == EAGAIN || errno == EWOULDBLOCK) {
+                break;
+            }
+
+            close_client(clientId);
+            return;
+        }
+
+        if (bytesRead == 0) {
+            // The client has closed the connection: its last requests have been processed
+            // already, and nobody would receive their output anyway.
+            close_client(clientId);
+            return;
+        }
+
+        readSize += static_cast<std::size_t>(bytesRead);
+        client.pendingInput.append(buffer.data(), static_cast<std::size_t>(bytesRead));
+        process_input(client);
+    }
+
+    if (!flush_output(client) || client.pendingOutput.size() > m_maxPendingOutputSize) {
+        close_client(clientId);
+        return;
+    }
+
+    if (client.bClosing && client.pendingOutput.empty()) {
+        close_client(clientId);
+        return;
+    }
+
+    const bool bWritableNeeded{!client.pendingOutput.empty()};
+    if (bWritableNeeded != client.bWritableWatched) {
+        m_eventLoop.get().setWritableWatched(client.sourceId, bWritableNeeded);
+        client.bWritableWatched = bWritableNeeded;
+    }
+}
+
+bool StreamServer::flush_output(Client& client) noexcept {
+    std::size_t sentSize{};
+    while (sentSize < client.pendingOutput.size()) {
+        const ssize_t bytesSent{::send(client.socket, client.pendingOutput.data() + sentSize,
+                                       client.pendingOutput.size() - sentSize, MSG_NOSIGNAL)};
+        if (bytesSent < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+
+            if (errno == EAGAIN || errno == EWOULDBLOCK) {
+                break;
+            }
+
+            return false;
+        }
+
+        sentSize += static_cast<std::size_t>(bytesSent);
+    }
+
+    client.pendingOutput.erase(0, sentSize);
+    return true;
+}
+
+} // namespace rpi_gc::remote
@@ -0,0 +1,148 @@
+// Copyright (C) 2023 Andrea Ballestrazzi
+#ifndef RPI_GC_STREAM_SERVER_HPP
+#define RPI_GC_STREAM_SERVER_HPP
+
+#include <application/event-loop.hpp>
+#include <common/types.hpp>
+
+#include <gh_log/logger.hpp>
+
+// C++ STL
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <string_view>
+#include <unordered_map>
+
+namespace rpi_gc::remote {
+
+//!!
+//! \brief Base of the servers that dispatch the clients of a non-blocking stream socket on the
+//!  event loop thread. It accepts the clients, reads their input and sends their output without
+//!  ever blocking the loop: the derived servers only implement their protocol.
+//!
+class StreamServer {
+public:
+    using logger_pointer = std::shared_ptr<gh_log::Logger>;
+
+    //! The maximum amount of data read from a client every time it's dispatched, so that a
+    //! busy client doesn't starve the others.
+    static constexpr std::size_t MAX_READ_SIZE_PER_DISPATCH{64 * 1024};
+
+    StreamServer(const StreamServer&) = delete;
+    StreamServer& operator=(const StreamServer&) = delete;
+
+    [[nodiscard]] bool isListening() const noexcept {
+        return m_listeningSocket >= 0;
+    }
+
+    [[nodiscard]] std::size_t getClientsCount() const noexcept {
+        return m_clients.size();
+    }
+
+protected:
+    //!!
+    //! \brief The connection state of a client. The derived servers extend it with the state
+    //!  of their protocol.
+    //!
+    struct Client {
+        virtual ~Client() noexcept = default;
+
+        int socket{-1};
+        EventLoop::source_id sourceId{};
+        StringType pendingInput{};
+        StringType pendingOutput{};
+        bool bWritableWatched{};
+        bool bClosing{};
+    };
+
+    //!!
+    //! \brief Construct a new stream server that doesn't listen on any socket.
+    //!
+    //! \param[in] eventLoop The loop that dispatches the clients. It must outlive the server.
+    //! \param[in] mainLogger The logger of the errors.
+    //! \param[in] maxClientsCount The number of clients that can be connected at once.
+    //! \param[in] maxPendingOutputSize The clients that don't read their responses are
+    //!  disconnected when the output that is still waiting to be sent exceeds this size.
+    //! \param[in] clientsName The name of the clients in the log messages, e.g. "command".
+    //!
+    StreamServer(EventLoop& eventLoop, logger_pointer mainLogger, std::size_t maxClientsCount,
+                 std::size_t maxPendingOutputSize, std::string_view clientsName) noexcept;
+
+    ~StreamServer() noexcept;
+
+    //!!
+    //! \brief Starts accepting the clients of a listening socket, that is closed by the server
+    //!  from now on.
+    //!
+    //! \param[in] listeningSocket A non-blocking socket that is already listening.
+    //! \throw std::system_error if the socket can't be dispatched by the loop. The socket isn't
+    //!  closed in this case.
+    //!
+    void listen_on(int listeningSocket);
+
+    //!!
+    //! \brief Disconnects all the clients and closes the listening socket.
+    //!
+    void stop_listening() noexcept;
+
+    [[nodiscard]] const logger_pointer& get_main_logger() const noexcept {
+        return m_mainLogger;
+    }
+
+    //!!
+    //! \brief Creates the state of a new client.
+    //!
+    //! \throw std::exception if the client can't be served. The client is disconnected.
+    //!
+    [[nodiscard]] virtual std::unique_ptr<Client> create_client() = 0;
+
+    //!!
+    //! \brief Processes the pending input of a client after new data has been read. The
+    //!  complete requests are removed from the input and their responses appended to the
+    //!  pending output. The client is disconnected once its output is sent if it's closing.
+    //!
+    virtual void process_input(Client& client) = 0;
+
+    //!!
+    //! \brief Called with the socket of a client that is refused because too many clients are
+    //!  connected, right before it's closed.
+    //!
+    virtual void reject_client([[maybe_unused]] int clientSocket) noexcept {}
+
+private:
+    using client_id = std::uint64_t;
+
+    std::reference_wrapper<EventLoop> m_eventLoop;
+    logger_pointer m_mainLogger;
+    std::size_t m_maxClientsCount;
+    std::size_t m_maxPendingOutputSize;
+    std::string_view m_clientsName;
+
+    int m_listeningSocket{-1};
+    EventLoop::source_id m_listeningSourceId{};
+
+    std::unordered_map<client_id, std::unique_ptr<Client>> m_clients{};
+    client_id m_nextClientId{};
+
+    void accept_clients();
+    void add_client(int clientSocket);
+    void close_client(client_id clientId) noexcept;
+
+    //!!
+    //! \brief Reads the available input of a client, processes it and sends the responses.
+    //!
+    void dispatch_client(client_id clientId);
+
+    //!!
+    //! \brief Writes as much pending output as possible without blocking.
+    //!
+    //! \return False if the connection has been lost.
+    //!
+    [[nodiscard]] bool flush_output(Client& client) noexcept;
+};
+
+} // namespace rpi_gc::remote
+
+#endif // !RPI_GC_STREAM_SERVER_HPP
@@ -0,0 +1,187 @@
+// Copyright (c) 2023 Andrea Ballestrazzi
+#include <sensors/sensor-acquisition-pipeline.hpp>
+
+#include <metrics/metrics-registry.hpp>
+
+// C++ STL
+#include <algorithm>
+#include <cassert>
+#include <iterator>
+#include <stdexcept>
+
+namespace rpi_gc::sensors {
+
+namespace {
+
+//!!
+//! \brief The metrics shared by all the sensors. They have no labels, so that hundreds of
+//!  sensors don't make hundreds of metrics.
+//!
+struct SensorAcquisitionMetrics {
+    gc::metrics::Counter& samples;
+    gc::metrics::Counter& readFailures;
+    gc::metrics::Counter& missedSamplings;
+    gc::metrics::Histogram& samplingLateness;
+};
+
+[[nodiscard]] SensorAcquisitionMetrics& GetSensorAcquisitionMetrics() noexcept {
+    static SensorAcquisitionMetrics sensorAcquisitionMetrics{
+        gc::metrics::GetDefaultRegistry().counter("gc_sensor_samples_total",
+                                                  "Number of samples taken from the sensors."),
+        gc::metrics::GetDefaultRegistry().counter("gc_sensor_read_failures_total",
+                                                  "Number of sensor reads that failed."),
+        gc::metrics::GetDefaultRegistry().counter(
+            "gc_sensor_missed_samplings_total",
+            "Number of sensor samplings skipped because the scheduler was late."),
+        gc::metrics::GetDefaultRegistry().histogram(
+            "gc_sensor_sampling_lateness_ns",
+            "Delay between the scheduled sampling time of a sensor and its read.")};
+
+    return sensorAcquisitionMetrics;
+}
+
+} // namespace
+
+SensorAcquisitionPipeline::~SensorAcquisitionPipeline() noexcept {
+    stop();
+}
+
+SensorAcquisitionPipeline::sensor_id SensorAcquisitionPipeline::registerSensor(
+    std::string name, sensor_source_pointer source, const clock_type::duration samplingPeriod,
+    const std::size_t ringCapacity) {
+    assert(!isRunning());
+
+    if (source == nullptr)
+        throw std::invalid_argument{"The sensor " + name + " has no source."};
+
+    if (samplingPeriod <= clock_type::duration::zero())
+        throw std::invalid_argument{"The sampling period of the sensor " + name +
+                                    " must be positive."};
+
+    if (findSensor(name).has_value())
+        throw std::invalid_argument{"A sensor named " + name + " is already registered."};
+
+    m_sensors.push_back(
+        std::make_unique<Sensor>(std::move(name), std::move(source), samplingPeriod, ringCapacity));
+    return m_sensors.size() - 1;
+}
+
+void SensorAcquisitionPipeline::start() {
+    if (isRunning())
+        return;
+
+    m_schedulerThread = std::jthread{[this](std::stop_token stopToken) {
+        run_scheduler(std::move(stopToken));
+    }};
+}
+
+void SensorAcquisitionPipeline::stop() noexcept {
+    if (!isRunning())
+        return;
+
+    m_schedulerThread.request_stop();
+    m_schedulerThread.join();
+}
+
+std::optional<SensorAcquisitionPipeline::sensor_id> SensorAcquisitionPipeline::findSensor(
+    const std::string_view name) const noexcept {
+    const auto sensorIt{std::ranges::find_if(m_sensors, [name](const auto& sensor) {
+        return sensor->name == name;
+    })};
+
+    if (sensorIt == m_sensors.end())
+        return std::nullopt;
+
+    return static_cast<sensor_id>(std::distance(m_sensors.begin(), sensorIt));
+}
+
+const std::string& SensorAcquisitionPipeline::getSensorName(const sensor_id sensorId) const {
+    return m_sensors.at(sensorId)->name;
+}
+
+const SensorSampleRing& SensorAcquisitionPipeline::getSamples(const sensor_id sensorId) const {
+    return m_sensors.at(sensorId)->samples;
+}
+
+std::uint64_t SensorAcquisitionPipeline::getFailedReadsCount(const sensor_id sensorId) const {
+    return m_sensors.at(sensorId)->failedReadsCount.load(std::memory_order_relaxed);
+}
+
+std::uint64_t SensorAcquisitionPipeline::getMissedSamplingsCount(const sensor_id sensorId) const {
+    return m_sensors.at(sensorId)->missedSamplingsCount.load(std::memory_order_relaxed);
+}
+
+void SensorAcquisitionPipeline::run_scheduler(std::stop_token stopToken) noexcept {
+    SensorAcquisitionMetrics& sensorAcquisitionMetrics{GetSensorAcquisitionMetrics()};
+
+    // A min-heap on the sampling time: the front is the next sensor to sample.
+    const auto isLater{[](const ScheduledSampling& lhs, const ScheduledSampling& rhs) {
+        return lhs.samplingTime > rhs.samplingTime;
+    }};
+
+    const clock_type::time_point startTime{clock_type::now()};
+    std::vector<ScheduledSampling> schedule{};
+    schedule.reserve(m_sensors.size());
+    for (sensor_id sensorId{}; sensorId < m_sensors.size(); ++sensorId)
+        schedule.push_back(ScheduledSampling{startTime, sensorId});
+
+    std::ranges::make_heap(schedule, isLater);
+
+    std::unique_lock wakeUpLock{m_wakeUpMutex};
+    while (!schedule.empty() && !stopToken.stop_requested()) {
+        const clock_type::time_point samplingTime{schedule.front().samplingTime};
+        if (clock_type::now() < samplingTime) {
+            // Only the stop request can wake the scheduler before the next sampling.
+            m_wakeUpListener.wait_until(wakeUpLock, stopToken, samplingTime, [] {
+                return false;
+            });
+            continue;
+        }
+
+        std::ranges::pop_heap(schedule, isLater);
+        ScheduledSampling& sampling{schedule.back()};
+        Sensor& sensor{*m_sensors[sampling.sensorId]};
+
+        const clock_type::time_point readTime{clock_type::now()};
+        sensorAcquisitionMetrics.samplingLateness.record(
+            static_cast<gc::metrics::Histogram::value_type>(
+                std::chrono::duration_cast<std::chrono::nanoseconds>(readTime - samplingTime)
+                    .count()));
+        sample_sensor(sensor);
+
+        // A sampling late by less than a period is taken late, while the whole periods the
+        // scheduler is behind are skipped, so that a slow sensor can't starve the others.
+        sampling.samplingTime += sensor.samplingPeriod;
+        const clock_type::time_point now{clock_type::now()};
+        if (sampling.samplingTime < now) {
+            const auto missedSamplingsCount{(now - sampling.samplingTime) / sensor.samplingPeriod};
+            if (missedSamplingsCount > 0) {
+                sampling.samplingTime += missedSamplingsCount * sensor.samplingPeriod;
+                sensor.missedSamplingsCount.fetch_add(
+                    static_cast<std::uint64_t>(missedSamplingsCount), std::memory_order_relaxed);
+                sensorAcquisitionMetrics.missedSamplings.increment(
+                    static_cast<std::uint64_t>(missedSamplingsCount));
+            }
+        }
+
+        std::ranges::push_heap(schedule, isLater);
+    }
+}
+
+void SensorAcquisitionPipeline::sample_sensor(Sensor& sensor) noexcept {
+    const std::optional<gh_hal::hardware_access::SensorSource::value_type> value{
+        sensor.source->read()};
+
+    if (!value.has_value()) {
+        sensor.failedReadsCount.fetch_add(1, std::memory_order_relaxed);
+        GetSensorAcquisitionMetrics().readFailures.increment();
+        return;
+    }
+
+    const auto timestamp{std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::system_clock::now().time_since_epoch())};
+    sensor.samples.push(SensorSample{timestamp.count(), *value});
+    GetSensorAcquisitionMetrics().samples.increment();
+}
+
+} // namespace rpi_gc::sensors
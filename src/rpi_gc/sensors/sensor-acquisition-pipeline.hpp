@@ -0,0 +1,131 @@
+// Copyright (c) 2023 Andrea Ballestrazzi
+#pragma once
+
+#include <sensors/sensor-sample-ring.hpp>
+
+#include <gh_hal/hardware-access/sensor-source.hpp>
+
+// C++ STL
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <stop_token>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace rpi_gc::sensors {
+
+//!!
+//! \brief Samples the registered sensors, each one at its own period, from a single scheduler
+//!  thread. The samples of every sensor are written into its own ring, which the consumers
+//!  (control loops, storage, status) read at their own pace without ever blocking the
+//!  acquisition.
+//!
+//!  The scheduler keeps the sensors in a queue ordered by their next sampling time and sleeps
+//!  until the first one is due. The sampling times are multiples of the period from the start,
+//!  so they don't drift: when a sampling is late, the missed ones are skipped and counted.
+//!
+class SensorAcquisitionPipeline final {
+public:
+    using sensor_source_pointer = std::shared_ptr<gh_hal::hardware_access::SensorSource>;
+    using sensor_id = std::size_t;
+    using clock_type = std::chrono::steady_clock;
+
+    static constexpr std::size_t DEFAULT_RING_CAPACITY{1024};
+
+    SensorAcquisitionPipeline() noexcept = default;
+    ~SensorAcquisitionPipeline() noexcept;
+
+    SensorAcquisitionPipeline(const SensorAcquisitionPipeline&) = delete;
+    SensorAcquisitionPipeline& operator=(const SensorAcquisitionPipeline&) = delete;
+
+    //!!
+    //! \brief Adds a sensor to the sampled ones. Must be called before start().
+    //!
+    //! \param[in] name The unique name of the sensor.
+    //! \param[in] source The sensor to sample.
+    //! \param[in] samplingPeriod The time between two samples.
+    //! \param[in] ringCapacity The number of samples kept for the consumers.
+    //! \return The identifier of the sensor, used to read its samples.
+    //! \throw std::invalid_argument if the name is already used, the source is null or the
+    //!  period is not positive.
+    //!
+    sensor_id registerSensor(std::string name, sensor_source_pointer source,
+                             clock_type::duration samplingPeriod,
+                             std::size_t ringCapacity = DEFAULT_RING_CAPACITY);
+
+    //!!
+    //! \brief Starts the scheduler thread. The first samples are taken immediately.
+    //!
+    void start();
+
+    //!!
+    //! \brief Stops the scheduler thread, waiting for the current read to end.
+    //!
+    void stop() noexcept;
+
+    [[nodiscard]] bool isRunning() const noexcept {
+        return m_schedulerThread.joinable();
+    }
+
+    [[nodiscard]] std::size_t getSensorsCount() const noexcept {
+        return m_sensors.size();
+    }
+
+    //! \return The identifier of the sensor with the given name, if any.
+    [[nodiscard]] std::optional<sensor_id> findSensor(std::string_view name) const noexcept;
+
+    [[nodiscard]] const std::string& getSensorName(sensor_id sensorId) const;
+
+    //!!
+    //! \brief Retrieves the samples of a sensor. The ring can be read from any thread while
+    //!  the pipeline is running.
+    //!
+    [[nodiscard]] const SensorSampleRing& getSamples(sensor_id sensorId) const;
+
+    //! \return The number of reads of the sensor that failed.
+    [[nodiscard]] std::uint64_t getFailedReadsCount(sensor_id sensorId) const;
+
+    //! \return The number of samplings of the sensor that have been skipped for being late.
+    [[nodiscard]] std::uint64_t getMissedSamplingsCount(sensor_id sensorId) const;
+
+private:
+    struct Sensor {
+        Sensor(std::string sensorName, sensor_source_pointer sensorSource,
+               clock_type::duration sensorSamplingPeriod, std::size_t ringCapacity)
+            : name{std::move(sensorName)},
+              source{std::move(sensorSource)},
+              samplingPeriod{sensorSamplingPeriod},
+              samples{ringCapacity} {}
+
+        std::string name{};
+        sensor_source_pointer source{};
+        clock_type::duration samplingPeriod{};
+        SensorSampleRing samples;
+        std::atomic<std::uint64_t> failedReadsCount{};
+        std::atomic<std::uint64_t> missedSamplingsCount{};
+    };
+
+    struct ScheduledSampling {
+        clock_type::time_point samplingTime{};
+        sensor_id sensorId{};
+    };
+
+    std::vector<std::unique_ptr<Sensor>> m_sensors{};
+    std::mutex m_wakeUpMutex{};
+    std::condition_variable_any m_wakeUpListener{};
+    std::jthread m_schedulerThread{};
+
+    void run_scheduler(std::stop_token stopToken) noexcept;
+    void sample_sensor(Sensor& sensor) noexcept;
+};
+
+} // namespace rpi_gc::sensors
@@ -0,0 +1,73 @@
+// Copyright (c) 2023 Andrea Ballestrazzi
+#include <sensors/sensor-sample-ring.hpp>
+
+// C++ STL
+#include <algorithm>
+#include <bit>
+
+namespace rpi_gc::sensors {
+
+SensorSampleRing::SensorSampleRing(const std::size_t capacity)
+    : m_capacityMask{std::bit_ceil(std::max<std::size_t>(capacity, 2)) - 1},
+      m_slots{std::make_unique<Slot[]>(m_capacityMask + 1)} {}
+
+void SensorSampleRing::push(const SensorSample& sample) noexcept {
+    const std::uint64_t position{m_writtenCount.load(std::memory_order_relaxed)};
+    Slot& slot{m_slots[position & m_capacityMask]};
+
+    slot.sequence.store(WRITING_SEQUENCE, std::memory_order_relaxed);
+    // The sample must not be visible before the slot is marked as being written.
+    std::atomic_thread_fence(std::memory_order_release);
+    slot.timestamp.store(sample.timestamp, std::memory_order_relaxed);
+    slot.value.store(sample.value, std::memory_order_relaxed);
+    slot.sequence.store(position + 1, std::memory_order_release);
+
+    m_writtenCount.store(position + 1, std::memory_order_release);
+}
+
+std::optional<SensorSample> SensorSampleRing::getLatest() const noexcept {
+    // The last sample can only be overwritten after another capacity - 1 pushes, so the
+    // retries end unless the consumer is preempted for that long.
+    SensorSample sample{};
+    for (std::uint64_t writtenCount{getWrittenCount()}; writtenCount != 0;
+         writtenCount = getWrittenCount()) {
+        if (try_read(writtenCount - 1, sample))
+            return sample;
+    }
+
+    return std::nullopt;
+}
+
+std::uint64_t SensorSampleRing::readFrom(const std::uint64_t fromPosition,
+                                         std::vector<SensorSample>& samples) const {
+    const std::uint64_t writtenCount{getWrittenCount()};
+    const std::uint64_t oldestPosition{
+        writtenCount > getCapacity() ? writtenCount - getCapacity() : 0};
+
+    SensorSample sample{};
+    for (std::uint64_t position{std::max(fromPosition, oldestPosition)};
+         position < writtenCount; ++position) {
+        // A failed read means that the producer has lapped the consumer: the sample is lost.
+        if (try_read(position, sample))
+            samples.push_back(sample);
+    }
+
+    return std::max(fromPosition, writtenCount);
+}
+
+bool SensorSampleRing::try_read(const std::uint64_t position,
+                                SensorSample& sample) const noexcept {
+    const Slot& slot{m_slots[position & m_capacityMask]};
+
+    if (slot.sequence.load(std::memory_order_acquire) != position + 1)
+        return false;
+
+    sample.timestamp = slot.timestamp.load(std::memory_order_relaxed);
+    sample.value = slot.value.load(std::memory_order_relaxed);
+    // The copy must be complete before the sequence is checked again.
+    std::atomic_thread_fence(std::memory_order_acquire);
+
+    return slot.sequence.load(std::memory_order_relaxed) == position + 1;
+}
+
+} // namespace rpi_gc::sensors
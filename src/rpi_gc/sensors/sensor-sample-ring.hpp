@@ -0,0 +1,95 @@
+// Copyright (c) 2023 Andrea Ballestrazzi
+#pragma once
+
+// C++ STL
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <vector>
+
+namespace rpi_gc::sensors {
+
+//!!
+//! \brief A sample of a sensor.
+//!
+struct SensorSample {
+    //! The milliseconds since the epoch, as the timestamps of the time-series store.
+    std::int64_t timestamp{};
+    double value{};
+
+    [[nodiscard]] friend bool operator==(const SensorSample&, const SensorSample&) noexcept =
+        default;
+};
+
+//!!
+//! \brief A fixed-size ring of the last samples of a sensor, written by a single producer and
+//!  read by any number of consumers. Neither side ever blocks: the producer overwrites the
+//!  oldest samples and a consumer that reads a slot while it's being overwritten retries it,
+//!  or skips it if the producer has already lapped the consumer.
+//!
+//!  Every slot is a sequence lock: the producer marks the slot as being written, writes the
+//!  sample and then publishes its position, so a consumer knows if its copy is consistent.
+//!
+class SensorSampleRing final {
+public:
+    //!!
+    //! \brief Construct a new ring.
+    //!
+    //! \param[in] capacity The number of samples kept by the ring, rounded up to a power of two.
+    //!
+    explicit SensorSampleRing(std::size_t capacity);
+
+    SensorSampleRing(const SensorSampleRing&) = delete;
+    SensorSampleRing& operator=(const SensorSampleRing&) = delete;
+
+    //!!
+    //! \brief Writes a sample, overwriting the oldest one if the ring is full. Only one thread
+    //!  can push into a ring.
+    //!
+    void push(const SensorSample& sample) noexcept;
+
+    //! \return The last written sample, or std::nullopt if no sample has been written.
+    [[nodiscard]] std::optional<SensorSample> getLatest() const noexcept;
+
+    //!!
+    //! \brief Appends the samples written from the given position on, oldest first. The
+    //!  samples that have already been overwritten are lost.
+    //!
+    //! \param[in] fromPosition The position of the first sample to read, i.e. the number of
+    //!  samples written before it.
+    //! \param[out] samples The vector the samples are appended to.
+    //! \return The position of the next sample to read.
+    //!
+    std::uint64_t readFrom(std::uint64_t fromPosition, std::vector<SensorSample>& samples) const;
+
+    //! \return The number of samples written since the ring has been created.
+    [[nodiscard]] std::uint64_t getWrittenCount() const noexcept {
+        return m_writtenCount.load(std::memory_order_acquire);
+    }
+
+    [[nodiscard]] std::size_t getCapacity() const noexcept {
+        return m_capacityMask + 1;
+    }
+
+private:
+    //! The value of a slot sequence while the slot is being written.
+    static constexpr std::uint64_t WRITING_SEQUENCE{0};
+
+    struct Slot {
+        //! The position of the sample plus one, or WRITING_SEQUENCE.
+        std::atomic<std::uint64_t> sequence{WRITING_SEQUENCE};
+        std::atomic<std::int64_t> timestamp{};
+        std::atomic<double> value{};
+    };
+
+    std::size_t m_capacityMask{};
+    std::unique_ptr<Slot[]> m_slots{};
+    std::atomic<std::uint64_t> m_writtenCount{};
+
+    //! \return True if the sample at the given position has been copied.
+    bool try_read(std::uint64_t position, SensorSample& sample) const noexcept;
+};
+
+} // namespace rpi_gc::sensors
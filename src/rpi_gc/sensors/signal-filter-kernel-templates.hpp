@@ -0,0 +1,254 @@
+// Copyright (c) 2023 Andrea Ballestrazzi
+#pragma once
+
+#include <sensors/signal-filter-kernels.hpp>
+#include <sensors/signal-filters.hpp>
+
+// C++ STL
+#include <cstddef>
+
+// The kernels are written once over a set of vector operations and instantiated by every
+// backend unit with its own instruction set. They live in an unnamed namespace so that every
+// unit gets its own copy: otherwise the linker could pick the copy compiled with AVX for the
+// units that run on CPUs without it. For the same reason they use no library function.
+namespace {
+
+// The kernels work on raw blocks of samples with fixed-size local arrays: the bounds are
+// those of the blocks passed by the filters, which check them.
+// NOLINTBEGIN(*-avoid-c-arrays, cppcoreguidelines-pro-bounds-*)
+
+//!!
+//! \brief The vector operations on a single sample, used by the scalar backend and by the
+//!  vector backends for the samples that don't fill a vector.
+//!
+struct ScalarOps {
+    using vector_type = double;
+    using mask_type = bool;
+
+    static constexpr std::size_t WIDTH{1};
+
+    static vector_type load(const double* values) noexcept {
+        return *values;
+    }
+
+    static void store(double* values, const vector_type vector) noexcept {
+        *values = vector;
+    }
+
+    static vector_type broadcast(const double value) noexcept {
+        return value;
+    }
+
+    static vector_type add(const vector_type lhs, const vector_type rhs) noexcept {
+        return lhs + rhs;
+    }
+
+    static vector_type sub(const vector_type lhs, const vector_type rhs) noexcept {
+        return lhs - rhs;
+    }
+
+    static vector_type mul(const vector_type lhs, const vector_type rhs) noexcept {
+        return lhs * rhs;
+    }
+
+    // The operands of min and max are swapped only if rhs < lhs, so that a compare-exchange
+    // always permutes them: a NaN isn't ordered and stays where it is, and a zero keeps its
+    // sign as -0.0 isn't less than 0.0. Every backend must give the same results.
+    static vector_type min(const vector_type lhs, const vector_type rhs) noexcept {
+        return rhs < lhs ? rhs : lhs;
+    }
+
+    static vector_type max(const vector_type lhs, const vector_type rhs) noexcept {
+        return rhs < lhs ? lhs : rhs;
+    }
+
+    static vector_type abs(const vector_type vector) noexcept {
+        return vector < 0.0 ? -vector : vector;
+    }
+
+    static mask_type greater(const vector_type lhs, const vector_type rhs) noexcept {
+        return lhs > rhs;
+    }
+
+    static vector_type select(const mask_type mask, const vector_type ifTrue,
+                              const vector_type ifFalse) noexcept {
+        return mask ? ifTrue : ifFalse;
+    }
+
+    static std::size_t count(const mask_type mask) noexcept {
+        return mask ? 1 : 0;
+    }
+};
+
+//! The number of windows after which the running sum of the moving average is recomputed.
+constexpr std::size_t MOVING_AVERAGE_RESUM_PERIOD{64};
+
+//!!
+//! \brief Computes the differences between the sample that enters a window and the one that
+//!  leaves it, when the window slides by one sample.
+//!
+template <typename Ops>
+void WindowStepsKernel(const double* input, double* steps, const std::size_t count,
+                       const std::size_t windowSize) noexcept {
+    std::size_t i{};
+    for (; i + Ops::WIDTH <= count; i += Ops::WIDTH)
+        Ops::store(steps + i, Ops::sub(Ops::load(input + i + windowSize), Ops::load(input + i)));
+
+    if constexpr (Ops::WIDTH > 1)
+        WindowStepsKernel<ScalarOps>(input + i, steps + i, count - i, windowSize);
+}
+
+template <typename Ops>
+void MovingAverageKernel(const double* input, double* output, const std::size_t count,
+                         const std::size_t windowSize) noexcept {
+    if (count == 0)
+        return;
+
+    // The steps of the running sum are computed with vectors and stored in the output, where
+    // every one is read right before being replaced by its average.
+    WindowStepsKernel<Ops>(input, output, count - 1, windowSize);
+
+    // The division is much slower than the multiplication, so the sums are multiplied by the
+    // reciprocal of the window size.
+    const double reciprocal{1.0 / static_cast<double>(windowSize)};
+
+    // The running sum makes every window O(1), but it's a chain of dependent additions, so it
+    // can't be vectorized. It's recomputed from scratch, oldest sample first, periodically so
+    // that the rounding errors don't accumulate over the stream, and when it isn't finite so
+    // that a NaN or an infinity doesn't outlive the windows that contain it.
+    double sum{};
+    double nextStep{};
+    for (std::size_t i{}; i < count; ++i) {
+        if (i % MOVING_AVERAGE_RESUM_PERIOD == 0 || !(sum - sum == 0.0)) {
+            sum = input[i];
+            for (std::size_t k{1}; k < windowSize; ++k)
+                sum += input[i + k];
+        } else {
+            sum += nextStep;
+        }
+
+        if (i + 1 < count)
+            nextStep = output[i];
+
+        output[i] = sum * reciprocal;
+    }
+}
+
+template <typename Ops>
+double ExponentialSmoothingKernel(const double* input, double* output, const std::size_t count,
+                                  const double smoothingFactor, double previousOutput) noexcept {
+    using vector_type = typename Ops::vector_type;
+    constexpr std::size_t WIDTH{Ops::WIDTH};
+
+    // The recurrence y[i] = d * y[i - 1] + a * x[i], with d = 1 - a, is unrolled over a vector:
+    //  y[i + j] = d^(j + 1) * y[i - 1] + sum_{m <= j} a * d^(j - m) * x[i + m]
+    // so a vector of outputs depends on the previous one only through its last output.
+    const double decay{1.0 - smoothingFactor};
+    double decayPowers[WIDTH + 1];
+    decayPowers[0] = 1.0;
+    for (std::size_t j{1}; j <= WIDTH; ++j)
+        decayPowers[j] = decayPowers[j - 1] * decay;
+
+    double carryFactors[WIDTH];
+    double sampleFactors[WIDTH][WIDTH];
+    for (std::size_t j{}; j < WIDTH; ++j) {
+        carryFactors[j] = decayPowers[j + 1];
+        for (std::size_t m{}; m < WIDTH; ++m)
+            sampleFactors[m][j] = j < m ? 0.0 : smoothingFactor * decayPowers[j - m];
+    }
+
+    const vector_type carryVector{Ops::load(carryFactors)};
+    vector_type sampleVectors[WIDTH];
+    for (std::size_t m{}; m < WIDTH; ++m)
+        sampleVectors[m] = Ops::load(sampleFactors[m]);
+
+    std::size_t i{};
+    for (; i + WIDTH <= count; i += WIDTH) {
+        vector_type outputs{Ops::mul(sampleVectors[0], Ops::broadcast(input[i]))};
+        for (std::size_t m{1}; m < WIDTH; ++m)
+            outputs = Ops::add(outputs, Ops::mul(sampleVectors[m], Ops::broadcast(input[i + m])));
+
+        outputs = Ops::add(outputs, Ops::mul(carryVector, Ops::broadcast(previousOutput)));
+        Ops::store(output + i, outputs);
+        previousOutput = output[i + WIDTH - 1];
+    }
+
+    if constexpr (WIDTH > 1) {
+        return ExponentialSmoothingKernel<ScalarOps>(input + i, output + i, count - i,
+                                                     smoothingFactor, previousOutput);
+    } else {
+        return previousOutput;
+    }
+}
+
+//!!
+//! \brief Computes the medians of the windows starting at the samples of a vector.
+//!
+template <typename Ops>
+typename Ops::vector_type MedianOfWindows(const double* input,
+                                          const std::size_t windowSize) noexcept {
+    typename Ops::vector_type values[rpi_gc::sensors::MedianFilter::MAX_WINDOW_SIZE];
+    for (std::size_t k{}; k < windowSize; ++k)
+        values[k] = Ops::load(input + k);
+
+    // An odd-even transposition sort: windowSize rounds of min/max sort windowSize values
+    // without any branch, so every lane is sorted at once.
+    for (std::size_t round{}; round < windowSize; ++round) {
+        for (std::size_t k{round % 2}; k + 1 < windowSize; k += 2) {
+            const typename Ops::vector_type lower{Ops::min(values[k], values[k + 1])};
+            values[k + 1] = Ops::max(values[k], values[k + 1]);
+            values[k] = lower;
+        }
+    }
+
+    return values[windowSize / 2];
+}
+
+template <typename Ops>
+void MedianKernel(const double* input, double* output, const std::size_t count,
+                  const std::size_t windowSize) noexcept {
+    std::size_t i{};
+    for (; i + Ops::WIDTH <= count; i += Ops::WIDTH)
+        Ops::store(output + i, MedianOfWindows<Ops>(input + i, windowSize));
+
+    if constexpr (Ops::WIDTH > 1)
+        MedianKernel<ScalarOps>(input + i, output + i, count - i, windowSize);
+}
+
+template <typename Ops>
+std::size_t OutlierRejectionKernel(const double* input, double* output, const std::size_t count,
+                                   const std::size_t windowSize,
+                                   const double maxDeviation) noexcept {
+    const typename Ops::vector_type maxDeviationVector{Ops::broadcast(maxDeviation)};
+
+    std::size_t rejectedCount{};
+    std::size_t i{};
+    for (; i + Ops::WIDTH <= count; i += Ops::WIDTH) {
+        const typename Ops::vector_type medians{MedianOfWindows<Ops>(input + i, windowSize)};
+        const typename Ops::vector_type samples{Ops::load(input + i + windowSize - 1)};
+        const typename Ops::mask_type outliers{
+            Ops::greater(Ops::abs(Ops::sub(samples, medians)), maxDeviationVector)};
+
+        Ops::store(output + i, Ops::select(outliers, medians, samples));
+        rejectedCount += Ops::count(outliers);
+    }
+
+    if constexpr (Ops::WIDTH > 1) {
+        rejectedCount += OutlierRejectionKernel<ScalarOps>(input + i, output + i, count - i,
+                                                           windowSize, maxDeviation);
+    }
+
+    return rejectedCount;
+}
+
+//! \return The kernels of the backend with the given vector operations.
+template <typename Ops>
+constexpr rpi_gc::sensors::detail::SignalFilterKernels MakeSignalFilterKernels() noexcept {
+    return rpi_gc::sensors::detail::SignalFilterKernels{
+        &MovingAverageKernel<Ops>, &ExponentialSmoothingKernel<Ops>, &MedianKernel<Ops>,
+        &OutlierRejectionKernel<Ops>};
+}
+
+// NOLINTEND(*-avoid-c-arrays, cppcoreguidelines-pro-bounds-*)
+
+} // namespace
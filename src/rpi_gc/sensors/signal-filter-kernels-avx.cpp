@@ -0,0 +1,92 @@
+// Copyright (c) 2023 Andrea Ballestrazzi
+// This unit is compiled with AVX enabled on x86 (see src/rpi_gc/CMakeLists.txt), so only the
+// AVX kernels must live here: they run only after the CPU has been checked.
+#include <sensors/signal-filter-kernels.hpp>
+
+#ifdef __AVX__
+#include <sensors/signal-filter-kernel-templates.hpp>
+
+// C++ STL
+#include <cstddef>
+
+// Intrinsics
+#include <immintrin.h>
+
+namespace {
+
+struct AvxOps {
+    using vector_type = __m256d;
+    using mask_type = __m256d;
+
+    static constexpr std::size_t WIDTH{4};
+
+    static vector_type load(const double* values) noexcept {
+        return _mm256_loadu_pd(values);
+    }
+
+    static void store(double* values, const vector_type vector) noexcept {
+        _mm256_storeu_pd(values, vector);
+    }
+
+    static vector_type broadcast(const double value) noexcept {
+        return _mm256_set1_pd(value);
+    }
+
+    static vector_type add(const vector_type lhs, const vector_type rhs) noexcept {
+        return _mm256_add_pd(lhs, rhs);
+    }
+
+    static vector_type sub(const vector_type lhs, const vector_type rhs) noexcept {
+        return _mm256_sub_pd(lhs, rhs);
+    }
+
+    static vector_type mul(const vector_type lhs, const vector_type rhs) noexcept {
+        return _mm256_mul_pd(lhs, rhs);
+    }
+
+    // Like minpd, vminpd returns its second operand if the operands are unordered or equal.
+    static vector_type min(const vector_type lhs, const vector_type rhs) noexcept {
+        return _mm256_min_pd(rhs, lhs);
+    }
+
+    static vector_type max(const vector_type lhs, const vector_type rhs) noexcept {
+        return _mm256_max_pd(lhs, rhs);
+    }
+
+    static vector_type abs(const vector_type vector) noexcept {
+        // Clears the sign bits.
+        return _mm256_andnot_pd(_mm256_set1_pd(-0.0), vector);
+    }
+
+    static mask_type greater(const vector_type lhs, const vector_type rhs) noexcept {
+        return _mm256_cmp_pd(lhs, rhs, _CMP_GT_OQ);
+    }
+
+    static vector_type select(const mask_type mask, const vector_type ifTrue,
+                              const vector_type ifFalse) noexcept {
+        return _mm256_blendv_pd(ifFalse, ifTrue, mask);
+    }
+
+    static std::size_t count(const mask_type mask) noexcept {
+        const auto bits{static_cast<unsigned>(_mm256_movemask_pd(mask))};
+        return (bits & 1U) + ((bits >> 1U) & 1U) + ((bits >> 2U) & 1U) + (bits >> 3U);
+    }
+};
+
+constexpr rpi_gc::sensors::detail::SignalFilterKernels AVX_KERNELS{
+    MakeSignalFilterKernels<AvxOps>()};
+
+} // namespace
+#endif // __AVX__
+
+namespace rpi_gc::sensors::detail {
+
+const SignalFilterKernels* GetAvxSignalFilterKernels() noexcept {
+#ifdef __AVX__
+    return &AVX_KERNELS;
+#else
+    return nullptr;
+#endif // __AVX__
+}
+
+} // namespace rpi_gc::sensors::detail
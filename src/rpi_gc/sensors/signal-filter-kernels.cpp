@@ -0,0 +1,179 @@
+// Copyright (c) 2023 Andrea Ballestrazzi
+#include <sensors/signal-filter-kernel-templates.hpp>
+#include <sensors/signal-filter-kernels.hpp>
+
+// C++ STL
+#include <cstddef>
+
+#if defined(__SSE2__)
+#define RPI_GC_SIGNAL_FILTERS_SSE2
+// Intrinsics
+#include <emmintrin.h>
+#endif // __SSE2__
+
+#if defined(__aarch64__) && defined(__ARM_NEON)
+#define RPI_GC_SIGNAL_FILTERS_NEON
+// Intrinsics
+#include <arm_neon.h>
+#endif // __aarch64__ && __ARM_NEON
+
+namespace {
+
+#ifdef RPI_GC_SIGNAL_FILTERS_SSE2
+struct Sse2Ops {
+    using vector_type = __m128d;
+    using mask_type = __m128d;
+
+    static constexpr std::size_t WIDTH{2};
+
+    static vector_type load(const double* values) noexcept {
+        return _mm_loadu_pd(values);
+    }
+
+    static void store(double* values, const vector_type vector) noexcept {
+        _mm_storeu_pd(values, vector);
+    }
+
+    static vector_type broadcast(const double value) noexcept {
+        return _mm_set1_pd(value);
+    }
+
+    static vector_type add(const vector_type lhs, const vector_type rhs) noexcept {
+        return _mm_add_pd(lhs, rhs);
+    }
+
+    static vector_type sub(const vector_type lhs, const vector_type rhs) noexcept {
+        return _mm_sub_pd(lhs, rhs);
+    }
+
+    static vector_type mul(const vector_type lhs, const vector_type rhs) noexcept {
+        return _mm_mul_pd(lhs, rhs);
+    }
+
+    // minpd and maxpd return their second operand if the operands are unordered or equal,
+    // so they are given in the order that matches ScalarOps.
+    static vector_type min(const vector_type lhs, const vector_type rhs) noexcept {
+        return _mm_min_pd(rhs, lhs);
+    }
+
+    static vector_type max(const vector_type lhs, const vector_type rhs) noexcept {
+        return _mm_max_pd(lhs, rhs);
+    }
+
+    static vector_type abs(const vector_type vector) noexcept {
+        // Clears the sign bits.
+        return _mm_andnot_pd(_mm_set1_pd(-0.0), vector);
+    }
+
+    static mask_type greater(const vector_type lhs, const vector_type rhs) noexcept {
+        return _mm_cmpgt_pd(lhs, rhs);
+    }
+
+    static vector_type select(const mask_type mask, const vector_type ifTrue,
+                              const vector_type ifFalse) noexcept {
+        return _mm_or_pd(_mm_and_pd(mask, ifTrue), _mm_andnot_pd(mask, ifFalse));
+    }
+
+    static std::size_t count(const mask_type mask) noexcept {
+        const auto bits{static_cast<unsigned>(_mm_movemask_pd(mask))};
+        return (bits & 1U) + (bits >> 1U);
+    }
+};
+
+constexpr rpi_gc::sensors::detail::SignalFilterKernels SSE2_KERNELS{
+    MakeSignalFilterKernels<Sse2Ops>()};
+#endif // RPI_GC_SIGNAL_FILTERS_SSE2
+
+#ifdef RPI_GC_SIGNAL_FILTERS_NEON
+struct NeonOps {
+    using vector_type = float64x2_t;
+    using mask_type = uint64x2_t;
+
+    static constexpr std::size_t WIDTH{2};
+
+    static vector_type load(const double* values) noexcept {
+        return vld1q_f64(values);
+    }
+
+    static void store(double* values, const vector_type vector) noexcept {
+        vst1q_f64(values, vector);
+    }
+
+    static vector_type broadcast(const double value) noexcept {
+        return vdupq_n_f64(value);
+    }
+
+    static vector_type add(const vector_type lhs, const vector_type rhs) noexcept {
+        return vaddq_f64(lhs, rhs);
+    }
+
+    static vector_type sub(const vector_type lhs, const vector_type rhs) noexcept {
+        return vsubq_f64(lhs, rhs);
+    }
+
+    static vector_type mul(const vector_type lhs, const vector_type rhs) noexcept {
+        return vmulq_f64(lhs, rhs);
+    }
+
+    // vminq_f64 and vmaxq_f64 propagate the NaNs and order -0.0 before 0.0, so the ScalarOps
+    // semantics are built with a comparison instead.
+    static vector_type min(const vector_type lhs, const vector_type rhs) noexcept {
+        return vbslq_f64(vcltq_f64(rhs, lhs), rhs, lhs);
+    }
+
+    static vector_type max(const vector_type lhs, const vector_type rhs) noexcept {
+        return vbslq_f64(vcltq_f64(rhs, lhs), lhs, rhs);
+    }
+
+    static vector_type abs(const vector_type vector) noexcept {
+        return vabsq_f64(vector);
+    }
+
+    static mask_type greater(const vector_type lhs, const vector_type rhs) noexcept {
+        return vcgtq_f64(lhs, rhs);
+    }
+
+    static vector_type select(const mask_type mask, const vector_type ifTrue,
+                              const vector_type ifFalse) noexcept {
+        return vbslq_f64(mask, ifTrue, ifFalse);
+    }
+
+    static std::size_t count(const mask_type mask) noexcept {
+        // Every lane of the mask is either all zeros or all ones.
+        return static_cast<std::size_t>(vgetq_lane_u64(mask, 0) & 1U) +
+               static_cast<std::size_t>(vgetq_lane_u64(mask, 1) & 1U);
+    }
+};
+
+constexpr rpi_gc::sensors::detail::SignalFilterKernels NEON_KERNELS{
+    MakeSignalFilterKernels<NeonOps>()};
+#endif // RPI_GC_SIGNAL_FILTERS_NEON
+
+constexpr rpi_gc::sensors::detail::SignalFilterKernels SCALAR_KERNELS{
+    MakeSignalFilterKernels<ScalarOps>()};
+
+} // namespace
+
+namespace rpi_gc::sensors::detail {
+
+const SignalFilterKernels* GetScalarSignalFilterKernels() noexcept {
+    return &SCALAR_KERNELS;
+}
+
+const SignalFilterKernels* GetSse2SignalFilterKernels() noexcept {
+#ifdef RPI_GC_SIGNAL_FILTERS_SSE2
+    return &SSE2_KERNELS;
+#else
+    return nullptr;
+#endif // RPI_GC_SIGNAL_FILTERS_SSE2
+}
+
+const SignalFilterKernels* GetNeonSignalFilterKernels() noexcept {
+#ifdef RPI_GC_SIGNAL_FILTERS_NEON
+    return &NEON_KERNELS;
+#else
+    return nullptr;
+#endif // RPI_GC_SIGNAL_FILTERS_NEON
+}
+
+} // namespace rpi_gc::sensors::detail
@@ -0,0 +1,54 @@
+// Copyright (c) 2023 Andrea Ballestrazzi
+#pragma once
+
+// C++ STL
+#include <cstddef>
+
+namespace rpi_gc::sensors::detail {
+
+//!!
+//! \brief The block kernels of a backend of the signal filters. The windowed kernels read
+//!  count + windowSize - 1 input samples and compute the output i from the input samples
+//!  i to i + windowSize - 1, the last one being the newest.
+//!
+struct SignalFilterKernels {
+    using moving_average_kernel = void (*)(const double* input, double* output,
+                                           std::size_t count, std::size_t windowSize) noexcept;
+
+    //! Returns the last output, or the previous one if there are no samples.
+    using exponential_smoothing_kernel = double (*)(const double* input, double* output,
+                                                    std::size_t count, double smoothingFactor,
+                                                    double previousOutput) noexcept;
+
+    using median_kernel = void (*)(const double* input, double* output, std::size_t count,
+                                   std::size_t windowSize) noexcept;
+
+    //! Returns the number of rejected samples.
+    using outlier_rejection_kernel = std::size_t (*)(const double* input, double* output,
+                                                     std::size_t count, std::size_t windowSize,
+                                                     double maxDeviation) noexcept;
+
+    moving_average_kernel movingAverage{};
+    exponential_smoothing_kernel exponentialSmoothing{};
+    median_kernel median{};
+    outlier_rejection_kernel outlierRejection{};
+};
+
+//! \return The kernels of the scalar backend.
+[[nodiscard]] const SignalFilterKernels* GetScalarSignalFilterKernels() noexcept;
+
+//! \return The kernels of the SSE2 backend, or nullptr if it hasn't been compiled in.
+[[nodiscard]] const SignalFilterKernels* GetSse2SignalFilterKernels() noexcept;
+
+//!!
+//! \brief Retrieves the kernels of the AVX backend, which are compiled in a unit of their own
+//!  with AVX enabled. The caller must check that the CPU supports AVX before running them.
+//!
+//! \return The kernels, or nullptr if they haven't been compiled in.
+//!
+[[nodiscard]] const SignalFilterKernels* GetAvxSignalFilterKernels() noexcept;
+
+//! \return The kernels of the NEON backend, or nullptr if it hasn't been compiled in.
+[[nodiscard]] const SignalFilterKernels* GetNeonSignalFilterKernels() noexcept;
+
+} // namespace rpi_gc::sensors::detail
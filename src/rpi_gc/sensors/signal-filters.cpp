@@ -0,0 +1,241 @@
+// Copyright (c) 2023 Andrea Ballestrazzi
+#include <sensors/signal-filters.hpp>
+
+#include <sensors/signal-filter-kernels.hpp>
+
+// C++ STL
+#include <algorithm>
+#include <iterator>
+#include <stdexcept>
+#include <string>
+
+namespace rpi_gc::sensors {
+
+namespace {
+
+[[nodiscard]] const detail::SignalFilterKernels* FindKernels(
+    const SignalFilterBackend backend) noexcept {
+    switch (backend) {
+    case SignalFilterBackend::Scalar:
+        return detail::GetScalarSignalFilterKernels();
+    case SignalFilterBackend::Sse2:
+        return detail::GetSse2SignalFilterKernels();
+    case SignalFilterBackend::Avx:
+#if defined(__x86_64__) || defined(__i386__)
+        // The AVX kernels are always compiled in on x86, but not every CPU can run them.
+        if (__builtin_cpu_supports("avx"))
+            return detail::GetAvxSignalFilterKernels();
+#endif // __x86_64__ || __i386__
+        return nullptr;
+    case SignalFilterBackend::Neon:
+        return detail::GetNeonSignalFilterKernels();
+    }
+
+    return nullptr;
+}
+
+[[nodiscard]] const detail::SignalFilterKernels& GetKernels(const SignalFilterBackend backend) {
+    const detail::SignalFilterKernels* const kernels{FindKernels(backend)};
+    if (kernels == nullptr) {
+        throw std::invalid_argument{"The " + std::string{GetSignalFilterBackendName(backend)} +
+                                    " signal filters aren't supported by this CPU."};
+    }
+
+    return *kernels;
+}
+
+void CheckMedianWindowSize(const std::size_t windowSize) {
+    if (windowSize % 2 == 0 || windowSize > MedianFilter::MAX_WINDOW_SIZE) {
+        throw std::invalid_argument{"The median window must be odd and not greater than " +
+                                    std::to_string(MedianFilter::MAX_WINDOW_SIZE) + "."};
+    }
+}
+
+void CheckBlockSizes(const std::span<const double> input, const std::span<double> output) {
+    if (output.size() < input.size())
+        throw std::invalid_argument{"The output block is smaller than the input one."};
+}
+
+//!!
+//! \brief Runs a windowed kernel over a block. The windows of the first samples of the block
+//!  start in the history, so they are built in the head buffer; the other ones are read
+//!  straight from the input. The history is then updated with the last samples.
+//!
+//! \param[in] input The samples of the block.
+//! \param[out] output The filtered samples.
+//! \param[in, out] history The last windowSize - 1 samples of the previous blocks.
+//! \param[in, out] headSamples A buffer of 2 * (windowSize - 1) samples.
+//! \param[in] kernel The kernel, called with the windows, the output and the samples count.
+//!
+template <typename Kernel>
+void RunWindowedKernel(const std::span<const double> input, const std::span<double> output,
+                       std::vector<double>& history, std::vector<double>& headSamples,
+                       const Kernel& kernel) {
+    const std::size_t historySize{history.size()};
+    const std::size_t headCount{std::min(historySize, input.size())};
+
+    std::ranges::copy(history, headSamples.begin());
+    std::ranges::copy(input.first(headCount), headSamples.begin() + historySize);
+    kernel(headSamples.data(), output.data(), headCount);
+
+    if (input.size() > historySize) {
+        kernel(input.data(), output.subspan(historySize).data(), input.size() - historySize);
+        std::ranges::copy(input.last(historySize), history.begin());
+    } else {
+        // The new history is the end of the old one followed by the whole block.
+        std::copy_n(headSamples.begin() + input.size(), historySize, history.begin());
+    }
+}
+
+} // namespace
+
+bool IsSignalFilterBackendSupported(const SignalFilterBackend backend) noexcept {
+    return FindKernels(backend) != nullptr;
+}
+
+SignalFilterBackend GetBestSignalFilterBackend() noexcept {
+    for (const SignalFilterBackend backend :
+         {SignalFilterBackend::Avx, SignalFilterBackend::Neon, SignalFilterBackend::Sse2}) {
+        if (IsSignalFilterBackendSupported(backend))
+            return backend;
+    }
+
+    return SignalFilterBackend::Scalar;
+}
+
+std::string_view GetSignalFilterBackendName(const SignalFilterBackend backend) noexcept {
+    switch (backend) {
+    case SignalFilterBackend::Scalar:
+        return "scalar";
+    case SignalFilterBackend::Sse2:
+        return "SSE2";
+    case SignalFilterBackend::Avx:
+        return "AVX";
+    case SignalFilterBackend::Neon:
+        return "NEON";
+    }
+
+    return "unknown";
+}
+
+void ExtractSampleValues(const std::span<const SensorSample> samples,
+                         std::vector<double>& values) {
+    values.reserve(values.size() + samples.size());
+    std::ranges::transform(samples, std::back_inserter(values),
+                           [](const SensorSample& sample) { return sample.value; });
+}
+
+MovingAverageFilter::MovingAverageFilter(const std::size_t windowSize,
+                                         const SignalFilterBackend backend)
+    : m_kernels{GetKernels(backend)},
+      m_windowSize{windowSize} {
+    if (m_windowSize == 0)
+        throw std::invalid_argument{"The moving average window can't be empty."};
+
+    m_history.resize(m_windowSize - 1);
+    m_headSamples.resize(2 * (m_windowSize - 1));
+}
+
+void MovingAverageFilter::process(const std::span<const double> input,
+                                  const std::span<double> output) {
+    CheckBlockSizes(input, output);
+    if (input.empty())
+        return;
+
+    if (!m_bPrimed) {
+        std::ranges::fill(m_history, input.front());
+        m_bPrimed = true;
+    }
+
+    RunWindowedKernel(input, output, m_history, m_headSamples,
+                      [this](const double* windows, double* outputs, const std::size_t count) {
+                          m_kernels.movingAverage(windows, outputs, count, m_windowSize);
+                      });
+}
+
+ExponentialSmoothingFilter::ExponentialSmoothingFilter(const double smoothingFactor,
+                                                       const SignalFilterBackend backend)
+    : m_kernels{GetKernels(backend)},
+      m_smoothingFactor{smoothingFactor} {
+    if (!(m_smoothingFactor > 0.0 && m_smoothingFactor <= 1.0))
+        throw std::invalid_argument{"The smoothing factor must be in (0, 1]."};
+}
+
+void ExponentialSmoothingFilter::process(const std::span<const double> input,
+                                         const std::span<double> output) {
+    CheckBlockSizes(input, output);
+    if (input.empty())
+        return;
+
+    if (!m_bPrimed) {
+        m_lastOutput = input.front();
+        m_bPrimed = true;
+    }
+
+    m_lastOutput = m_kernels.exponentialSmoothing(input.data(), output.data(), input.size(),
+                                                  m_smoothingFactor, m_lastOutput);
+}
+
+MedianFilter::MedianFilter(const std::size_t windowSize, const SignalFilterBackend backend)
+    : m_kernels{GetKernels(backend)},
+      m_windowSize{windowSize} {
+    CheckMedianWindowSize(m_windowSize);
+
+    m_history.resize(m_windowSize - 1);
+    m_headSamples.resize(2 * (m_windowSize - 1));
+}
+
+void MedianFilter::process(const std::span<const double> input, const std::span<double> output) {
+    CheckBlockSizes(input, output);
+    if (input.empty())
+        return;
+
+    if (!m_bPrimed) {
+        std::ranges::fill(m_history, input.front());
+        m_bPrimed = true;
+    }
+
+    RunWindowedKernel(input, output, m_history, m_headSamples,
+                      [this](const double* windows, double* outputs, const std::size_t count) {
+                          m_kernels.median(windows, outputs, count, m_windowSize);
+                      });
+}
+
+OutlierRejectionFilter::OutlierRejectionFilter(const std::size_t windowSize,
+                                               const double maxDeviation,
+                                               const SignalFilterBackend backend)
+    : m_kernels{GetKernels(backend)},
+      m_windowSize{windowSize},
+      m_maxDeviation{maxDeviation} {
+    CheckMedianWindowSize(m_windowSize);
+    if (!(m_maxDeviation >= 0.0))
+        throw std::invalid_argument{"The maximum deviation can't be negative."};
+
+    m_history.resize(m_windowSize - 1);
+    m_headSamples.resize(2 * (m_windowSize - 1));
+}
+
+std::size_t OutlierRejectionFilter::process(const std::span<const double> input,
+                                            const std::span<double> output) {
+    CheckBlockSizes(input, output);
+    if (input.empty())
+        return 0;
+
+    if (!m_bPrimed) {
+        std::ranges::fill(m_history, input.front());
+        m_bPrimed = true;
+    }
+
+    std::size_t rejectedCount{};
+    RunWindowedKernel(input, output, m_history, m_headSamples,
+                      [this, &rejectedCount](const double* windows, double* outputs,
+                                             const std::size_t count) {
+                          rejectedCount += m_kernels.outlierRejection(windows, outputs, count,
+                                                                      m_windowSize,
+                                                                      m_maxDeviation);
+                      });
+
+    return rejectedCount;
+}
+
+} // namespace rpi_gc::sensors
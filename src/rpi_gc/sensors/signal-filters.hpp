@@ -0,0 +1,214 @@
+// Copyright (c) 2023 Andrea Ballestrazzi
+#pragma once
+
+#include <sensors/sensor-sample-ring.hpp>
+
+// C++ STL
+#include <cstddef>
+#include <span>
+#include <string_view>
+#include <vector>
+
+namespace rpi_gc::sensors {
+
+namespace detail {
+struct SignalFilterKernels;
+} // namespace detail
+
+//!!
+//! \brief The instruction sets the signal filters can run on.
+//!
+enum class SignalFilterBackend {
+    //! Plain C++, available everywhere.
+    Scalar,
+    //! Two samples per instruction, available on every x86_64 CPU.
+    Sse2,
+    //! Four samples per instruction, on the x86_64 CPUs that support it.
+    Avx,
+    //! Two samples per instruction, available on every aarch64 CPU (Raspberry Pi 3 and later
+    //! with a 64-bit OS).
+    Neon
+};
+
+//! \return True if the backend has been compiled in and the CPU supports it.
+[[nodiscard]] bool IsSignalFilterBackendSupported(SignalFilterBackend backend) noexcept;
+
+//! \return The fastest backend supported by the CPU.
+[[nodiscard]] SignalFilterBackend GetBestSignalFilterBackend() noexcept;
+
+[[nodiscard]] std::string_view GetSignalFilterBackendName(SignalFilterBackend backend) noexcept;
+
+//!!
+//! \brief Appends the values of the given samples, as read from a SensorSampleRing, to a
+//!  vector, so that a block of samples can be filtered at once.
+//!
+void ExtractSampleValues(std::span<const SensorSample> samples, std::vector<double>& values);
+
+//!!
+//! \brief The moving average of the last samples. The filter keeps its history between
+//!  the blocks, so filtering a signal block by block gives the same result as filtering it at
+//!  once, up to the rounding of the running sum. Before the window is full, the missing samples
+//!  are taken equal to the first one. A NaN sample makes NaN only the averages of the windows
+//!  that contain it.
+//!
+class MovingAverageFilter final {
+public:
+    //!!
+    //! \brief Construct a new moving average filter.
+    //!
+    //! \param[in] windowSize The number of samples averaged.
+    //! \param[in] backend The instruction set used by the filter.
+    //! \throw std::invalid_argument If the window is empty or the backend isn't supported.
+    //!
+    explicit MovingAverageFilter(std::size_t windowSize,
+                                 SignalFilterBackend backend = GetBestSignalFilterBackend());
+
+    //!!
+    //! \brief Filters a block of samples.
+    //!
+    //! \param[in] input The samples, which must not overlap the output.
+    //! \param[out] output The filtered samples, as many as the input ones.
+    //! \throw std::invalid_argument If the output is smaller than the input.
+    //!
+    void process(std::span<const double> input, std::span<double> output);
+
+    //! \brief Forgets the history, as if no sample had been filtered.
+    void reset() noexcept {
+        m_bPrimed = false;
+    }
+
+private:
+    const detail::SignalFilterKernels& m_kernels;
+    std::size_t m_windowSize{};
+    std::vector<double> m_history{};
+    std::vector<double> m_headSamples{};
+    bool m_bPrimed{};
+};
+
+//!!
+//! \brief The exponential smoothing of the samples: every output moves from the previous one
+//!  towards the new sample by the smoothing factor. The first output is the first sample.
+//!
+class ExponentialSmoothingFilter final {
+public:
+    //!!
+    //! \brief Construct a new exponential smoothing filter.
+    //!
+    //! \param[in] smoothingFactor The weight of the new sample, in (0, 1].
+    //! \param[in] backend The instruction set used by the filter.
+    //! \throw std::invalid_argument If the factor is out of range or the backend isn't
+    //!  supported.
+    //!
+    explicit ExponentialSmoothingFilter(double smoothingFactor,
+                                        SignalFilterBackend backend = GetBestSignalFilterBackend());
+
+    //!!
+    //! \brief Filters a block of samples.
+    //!
+    //! \param[in] input The samples.
+    //! \param[out] output The filtered samples, as many as the input ones.
+    //! \throw std::invalid_argument If the output is smaller than the input.
+    //!
+    void process(std::span<const double> input, std::span<double> output);
+
+    //! \brief Forgets the last output, as if no sample had been filtered.
+    void reset() noexcept {
+        m_bPrimed = false;
+    }
+
+private:
+    const detail::SignalFilterKernels& m_kernels;
+    double m_smoothingFactor{};
+    double m_lastOutput{};
+    bool m_bPrimed{};
+};
+
+//!!
+//! \brief The median of the last samples, which removes the spikes shorter than half the
+//!  window without smoothing the steps. Before the window is full, the missing samples are
+//!  taken equal to the first one. A NaN sample isn't ordered with the others, so the medians
+//!  of the windows that contain it are one of their samples, the same on every backend.
+//!
+class MedianFilter final {
+public:
+    //! The largest window supported by the median kernels.
+    static constexpr std::size_t MAX_WINDOW_SIZE{15};
+
+    //!!
+    //! \brief Construct a new median filter.
+    //!
+    //! \param[in] windowSize The number of samples the median is taken of, odd and not
+    //!  greater than MAX_WINDOW_SIZE.
+    //! \param[in] backend The instruction set used by the filter.
+    //! \throw std::invalid_argument If the window is invalid or the backend isn't supported.
+    //!
+    explicit MedianFilter(std::size_t windowSize,
+                          SignalFilterBackend backend = GetBestSignalFilterBackend());
+
+    //!!
+    //! \brief Filters a block of samples.
+    //!
+    //! \param[in] input The samples, which must not overlap the output.
+    //! \param[out] output The filtered samples, as many as the input ones.
+    //! \throw std::invalid_argument If the output is smaller than the input.
+    //!
+    void process(std::span<const double> input, std::span<double> output);
+
+    //! \brief Forgets the history, as if no sample had been filtered.
+    void reset() noexcept {
+        m_bPrimed = false;
+    }
+
+private:
+    const detail::SignalFilterKernels& m_kernels;
+    std::size_t m_windowSize{};
+    std::vector<double> m_history{};
+    std::vector<double> m_headSamples{};
+    bool m_bPrimed{};
+};
+
+//!!
+//! \brief Replaces the samples that are further than a maximum deviation from the median of
+//!  the last samples with that median, and keeps the others as they are. Unlike the median
+//!  filter, the valid samples aren't changed.
+//!
+class OutlierRejectionFilter final {
+public:
+    //!!
+    //! \brief Construct a new outlier rejection filter.
+    //!
+    //! \param[in] windowSize The number of samples the median is taken of, odd and not
+    //!  greater than MedianFilter::MAX_WINDOW_SIZE.
+    //! \param[in] maxDeviation The largest distance from the median of a valid sample.
+    //! \param[in] backend The instruction set used by the filter.
+    //! \throw std::invalid_argument If the window or the deviation are invalid or the backend
+    //!  isn't supported.
+    //!
+    OutlierRejectionFilter(std::size_t windowSize, double maxDeviation,
+                           SignalFilterBackend backend = GetBestSignalFilterBackend());
+
+    //!!
+    //! \brief Filters a block of samples.
+    //!
+    //! \param[in] input The samples, which must not overlap the output.
+    //! \param[out] output The filtered samples, as many as the input ones.
+    //! \return The number of rejected samples.
+    //! \throw std::invalid_argument If the output is smaller than the input.
+    //!
+    std::size_t process(std::span<const double> input, std::span<double> output);
+
+    //! \brief Forgets the history, as if no sample had been filtered.
+    void reset() noexcept {
+        m_bPrimed = false;
+    }
+
+private:
+    const detail::SignalFilterKernels& m_kernels;
+    std::size_t m_windowSize{};
+    double m_maxDeviation{};
+    std::vector<double> m_history{};
+    std::vector<double> m_headSamples{};
+    bool m_bPrimed{};
+};
+
+} // namespace rpi_gc::sensors
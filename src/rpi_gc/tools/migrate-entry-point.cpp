@@ -0,0 +1,104 @@
+// Copyright (c) 2023 Andrea Ballestrazzi
+#include <gc-project/migration/bulk-project-migrator.hpp>
+#include <gc-project/upgraders/project-upgraders.hpp>
+
+#include <version/version-numbers.hpp>
+
+#include <common/types.hpp>
+#include <gh_cmd/gh_cmd.hpp>
+
+// C++ STL
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <filesystem>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <optional>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace {
+
+void PrintReport(const rpi_gc::gc_project::migration::MigrationReport& report,
+                 std::ostream& outputStream) {
+    constexpr double BYTES_PER_MEGABYTE{1024.0 * 1024.0};
+    const double elapsedSeconds{std::chrono::duration<double>{report.elapsedTime}.count()};
+
+    outputStream << "Processed projects: " << report.getProcessedProjects() << '\n';
+    outputStream << "  migrated:   " << report.migratedProjects << '\n';
+    outputStream << "  up to date: " << report.upToDateProjects << '\n';
+    outputStream << "  failed:     " << report.failures.size() << '\n';
+    outputStream << std::fixed << std::setprecision(2);
+    outputStream << "Elapsed time: " << elapsedSeconds << " s\n";
+    outputStream << "Throughput: " << report.getProjectsPerSecond() << " projects/s, "
+                 << report.getBytesPerSecond() / BYTES_PER_MEGABYTE << " MB/s\n";
+
+    for (const auto& failure : report.failures)
+        outputStream << "FAILED " << failure.projectPath.string() << ": " << failure.reason
+                     << '\n';
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    using namespace rpi_gc;
+    using DefaultOptionParser = gh_cmd::DefaultOptionParser<CharType>;
+
+    DefaultOptionParser optionParser{"rpi_gc_migrate [OPTIONS] <projects-directory>"};
+
+    const auto helpSwitch{
+        std::make_shared<gh_cmd::Switch<CharType>>('h', "help", "Displays this help page.")};
+    const auto outputOption{std::make_shared<gh_cmd::Value<CharType, StringType>>(
+        'o', "output",
+        "Writes the migrated projects inside the given directory instead of "
+        "migrating them in place.")};
+    const auto jobsOption{std::make_shared<gh_cmd::Value<CharType, std::uint32_t>>(
+        'j', "jobs", "Sets the number of worker threads. Defaults to the number of cores.")};
+
+    optionParser.addSwitch(helpSwitch);
+    optionParser.addOption(outputOption);
+    optionParser.addOption(jobsOption);
+
+    try {
+        optionParser.parse(std::vector<StringType>{argv, argv + argc});
+    } catch (const std::exception& e) {
+        std::cerr << e.what() << '\n';
+        optionParser.printHelp(std::cerr);
+        return 1;
+    }
+
+    const std::vector<StringType> arguments{optionParser.getNonOptionArguments()};
+    if (helpSwitch->isSet() || arguments.size() != 1) {
+        optionParser.printHelp(std::cout);
+        return helpSwitch->isSet() ? 0 : 1;
+    }
+
+    std::optional<std::filesystem::path> outputDirectory{};
+    if (outputOption->isSet())
+        outputDirectory = outputOption->value();
+
+    // The gh_cmd values don't keep their default after parsing, so the default is resolved here.
+    const std::size_t workersCount{jobsOption->isSet() ? jobsOption->value()
+                                                       : std::thread::hardware_concurrency()};
+
+    const auto upgraderRegistry{gc_project::upgraders::CreateProjectUpgraderRegistry()};
+    const gc_project::migration::BulkProjectMigrator migrator{
+        upgraderRegistry, version::getApplicationVersion(), workersCount};
+
+    gc_project::migration::MigrationReport report{};
+    try {
+        report = migrator.migrateDirectory(std::filesystem::path{arguments.front()},
+                                           outputDirectory);
+    } catch (const std::exception& e) {
+        std::cerr << "Unable to migrate the projects: " << e.what() << '\n';
+        return 1;
+    }
+
+    PrintReport(report, std::cout);
+
+    return report.failures.empty() ? 0 : 2;
+}
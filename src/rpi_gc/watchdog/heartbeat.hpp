@@ -0,0 +1,75 @@
+// Copyright (c) 2023 Andrea Ballestrazzi
+#pragma once
+
+// C++ STL
+#include <atomic>
+#include <chrono>
+#include <limits>
+
+namespace rpi_gc::watchdog {
+
+//!!
+//! \brief The heartbeat of a long-running worker, written by the worker and read by the
+//!  watchdog supervisor. It's a single atomic timestamp, so beating costs a clock read and a
+//!  relaxed store and never blocks.
+//!
+//!  Instead of the time of the last beat, the heartbeat stores the time until which the
+//!  worker is allowed to be silent: the worker can announce a long wait without waking up
+//!  to beat during it.
+//!
+class Heartbeat final {
+public:
+    using clock_type = std::chrono::steady_clock;
+
+    //!!
+    //! \brief Signals that the worker is alive. The worker must beat again before the timeout
+    //!  of the supervisor elapses.
+    //!
+    void beat() noexcept {
+        beatFor(clock_type::duration::zero());
+    }
+
+    //!!
+    //! \brief Signals that the worker is alive and that it won't beat for the given time,
+    //!  e.g. because it's going to wait.
+    //!
+    //! \param silenceTime The time after which the timeout of the supervisor starts elapsing.
+    //!
+    void beatFor(const clock_type::duration silenceTime) noexcept {
+        m_silentUntil.store((clock_type::now() + silenceTime).time_since_epoch().count(),
+                            std::memory_order_relaxed);
+    }
+
+    //!!
+    //! \brief Signals that the worker has stopped: it isn't supervised until it beats again.
+    //!
+    void stop() noexcept {
+        m_silentUntil.store(STOPPED, std::memory_order_relaxed);
+    }
+
+    //!!
+    //! \brief Checks whether the worker has been silent for longer than it announced.
+    //!
+    //! \param now The current time.
+    //! \param timeout The time the worker can be late before being considered hung.
+    //! \return True if the worker is running and the timeout has elapsed.
+    //!
+    [[nodiscard]] bool isOverdue(const clock_type::time_point now,
+                                 const clock_type::duration timeout) const noexcept {
+        const clock_type::rep silentUntil{getSilentUntil()};
+        return silentUntil != STOPPED &&
+               now.time_since_epoch().count() - silentUntil > timeout.count();
+    }
+
+    //! \return The raw time until which the worker can be silent, which changes at every beat.
+    [[nodiscard]] clock_type::rep getSilentUntil() const noexcept {
+        return m_silentUntil.load(std::memory_order_relaxed);
+    }
+
+private:
+    static constexpr clock_type::rep STOPPED{std::numeric_limits<clock_type::rep>::max()};
+
+    std::atomic<clock_type::rep> m_silentUntil{STOPPED};
+};
+
+} // namespace rpi_gc::watchdog
@@ -0,0 +1,122 @@
+// Copyright (c) 2023 Andrea Ballestrazzi
+#include <watchdog/watchdog-supervisor.hpp>
+
+#include <common/types.hpp>
+#include <metrics/metrics-registry.hpp>
+
+// C++ STL
+#include <algorithm>
+#include <cassert>
+#include <string_view>
+#include <utility>
+
+namespace rpi_gc::watchdog {
+
+namespace {
+
+constexpr std::string_view WATCHDOG_LOG_PREFIX{"[Watchdog] "};
+
+//!!
+//! \brief Gets the trips counter, registering it the first time.
+//!
+//! \throws std::invalid_argument if a metric with the same name is already registered with
+//!  another kind.
+[[nodiscard]] gc::metrics::Counter& GetWatchdogTripsCounter() {
+    static gc::metrics::Counter& watchdogTripsCounter{gc::metrics::GetDefaultRegistry().counter(
+        "gc_watchdog_trips_total", "Number of hung workers detected by the watchdog.")};
+
+    return watchdogTripsCounter;
+}
+
+} // namespace
+
+WatchdogSupervisor::WatchdogSupervisor(output_cutoff forceOutputsInactive,
+                                       logger_pointer mainLogger)
+    : m_forceOutputsInactive{std::move(forceOutputsInactive)},
+      m_mainLogger{std::move(mainLogger)} {
+    assert(static_cast<bool>(m_forceOutputsInactive));
+    assert(m_mainLogger != nullptr);
+
+    // The counter is registered here, so a registration failure reaches the caller instead
+    // of terminating the supervision thread when a worker hangs.
+    static_cast<void>(GetWatchdogTripsCounter());
+}
+
+WatchdogSupervisor::~WatchdogSupervisor() noexcept {
+    stop();
+}
+
+void WatchdogSupervisor::supervise(std::string workerName, const Heartbeat& heartbeat,
+                                   emergency_stoppable_system_pointer system) {
+    assert(!m_supervisionThread.joinable());
+    assert(system != nullptr);
+
+    m_supervisedWorkers.push_back(
+        SupervisedWorker{std::move(workerName), std::cref(heartbeat), std::move(system)});
+}
+
+void WatchdogSupervisor::start(const std::chrono::milliseconds timeout) {
+    if (m_supervisionThread.joinable())
+        return;
+
+    const std::chrono::milliseconds supervisionTimeout{std::max(timeout, MIN_TIMEOUT)};
+    m_mainLogger->logInfo(StringType{WATCHDOG_LOG_PREFIX} + "Supervising " +
+                          std::to_string(m_supervisedWorkers.size()) + " workers with a " +
+                          std::to_string(supervisionTimeout.count()) + "ms timeout.");
+
+    m_supervisionThread = std::jthread{[this, supervisionTimeout](std::stop_token stopToken) {
+        run_supervision(std::move(stopToken), supervisionTimeout);
+    }};
+}
+
+void WatchdogSupervisor::stop() noexcept {
+    if (!m_supervisionThread.joinable())
+        return;
+
+    m_supervisionThread.request_stop();
+    m_supervisionThread.join();
+}
+
+void WatchdogSupervisor::run_supervision(std::stop_token stopToken,
+                                         const std::chrono::milliseconds timeout) noexcept {
+    const std::chrono::milliseconds checkPeriod{timeout / 4};
+
+    std::unique_lock wakeUpLock{m_wakeUpMutex};
+    while (!stopToken.stop_requested()) {
+        // Only the stop request can wake the supervisor before the next check.
+        if (m_wakeUpListener.wait_for(wakeUpLock, stopToken, checkPeriod, [] {
+                return false;
+            }) ||
+            stopToken.stop_requested())
+            break;
+
+        const Heartbeat::clock_type::time_point now{Heartbeat::clock_type::now()};
+        for (SupervisedWorker& supervisedWorker : m_supervisedWorkers) {
+            const Heartbeat& heartbeat{supervisedWorker.heartbeat.get()};
+            if (heartbeat.isOverdue(now, timeout) &&
+                heartbeat.getSilentUntil() != supervisedWorker.trippedSilentUntil) {
+                trip(supervisedWorker);
+            }
+        }
+    }
+}
+
+void WatchdogSupervisor::trip(SupervisedWorker& supervisedWorker) noexcept {
+    supervisedWorker.trippedSilentUntil = supervisedWorker.heartbeat.get().getSilentUntil();
+    m_tripsCount++;
+    GetWatchdogTripsCounter().increment();
+
+    m_mainLogger->logError(StringType{WATCHDOG_LOG_PREFIX} + "The heartbeat of the " +
+                           supervisedWorker.name +
+                           " worker is overdue. Forcing the outputs off and aborting it.");
+
+    // The outputs are turned off first: the hung worker can't turn them off by itself until
+    // its hardware call returns, and the abort only asks it to stop.
+    const std::size_t inactiveLinesCount{m_forceOutputsInactive()};
+    m_mainLogger->logError(StringType{WATCHDOG_LOG_PREFIX} + "Forced " +
+                           std::to_string(inactiveLinesCount) + " output lines off.");
+
+    supervisedWorker.system->emergencyAbort();
+}
+
+} // namespace rpi_gc::watchdog
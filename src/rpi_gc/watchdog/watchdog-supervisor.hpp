@@ -0,0 +1,109 @@
+// Copyright (c) 2023 Andrea Ballestrazzi
+#pragma once
+
+#include <abort-system/emergency-stoppable-system.hpp>
+#include <watchdog/heartbeat.hpp>
+
+#include <gh_log/logger.hpp>
+
+// C++ STL
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <stop_token>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace rpi_gc::watchdog {
+
+//!!
+//! \brief Supervises the heartbeats of the long-running workers from its own thread. When a
+//!  heartbeat is overdue, the supervisor forces all the outputs off through a path that is
+//!  independent from the worker and then aborts the system that owns the worker.
+//!
+//!  The heartbeats are checked four times per timeout, so a hung worker is detected at most
+//!  1.25 timeouts after it should have beaten. Between two checks the supervisor sleeps.
+//!
+class WatchdogSupervisor final {
+public:
+    using logger_pointer = std::shared_ptr<gh_log::Logger>;
+    using emergency_stoppable_system_pointer =
+        std::shared_ptr<abort_system::EmergencyStoppableSystem>;
+    //! Drives all the outputs to the inactive state, returning the number of driven lines.
+    using output_cutoff = std::function<std::size_t()>;
+
+    static constexpr std::chrono::milliseconds MIN_TIMEOUT{100};
+    static constexpr std::chrono::milliseconds DEFAULT_TIMEOUT{1000};
+
+    //!!
+    //! \brief Construct a new supervisor, which isn't running.
+    //!
+    //! \param[in] forceOutputsInactive The emergency path that turns off all the outputs. It
+    //!  must not depend on the supervised systems, e.g. on their locks.
+    //! \param[in] mainLogger The logger that writes to the application main log file.
+    //! \throws std::invalid_argument if the metrics of the supervisor can't be registered.
+    //!
+    WatchdogSupervisor(output_cutoff forceOutputsInactive, logger_pointer mainLogger);
+
+    ~WatchdogSupervisor() noexcept;
+
+    WatchdogSupervisor(const WatchdogSupervisor&) = delete;
+    WatchdogSupervisor& operator=(const WatchdogSupervisor&) = delete;
+
+    //!!
+    //! \brief Adds a worker to the supervised ones. Must be called before start().
+    //!
+    //! \param[in] workerName The name of the worker, used in the logs.
+    //! \param[in] heartbeat The heartbeat of the worker, which must outlive the supervisor.
+    //! \param[in] system The system that is aborted when the worker hangs. Its abort must not
+    //!  wait for the worker.
+    //!
+    void supervise(std::string workerName, const Heartbeat& heartbeat,
+                   emergency_stoppable_system_pointer system);
+
+    //!!
+    //! \brief Starts the supervision thread.
+    //!
+    //! \param[in] timeout The time a heartbeat can be late before its worker is considered
+    //!  hung. Clamped to MIN_TIMEOUT.
+    //!
+    void start(std::chrono::milliseconds timeout = DEFAULT_TIMEOUT);
+
+    //!!
+    //! \brief Stops the supervision thread, waiting for it to end.
+    //!
+    void stop() noexcept;
+
+    //! \return The number of times a hung worker has been detected.
+    [[nodiscard]] std::uint64_t getTripsCount() const noexcept {
+        return m_tripsCount.load();
+    }
+
+private:
+    struct SupervisedWorker {
+        std::string name{};
+        std::reference_wrapper<const Heartbeat> heartbeat;
+        emergency_stoppable_system_pointer system{};
+        //! The heartbeat value of the last trip, so that a worker is aborted once per hang.
+        Heartbeat::clock_type::rep trippedSilentUntil{};
+    };
+
+    output_cutoff m_forceOutputsInactive{};
+    logger_pointer m_mainLogger{};
+    std::vector<SupervisedWorker> m_supervisedWorkers{};
+    std::atomic<std::uint64_t> m_tripsCount{};
+    std::mutex m_wakeUpMutex{};
+    std::condition_variable_any m_wakeUpListener{};
+    std::jthread m_supervisionThread{};
+
+    void run_supervision(std::stop_token stopToken, std::chrono::milliseconds timeout) noexcept;
+    void trip(SupervisedWorker& supervisedWorker) noexcept;
+};
+
+} // namespace rpi_gc::watchdog
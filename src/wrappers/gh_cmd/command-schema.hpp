@@ -0,0 +1,719 @@
+// Copyright (c) 2023 Andrea Ballestrazzi
+#pragma once
+
+// C++ STL
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <charconv>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <limits>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+//!!
+//! \brief Compile-time schemas of the terminal commands and of their options.
+//!
+//!  A command is described by its name and by the list of its options, each one with its
+//!  long name, short name and value type:
+//!
+//!  using AutoWateringSchema = CommandSchema<"auto-watering",
+//!                                           Switch<"help", 'h'>,
+//!                                           Value<"activation-time", 'A', std::uint64_t>>;
+//!
+//!  The command names and the option names are looked up through perfect hash tables built
+//!  at compile time, the input lines are split into string views without allocating and the
+//!  parsed values are stored by value, so that they can be read by name, e.g.
+//!  options.value<"activation-time">(), or passed to typed handlers without any lookup.
+//!
+//!  Supported value types are integral and floating point numbers, std::string_view (which
+//!  refers to the parsed line) and std::string.
+namespace gh_cmd::schema {
+
+//!!
+//! \brief A string literal that can be used as a template argument.
+//!
+template <std::size_t N>
+struct FixedString {
+    char characters[N]{};
+
+    consteval FixedString(const char (&str)[N]) noexcept {
+        std::copy_n(str, N, characters);
+    }
+
+    [[nodiscard]] constexpr std::string_view view() const noexcept {
+        return std::string_view{characters, N - 1};
+    }
+};
+
+// Tokenization
+// -----------------------------------------------------------------------------------------
+
+[[nodiscard]] constexpr bool IsTokenSeparator(const char c) noexcept {
+    return c == ' ' || c == '\t' || c == '\n' || c == '\r' || c == '\v' || c == '\f';
+}
+
+//!!
+//! \brief Iterates over the whitespace separated tokens of a line. The tokens are views
+//!  of the line, which must outlive them.
+//!
+class TokenIterator {
+public:
+    using value_type = std::string_view;
+    using difference_type = std::ptrdiff_t;
+    using iterator_category = std::forward_iterator_tag;
+
+    //! Constructs the end iterator.
+    constexpr TokenIterator() noexcept = default;
+
+    constexpr explicit TokenIterator(std::string_view line) noexcept : m_remaining{line} {
+        advance();
+    }
+
+    [[nodiscard]] constexpr std::string_view operator*() const noexcept {
+        return m_token;
+    }
+
+    constexpr TokenIterator& operator++() noexcept {
+        advance();
+        return *this;
+    }
+
+    constexpr TokenIterator operator++(int) noexcept {
+        TokenIterator previous{*this};
+        advance();
+        return previous;
+    }
+
+    [[nodiscard]] constexpr bool operator==(const TokenIterator& other) const noexcept {
+        return m_token.data() == other.m_token.data() && m_token.size() == other.m_token.size();
+    }
+
+private:
+    std::string_view m_remaining{};
+    std::string_view m_token{};
+
+    constexpr void advance() noexcept {
+        const auto tokenBegin{std::find_if_not(m_remaining.begin(), m_remaining.end(),
+                                               IsTokenSeparator)};
+        if (tokenBegin == m_remaining.end()) {
+            m_remaining = {};
+            m_token = {};
+            return;
+        }
+
+        const auto tokenEnd{std::find_if(tokenBegin, m_remaining.end(), IsTokenSeparator)};
+        const auto tokenOffset{static_cast<std::size_t>(tokenBegin - m_remaining.begin())};
+        const auto tokenSize{static_cast<std::size_t>(tokenEnd - tokenBegin)};
+
+        m_token = m_remaining.substr(tokenOffset, tokenSize);
+        m_remaining.remove_prefix(tokenOffset + tokenSize);
+    }
+};
+
+//!!
+//! \brief The tokens of a line, as a forward range of string views.
+//!
+class TokenRange {
+public:
+    constexpr explicit TokenRange(std::string_view line) noexcept : m_line{line} {}
+
+    [[nodiscard]] constexpr TokenIterator begin() const noexcept {
+        return TokenIterator{m_line};
+    }
+
+    [[nodiscard]] constexpr TokenIterator end() const noexcept {
+        return TokenIterator{};
+    }
+
+    [[nodiscard]] constexpr bool empty() const noexcept {
+        return begin() == end();
+    }
+
+private:
+    std::string_view m_line;
+};
+
+//!!
+//! \brief Splits a line into its whitespace separated tokens, without allocating.
+//!
+[[nodiscard]] constexpr TokenRange Tokenize(std::string_view line) noexcept {
+    return TokenRange{line};
+}
+
+// Perfect hashing
+// -----------------------------------------------------------------------------------------
+
+//!!
+//! \brief Seeded FNV-1a hash of a name.
+//!
+[[nodiscard]] constexpr std::uint64_t HashName(std::string_view name,
+                                               const std::uint64_t seed) noexcept {
+    constexpr std::uint64_t FNV_OFFSET_BASIS{14695981039346656037ULL};
+    constexpr std::uint64_t FNV_PRIME{1099511628211ULL};
+
+    std::uint64_t hash{FNV_OFFSET_BASIS ^ (seed * FNV_PRIME)};
+    for (const char c : name) {
+        hash ^= static_cast<unsigned char>(c);
+        hash *= FNV_PRIME;
+    }
+
+    return hash ^ (hash >> 32);
+}
+
+//!!
+//! \brief A table that maps a fixed set of names to their indices with a single hash and a
+//!  single comparison. The seed that doesn't make any name collide is searched when the
+//!  table is constructed, so the table must be built at compile time.
+//!
+template <std::size_t KeysCount>
+class PerfectHashTable {
+public:
+    static constexpr std::size_t NOT_FOUND{std::numeric_limits<std::size_t>::max()};
+
+    //! Four slots per key make a collision-free seed quick to find.
+    static constexpr std::size_t SLOTS_COUNT{
+        std::bit_ceil(std::max<std::size_t>(KeysCount * 4, 1))};
+
+    static_assert(KeysCount < std::numeric_limits<std::uint8_t>::max(),
+                  "Too many keys for a perfect hash table.");
+
+    //!!
+    //! \brief Builds the table of the given keys.
+    //!
+    //! \throw std::invalid_argument if the keys contain duplicates, which makes the
+    //!  compilation fail.
+    //!
+    consteval explicit PerfectHashTable(const std::array<std::string_view, KeysCount>& keys)
+        : m_keys{keys} {
+        for (std::size_t i{}; i < KeysCount; ++i) {
+            for (std::size_t j{i + 1}; j < KeysCount; ++j) {
+                if (keys[i] == keys[j]) {
+                    throw std::invalid_argument{"The perfect hash table keys must be unique."};
+                }
+            }
+        }
+
+        constexpr std::uint64_t MAX_SEED{1 << 16};
+        for (std::uint64_t seed{}; seed < MAX_SEED; ++seed) {
+            if (try_seed(seed)) {
+                return;
+            }
+        }
+
+        throw std::invalid_argument{"No perfect hash seed has been found for the keys."};
+    }
+
+    //!!
+    //! \brief Looks up a key.
+    //!
+    //! \return The index of the key in the array given at construction, or NOT_FOUND.
+    //!
+    [[nodiscard]] constexpr std::size_t find(std::string_view key) const noexcept {
+        const std::size_t keyIndex{m_slots[HashName(key, m_seed) & (SLOTS_COUNT - 1)]};
+        return keyIndex < KeysCount && m_keys[keyIndex] == key ? keyIndex : NOT_FOUND;
+    }
+
+    [[nodiscard]] constexpr std::uint64_t getSeed() const noexcept {
+        return m_seed;
+    }
+
+private:
+    static constexpr std::uint8_t EMPTY_SLOT{std::numeric_limits<std::uint8_t>::max()};
+
+    std::array<std::string_view, KeysCount> m_keys{};
+    std::array<std::uint8_t, SLOTS_COUNT> m_slots{};
+    std::uint64_t m_seed{};
+
+    consteval bool try_seed(const std::uint64_t seed) {
+        m_slots.fill(EMPTY_SLOT);
+        for (std::size_t keyIndex{}; keyIndex < KeysCount; ++keyIndex) {
+            std::uint8_t& slot{m_slots[HashName(m_keys[keyIndex], seed) & (SLOTS_COUNT - 1)]};
+            if (slot != EMPTY_SLOT) {
+                return false;
+            }
+
+            slot = static_cast<std::uint8_t>(keyIndex);
+        }
+
+        m_seed = seed;
+        return true;
+    }
+};
+
+// Options
+// -----------------------------------------------------------------------------------------
+
+//!!
+//! \brief The reason why a command line couldn't be parsed.
+//!
+enum class ParseError : std::uint8_t {
+    None,
+
+    // The line doesn't contain any token.
+    EmptyLine,
+
+    // The first token doesn't name any command of the table.
+    UnknownCommand,
+
+    // The token doesn't name any option of the command.
+    UnknownOption,
+
+    // The option requires a value but it's the last token of the line.
+    MissingValue,
+
+    // The value can't be converted to the type of the option.
+    InvalidValue,
+
+    // The token isn't an option: the commands don't accept positional arguments.
+    UnexpectedArgument
+};
+
+//!!
+//! \brief The result of a parsing operation. It evaluates to true if the line was parsed
+//!  successfully. On failure, the token refers to the one that didn't pass the validation.
+//!
+struct ParseResult {
+    ParseError error{ParseError::None};
+    std::string_view token{};
+
+    [[nodiscard]] constexpr explicit operator bool() const noexcept {
+        return error == ParseError::None;
+    }
+};
+
+[[nodiscard]] constexpr std::string_view ParseErrorToString(const ParseError error) noexcept {
+    switch (error) {
+        case ParseError::None:
+            return "no error";
+        case ParseError::EmptyLine:
+            return "empty line";
+        case ParseError::UnknownCommand:
+            return "unknown command";
+        case ParseError::UnknownOption:
+            return "unknown option";
+        case ParseError::MissingValue:
+            return "missing value";
+        case ParseError::InvalidValue:
+            return "invalid value";
+        case ParseError::UnexpectedArgument:
+            return "unexpected argument";
+    }
+
+    return "unknown error";
+}
+
+//!!
+//! \brief Converts the token of a value to the type of its option.
+//!
+//! \return False if the token isn't a valid value.
+//!
+template <typename ValueType>
+[[nodiscard]] constexpr bool ParseValue(std::string_view token, ValueType& value) {
+    if constexpr (std::is_same_v<ValueType, std::string_view>) {
+        value = token;
+        return true;
+    } else if constexpr (std::is_same_v<ValueType, std::string>) {
+        value = ValueType{token};
+        return true;
+    } else if constexpr (std::is_same_v<ValueType, bool>) {
+        if (token == "true" || token == "1") {
+            value = true;
+            return true;
+        }
+
+        if (token == "false" || token == "0") {
+            value = false;
+            return true;
+        }
+
+        return false;
+    } else if constexpr (std::is_integral_v<ValueType>) {
+        // Written by hand, as std::from_chars isn't constexpr before C++23.
+        bool bNegative{};
+        if (!token.empty() && (token.front() == '-' || token.front() == '+')) {
+            bNegative = token.front() == '-';
+            token.remove_prefix(1);
+        }
+
+        if (token.empty() || (bNegative && std::is_unsigned_v<ValueType>)) {
+            return false;
+        }
+
+        using wide_type = std::conditional_t<std::is_signed_v<ValueType>, std::intmax_t,
+                                             std::uintmax_t>;
+        constexpr auto MAX_MAGNITUDE{static_cast<std::uintmax_t>(
+            std::numeric_limits<ValueType>::max())};
+        const std::uintmax_t maxMagnitude{bNegative ? MAX_MAGNITUDE + 1 : MAX_MAGNITUDE};
+
+        std::uintmax_t magnitude{};
+        for (const char c : token) {
+            if (c < '0' || c > '9') {
+                return false;
+            }
+
+            const auto digit{static_cast<std::uintmax_t>(c - '0')};
+            if (magnitude > (maxMagnitude - digit) / 10) {
+                return false;
+            }
+
+            magnitude = magnitude * 10 + digit;
+        }
+
+        value = bNegative ? static_cast<ValueType>(-static_cast<wide_type>(magnitude - 1) - 1)
+                          : static_cast<ValueType>(magnitude);
+        return true;
+    } else if constexpr (std::is_floating_point_v<ValueType>) {
+        const auto [end, errorCode]{
+            std::from_chars(token.data(), token.data() + token.size(), value)};
+        return errorCode == std::errc{} && end == token.data() + token.size();
+    } else {
+        static_assert(!sizeof(ValueType), "The type of the option value isn't supported.");
+    }
+}
+
+//!!
+//! \brief An option without value, set when it's present in the line.
+//!
+template <FixedString LongName, char ShortName = '\0'>
+struct Switch {
+    using value_type = bool;
+
+    static constexpr std::string_view LONG_NAME{LongName.view()};
+    static constexpr char SHORT_NAME{ShortName};
+    static constexpr bool TAKES_VALUE{false};
+};
+
+//!!
+//! \brief An option followed by a value, e.g. "--activation-time 600" or
+//!  "--activation-time=600".
+//!
+template <FixedString LongName, char ShortName, typename ValueType>
+struct Value {
+    using value_type = ValueType;
+
+    static constexpr std::string_view LONG_NAME{LongName.view()};
+    static constexpr char SHORT_NAME{ShortName};
+    static constexpr bool TAKES_VALUE{true};
+};
+
+template <typename OptionType>
+concept OptionSchema = requires {
+    typename OptionType::value_type;
+    { OptionType::LONG_NAME } -> std::convertible_to<std::string_view>;
+    { OptionType::SHORT_NAME } -> std::convertible_to<char>;
+    { OptionType::TAKES_VALUE } -> std::convertible_to<bool>;
+};
+
+//!!
+//! \brief The values of the options parsed from a command line, stored by value. The
+//!  options are addressed by their long name, resolved to their index at compile time.
+//!
+template <OptionSchema... Options>
+class ParsedOptions {
+public:
+    static constexpr std::size_t OPTIONS_COUNT{sizeof...(Options)};
+
+    //!!
+    //! \brief The index of an option in the schema. The compilation fails if the schema
+    //!  doesn't have it.
+    //!
+    template <FixedString LongName>
+    [[nodiscard]] static consteval std::size_t indexOf() noexcept {
+        constexpr std::array<std::string_view, OPTIONS_COUNT> LONG_NAMES{Options::LONG_NAME...};
+        const auto nameIt{std::find(LONG_NAMES.begin(), LONG_NAMES.end(), LongName.view())};
+        return static_cast<std::size_t>(nameIt - LONG_NAMES.begin());
+    }
+
+    template <FixedString LongName>
+    [[nodiscard]] constexpr bool isSet() const noexcept {
+        constexpr std::size_t OPTION_INDEX{indexOf<LongName>()};
+        static_assert(OPTION_INDEX < OPTIONS_COUNT, "The schema doesn't have this option.");
+
+        return std::get<OPTION_INDEX>(m_values).has_value();
+    }
+
+    //!!
+    //! \brief The value of an option, which must be set.
+    //!
+    template <FixedString LongName>
+    [[nodiscard]] constexpr const auto& value() const noexcept {
+        constexpr std::size_t OPTION_INDEX{indexOf<LongName>()};
+        static_assert(OPTION_INDEX < OPTIONS_COUNT, "The schema doesn't have this option.");
+
+        return *std::get<OPTION_INDEX>(m_values);
+    }
+
+    //!!
+    //! \brief The value of an option, or the given default value if it isn't set.
+    //!
+    template <FixedString LongName, typename DefaultType>
+    [[nodiscard]] constexpr auto valueOr(DefaultType&& defaultValue) const {
+        constexpr std::size_t OPTION_INDEX{indexOf<LongName>()};
+        static_assert(OPTION_INDEX < OPTIONS_COUNT, "The schema doesn't have this option.");
+
+        return std::get<OPTION_INDEX>(m_values).value_or(std::forward<DefaultType>(defaultValue));
+    }
+
+    //!!
+    //! \brief Invokes the handler of every option that is set, in the schema order. Handlers
+    //!  are matched to the options by position: the switch handlers take no argument and
+    //!  the value handlers take the parsed value.
+    //!
+    template <typename... Handlers>
+    constexpr void visit(Handlers&&... handlers) const {
+        static_assert(sizeof...(Handlers) == OPTIONS_COUNT,
+                      "Every option of the schema needs its handler.");
+
+        visit_set_options(std::index_sequence_for<Options...>{},
+                          std::forward_as_tuple(std::forward<Handlers>(handlers)...));
+    }
+
+    constexpr void clear() noexcept {
+        m_values = {};
+    }
+
+    //!!
+    //! \brief Parses the option tokens of a command line, i.e. the ones after the command
+    //!  name. The previous values are cleared first.
+    //!
+    template <std::input_iterator TokenIt, std::sentinel_for<TokenIt> TokenEnd>
+    constexpr ParseResult parse(TokenIt tokenIt, const TokenEnd tokenEnd) {
+        clear();
+
+        while (tokenIt != tokenEnd) {
+            const std::string_view token{*tokenIt};
+            ++tokenIt;
+
+            if (token.size() < 2 || token.front() != '-') {
+                return ParseResult{ParseError::UnexpectedArgument, token};
+            }
+
+            // Both "--name value" and "--name=value" are accepted for the long names.
+            std::size_t optionIndex{PerfectHashTable<OPTIONS_COUNT>::NOT_FOUND};
+            std::optional<std::string_view> inlineValue{};
+            if (token[1] == '-') {
+                std::string_view longName{token.substr(2)};
+                if (const auto equalPosition{longName.find('=')};
+                    equalPosition != std::string_view::npos) {
+                    inlineValue = longName.substr(equalPosition + 1);
+                    longName = longName.substr(0, equalPosition);
+                }
+
+                optionIndex = LONG_NAMES_TABLE.find(longName);
+            } else if (token.size() == 2) {
+                optionIndex = SHORT_NAMES_TABLE[static_cast<unsigned char>(token[1])];
+            }
+
+            if (optionIndex >= OPTIONS_COUNT) {
+                return ParseResult{ParseError::UnknownOption, token};
+            }
+
+            std::optional<std::string_view> valueToken{inlineValue};
+            if (TAKES_VALUE[optionIndex] && !valueToken.has_value()) {
+                if (tokenIt == tokenEnd) {
+                    return ParseResult{ParseError::MissingValue, token};
+                }
+
+                valueToken = *tokenIt;
+                ++tokenIt;
+            }
+
+            if (!TAKES_VALUE[optionIndex] && valueToken.has_value()) {
+                return ParseResult{ParseError::InvalidValue, token};
+            }
+
+            if (!SETTERS[optionIndex](m_values, valueToken.value_or(std::string_view{}))) {
+                return ParseResult{ParseError::InvalidValue, *valueToken};
+            }
+        }
+
+        return ParseResult{};
+    }
+
+private:
+    using values_tuple = std::tuple<std::optional<typename Options::value_type>...>;
+    using setter_type = bool (*)(values_tuple&, std::string_view);
+
+    static constexpr PerfectHashTable<OPTIONS_COUNT> LONG_NAMES_TABLE{
+        std::array<std::string_view, OPTIONS_COUNT>{Options::LONG_NAME...}};
+
+    static constexpr std::array<bool, OPTIONS_COUNT> TAKES_VALUE{Options::TAKES_VALUE...};
+
+    //! The index of the option of every short name, or NOT_FOUND.
+    static constexpr std::array<std::size_t, 256> SHORT_NAMES_TABLE{[] {
+        std::array<std::size_t, 256> table{};
+        table.fill(PerfectHashTable<OPTIONS_COUNT>::NOT_FOUND);
+
+        constexpr std::array<char, OPTIONS_COUNT> SHORT_NAMES{Options::SHORT_NAME...};
+        for (std::size_t optionIndex{}; optionIndex < OPTIONS_COUNT; ++optionIndex) {
+            if (SHORT_NAMES[optionIndex] == '\0') {
+                continue;
+            }
+
+            std::size_t& entry{table[static_cast<unsigned char>(SHORT_NAMES[optionIndex])]};
+            if (entry != PerfectHashTable<OPTIONS_COUNT>::NOT_FOUND) {
+                throw std::invalid_argument{"The option short names must be unique."};
+            }
+
+            entry = optionIndex;
+        }
+
+        return table;
+    }()};
+
+    // Declared before the setters table, which is initialized where the class is incomplete.
+    template <std::size_t OptionIndex>
+    static constexpr bool set_value(values_tuple& values, std::string_view valueToken) {
+        using option_type = std::tuple_element_t<OptionIndex, std::tuple<Options...>>;
+        using value_type = typename option_type::value_type;
+
+        if constexpr (!option_type::TAKES_VALUE) {
+            std::get<OptionIndex>(values) = true;
+            return true;
+        } else {
+            value_type value{};
+            if (!ParseValue(valueToken, value)) {
+                return false;
+            }
+
+            std::get<OptionIndex>(values) = std::move(value);
+            return true;
+        }
+    }
+
+    //! The function that stores the value of every option, indexed like the options.
+    static constexpr std::array<setter_type, OPTIONS_COUNT> SETTERS{
+        []<std::size_t... OptionIndices>(std::index_sequence<OptionIndices...>) {
+            return std::array<setter_type, OPTIONS_COUNT>{
+                &ParsedOptions::set_value<OptionIndices>...};
+        }(std::index_sequence_for<Options...>{})};
+
+    values_tuple m_values{};
+
+    template <std::size_t... OptionIndices, typename HandlersTuple>
+    constexpr void visit_set_options(std::index_sequence<OptionIndices...>,
+                                     HandlersTuple&& handlers) const {
+        (visit_option<OptionIndices>(std::get<OptionIndices>(handlers)), ...);
+    }
+
+    template <std::size_t OptionIndex, typename Handler>
+    constexpr void visit_option(Handler& handler) const {
+        using option_type = std::tuple_element_t<OptionIndex, std::tuple<Options...>>;
+
+        const auto& optionValue{std::get<OptionIndex>(m_values)};
+        if (!optionValue.has_value()) {
+            return;
+        }
+
+        if constexpr (option_type::TAKES_VALUE) {
+            std::invoke(handler, *optionValue);
+        } else {
+            std::invoke(handler);
+        }
+    }
+};
+
+// Commands
+// -----------------------------------------------------------------------------------------
+
+//!!
+//! \brief Describes a command and its options.
+//!
+template <FixedString Name, OptionSchema... Options>
+struct CommandSchema {
+    using parsed_options = ParsedOptions<Options...>;
+
+    static constexpr std::string_view NAME{Name.view()};
+};
+
+//!!
+//! \brief Dispatches the command lines to the commands of a fixed set of schemas.
+//!
+template <typename... Commands>
+class CommandTable {
+public:
+    static constexpr std::size_t COMMANDS_COUNT{sizeof...(Commands)};
+    static constexpr std::size_t NOT_FOUND{PerfectHashTable<COMMANDS_COUNT>::NOT_FOUND};
+
+    //!!
+    //! \brief The index of a command in the table, or NOT_FOUND.
+    //!
+    [[nodiscard]] static constexpr std::size_t find(std::string_view commandName) noexcept {
+        return NAMES_TABLE.find(commandName);
+    }
+
+    //!!
+    //! \brief Parses a command line and invokes the handler of its command with the parsed
+    //!  options. Handlers are matched to the commands by position and take the
+    //!  parsed_options of their schema.
+    //!
+    //! \return The result of the parsing. The handler isn't invoked if it failed.
+    //!
+    template <typename... Handlers>
+    static constexpr ParseResult dispatch(std::string_view line, Handlers&&... handlers) {
+        static_assert(sizeof...(Handlers) == COMMANDS_COUNT,
+                      "Every command of the table needs its handler.");
+
+        const TokenRange tokens{line};
+        TokenIterator tokenIt{tokens.begin()};
+        if (tokenIt == tokens.end()) {
+            return ParseResult{ParseError::EmptyLine, {}};
+        }
+
+        const std::string_view commandName{*tokenIt};
+        const std::size_t commandIndex{find(commandName)};
+        if (commandIndex == NOT_FOUND) {
+            return ParseResult{ParseError::UnknownCommand, commandName};
+        }
+
+        ++tokenIt;
+        return dispatch_to(commandIndex, tokenIt, tokens.end(),
+                           std::index_sequence_for<Commands...>{},
+                           std::forward_as_tuple(std::forward<Handlers>(handlers)...));
+    }
+
+private:
+    static constexpr PerfectHashTable<COMMANDS_COUNT> NAMES_TABLE{
+        std::array<std::string_view, COMMANDS_COUNT>{Commands::NAME...}};
+
+    template <std::size_t... CommandIndices, typename HandlersTuple>
+    static constexpr ParseResult dispatch_to(const std::size_t commandIndex,
+                                             TokenIterator tokenIt, TokenIterator tokenEnd,
+                                             std::index_sequence<CommandIndices...>,
+                                             HandlersTuple&& handlers) {
+        ParseResult result{};
+        ((CommandIndices == commandIndex &&
+          (result = parse_and_invoke<CommandIndices>(tokenIt, tokenEnd,
+                                                     std::get<CommandIndices>(handlers)),
+           true)) ||
+         ...);
+
+        return result;
+    }
+
+    template <std::size_t CommandIndex, typename Handler>
+    static constexpr ParseResult parse_and_invoke(TokenIterator tokenIt, TokenIterator tokenEnd,
+                                                  Handler& handler) {
+        using command_type = std::tuple_element_t<CommandIndex, std::tuple<Commands...>>;
+
+        typename command_type::parsed_options options{};
+        const ParseResult result{options.parse(tokenIt, tokenEnd)};
+        if (result) {
+            std::invoke(handler, std::as_const(options));
+        }
+
+        return result;
+    }
+};
+
+} // namespace gh_cmd::schema
@@ -0,0 +1,78 @@
+// Copyright (c) 2023 Andrea Ballestrazzi
+#include <gh_hal/backends/simulated/scripted-sensor-source.hpp>
+
+// C++ STL
+#include <algorithm>
+#include <stdexcept>
+#include <utility>
+
+namespace gh_hal::backends::simulated {
+
+ScriptedSensorSource::ScriptedSensorSource(std::vector<SensorScriptStep> script, const bool bLoop,
+                                           const double noiseAmplitude,
+                                           const std::uint64_t noiseSeed)
+    : m_script{std::move(script)},
+      m_bLoop{bLoop},
+      m_noiseAmplitude{noiseAmplitude},
+      m_noiseState{noiseSeed} {
+    std::erase_if(m_script, [](const SensorScriptStep& step) {
+        return step.readsCount == 0;
+    });
+
+    if (m_script.empty())
+        throw std::invalid_argument{"The script of a simulated sensor must have at least a read."};
+
+    if (!(noiseAmplitude >= 0.0))
+        throw std::invalid_argument{"The noise amplitude of a simulated sensor can't be negative."};
+}
+
+std::optional<ScriptedSensorSource::value_type> ScriptedSensorSource::read() noexcept {
+    m_readsCount.fetch_add(1, std::memory_order_relaxed);
+
+    const SensorScriptStep& step{m_script[m_stepIndex]};
+    const std::uint64_t readIndex{m_stepReadIndex};
+
+    // When the script doesn't loop, the last read of the last step is repeated forever.
+    if (m_stepReadIndex + 1 < step.readsCount) {
+        ++m_stepReadIndex;
+    } else if (m_stepIndex + 1 < m_script.size()) {
+        ++m_stepIndex;
+        m_stepReadIndex = 0;
+    } else if (m_bLoop) {
+        m_stepIndex = 0;
+        m_stepReadIndex = 0;
+    }
+
+    switch (step.kind) {
+    case SensorScriptStep::Kind::Failure:
+        return std::nullopt;
+    case SensorScriptStep::Kind::Ramp: {
+        const double progress{step.readsCount == 1
+                                  ? 1.0
+                                  : static_cast<double>(readIndex) /
+                                        static_cast<double>(step.readsCount - 1)};
+        return step.fromValue + (step.toValue - step.fromValue) * progress + next_noise();
+    }
+    case SensorScriptStep::Kind::Constant:
+    default:
+        return step.fromValue + next_noise();
+    }
+}
+
+double ScriptedSensorSource::next_noise() noexcept {
+    if (m_noiseAmplitude == 0.0)
+        return 0.0;
+
+    // SplitMix64: a tiny generator with a single word of state.
+    m_noiseState += 0x9E3779B97F4A7C15ULL;
+    std::uint64_t noiseBits{m_noiseState};
+    noiseBits = (noiseBits ^ (noiseBits >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    noiseBits = (noiseBits ^ (noiseBits >> 27)) * 0x94D049BB133111EBULL;
+    noiseBits ^= noiseBits >> 31;
+
+    // The 53 most significant bits give a uniform value in [0, 1).
+    const double unitNoise{static_cast<double>(noiseBits >> 11) * 0x1.0p-53};
+    return (unitNoise * 2.0 - 1.0) * m_noiseAmplitude;
+}
+
+} // namespace gh_hal::backends::simulated
@@ -0,0 +1,75 @@
+// Copyright (c) 2023 Andrea Ballestrazzi
+#pragma once
+
+#include <gh_hal/hardware-access/sensor-source.hpp>
+
+// C++ STL
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <vector>
+
+namespace gh_hal::backends::simulated {
+
+//!!
+//! \brief A step of the script of a simulated sensor, which lasts the given number of reads.
+//!
+struct SensorScriptStep {
+    enum class Kind {
+        //! The reads return fromValue.
+        Constant,
+        //! The reads go linearly from fromValue to toValue, which is returned by the last read.
+        Ramp,
+        //! The reads fail.
+        Failure
+    };
+
+    Kind kind{Kind::Constant};
+    double fromValue{};
+    double toValue{};
+    std::uint64_t readsCount{1};
+};
+
+//!!
+//! \brief A simulated sensor that returns the values of a script, so that the consumers of the
+//!  sensors can be tested and loaded without hardware. Every read advances the script by one
+//!  read and, when the script ends, it restarts or keeps returning its last value.
+//!
+//!  A deterministic noise can be added to the values: it's generated from the given seed, so
+//!  two sources with the same script and seed return the same values.
+//!
+class ScriptedSensorSource final : public hardware_access::SensorSource {
+public:
+    //!!
+    //! \brief Construct a new scripted sensor.
+    //!
+    //! \param[in] script The steps played by the sensor. The steps without reads are skipped.
+    //! \param[in] bLoop Whether the script restarts when it ends.
+    //! \param[in] noiseAmplitude The maximum absolute value of the noise added to the values.
+    //! \param[in] noiseSeed The seed of the noise.
+    //! \throw std::invalid_argument if the script has no reads or the amplitude is negative.
+    //!
+    explicit ScriptedSensorSource(std::vector<SensorScriptStep> script, bool bLoop = true,
+                                  double noiseAmplitude = 0.0, std::uint64_t noiseSeed = 1);
+
+    [[nodiscard]] std::optional<value_type> read() noexcept override;
+
+    //! \return The number of times the sensor has been read, failures included.
+    [[nodiscard]] std::uint64_t getReadsCount() const noexcept {
+        return m_readsCount.load(std::memory_order_relaxed);
+    }
+
+private:
+    std::vector<SensorScriptStep> m_script{};
+    bool m_bLoop{};
+    double m_noiseAmplitude{};
+    std::uint64_t m_noiseState{};
+    std::size_t m_stepIndex{};
+    std::uint64_t m_stepReadIndex{};
+    std::atomic<std::uint64_t> m_readsCount{};
+
+    [[nodiscard]] double next_noise() noexcept;
+};
+
+} // namespace gh_hal::backends::simulated
@@ -0,0 +1,13 @@
+// Copyright (c) 2023 Andrea Ballestrazzi
+#include <gh_hal/hardware-access/output-cutoff.hpp>
+
+// Implementations
+#include <gh_hal/internal/output-lines-registry.hpp>
+
+namespace gh_hal::hardware_access {
+
+std::size_t ForceAllOutputsInactive() noexcept {
+    return internal::ForceRegisteredOutputsInactive();
+}
+
+} // namespace gh_hal::hardware_access
@@ -0,0 +1,20 @@
+// Copyright (c) 2023 Andrea Ballestrazzi
+#pragma once
+
+// C++ STL
+#include <cstddef>
+
+namespace gh_hal::hardware_access {
+
+//!!
+//! \brief Drives every output line requested through the board chips to its inactive state.
+//!  This is an emergency path independent from the pins objects: it doesn't take any lock and
+//!  it doesn't go through the users of the pins, so it can be used while one of them is stuck.
+//!
+//! \note The pins objects aren't notified, so their users still consider them active.
+//!
+//! \return The number of lines driven to the inactive state.
+//!
+std::size_t ForceAllOutputsInactive() noexcept;
+
+} // namespace gh_hal::hardware_access
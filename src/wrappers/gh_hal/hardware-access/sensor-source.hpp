@@ -0,0 +1,27 @@
+// Copyright (c) 2023 Andrea Ballestrazzi
+#pragma once
+
+// C++ STL
+#include <optional>
+
+namespace gh_hal::hardware_access {
+
+//!!
+//! \brief Represents the basic interface of a sensor that can be sampled, e.g. a temperature
+//!  or a soil moisture probe. The value is in the unit of the sensor.
+//!
+struct SensorSource {
+    using value_type = double;
+
+    virtual ~SensorSource() noexcept = default;
+
+    //!!
+    //! \brief Reads the current value of the sensor. The sampler calls it from a single
+    //!  thread, so it doesn't need to be thread-safe, but it must return quickly: a slow read
+    //!  delays the sampling of the other sensors.
+    //!
+    //! \return The read value or std::nullopt if the sensor couldn't be read.
+    [[nodiscard]] virtual std::optional<value_type> read() noexcept = 0;
+};
+
+} // namespace gh_hal::hardware_access
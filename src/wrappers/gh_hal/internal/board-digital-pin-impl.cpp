@@ -1,6 +1,9 @@
 // Copyright (c) 2023 Andrea Ballestrazzi
 #include <gh_hal/internal/board-digital-pin-impl.hpp>
 
+#include <metrics/metrics-registry.hpp>
+#include <metrics/scoped-timer.hpp>
+
 namespace gh_hal::internal {
 
 namespace details {
@@ -22,22 +25,56 @@ constexpr void deactivateImpl(
     BoardDigitalPinImpl::backend_type_reference /*lineRequest*/,
     const hardware_access::BoardDigitalPin::offset_type /*offsetValue*/) noexcept {}
 #endif // USE_LIBGPIOD
+
+struct PinWriteMetrics {
+    gc::metrics::Counter& activations;
+    gc::metrics::Counter& deactivations;
+    gc::metrics::Histogram& writeDuration;
+};
+
+//!!
+//! \brief Gets the metrics, registering them the first time.
+//!
+//! \throws std::invalid_argument if a metric with the same name is already registered with
+//!  another kind.
+[[nodiscard]] PinWriteMetrics& GetPinWriteMetrics() {
+    static PinWriteMetrics pinWriteMetrics{
+        gc::metrics::GetDefaultRegistry().counter(
+            "gc_hal_pin_writes_total", "Number of digital pin writes.", {{"state", "active"}}),
+        gc::metrics::GetDefaultRegistry().counter(
+            "gc_hal_pin_writes_total", "Number of digital pin writes.", {{"state", "inactive"}}),
+        gc::metrics::GetDefaultRegistry().histogram("gc_hal_pin_write_duration_ns",
+                                                    "Duration of the digital pin writes.")};
+
+    return pinWriteMetrics;
+}
 } // namespace details
 
 BoardDigitalPinImpl::BoardDigitalPinImpl(
     const hardware_access::BoardDigitalPin::offset_type offsetValue,
     const hardware_access::DigitalPinRequestDirection direction, backend_type_reference backImpl,
-    const hardware_access::DigitalOutPinActivationState activationState) noexcept
+    const hardware_access::DigitalOutPinActivationState activationState)
     : m_offset{offsetValue},
       m_direction{direction},
       m_activationState{activationState},
-      m_backendReference{backImpl} {}
+      m_backendReference{backImpl} {
+    // The metrics are registered here, so the writes never do it.
+    static_cast<void>(details::GetPinWriteMetrics());
+}
 
 void BoardDigitalPinImpl::activate() noexcept {
+    details::PinWriteMetrics& pinWriteMetrics{details::GetPinWriteMetrics()};
+    pinWriteMetrics.activations.increment();
+
+    const gc::metrics::ScopedTimer writeTimer{pinWriteMetrics.writeDuration};
     details::activateImpl(m_backendReference, m_offset);
 }
 
 void BoardDigitalPinImpl::deactivate() noexcept {
+    details::PinWriteMetrics& pinWriteMetrics{details::GetPinWriteMetrics()};
+    pinWriteMetrics.deactivations.increment();
+
+    const gc::metrics::ScopedTimer writeTimer{pinWriteMetrics.writeDuration};
     details::deactivateImpl(m_backendReference, m_offset);
 }
 
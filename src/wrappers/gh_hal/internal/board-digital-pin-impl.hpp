@@ -29,7 +29,7 @@ public:
         const hardware_access::BoardDigitalPin::offset_type offsetValue,
         const hardware_access::DigitalPinRequestDirection direction,
         backend_type_reference backImpl,
-        const hardware_access::DigitalOutPinActivationState activationState) noexcept;
+        const hardware_access::DigitalOutPinActivationState activationState);
 
     [[nodiscard]] hardware_access::DigitalPinRequestDirection getDirection()
         const noexcept override {
@@ -25,7 +25,15 @@ void LineRequest::request_lines(
             backends::libgpiod_impl::requestLines(
                 chip.get(), consumer, offsets, details::LibgpiodConverter.convert(direction),
                 m_activationState == hardware_access::DigitalOutPinActivationState::ActiveLow));
-    } catch (...) {}
+    } catch (...) {
+        return;
+    }
+
+    if (direction == hardware_access::DigitalPinRequestDirection::Output) {
+        m_outputLinesRegistration =
+            OutputLinesRegistration{std::get<1>(*m_lineRequest).fd(),
+                                    static_cast<std::uint32_t>(offsets.size())};
+    }
 }
 
 std::vector<std::unique_ptr<hardware_access::BoardDigitalPin>> LineRequest::getBoardPins()
@@ -63,6 +71,11 @@ void LineRequest::request_lines(
                    [](const hardware_access::BoardDigitalPin::offset_type offset) {
                        return backends::simulated::DigitalBoardPin{offset};
                    });
+
+    if (direction == hardware_access::DigitalPinRequestDirection::Output) {
+        m_outputLinesRegistration =
+            OutputLinesRegistration{-1, static_cast<std::uint32_t>(offsets.size())};
+    }
 }
 
 std::vector<std::unique_ptr<hardware_access::BoardDigitalPin>> LineRequest::getBoardPins()
@@ -2,6 +2,7 @@
 #pragma once
 
 #include <gh_hal/hardware-access/board-digital-pin.hpp>
+#include <gh_hal/internal/output-lines-registry.hpp>
 
 #ifdef USE_LIBGPIOD
 #include <gh_hal/backends/libgpiod/chip-api.hpp>
@@ -101,6 +102,8 @@ public:
 private:
     hardware_access::DigitalOutPinActivationState m_activationState{};
     std::unique_ptr<backend_type> m_lineRequest{};
+    // Declared after the request, so that the lines are unregistered before being released.
+    OutputLinesRegistration m_outputLinesRegistration{};
 
     void request_lines(const consumer_type& consumer, chip_reference chip,
                        const std::vector<offset_type>& offsets,
@@ -0,0 +1,120 @@
+// Copyright (c) 2023 Andrea Ballestrazzi
+#include <gh_hal/internal/output-lines-registry.hpp>
+
+// C++ STL
+#include <array>
+#include <atomic>
+#include <utility>
+
+#ifdef USE_LIBGPIOD
+// POSIX
+#include <linux/gpio.h>
+#include <sys/ioctl.h>
+#endif // USE_LIBGPIOD
+
+namespace gh_hal::internal {
+
+namespace {
+
+constexpr std::size_t MAX_OUTPUT_REQUESTS{64};
+
+//!!
+//! \brief A registered line request. The lines count is written last and cleared first, so a
+//!  cutoff that reads a non-zero count always reads the file descriptor that goes with it.
+//!
+struct OutputLinesSlot {
+    std::atomic_bool bUsed{};
+    std::atomic<int> fileDescriptor{-1};
+    std::atomic<std::uint32_t> linesCount{};
+};
+
+using output_lines_slots = std::array<OutputLinesSlot, MAX_OUTPUT_REQUESTS>;
+
+[[nodiscard]] output_lines_slots& GetOutputLinesSlots() noexcept {
+    static output_lines_slots outputLinesSlots{};
+    return outputLinesSlots;
+}
+
+//! \return True if the lines have been driven to the inactive state.
+[[nodiscard]] bool DriveLinesInactive(const int fileDescriptor,
+                                      [[maybe_unused]] const std::uint32_t linesCount) noexcept {
+    // The simulated lines have no state to drive.
+    if (fileDescriptor < 0)
+        return true;
+
+#ifdef USE_LIBGPIOD
+    // The values are set through the character device of the line request, so that neither
+    // libgpiod nor the pins objects are involved. The lines are addressed by their index
+    // inside the request and the active-low requests are inverted by the kernel.
+    gpio_v2_line_values lineValues{};
+    lineValues.bits = 0;
+    lineValues.mask = linesCount >= 64 ? ~std::uint64_t{} : (std::uint64_t{1} << linesCount) - 1;
+
+    return ::ioctl(fileDescriptor, GPIO_V2_LINE_SET_VALUES_IOCTL, &lineValues) == 0;
+#else
+    return true;
+#endif // USE_LIBGPIOD
+}
+
+} // namespace
+
+OutputLinesRegistration::OutputLinesRegistration(const int fileDescriptor,
+                                                 const std::uint32_t linesCount) noexcept {
+    output_lines_slots& outputLinesSlots{GetOutputLinesSlots()};
+    for (std::size_t i{}; i < outputLinesSlots.size(); ++i) {
+        bool bExpectedUsed{false};
+        if (!outputLinesSlots[i].bUsed.compare_exchange_strong(bExpectedUsed, true,
+                                                               std::memory_order_acq_rel))
+            continue;
+
+        outputLinesSlots[i].fileDescriptor.store(fileDescriptor, std::memory_order_relaxed);
+        outputLinesSlots[i].linesCount.store(linesCount, std::memory_order_release);
+        m_slotIndex = i;
+        return;
+    }
+}
+
+OutputLinesRegistration::~OutputLinesRegistration() noexcept {
+    unregister();
+}
+
+OutputLinesRegistration::OutputLinesRegistration(OutputLinesRegistration&& other) noexcept
+    : m_slotIndex{std::exchange(other.m_slotIndex, NO_SLOT)} {}
+
+OutputLinesRegistration& OutputLinesRegistration::operator=(
+    OutputLinesRegistration&& other) noexcept {
+    if (this != &other) {
+        unregister();
+        m_slotIndex = std::exchange(other.m_slotIndex, NO_SLOT);
+    }
+
+    return *this;
+}
+
+void OutputLinesRegistration::unregister() noexcept {
+    if (m_slotIndex == NO_SLOT)
+        return;
+
+    OutputLinesSlot& outputLinesSlot{GetOutputLinesSlots()[m_slotIndex]};
+    outputLinesSlot.linesCount.store(0, std::memory_order_release);
+    outputLinesSlot.fileDescriptor.store(-1, std::memory_order_relaxed);
+    outputLinesSlot.bUsed.store(false, std::memory_order_release);
+    m_slotIndex = NO_SLOT;
+}
+
+std::size_t ForceRegisteredOutputsInactive() noexcept {
+    std::size_t inactiveLinesCount{};
+    for (const OutputLinesSlot& outputLinesSlot : GetOutputLinesSlots()) {
+        const std::uint32_t linesCount{outputLinesSlot.linesCount.load(std::memory_order_acquire)};
+        if (linesCount == 0)
+            continue;
+
+        if (DriveLinesInactive(outputLinesSlot.fileDescriptor.load(std::memory_order_relaxed),
+                               linesCount))
+            inactiveLinesCount += linesCount;
+    }
+
+    return inactiveLinesCount;
+}
+
+} // namespace gh_hal::internal
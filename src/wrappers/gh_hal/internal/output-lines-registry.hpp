@@ -0,0 +1,57 @@
+// Copyright (c) 2023 Andrea Ballestrazzi
+#pragma once
+
+// C++ STL
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+
+namespace gh_hal::internal {
+
+//!!
+//! \brief Keeps a line request with output lines in the registry used by the emergency cutoff
+//!  for as long as it lives. The registry is a fixed table of atomic slots, so registering,
+//!  unregistering and cutting off never take a lock.
+//!
+class OutputLinesRegistration final {
+public:
+    constexpr OutputLinesRegistration() noexcept = default;
+
+    //!!
+    //! \brief Registers the output lines of a line request. If the registry is full, the lines
+    //!  won't be cut off.
+    //!
+    //! \param[in] fileDescriptor The file descriptor of the line request, or -1 if the lines
+    //!  are simulated.
+    //! \param[in] linesCount The number of lines of the line request.
+    //!
+    OutputLinesRegistration(int fileDescriptor, std::uint32_t linesCount) noexcept;
+    ~OutputLinesRegistration() noexcept;
+
+    OutputLinesRegistration(OutputLinesRegistration&& other) noexcept;
+    OutputLinesRegistration& operator=(OutputLinesRegistration&& other) noexcept;
+
+    OutputLinesRegistration(const OutputLinesRegistration&) = delete;
+    OutputLinesRegistration& operator=(const OutputLinesRegistration&) = delete;
+
+    [[nodiscard]] constexpr explicit operator bool() const noexcept {
+        return m_slotIndex != NO_SLOT;
+    }
+
+private:
+    static constexpr std::size_t NO_SLOT{std::numeric_limits<std::size_t>::max()};
+
+    std::size_t m_slotIndex{NO_SLOT};
+
+    void unregister() noexcept;
+};
+
+//!!
+//! \brief Drives all the registered output lines to their inactive state, writing directly to
+//!  the line requests.
+//!
+//! \return The number of lines driven to the inactive state.
+//!
+std::size_t ForceRegisteredOutputsInactive() noexcept;
+
+} // namespace gh_hal::internal
@@ -2,12 +2,17 @@
 #ifdef USE_SPDLOG
 #include <gh_log/spl-logger.hpp>
 
+#include <metrics/metrics-registry.hpp>
+
 #include <spdlog/sinks/basic_file_sink.h>
 #include <spdlog/sinks/daily_file_sink.h>
+#include <spdlog/sinks/ostream_sink.h>
 #include <spdlog/sinks/stdout_color_sinks.h>
 
 // C++ STL
+#include <array>
 #include <cassert>
+#include <cstddef>
 
 namespace gh_log {
 
@@ -54,6 +59,27 @@ static_assert(LoggingLevelConverter::toSpdlogLevel(ELoggingLevel::Error) ==
 static_assert(LoggingLevelConverter::toSpdlogLevel(ELoggingLevel::Critical) ==
               LoggingLevelConverter::spdlog_logging_level::critical);
 
+//!!
+//! \brief Gets the counter of the messages logged with the given level.
+//!
+[[nodiscard]] gc::metrics::Counter& GetLoggedMessagesCounter(const ELoggingLevel level) {
+    static const std::array<gc::metrics::Counter*, 6> LOGGED_MESSAGES_COUNTERS{[] {
+        constexpr std::array<const char*, 6> LEVEL_NAMES{"trace",   "debug", "info",
+                                                         "warning", "error", "critical"};
+
+        std::array<gc::metrics::Counter*, 6> counters{};
+        for (std::size_t i{}; i < counters.size(); ++i) {
+            counters[i] = &gc::metrics::GetDefaultRegistry().counter(
+                "gc_log_messages_total", "Number of messages logged.",
+                {{"level", LEVEL_NAMES[i]}});
+        }
+
+        return counters;
+    }()};
+
+    return *LOGGED_MESSAGES_COUNTERS[static_cast<std::size_t>(level)];
+}
+
 } // namespace details
 
 SPLLogger::SPLLogger(logger_pointer logger) : m_logger{std::move(logger)} {
@@ -63,40 +89,47 @@ SPLLogger::SPLLogger(logger_pointer logger) : m_logger{std::move(logger)} {
 void SPLLogger::logTrace(const LogStringType& msg) {
     assert(m_logger);
 
+    details::GetLoggedMessagesCounter(ELoggingLevel::Trace).increment();
     m_logger->trace(msg);
 }
 
 void SPLLogger::logDebug(const LogStringType& msg) {
     assert(m_logger);
 
+    details::GetLoggedMessagesCounter(ELoggingLevel::Debug).increment();
     m_logger->debug(msg);
 }
 
 void SPLLogger::logInfo(const LogStringType& msg) {
     assert(m_logger);
 
+    details::GetLoggedMessagesCounter(ELoggingLevel::Info).increment();
     m_logger->info(msg);
 }
 
 void SPLLogger::logWarning(const LogStringType& msg) {
     assert(m_logger);
 
+    details::GetLoggedMessagesCounter(ELoggingLevel::Warning).increment();
     m_logger->warn(msg);
 }
 
 void SPLLogger::logError(const LogStringType& msg) {
     assert(m_logger);
 
+    details::GetLoggedMessagesCounter(ELoggingLevel::Error).increment();
     m_logger->error(msg);
 }
 
 void SPLLogger::logCritical(const LogStringType& msg) {
     assert(m_logger);
 
+    details::GetLoggedMessagesCounter(ELoggingLevel::Critical).increment();
     m_logger->critical(msg);
 }
 
 void SPLLogger::logMessage(const ELoggingLevel level, LogStringType message) {
+    details::GetLoggedMessagesCounter(level).increment();
     m_logger->log(details::LoggingLevelConverter::toSpdlogLevel(level), message);
 }
 
@@ -123,6 +156,15 @@ std::shared_ptr<SPLLogger> SPLLogger::createDailyRotatingLogger(const std::strin
     return std::make_shared<SPLLogger>(spdlog::daily_logger_mt(name, "logs/daily-log.log"));
 }
 
+std::shared_ptr<SPLLogger> SPLLogger::createStreamLogger(const std::string& name,
+                                                        std::ostream& outputStream) {
+    // The stream is flushed with every message so a remote client gets the logs with the
+    // response they belong to.
+    auto streamSink{std::make_shared<spdlog::sinks::ostream_sink_mt>(outputStream, true)};
+    return std::make_shared<SPLLogger>(
+        std::make_shared<spdlog::logger>(name, std::move(streamSink)));
+}
+
 } // namespace gh_log
 
 #endif // USE_SPDLOG
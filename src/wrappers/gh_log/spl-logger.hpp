@@ -9,6 +9,8 @@
 // C++ STL
 #include <filesystem>
 #include <memory>
+#include <ostream>
+#include <string>
 
 namespace gh_log {
 
@@ -33,6 +35,12 @@ public:
     [[nodiscard]] static std::shared_ptr<SPLLogger> createDailyRotatingLogger(
         const std::string& name) noexcept;
 
+    //!!
+    //! \brief Creates a logger that writes to the given stream, e.g. the one of a remote
+    //!  client. The logger isn't registered, so many loggers can share the same name.
+    [[nodiscard]] static std::shared_ptr<SPLLogger> createStreamLogger(const std::string& name,
+                                                                       std::ostream& outputStream);
+
     void logMessage(const ELoggingLevel logLevel, LogStringType message) override;
 
     void logTrace(const LogStringType& msg) override;
@@ -0,0 +1,207 @@
+// Copyright (c) 2023 Andrea Ballestrazzi
+#include <gh_cmd/command-schema.hpp>
+#include <testing-core.hpp>
+
+// C++ STL
+#include <array>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace {
+
+using namespace gh_cmd::schema;
+
+using AutoWateringSchema =
+    CommandSchema<"auto-watering", Switch<"help", 'h'>, Switch<"stop">,
+                  Value<"activation-time", 'A', std::uint64_t>, Value<"start", 'S', std::string>,
+                  Value<"offset", 'O', std::int16_t>, Value<"ratio", 'R', double>>;
+
+using StatusSchema = CommandSchema<"status", Switch<"help", 'h'>>;
+
+using TestCommandTable = CommandTable<AutoWateringSchema, StatusSchema>;
+
+[[nodiscard]] constexpr std::size_t CountTokens(std::string_view line) noexcept {
+    std::size_t tokensCount{};
+    for ([[maybe_unused]] const std::string_view token : Tokenize(line)) {
+        ++tokensCount;
+    }
+
+    return tokensCount;
+}
+
+} // namespace
+
+TEST_CASE("Command schema tokenization unit tests",
+          "[unit][solitary][gh_cmd][schema][Tokenize]") {
+    STATIC_REQUIRE(CountTokens("") == 0);
+    STATIC_REQUIRE(CountTokens(" \t ") == 0);
+    STATIC_REQUIRE(CountTokens("status") == 1);
+    STATIC_REQUIRE(CountTokens("  auto-watering\t-A  600 \r\n") == 3);
+
+    GIVEN("A line with many separators between the tokens") {
+        const std::string line{"  auto-watering\t--start   north \n"};
+
+        WHEN("It's tokenized") {
+            const std::vector<std::string_view> tokens{Tokenize(line).begin(),
+                                                       Tokenize(line).end()};
+
+            THEN("The tokens should be views of the line without the separators") {
+                REQUIRE(tokens.size() == 3);
+                CHECK(tokens[0] == "auto-watering");
+                CHECK(tokens[1] == "--start");
+                CHECK(tokens[2] == "north");
+                CHECK(tokens[2].data() == line.data() + line.find("north"));
+            }
+        }
+    }
+}
+
+TEST_CASE("Command schema perfect hash table unit tests",
+          "[unit][solitary][gh_cmd][schema][PerfectHashTable]") {
+    static constexpr std::array<std::string_view, 8> KEYS{
+        "help", "version", "abort", "exit", "auto-watering", "status", "project", "script"};
+    static constexpr PerfectHashTable<KEYS.size()> TABLE{KEYS};
+
+    SECTION("Every key should be found at its index") {
+        STATIC_REQUIRE(TABLE.find("help") == 0);
+        STATIC_REQUIRE(TABLE.find("project") == 6);
+
+        for (std::size_t i{}; i < KEYS.size(); ++i) {
+            CHECK(TABLE.find(KEYS[i]) == i);
+        }
+    }
+
+    SECTION("The names that aren't keys should not be found") {
+        STATIC_REQUIRE(TABLE.find("") == PerfectHashTable<KEYS.size()>::NOT_FOUND);
+        CHECK(TABLE.find("statu") == PerfectHashTable<KEYS.size()>::NOT_FOUND);
+        CHECK(TABLE.find("statuss") == PerfectHashTable<KEYS.size()>::NOT_FOUND);
+        CHECK(TABLE.find("Help") == PerfectHashTable<KEYS.size()>::NOT_FOUND);
+    }
+}
+
+TEST_CASE("Command schema option parsing unit tests",
+          "[unit][solitary][gh_cmd][schema][ParsedOptions]") {
+    using ParsedOptionsType = AutoWateringSchema::parsed_options;
+
+    STATIC_REQUIRE(ParsedOptionsType::indexOf<"help">() == 0);
+    STATIC_REQUIRE(ParsedOptionsType::indexOf<"ratio">() == 5);
+
+    STATIC_REQUIRE([] {
+        ParsedOptionsType options{};
+        const TokenRange tokens{Tokenize("-A 600 --stop")};
+        return options.parse(tokens.begin(), tokens.end()) &&
+               options.value<"activation-time">() == 600 && options.isSet<"stop">() &&
+               !options.isSet<"help">();
+    }());
+
+    ParsedOptionsType options{};
+    const auto parse{[&options](std::string_view arguments) {
+        const TokenRange tokens{Tokenize(arguments)};
+        return options.parse(tokens.begin(), tokens.end());
+    }};
+
+    SECTION("Long and short names with separated or inline values should be parsed") {
+        REQUIRE(parse("--activation-time 600 -S north --offset=-32768 -R 0.25"));
+
+        CHECK(options.value<"activation-time">() == 600);
+        CHECK(options.value<"start">() == "north");
+        CHECK(options.value<"offset">() == -32768);
+        CHECK(options.value<"ratio">() == 0.25);
+        CHECK_FALSE(options.isSet<"help">());
+        CHECK(options.valueOr<"stop">(false) == false);
+    }
+
+    SECTION("A new parsing should clear the previous values") {
+        REQUIRE(parse("-h -A 600"));
+        REQUIRE(parse("--stop"));
+
+        CHECK(options.isSet<"stop">());
+        CHECK_FALSE(options.isSet<"help">());
+        CHECK_FALSE(options.isSet<"activation-time">());
+    }
+
+    SECTION("The invalid lines should be reported with the offending token") {
+        const ParseResult unknownOption{parse("-A 600 --activation")};
+        CHECK(unknownOption.error == ParseError::UnknownOption);
+        CHECK(unknownOption.token == "--activation");
+
+        const ParseResult missingValue{parse("--start")};
+        CHECK(missingValue.error == ParseError::MissingValue);
+        CHECK(missingValue.token == "--start");
+
+        const ParseResult negativeUnsigned{parse("-A -1")};
+        CHECK(negativeUnsigned.error == ParseError::InvalidValue);
+        CHECK(negativeUnsigned.token == "-1");
+
+        const ParseResult outOfRange{parse("--offset 32768")};
+        CHECK(outOfRange.error == ParseError::InvalidValue);
+        CHECK(outOfRange.token == "32768");
+
+        const ParseResult switchWithValue{parse("--stop=true")};
+        CHECK(switchWithValue.error == ParseError::InvalidValue);
+
+        const ParseResult positionalArgument{parse("north")};
+        CHECK(positionalArgument.error == ParseError::UnexpectedArgument);
+        CHECK(ParseErrorToString(positionalArgument.error) == "unexpected argument");
+    }
+
+    SECTION("The handlers of the set options should be invoked with the typed values") {
+        REQUIRE(parse("--stop -A 600"));
+
+        bool bStopHandled{};
+        std::uint64_t activationTime{};
+        bool bOtherHandled{};
+        options.visit([&bOtherHandled] { bOtherHandled = true; },
+                      [&bStopHandled] { bStopHandled = true; },
+                      [&activationTime](const std::uint64_t value) { activationTime = value; },
+                      [&bOtherHandled](const std::string&) { bOtherHandled = true; },
+                      [&bOtherHandled](std::int16_t) { bOtherHandled = true; },
+                      [&bOtherHandled](double) { bOtherHandled = true; });
+
+        CHECK(bStopHandled);
+        CHECK(activationTime == 600);
+        CHECK_FALSE(bOtherHandled);
+    }
+}
+
+TEST_CASE("Command schema command table unit tests",
+          "[unit][solitary][gh_cmd][schema][CommandTable]") {
+    STATIC_REQUIRE(TestCommandTable::find("auto-watering") == 0);
+    STATIC_REQUIRE(TestCommandTable::find("status") == 1);
+    STATIC_REQUIRE(TestCommandTable::find("project") == TestCommandTable::NOT_FOUND);
+
+    std::uint64_t activationTime{};
+    bool bStatusHelpRequested{};
+    const auto dispatch{[&](std::string_view line) {
+        return TestCommandTable::dispatch(
+            line,
+            [&activationTime](const AutoWateringSchema::parsed_options& options) {
+                activationTime = options.valueOr<"activation-time">(std::uint64_t{});
+            },
+            [&bStatusHelpRequested](const StatusSchema::parsed_options& options) {
+                bStatusHelpRequested = options.isSet<"help">();
+            });
+    }};
+
+    SECTION("The line should be dispatched to the handler of its command") {
+        CHECK(dispatch("auto-watering -A 600"));
+        CHECK(activationTime == 600);
+
+        CHECK(dispatch("  status --help"));
+        CHECK(bStatusHelpRequested);
+    }
+
+    SECTION("The handler should not be invoked if the line is invalid") {
+        const ParseResult invalidOption{dispatch("status --verbose")};
+        CHECK(invalidOption.error == ParseError::UnknownOption);
+        CHECK_FALSE(bStatusHelpRequested);
+
+        const ParseResult unknownCommand{dispatch("project --save")};
+        CHECK(unknownCommand.error == ParseError::UnknownCommand);
+        CHECK(unknownCommand.token == "project");
+
+        CHECK(dispatch(" \t").error == ParseError::EmptyLine);
+    }
+}
@@ -0,0 +1,82 @@
+// Copyright (c) 2023 Andrea Ballestrazzi
+#include <gh_hal/backends/simulated/scripted-sensor-source.hpp>
+
+#include <testing-core.hpp>
+
+// C++ STL
+#include <cmath>
+#include <optional>
+#include <stdexcept>
+#include <vector>
+
+TEST_CASE("ScriptedSensorSource unit tests",
+          "[unit][solitary][gh_hal][backends][simulated][ScriptedSensorSource]") {
+    using gh_hal::backends::simulated::ScriptedSensorSource;
+    using gh_hal::backends::simulated::SensorScriptStep;
+    using Kind = SensorScriptStep::Kind;
+
+    const std::vector<SensorScriptStep> script{
+        SensorScriptStep{.kind = Kind::Constant, .fromValue = 20.0, .readsCount = 2},
+        SensorScriptStep{.kind = Kind::Ramp, .fromValue = 10.0, .toValue = 40.0, .readsCount = 4},
+        SensorScriptStep{.kind = Kind::Failure, .readsCount = 1}};
+
+    GIVEN("A looping scripted sensor") {
+        ScriptedSensorSource sourceUnderTest{script};
+
+        WHEN("It's read more times than the script length") {
+            std::vector<std::optional<double>> values{};
+            for (int i{}; i < 9; ++i)
+                values.push_back(sourceUnderTest.read());
+
+            THEN("It should play the steps in order and restart") {
+                const std::vector<std::optional<double>> expectedValues{
+                    20.0, 20.0, 10.0, 20.0, 30.0, 40.0, std::nullopt, 20.0, 20.0};
+                CHECK(values == expectedValues);
+                CHECK(sourceUnderTest.getReadsCount() == 9);
+            }
+        }
+    }
+
+    GIVEN("A scripted sensor that doesn't loop") {
+        ScriptedSensorSource sourceUnderTest{{SensorScriptStep{.kind = Kind::Ramp,
+                                                               .fromValue = 0.0,
+                                                               .toValue = 1.0,
+                                                               .readsCount = 2}},
+                                             false};
+
+        WHEN("The script ends") {
+            CHECK(sourceUnderTest.read() == 0.0);
+            CHECK(sourceUnderTest.read() == 1.0);
+
+            THEN("It should keep returning its last value") {
+                CHECK(sourceUnderTest.read() == 1.0);
+                CHECK(sourceUnderTest.read() == 1.0);
+            }
+        }
+    }
+
+    GIVEN("Two noisy scripted sensors with the same seed") {
+        ScriptedSensorSource firstSource{script, true, 0.5, 42};
+        ScriptedSensorSource secondSource{script, true, 0.5, 42};
+
+        THEN("They should return the same values within the noise amplitude") {
+            for (int i{}; i < 6; ++i) {
+                const std::optional<double> firstValue{firstSource.read()};
+                const std::optional<double> secondValue{secondSource.read()};
+
+                REQUIRE(firstValue.has_value());
+                CHECK(firstValue == secondValue);
+                CHECK(std::abs(*firstValue - 25.0) <= 15.5);
+            }
+        }
+    }
+
+    GIVEN("An invalid script") {
+        THEN("The construction should fail") {
+            CHECK_THROWS_AS(ScriptedSensorSource{{}}, std::invalid_argument);
+            CHECK_THROWS_AS(ScriptedSensorSource{{SensorScriptStep{.readsCount = 0}}},
+                            std::invalid_argument);
+            CHECK_THROWS_AS((ScriptedSensorSource{script, true, -1.0}), std::invalid_argument);
+        }
+    }
+}
@@ -0,0 +1,102 @@
+// Copyright (c) 2023 Andrea Ballestrazzi
+
+#include <gh_hal/hardware-access/output-cutoff.hpp>
+#include <gh_hal/internal/output-lines-registry.hpp>
+
+// Test frameworks.
+#include <testing-core.hpp>
+
+// C++ STL
+#include <cstddef>
+#include <memory>
+#include <utility>
+#include <vector>
+
+TEST_CASE("OutputLinesRegistration unit tests",
+          "[unit][solitary][gh_hal][internal][OutputLinesRegistration]") {
+    using gh_hal::internal::ForceRegisteredOutputsInactive;
+    using gh_hal::internal::OutputLinesRegistration;
+
+    // Other line requests may be alive while the tests run: the counts are relative to them.
+    const std::size_t previousLinesCount{ForceRegisteredOutputsInactive()};
+
+    GIVEN("A default constructed registration") {
+        const OutputLinesRegistration registrationUnderTest{};
+
+        THEN("It should not register any line") {
+            CHECK_FALSE(static_cast<bool>(registrationUnderTest));
+            CHECK(ForceRegisteredOutputsInactive() == previousLinesCount);
+        }
+    }
+
+    GIVEN("The registration of a simulated line request with 3 output lines") {
+        auto registrationUnderTest{std::make_unique<OutputLinesRegistration>(-1, 3)};
+
+        THEN("The cutoff should drive its lines") {
+            REQUIRE(static_cast<bool>(*registrationUnderTest));
+            CHECK(ForceRegisteredOutputsInactive() == previousLinesCount + 3);
+        }
+
+        WHEN("The registration is moved") {
+            const OutputLinesRegistration movedRegistration{std::move(*registrationUnderTest)};
+
+            THEN("Its lines should be driven once") {
+                CHECK_FALSE(static_cast<bool>(*registrationUnderTest));
+                CHECK(static_cast<bool>(movedRegistration));
+                CHECK(ForceRegisteredOutputsInactive() == previousLinesCount + 3);
+            }
+        }
+
+        WHEN("The registration is destroyed") {
+            registrationUnderTest.reset();
+
+            THEN("The cutoff should not drive its lines anymore") {
+                CHECK(ForceRegisteredOutputsInactive() == previousLinesCount);
+            }
+        }
+    }
+
+    GIVEN("More registrations than the registry can hold") {
+        constexpr std::size_t REGISTRATIONS_COUNT{128};
+
+        std::vector<OutputLinesRegistration> registrations{};
+        registrations.reserve(REGISTRATIONS_COUNT);
+        for (std::size_t i{}; i < REGISTRATIONS_COUNT; ++i)
+            registrations.emplace_back(-1, 1);
+
+        THEN("Only the registered lines should be driven") {
+            std::size_t registeredCount{};
+            for (const OutputLinesRegistration& registration : registrations) {
+                if (static_cast<bool>(registration))
+                    ++registeredCount;
+            }
+
+            CHECK(registeredCount < REGISTRATIONS_COUNT);
+            CHECK_FALSE(static_cast<bool>(registrations.back()));
+            CHECK(ForceRegisteredOutputsInactive() == previousLinesCount + registeredCount);
+        }
+
+        WHEN("A registration is released") {
+            registrations.front() = OutputLinesRegistration{};
+            const OutputLinesRegistration newRegistration{-1, 1};
+
+            THEN("Its slot should be reused") {
+                CHECK(static_cast<bool>(newRegistration));
+            }
+        }
+    }
+}
+
+TEST_CASE("ForceAllOutputsInactive unit tests",
+          "[unit][solitary][gh_hal][hardware-access][ForceAllOutputsInactive]") {
+    using gh_hal::internal::OutputLinesRegistration;
+
+    GIVEN("A registered simulated line request") {
+        const std::size_t previousLinesCount{gh_hal::hardware_access::ForceAllOutputsInactive()};
+        const OutputLinesRegistration registration{-1, 2};
+
+        THEN("The cutoff should drive the registered lines") {
+            CHECK(gh_hal::hardware_access::ForceAllOutputsInactive() == previousLinesCount + 2);
+        }
+    }
+}
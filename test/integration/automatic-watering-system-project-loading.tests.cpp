@@ -104,3 +104,60 @@ SCENARIO("AWS configuration loading integration tests",
         }
     }
 }
+
+SCENARIO("AWS configuration loading without devices integration tests",
+         "[integration][AutomaticWateringSystem][Project][ProjectController]") {
+    using namespace rpi_gc::gc_project;
+    using namespace gc::project_management;
+    using namespace rpi_gc::automatic_watering;
+    using namespace std::string_literals;
+    using ::testing::_;
+    using ::testing::StrictMock;
+
+    std::shared_ptr<StrictMock<gh_log::mocks::LoggerMock>> mainLoggerMock{
+        std::make_shared<StrictMock<gh_log::mocks::LoggerMock>>()};
+    std::shared_ptr<StrictMock<gh_log::mocks::LoggerMock>> userLoggerMock{
+        std::make_shared<StrictMock<gh_log::mocks::LoggerMock>>()};
+
+    std::unique_ptr<StrictMock<mocks::WateringSystemHardwareControllerMock>> hardwareControllerMock{
+        std::make_unique<StrictMock<mocks::WateringSystemHardwareControllerMock>>()};
+    std::atomic<WateringSystemHardwareController*> atomicHardwareController{
+        hardwareControllerMock.get()};
+
+    std::shared_ptr<StrictMock<mocks::WateringSystemTimeProviderMock>> timeProviderMock{
+        std::make_shared<StrictMock<mocks::WateringSystemTimeProviderMock>>()};
+    std::atomic<WateringSystemTimeProvider*> timeProviderAtomic{timeProviderMock.get()};
+    std::mutex hardwareAccessMutex{};
+
+    DailyCycleAutomaticWateringSystem awsUnderTest{
+        std::ref(hardwareAccessMutex), mainLoggerMock, userLoggerMock,
+        std::ref(atomicHardwareController), std::ref(timeProviderAtomic)};
+
+    ProjectController projectController{};
+    Project project{
+        Project::time_point_type{},
+        "TestProject", semver::version{1, 2, 0}
+    };
+
+    // The flow node doesn't contain the devices array.
+    ProjectNode automaticWateringSystemNode{}, awsFlowNode{};
+    awsFlowNode.addValue("activationTime", 600ull);
+    awsFlowNode.addValue("deactivationTime", 1200ull);
+    awsFlowNode.addValue("deactivationSepTime", 300ull);
+
+    automaticWateringSystemNode.addObject("flow", std::move(awsFlowNode));
+    automaticWateringSystemNode.addValue("mode", "cycled");
+
+    project.addObject("automaticWateringSystem", std::move(automaticWateringSystemNode));
+    projectController.setCurrentProject(std::move(project));
+    projectController.registerProjectComponent(awsUnderTest);
+
+    WHEN("The configuration loading for the AWS is triggered") {
+        THEN("The configuration should be rejected without touching the hardware") {
+            EXPECT_CALL(*userLoggerMock, logError(_)).Times(1);
+            EXPECT_CALL(*mainLoggerMock, logError(_)).Times(1);
+
+            CHECK_NOTHROW(projectController.loadProjectData());
+        }
+    }
+}
@@ -81,10 +81,11 @@ SCENARIO("Daily-Cycle AWS project data saving",
                 AND_THEN("The flow description should be correct") {
                     const auto& awsFlowValues{awsFlowObject.getValues()};
 
-                    REQUIRE(awsFlowValues.size() == 3);
+                    REQUIRE(awsFlowValues.size() == 4);
                     REQUIRE(awsFlowValues.contains("activationTime"));
                     REQUIRE(awsFlowValues.contains("deactivationTime"));
                     REQUIRE(awsFlowValues.contains("deactivationSepTime"));
+                    REQUIRE(awsFlowValues.contains("flowRate"));
 
                     CHECK(std::get<std::int64_t>(awsFlowValues.at("activationTime")) ==
                           timeProvider->getWateringSystemActivationDuration().count());
@@ -92,6 +93,7 @@ SCENARIO("Daily-Cycle AWS project data saving",
                           timeProvider->getWateringSystemDeactivationDuration().count());
                     CHECK(std::get<std::int64_t>(awsFlowValues.at("deactivationSepTime")) ==
                           timeProvider->getPumpValveDeactivationTimeSeparation().count());
+                    CHECK(std::get<double>(awsFlowValues.at("flowRate")) == 0.0);
                 }
 
                 AND_THEN("The flow should have two devices") {
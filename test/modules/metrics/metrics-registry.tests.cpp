@@ -0,0 +1,73 @@
+// Copyright (c) 2023 Andrea Ballestrazzi
+#include <metrics/metrics-registry.hpp>
+
+#include <testing-core.hpp>
+
+// C++ STL
+#include <stdexcept>
+#include <variant>
+#include <vector>
+
+TEST_CASE("MetricsRegistry unit tests", "[unit][solitary][modules][metrics][MetricsRegistry]") {
+    using namespace gc::metrics;
+
+    GIVEN("A registry") {
+        MetricsRegistry registry{};
+
+        WHEN("A metric is requested twice with the same name and labels") {
+            Counter& firstCounter{
+                registry.counter("writes_total", "Number of writes.", {{"state", "active"}})};
+            Counter& secondCounter{
+                registry.counter("writes_total", "Other help.", {{"state", "active"}})};
+
+            THEN("The same metric should be returned") {
+                CHECK(&firstCounter == &secondCounter);
+            }
+        }
+
+        WHEN("A metric is requested with other labels") {
+            Counter& activeCounter{
+                registry.counter("writes_total", "Number of writes.", {{"state", "active"}})};
+            Counter& inactiveCounter{
+                registry.counter("writes_total", "Number of writes.", {{"state", "inactive"}})};
+
+            THEN("A new metric should be created") {
+                CHECK(&activeCounter != &inactiveCounter);
+            }
+        }
+
+        WHEN("A name is requested with another kind") {
+            [[maybe_unused]] Counter& counter{registry.counter("writes_total", "")};
+
+            THEN("An exception should be thrown") {
+                CHECK_THROWS_AS(registry.gauge("writes_total", ""), std::invalid_argument);
+                CHECK_THROWS_AS(registry.histogram("writes_total", ""), std::invalid_argument);
+            }
+        }
+
+        WHEN("The metrics are recorded and collected") {
+            registry.counter("writes_total", "Number of writes.").increment(3);
+            registry.gauge("running_jobs", "Number of running jobs.").add(2);
+            registry.histogram("write_duration_ns", "Duration of the writes.").record(150);
+
+            const std::vector<MetricSample> samples{registry.collect()};
+
+            THEN("The samples should hold the values in registration order") {
+                REQUIRE(samples.size() == 3);
+
+                CHECK(samples[0].descriptor.name == "writes_total");
+                CHECK(samples[0].descriptor.help == "Number of writes.");
+                CHECK(samples[0].descriptor.kind == MetricKind::Counter);
+                CHECK(std::get<Counter::value_type>(samples[0].value) == 3);
+
+                CHECK(samples[1].descriptor.kind == MetricKind::Gauge);
+                CHECK(std::get<Gauge::value_type>(samples[1].value) == 2);
+
+                CHECK(samples[2].descriptor.kind == MetricKind::Histogram);
+                const auto& snapshot{std::get<HistogramSnapshot>(samples[2].value)};
+                CHECK(snapshot.count == 1);
+                CHECK(snapshot.sum == 150);
+            }
+        }
+    }
+}
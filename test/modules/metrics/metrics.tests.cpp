@@ -0,0 +1,127 @@
+// Copyright (c) 2023 Andrea Ballestrazzi
+#include <metrics/counter.hpp>
+#include <metrics/gauge.hpp>
+#include <metrics/histogram.hpp>
+#include <metrics/scoped-timer.hpp>
+
+#include <testing-core.hpp>
+
+// C++ STL
+#include <chrono>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+namespace {
+
+constexpr std::size_t THREADS_COUNT{4};
+constexpr std::size_t RECORDS_PER_THREAD{10'000};
+
+template <typename RecordFunction>
+void RecordFromManyThreads(RecordFunction recordFunction) {
+    std::vector<std::jthread> threads{};
+    for (std::size_t i{}; i < THREADS_COUNT; ++i) {
+        threads.emplace_back([&recordFunction] {
+            for (std::size_t j{}; j < RECORDS_PER_THREAD; ++j)
+                recordFunction(j);
+        });
+    }
+}
+
+} // namespace
+
+TEST_CASE("Counter and Gauge unit tests", "[unit][solitary][modules][metrics][Counter][Gauge]") {
+    using namespace gc::metrics;
+
+    SECTION("The counter should sum the increments of all the threads") {
+        Counter counter{};
+        counter.increment(5);
+        RecordFromManyThreads([&counter](std::size_t) { counter.increment(); });
+
+        CHECK(counter.getValue() == 5 + THREADS_COUNT * RECORDS_PER_THREAD);
+    }
+
+    SECTION("The gauge should go up and down") {
+        Gauge gauge{};
+        gauge.add(10);
+        gauge.sub(25);
+        CHECK(gauge.getValue() == -15);
+
+        gauge.set(42);
+        CHECK(gauge.getValue() == 42);
+
+        RecordFromManyThreads([&gauge](std::size_t j) {
+            if (j % 2 == 0) {
+                gauge.add(3);
+            } else {
+                gauge.sub(1);
+            }
+        });
+
+        CHECK(gauge.getValue() ==
+              42 + static_cast<Gauge::value_type>(THREADS_COUNT * RECORDS_PER_THREAD));
+    }
+}
+
+TEST_CASE("Histogram unit tests", "[unit][solitary][modules][metrics][Histogram]") {
+    using namespace gc::metrics;
+
+    SECTION("Small values have their own bucket") {
+        STATIC_CHECK(HistogramBuckets::GetBucketIndex(0) == 0);
+        STATIC_CHECK(HistogramBuckets::GetBucketIndex(15) == 15);
+        STATIC_CHECK(HistogramBuckets::GetBucketIndex(16) == 16);
+    }
+
+    SECTION("Every bucket contains the values between its bounds") {
+        for (std::size_t i{}; i < HistogramBuckets::BUCKETS_COUNT; ++i) {
+            const auto lowerBound{HistogramBuckets::GetBucketLowerBound(i)};
+            const auto upperBound{HistogramBuckets::GetBucketUpperBound(i)};
+
+            CHECK(HistogramBuckets::GetBucketIndex(lowerBound) == i);
+            CHECK(HistogramBuckets::GetBucketIndex(upperBound) == i);
+            CHECK(upperBound - lowerBound <= lowerBound / HistogramBuckets::SUB_BUCKETS_COUNT);
+        }
+
+        CHECK(HistogramBuckets::GetBucketIndex(HistogramBuckets::MAX_VALUE + 1000) ==
+              HistogramBuckets::BUCKETS_COUNT - 1);
+    }
+
+    SECTION("The snapshot should merge the values recorded by all the threads") {
+        Histogram histogram{};
+        RecordFromManyThreads([&histogram](std::size_t j) { histogram.record((j + 1) * 100); });
+
+        const HistogramSnapshot snapshot{histogram.getSnapshot()};
+        CHECK(snapshot.count == THREADS_COUNT * RECORDS_PER_THREAD);
+        CHECK(snapshot.max == RECORDS_PER_THREAD * 100);
+        CHECK(snapshot.sum ==
+              THREADS_COUNT * 100 * RECORDS_PER_THREAD * (RECORDS_PER_THREAD + 1) / 2);
+        CHECK(snapshot.getMean() == 100.0 * (RECORDS_PER_THREAD + 1) / 2);
+
+        const auto median{snapshot.getValueAtQuantile(0.5)};
+        CHECK(median >= 500'000);
+        CHECK(median <= 500'000 + 500'000 / HistogramBuckets::SUB_BUCKETS_COUNT);
+        CHECK(snapshot.getValueAtQuantile(1.0) == snapshot.max);
+    }
+
+    SECTION("An empty histogram should have no quantiles") {
+        const HistogramSnapshot snapshot{Histogram{}.getSnapshot()};
+
+        CHECK(snapshot.count == 0);
+        CHECK(snapshot.getValueAtQuantile(0.99) == 0);
+        CHECK(snapshot.getMean() == 0.0);
+    }
+
+    SECTION("The scoped timer should record the elapsed time") {
+        using namespace std::chrono_literals;
+
+        Histogram histogram{};
+        {
+            const ScopedTimer timer{histogram};
+            std::this_thread::sleep_for(1ms);
+        }
+
+        const HistogramSnapshot snapshot{histogram.getSnapshot()};
+        CHECK(snapshot.count == 1);
+        CHECK(snapshot.max >= 1'000'000);
+    }
+}
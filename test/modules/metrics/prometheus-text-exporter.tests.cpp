@@ -0,0 +1,76 @@
+// Copyright (c) 2023 Andrea Ballestrazzi
+#include <metrics/metrics-registry.hpp>
+#include <metrics/prometheus-text-exporter.hpp>
+
+#include <testing-core.hpp>
+
+// C++ STL
+#include <string>
+#include <string_view>
+
+TEST_CASE("PrometheusTextExporter unit tests",
+          "[unit][solitary][modules][metrics][PrometheusTextExporter]") {
+    using namespace gc::metrics;
+
+    GIVEN("A registry with counters, gauges and histograms") {
+        MetricsRegistry registry{};
+        registry.counter("gc_writes_total", "Number of writes.", {{"state", "active"}})
+            .increment(3);
+        registry.gauge("gc_running_jobs", "Number of running jobs.").add(-2);
+        registry.counter("gc_writes_total", "Number of writes.", {{"state", "inactive"}})
+            .increment(1);
+        [[maybe_unused]] const Counter& escapedCounter{registry.counter(
+            "gc_escaped_total", "Back\\slash and\nnew line.", {{"path", "C:\\\"dir\"\n"}})};
+
+        Histogram& durationHistogram{registry.histogram("gc_write_duration_ns", "Duration.")};
+        for (std::uint64_t value{1}; value <= 100; ++value)
+            durationHistogram.record(value);
+
+        PrometheusTextExporter exporter{registry};
+
+        WHEN("The metrics are rendered") {
+            const std::string text{exporter.render()};
+
+            THEN("The samples of a metric should be grouped under a single header") {
+                CHECK(text.starts_with("# HELP gc_writes_total Number of writes.\n"
+                                       "# TYPE gc_writes_total counter\n"
+                                       "gc_writes_total{state=\"active\"} 3\n"
+                                       "gc_writes_total{state=\"inactive\"} 1\n"
+                                       "# HELP gc_running_jobs Number of running jobs.\n"
+                                       "# TYPE gc_running_jobs gauge\n"
+                                       "gc_running_jobs -2\n"));
+            }
+
+            THEN("The help texts and the label values should be escaped") {
+                CHECK(text.find("# HELP gc_escaped_total Back\\\\slash and\\nnew line.\n") !=
+                      std::string::npos);
+                CHECK(text.find("gc_escaped_total{path=\"C:\\\\\\\"dir\\\"\\n\"} 0\n") !=
+                      std::string::npos);
+            }
+
+            THEN("The histograms should be rendered as summaries") {
+                CHECK(text.ends_with("# HELP gc_write_duration_ns Duration.\n"
+                                     "# TYPE gc_write_duration_ns summary\n"
+                                     "gc_write_duration_ns{quantile=\"0.5\"} 51\n"
+                                     "gc_write_duration_ns{quantile=\"0.9\"} 91\n"
+                                     "gc_write_duration_ns{quantile=\"0.99\"} 99\n"
+                                     "gc_write_duration_ns{quantile=\"0.999\"} 100\n"
+                                     "gc_write_duration_ns_sum 5050\n"
+                                     "gc_write_duration_ns_count 100\n"));
+            }
+        }
+
+        WHEN("The metrics are rendered again") {
+            const std::string_view firstText{exporter.render()};
+            const char* const firstBuffer{firstText.data()};
+
+            registry.gauge("gc_running_jobs", "Number of running jobs.").add(2);
+            const std::string_view secondText{exporter.render()};
+
+            THEN("The new values should be rendered in the same buffer") {
+                CHECK(secondText.find("gc_running_jobs 0\n") != std::string_view::npos);
+                CHECK(secondText.data() == firstBuffer);
+            }
+        }
+    }
+}
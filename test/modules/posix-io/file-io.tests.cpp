@@ -0,0 +1,74 @@
+// Copyright (c) 2023 Andrea Ballestrazzi
+#include <posix-io/file-io.hpp>
+#include <posix-io/system-error.hpp>
+
+#include <testing-core.hpp>
+
+// C++ STL
+#include <array>
+#include <cerrno>
+#include <cstdint>
+#include <filesystem>
+#include <string>
+#include <system_error>
+#include <vector>
+
+// POSIX
+#include <fcntl.h>
+#include <unistd.h>
+
+TEST_CASE("POSIX file IO unit tests", "[unit][sociable][modules][posix-io]") {
+    using namespace gc::posix_io;
+
+    const std::filesystem::path filePath{std::filesystem::temp_directory_path() /
+                                         "fep-posix-io-tests.bin"};
+    std::filesystem::remove(filePath);
+
+    SECTION("The fields should be loaded as they were stored") {
+        std::array<std::uint8_t, 16> bytes{};
+        StoreField(bytes, 0, std::uint32_t{0x53544347});
+        StoreField(bytes, 4, std::uint16_t{7});
+        StoreField(bytes, 8, -2.5);
+
+        const std::span<const std::uint8_t> storedBytes{bytes};
+        CHECK(LoadField<std::uint32_t>(storedBytes, 0) == 0x53544347);
+        CHECK(LoadField<std::uint16_t>(storedBytes, 4) == 7);
+        CHECK(LoadField<double>(storedBytes, 8) == -2.5);
+    }
+
+    SECTION("The written bytes should be read back at their offset") {
+        const int fileDescriptor{::open(filePath.c_str(), O_RDWR | O_CREAT | O_CLOEXEC, 0644)};
+        REQUIRE(fileDescriptor >= 0);
+        const FileDescriptorGuard fileDescriptorGuard{fileDescriptor};
+
+        const std::vector<std::uint8_t> writtenBytes(4096, 0xA5);
+        WriteAll(fileDescriptor, writtenBytes.data(), writtenBytes.size(), 8, "write");
+
+        std::vector<std::uint8_t> readBytes(writtenBytes.size());
+        CHECK(ReadAll(fileDescriptor, readBytes.data(), readBytes.size(), 8, "read"));
+        CHECK(readBytes == writtenBytes);
+
+        // The read past the end of the file.
+        CHECK_FALSE(ReadAll(fileDescriptor, readBytes.data(), readBytes.size(), 16, "read"));
+    }
+
+    SECTION("The errors should be thrown with the errno and the description") {
+        std::error_code errorCode{};
+        std::string errorMessage{};
+        try {
+            errno = EBADF;
+            ThrowSystemError("Unable to do it");
+        } catch (const std::system_error& exc) {
+            errorCode = exc.code();
+            errorMessage = exc.what();
+        }
+
+        CHECK(errorCode == std::error_code{EBADF, std::system_category()});
+        CHECK(errorMessage.starts_with("Unable to do it"));
+
+        const std::array<std::uint8_t, 1> bytes{};
+        CHECK_THROWS_AS(WriteAll(-1, bytes.data(), bytes.size(), 0, "write"), std::system_error);
+    }
+
+    std::filesystem::remove(filePath);
+}
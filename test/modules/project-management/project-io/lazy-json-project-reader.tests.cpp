@@ -0,0 +1,208 @@
+// Copyright (c) 2023 Andrea Ballestrazzi
+
+#include <project-management/project.hpp>
+#include <src/project-io/lazy-json-project-reader.hpp>
+
+#include <testing-core.hpp>
+
+// C++ STL
+#include <chrono>
+#include <cstdint>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+TEST_CASE("LazyJsonProjectReader root members indexing unit tests",
+          "[unit][solitary][modules][project-management][project-io][LazyJsonProjectReader]") {
+    using namespace gc::project_management::project_io;
+
+    SECTION("Should index every root member with the exact value range") {
+        constexpr std::string_view document{
+            R"( { "a": 1, "b" : "x}\"y", "c": { "d": [1, {"e": "]"}] }, "f": [ ] } )"};
+
+        const auto members{details::IndexJsonRootMembers(document)};
+
+        REQUIRE(members.size() == 4);
+        CHECK(members[0].key == "a");
+        CHECK(document.substr(members[0].valueBegin,
+                              members[0].valueEnd - members[0].valueBegin) == "1");
+        CHECK(members[1].key == "b");
+        CHECK(document.substr(members[1].valueBegin,
+                              members[1].valueEnd - members[1].valueBegin) == R"("x}\"y")");
+        CHECK(members[2].key == "c");
+        CHECK(document.substr(members[2].valueBegin,
+                              members[2].valueEnd - members[2].valueBegin) ==
+              R"({ "d": [1, {"e": "]"}] })");
+        CHECK(members[3].key == "f");
+        CHECK(document.substr(members[3].valueBegin,
+                              members[3].valueEnd - members[3].valueBegin) == "[ ]");
+    }
+
+    SECTION("Should decode keys with escape sequences") {
+        const auto members{details::IndexJsonRootMembers(R"({"a\"b": true})")};
+
+        REQUIRE(members.size() == 1);
+        CHECK(members[0].key == "a\"b");
+    }
+
+    SECTION("Should return no members for an empty object") {
+        CHECK(details::IndexJsonRootMembers(" {} ").empty());
+    }
+
+    SECTION("Should throw a std::runtime_error if the document is malformed") {
+        CHECK_THROWS_AS(details::IndexJsonRootMembers(""), std::runtime_error);
+        CHECK_THROWS_AS(details::IndexJsonRootMembers("[1, 2]"), std::runtime_error);
+        CHECK_THROWS_AS(details::IndexJsonRootMembers(R"({"a": {"b": 1})"), std::runtime_error);
+        CHECK_THROWS_AS(details::IndexJsonRootMembers(R"({"a" 1})"), std::runtime_error);
+        CHECK_THROWS_AS(details::IndexJsonRootMembers(R"({"a": 1} 2)"), std::runtime_error);
+    }
+}
+
+TEST_CASE("LazyJsonProjectReader unit tests",
+          "[unit][sociable][modules][project-management][project-io][LazyJsonProjectReader]") {
+    using namespace gc::project_management;
+    using namespace gc::project_management::project_io;
+
+    GIVEN("A project with values, arrays and objects") {
+        auto inputStream{std::make_unique<std::istringstream>(R"(
+            {
+                "creation_timedate": 1672576240,
+                "title": "test-title",
+                "version": "1.2.3",
+                "test-value": -42,
+                "test-value-array": [1, 2, 3],
+                "test-object-array": [{"a": true}],
+                "test-value-object": {
+                    "test-value": 42,
+                    "test-nested-object": {
+                        "test-str": "nested"
+                    }
+                }
+            }
+        )")};
+
+        const Project expectedProject{
+            std::chrono::system_clock::from_time_t(1672576240), "test-title",
+            semver::version{1, 2, 3}
+        };
+
+        LazyJsonProjectReader projectReaderUnderTest{std::move(inputStream)};
+
+        WHEN("The project is read") {
+            Project inputProject{};
+            projectReaderUnderTest >> inputProject;
+
+            THEN("The read project basic data should be correct") {
+                REQUIRE(SoftCompareProjects(inputProject, expectedProject));
+            }
+
+            THEN("Values and arrays should be read eagerly") {
+                CHECK(inputProject.getValue<std::int64_t>("test-value") == -42);
+                CHECK(inputProject.getValueArray("test-value-array").size() == 3);
+                CHECK(inputProject.getObjectArray("test-object-array").size() == 1);
+            }
+
+            THEN("The object should be reported as present before being accessed") {
+                CHECK(inputProject.containsObject("test-value-object"));
+                CHECK(inputProject.contains("test-value-object"));
+            }
+
+            THEN("The object should be fully read when accessed") {
+                const auto& obj{inputProject.getObject("test-value-object")};
+
+                CHECK(obj.getValue<std::uint64_t>("test-value") == 42);
+                CHECK(obj.getObject("test-nested-object").getValue<std::string>("test-str") ==
+                      "nested");
+            }
+
+            THEN("A copy of the project should be able to read the object") {
+                const Project projectCopy{inputProject};
+
+                CHECK(projectCopy.getObject("test-value-object")
+                          .getValue<std::uint64_t>("test-value") == 42);
+            }
+
+            THEN("All the objects should be available when they're enumerated") {
+                const auto& objects{inputProject.getObjects()};
+
+                REQUIRE(objects.size() == 1);
+                CHECK(objects.contains("test-value-object"));
+            }
+        }
+    }
+
+    GIVEN("A project with an invalid value inside an object") {
+        auto inputStream{std::make_unique<std::istringstream>(R"(
+            {
+                "creation_timedate": 1672576240,
+                "title": "test-title",
+                "version": "1.2.3",
+                "test-value-object": { "test-value": tru }
+            }
+        )")};
+
+        LazyJsonProjectReader projectReaderUnderTest{std::move(inputStream)};
+
+        WHEN("The project is read") {
+            Project inputProject{};
+            projectReaderUnderTest >> inputProject;
+
+            THEN("The error should be reported when the object is accessed") {
+                CHECK_THROWS(inputProject.getObject("test-value-object"));
+                CHECK_THROWS(inputProject.getObjects());
+                CHECK(inputProject.containsObject("test-value-object"));
+            }
+        }
+    }
+
+    GIVEN("A project with an object that is read by many threads") {
+        auto inputStream{std::make_unique<std::istringstream>(R"(
+            {
+                "creation_timedate": 1672576240,
+                "title": "test-title",
+                "version": "1.2.3",
+                "first-object": { "test-value": 1 },
+                "second-object": { "test-value": 2 }
+            }
+        )")};
+
+        LazyJsonProjectReader projectReader{std::move(inputStream)};
+        Project inputProject{};
+        projectReader >> inputProject;
+
+        WHEN("The objects are accessed concurrently") {
+            const Project& sharedProject{inputProject};
+            std::vector<std::uint64_t> readValues(8);
+            std::vector<std::thread> readers{};
+            for (std::size_t i{}; i < readValues.size(); ++i) {
+                readers.emplace_back([&sharedProject, &readValues, i]() {
+                    const std::string key{i % 2 == 0 ? "first-object" : "second-object"};
+                    readValues[i] = sharedProject.getObject(key).getValue<std::uint64_t>(
+                        "test-value");
+                    readValues[i] += sharedProject.getObjects().size() * 10;
+                });
+            }
+
+            for (auto& reader : readers)
+                reader.join();
+
+            THEN("Every thread should read the loaded objects") {
+                for (std::size_t i{}; i < readValues.size(); ++i)
+                    CHECK(readValues[i] == (i % 2 == 0 ? 21 : 22));
+            }
+        }
+    }
+
+    GIVEN("A project without the header") {
+        auto inputStream{std::make_unique<std::istringstream>(R"({ "title": "test-title" })")};
+
+        LazyJsonProjectReader projectReaderUnderTest{std::move(inputStream)};
+
+        THEN("Reading the project should throw a std::runtime_error") {
+            Project inputProject{};
+            CHECK_THROWS_AS(projectReaderUnderTest >> inputProject, std::runtime_error);
+        }
+    }
+}
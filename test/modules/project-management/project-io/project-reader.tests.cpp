@@ -22,4 +22,17 @@ TEST_CASE("ProjectReader Factory tests",
             CHECK_THROWS_AS(project_io::CreateJsonProjectFileReader("."), std::invalid_argument);
         }
     }
+
+    SECTION("CreateLazyJsonProjectFileReader() Function") {
+        SECTION("Should throw a std::invalid_argument exception if the input file does not exist") {
+            CHECK_THROWS_AS(
+                project_io::CreateLazyJsonProjectFileReader("inexistent_dir/inexistent_file.json"),
+                std::invalid_argument);
+        }
+
+        SECTION("Should throw a std::invalid_argument exception if the input path is not a file") {
+            CHECK_THROWS_AS(project_io::CreateLazyJsonProjectFileReader("."),
+                            std::invalid_argument);
+        }
+    }
 }
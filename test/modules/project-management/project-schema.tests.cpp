@@ -0,0 +1,193 @@
+// Copyright (c) 2023 Andrea Ballestrazzi
+#include <project-management/schema/project-schema.hpp>
+
+#include <testing-core.hpp>
+
+// C++ STL
+#include <chrono>
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace tests {
+
+enum class Color {
+    Red,
+    Green
+};
+
+struct Leaf {
+    std::string name{};
+    Color color{};
+
+    static constexpr auto schema() noexcept {
+        using namespace gc::project_management::schema;
+        constexpr std::array<std::pair<std::string_view, Color>, 2> COLOR_NAMES{
+            std::pair{std::string_view{"red"}, Color::Red},
+            std::pair{std::string_view{"green"}, Color::Green}
+        };
+
+        return MakeSchema(MakeField("name", &Leaf::name),
+                          MakeEnumField("color", &Leaf::color, COLOR_NAMES));
+    }
+};
+
+struct Branch {
+    bool bEnabled{};
+    std::uint16_t id{};
+    std::int32_t offset{};
+    double ratio{};
+    std::chrono::milliseconds period{};
+    std::optional<std::string> label{};
+    std::optional<Leaf> mainLeaf{};
+    std::vector<Leaf> leaves{};
+
+    static constexpr auto schema() noexcept {
+        using namespace gc::project_management::schema;
+        return MakeSchema(
+            MakeField("enabled", &Branch::bEnabled), MakeField("id", &Branch::id),
+            MakeField("offset", &Branch::offset), MakeField("ratio", &Branch::ratio),
+            MakeField("period", &Branch::period), MakeField("label", &Branch::label),
+            MakeField("mainLeaf", &Branch::mainLeaf), MakeField("leaves", &Branch::leaves));
+    }
+};
+
+} // namespace tests
+
+TEST_CASE("Project schema unit tests",
+          "[unit][solitary][modules][project-management][schema][ProjectSchema]") {
+    using namespace gc::project_management;
+    using namespace std::string_literals;
+
+    static_assert(schema::Schematized<tests::Branch>);
+    static_assert(!schema::Schematized<ProjectNode>);
+
+    GIVEN("A node that matches the schema") {
+        ProjectNode node{};
+        node.addValue("enabled"s, true)
+            .addValue("id"s, std::uint64_t{42})
+            .addValue("offset"s, std::int64_t{-7})
+            .addValue("ratio"s, std::uint64_t{2})
+            .addValue("period"s, std::uint64_t{1500})
+            .addValue("unknown"s, "ignored"s);
+
+        ProjectNode leafNode{};
+        leafNode.addValue("name"s, "leaf"s).addValue("color"s, "green"s);
+        node.addObjectArray("leaves"s, std::vector<ProjectNode>{leafNode, leafNode});
+
+        WHEN("The node is decoded") {
+            tests::Branch branch{};
+            const schema::DecodeResult result{schema::Decode(node, branch)};
+
+            THEN("The decoding should succeed") {
+                REQUIRE(result);
+                CHECK(branch.bEnabled);
+                CHECK(branch.id == 42);
+                CHECK(branch.offset == -7);
+                CHECK(branch.ratio == 2.0);
+                CHECK(branch.period == std::chrono::milliseconds{1500});
+                CHECK_FALSE(branch.label.has_value());
+                CHECK_FALSE(branch.mainLeaf.has_value());
+                REQUIRE(branch.leaves.size() == 2);
+                CHECK(branch.leaves[1].name == "leaf");
+                CHECK(branch.leaves[1].color == tests::Color::Green);
+            }
+        }
+    }
+
+    GIVEN("A node without a required field") {
+        ProjectNode node{};
+        node.addValue("enabled"s, true);
+
+        THEN("The decoding should report the missing field") {
+            tests::Branch branch{};
+            const schema::DecodeResult result{schema::Decode(node, branch)};
+
+            CHECK(result.error == schema::DecodeError::MissingField);
+            CHECK(result.key == "id");
+        }
+    }
+
+    GIVEN("A node with a wrong value type") {
+        ProjectNode leafNode{};
+        leafNode.addValue("name"s, true).addValue("color"s, "red"s);
+
+        THEN("The decoding should report a type mismatch") {
+            tests::Leaf leaf{};
+            const schema::DecodeResult result{schema::Decode(leafNode, leaf)};
+
+            CHECK(result.error == schema::DecodeError::TypeMismatch);
+            CHECK(result.key == "name");
+        }
+    }
+
+    GIVEN("A node with an unknown enum value") {
+        ProjectNode leafNode{};
+        leafNode.addValue("name"s, "leaf"s).addValue("color"s, "blue"s);
+
+        THEN("The decoding should report the unknown enum value") {
+            tests::Leaf leaf{};
+            const schema::DecodeResult result{schema::Decode(leafNode, leaf)};
+
+            CHECK(result.error == schema::DecodeError::UnknownEnumValue);
+            CHECK(result.key == "color");
+        }
+    }
+
+    GIVEN("A node with a value that doesn't fit the member") {
+        tests::Branch branch{};
+        ProjectNode node{schema::Encode(branch)};
+        node.addValue("id"s, std::uint64_t{70000});
+
+        THEN("The decoding should report the value out of range") {
+            const schema::DecodeResult result{schema::Decode(node, branch)};
+
+            CHECK(result.error == schema::DecodeError::ValueOutOfRange);
+            CHECK(result.key == "id");
+        }
+    }
+
+    GIVEN("A fully populated object") {
+        tests::Branch branch{};
+        branch.bEnabled = true;
+        branch.id = 3;
+        branch.offset = -3;
+        branch.ratio = 0.5;
+        branch.period = std::chrono::milliseconds{600};
+        branch.label = "label";
+        branch.mainLeaf = tests::Leaf{"main", tests::Color::Red};
+        branch.leaves.push_back(tests::Leaf{"other", tests::Color::Green});
+
+        WHEN("The object is encoded") {
+            const ProjectNode node{schema::Encode(branch)};
+
+            THEN("The node should contain the fields with their project representation") {
+                CHECK(node.getValue<bool>("enabled"s));
+                CHECK(node.getValue<std::uint64_t>("id"s) == 3);
+                CHECK(node.getValue<std::int64_t>("offset"s) == -3);
+                CHECK(node.getValue<std::int64_t>("period"s) == 600);
+                CHECK(node.getObject("mainLeaf"s).getValue<std::string>("color"s) == "red");
+                CHECK(node.getObjectArray("leaves"s).size() == 1);
+            }
+
+            AND_WHEN("The node is decoded again") {
+                tests::Branch decodedBranch{};
+                const schema::DecodeResult result{schema::Decode(node, decodedBranch)};
+
+                THEN("The decoded object should be equal to the original one") {
+                    REQUIRE(result);
+                    CHECK(decodedBranch.id == branch.id);
+                    CHECK(decodedBranch.offset == branch.offset);
+                    CHECK(decodedBranch.ratio == branch.ratio);
+                    CHECK(decodedBranch.period == branch.period);
+                    CHECK(decodedBranch.label == branch.label);
+                    REQUIRE(decodedBranch.mainLeaf.has_value());
+                    CHECK(decodedBranch.mainLeaf->name == "main");
+                    REQUIRE(decodedBranch.leaves.size() == 1);
+                    CHECK(decodedBranch.leaves[0].color == tests::Color::Green);
+                }
+            }
+        }
+    }
+}
@@ -0,0 +1,139 @@
+// Copyright (c) 2023 Andrea Ballestrazzi
+#include <project-management/integrity-check/project-upgrader-registry.hpp>
+
+#include <testing-core.hpp>
+
+// C++ STL
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace tests {
+
+//!!
+//! \brief Upgrader that records its name inside the given log when it's applied.
+//!
+class RecordingUpgrader final
+    : public gc::project_management::integrity_check::ProjectIntegrityChecker {
+public:
+    RecordingUpgrader(std::string name, std::vector<std::string>& appliedUpgraders,
+                      bool bSucceeds = true) noexcept
+        : m_name{std::move(name)},
+          m_appliedUpgraders{appliedUpgraders},
+          m_bSucceeds{bSucceeds} {}
+
+    [[nodiscard]] bool checkIntegrity(
+        const gc::project_management::Project&) const noexcept override {
+        return false;
+    }
+
+    [[nodiscard]] bool tryApplyIntegrityFixes(gc::project_management::Project&) override {
+        m_appliedUpgraders.push_back(m_name);
+        return m_bSucceeds;
+    }
+
+private:
+    std::string m_name;
+    std::vector<std::string>& m_appliedUpgraders;
+    bool m_bSucceeds;
+};
+
+} // namespace tests
+
+TEST_CASE(
+    "ProjectUpgraderRegistry unit tests",
+    "[unit][solitary][modules][project-management][integrity-check][ProjectUpgraderRegistry]") {
+    using namespace gc::project_management;
+    using integrity_check::ProjectUpgraderRegistry;
+
+    std::vector<std::string> appliedUpgraders{};
+    const auto makeFactory{[&appliedUpgraders](std::string name, bool bSucceeds = true) {
+        return [&appliedUpgraders, name, bSucceeds] {
+            return std::make_unique<tests::RecordingUpgrader>(name, appliedUpgraders, bSucceeds);
+        };
+    }};
+
+    ProjectUpgraderRegistry registryUnderTest{};
+
+    GIVEN("An upgrader that doesn't increase the version") {
+        THEN("The registration should throw") {
+            CHECK_THROWS_AS(registryUnderTest.registerUpgrader(semver::version{1, 2, 0},
+                                                               semver::version{1, 2, 0},
+                                                               makeFactory("invalid")),
+                            std::invalid_argument);
+        }
+    }
+
+    GIVEN("A chain of upgraders and a shortcut") {
+        registryUnderTest.registerUpgrader(semver::version{1, 0, 0}, semver::version{1, 1, 0},
+                                           makeFactory("1.0->1.1"));
+        registryUnderTest.registerUpgrader(semver::version{1, 1, 0}, semver::version{1, 2, 0},
+                                           makeFactory("1.1->1.2"));
+        registryUnderTest.registerUpgrader(semver::version{1, 2, 0}, semver::version{2, 0, 0},
+                                           makeFactory("1.2->2.0"));
+        registryUnderTest.registerUpgrader(semver::version{1, 0, 0}, semver::version{1, 2, 0},
+                                           makeFactory("1.0->1.2"));
+
+        WHEN("The path from the oldest version to the newest one is searched") {
+            const auto path{registryUnderTest.findMigrationPath(semver::version{1, 0, 0},
+                                                                semver::version{2, 0, 0})};
+
+            THEN("The shortcut should be used") {
+                REQUIRE(path.size() == 2);
+                CHECK(path[0]->toVersion == semver::version{1, 2, 0});
+                CHECK(path[1]->toVersion == semver::version{2, 0, 0});
+            }
+        }
+
+        WHEN("The target version is lower than the newest upgrader") {
+            const auto path{registryUnderTest.findMigrationPath(semver::version{1, 1, 0},
+                                                                semver::version{1, 5, 0})};
+
+            THEN("The path should stop at the highest version below the target") {
+                REQUIRE(path.size() == 1);
+                CHECK(path[0]->toVersion == semver::version{1, 2, 0});
+            }
+        }
+
+        WHEN("A patch version inside an upgrader range is migrated") {
+            Project project{Project::time_point_type{}, "TestProject", semver::version{1, 1, 3}};
+            const bool bRes{registryUnderTest.migrate(project, semver::version{2, 0, 0})};
+
+            THEN("The upgraders should be applied in order") {
+                CHECK(bRes);
+                CHECK(appliedUpgraders == std::vector<std::string>{"1.1->1.2", "1.2->2.0"});
+                CHECK(project.getVersion() == semver::version{2, 0, 0});
+            }
+        }
+
+        WHEN("An up to date project is migrated") {
+            Project project{Project::time_point_type{}, "TestProject", semver::version{2, 0, 0}};
+            const bool bRes{registryUnderTest.migrate(project, semver::version{2, 0, 0})};
+
+            THEN("No upgrader should be applied") {
+                CHECK(bRes);
+                CHECK(appliedUpgraders.empty());
+            }
+        }
+    }
+
+    GIVEN("An upgrader that fails") {
+        registryUnderTest.registerUpgrader(semver::version{1, 0, 0}, semver::version{1, 1, 0},
+                                           makeFactory("1.0->1.1", false));
+        registryUnderTest.registerUpgrader(semver::version{1, 1, 0}, semver::version{1, 2, 0},
+                                           makeFactory("1.1->1.2"));
+
+        WHEN("A project is migrated") {
+            Project project{Project::time_point_type{}, "TestProject", semver::version{1, 0, 0}};
+            const bool bRes{registryUnderTest.migrate(project, semver::version{1, 2, 0})};
+
+            THEN("The migration should stop at the failing upgrader") {
+                CHECK_FALSE(bRes);
+                CHECK(appliedUpgraders == std::vector<std::string>{"1.0->1.1"});
+                CHECK(project.getVersion() == semver::version{1, 0, 0});
+            }
+        }
+    }
+}
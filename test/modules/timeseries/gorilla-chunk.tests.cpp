@@ -0,0 +1,156 @@
+// Copyright (c) 2023 Andrea Ballestrazzi
+#include <timeseries/bit-stream.hpp>
+#include <timeseries/gorilla-chunk.hpp>
+
+#include <testing-core.hpp>
+
+// C++ STL
+#include <bit>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
+#include <vector>
+
+namespace {
+
+//! \return The samples decoded from the bytes of an encoder.
+[[nodiscard]] std::vector<gc::timeseries::Sample> Decode(
+    const gc::timeseries::ChunkEncoder& encoder) {
+    gc::timeseries::ChunkDecoder decoder{encoder.getBytes(), encoder.getBitsCount(),
+                                         encoder.getSamplesCount()};
+
+    std::vector<gc::timeseries::Sample> samples{};
+    for (gc::timeseries::Sample sample{}; decoder.next(sample);)
+        samples.push_back(sample);
+
+    return samples;
+}
+
+//! \return True if the samples have the same timestamps and the same value bits, so that the
+//!  NaNs compare equal.
+[[nodiscard]] bool AreBitwiseEqual(const std::vector<gc::timeseries::Sample>& first,
+                                   const std::vector<gc::timeseries::Sample>& second) {
+    if (first.size() != second.size())
+        return false;
+
+    for (std::size_t i{}; i < first.size(); ++i) {
+        if (first[i].timestamp != second[i].timestamp ||
+            std::bit_cast<std::uint64_t>(first[i].value) !=
+                std::bit_cast<std::uint64_t>(second[i].value))
+            return false;
+    }
+
+    return true;
+}
+
+} // namespace
+
+TEST_CASE("BitWriter and BitReader unit tests",
+          "[unit][solitary][modules][timeseries][BitStream]") {
+    using namespace gc::timeseries;
+
+    GIVEN("A writer with fields across the byte boundaries") {
+        BitWriter writer{};
+        writer.writeBits(0b101, 3);
+        writer.writeBits(0xABCD, 16);
+        writer.writeBit(true);
+        writer.writeBits(0xFFFF'FFFF'FFFF'FFFF, 64);
+
+        THEN("The bytes should hold the fields most significant bit first") {
+            CHECK(writer.getBitsCount() == 84);
+            REQUIRE(writer.getBytes().size() == 11);
+            CHECK(writer.getBytes()[0] == 0b1011'0101);
+            CHECK(writer.getBytes()[1] == 0b0111'1001);
+        }
+
+        WHEN("The fields are read back") {
+            BitReader reader{writer.getBytes(), writer.getBitsCount()};
+
+            THEN("They should have the written values") {
+                CHECK(reader.readBits(3) == 0b101);
+                CHECK(reader.readBits(16) == 0xABCD);
+                CHECK(reader.readBit());
+                CHECK(reader.readBits(64) == 0xFFFF'FFFF'FFFF'FFFF);
+                CHECK(reader.getRemainingBitsCount() == 0);
+            }
+
+            THEN("Reading past the written bits should throw") {
+                [[maybe_unused]] const std::uint64_t fields{reader.readBits(64)};
+                CHECK_THROWS_AS(reader.readBits(21), std::out_of_range);
+            }
+        }
+    }
+}
+
+TEST_CASE("ChunkEncoder and ChunkDecoder unit tests",
+          "[unit][solitary][modules][timeseries][GorillaChunk]") {
+    using namespace gc::timeseries;
+
+    ChunkEncoder encoder{};
+
+    GIVEN("A regular series with slowly changing values") {
+        std::vector<Sample> samples{};
+        for (timestamp_type i{}; i < 1000; ++i)
+            samples.push_back(Sample{1'700'000'000'000 + i * 10'000, 20.0 + (i / 50) * 0.1});
+
+        for (const Sample& sample : samples)
+            encoder.append(sample);
+
+        THEN("The samples should be decoded unchanged") {
+            CHECK(Decode(encoder) == samples);
+            CHECK(encoder.getFirstTimestamp() == samples.front().timestamp);
+            CHECK(encoder.getLastTimestamp() == samples.back().timestamp);
+        }
+
+        THEN("Every sample should take less than two bytes") {
+            CHECK(encoder.getBytes().size() < samples.size() * 2);
+        }
+    }
+
+    GIVEN("A series with irregular timestamps and special values") {
+        constexpr double INF{std::numeric_limits<double>::infinity()};
+        constexpr timestamp_type MIN_TIMESTAMP{std::numeric_limits<timestamp_type>::min()};
+        constexpr timestamp_type MAX_TIMESTAMP{std::numeric_limits<timestamp_type>::max()};
+
+        const std::vector<Sample> samples{
+            {MIN_TIMESTAMP,          -0.0                                     },
+            {MIN_TIMESTAMP + 1,      std::numeric_limits<double>::quiet_NaN() },
+            {-5,                     INF                                      },
+            {-5,                     -INF                                     },
+            {60,                     std::numeric_limits<double>::denorm_min()},
+            {124,                    1e300                                    },
+            {380,                    -1e-300                                  },
+            {2'430,                  1e-300                                   },
+            {1'000'000,              42.0                                     },
+            {1'000'000,              42.0                                     },
+            {MAX_TIMESTAMP - 10,     42.5                                     },
+            {MAX_TIMESTAMP,          std::numeric_limits<double>::max()       },
+        };
+
+        for (const Sample& sample : samples)
+            encoder.append(sample);
+
+        THEN("The samples should be decoded bit by bit") {
+            CHECK(AreBitwiseEqual(Decode(encoder), samples));
+        }
+
+        THEN("A truncated chunk should not be decoded") {
+            ChunkDecoder decoder{encoder.getBytes(), encoder.getBitsCount() - 1,
+                                 encoder.getSamplesCount()};
+
+            const auto decodeAll{[&decoder] {
+                for (Sample sample{}; decoder.next(sample);) {
+                }
+            }};
+            CHECK_THROWS_AS(decodeAll(), std::out_of_range);
+        }
+    }
+
+    GIVEN("An empty encoder") {
+        THEN("Nothing should be decoded") {
+            CHECK(Decode(encoder).empty());
+            CHECK(encoder.getBitsCount() == 0);
+        }
+    }
+}
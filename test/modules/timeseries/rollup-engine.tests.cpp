@@ -0,0 +1,191 @@
+// Copyright (c) 2023 Andrea Ballestrazzi
+#include <timeseries/rollup-engine.hpp>
+
+#include <testing-core.hpp>
+
+#include <catch2/catch_approx.hpp>
+
+// C++ STL
+#include <cmath>
+#include <filesystem>
+#include <limits>
+#include <stdexcept>
+#include <vector>
+
+TEST_CASE("Aggregate unit tests", "[unit][solitary][modules][timeseries][Aggregate]") {
+    using namespace gc::timeseries;
+
+    GIVEN("Two aggregates") {
+        Aggregate first{};
+        first.add(3.0);
+        first.add(-1.0);
+
+        Aggregate second{};
+        second.add(8.0);
+
+        WHEN("They are merged") {
+            first.merge(second);
+
+            THEN("The result should summarize all the values") {
+                CHECK(first == Aggregate{-1.0, 8.0, 10.0, 3});
+                CHECK(first.getMean() == Catch::Approx(10.0 / 3.0));
+            }
+        }
+
+        WHEN("An empty aggregate is merged") {
+            first.merge(Aggregate{});
+
+            THEN("Nothing should change") {
+                CHECK(first == Aggregate{-1.0, 3.0, 2.0, 2});
+                CHECK(Aggregate{}.getMean() == 0.0);
+            }
+        }
+    }
+}
+
+TEST_CASE("RollupEngine unit tests", "[unit][sociable][modules][timeseries][RollupEngine]") {
+    using namespace gc::timeseries;
+
+    const std::filesystem::path engineDirectory{std::filesystem::temp_directory_path() /
+                                                "fep-rollup-engine-tests"};
+    std::filesystem::remove_all(engineDirectory);
+
+    // Midnight UTC, so that the intervals of the samples are aligned.
+    constexpr timestamp_type START{1'699'920'000'000};
+    constexpr timestamp_type SECOND{1'000};
+    constexpr timestamp_type MINUTE{GetResolutionDuration(Resolution::Minute)};
+    constexpr timestamp_type HOUR{GetResolutionDuration(Resolution::Hour)};
+    constexpr timestamp_type DAY{GetResolutionDuration(Resolution::Day)};
+
+    // One sample per second for three hours, from 0 to 59 every minute.
+    constexpr timestamp_type SAMPLES_COUNT{3 * 3'600};
+    const auto appendSamples{[](RollupEngine& engine, const timestamp_type begin,
+                                const timestamp_type end) {
+        for (timestamp_type i{begin}; i < end; ++i)
+            engine.append("moisture", START + i * SECOND, static_cast<double>(i % 60));
+    }};
+
+    GIVEN("An engine with three hours of samples") {
+        RollupEngine engineUnderTest{engineDirectory};
+        appendSamples(engineUnderTest, 0, SAMPLES_COUNT);
+
+        const timestamp_type lastTimestamp{START + (SAMPLES_COUNT - 1) * SECOND};
+
+        THEN("A step shorter than a minute should be served from the raw samples") {
+            const RollupQueryResult result{
+                engineUnderTest.query("moisture", START, lastTimestamp, 10 * SECOND)};
+
+            CHECK(result.resolution == Resolution::Raw);
+            REQUIRE(result.samples.size() == SAMPLES_COUNT);
+            CHECK(result.samples[61] == AggregateSample{START + 61 * SECOND, {1.0, 1.0, 1.0, 1}});
+        }
+
+        THEN("A step of some minutes should be served from the 1-minute aggregates") {
+            const RollupQueryResult result{
+                engineUnderTest.query("moisture", START + 30 * SECOND, lastTimestamp, 5 * MINUTE)};
+
+            CHECK(result.resolution == Resolution::Minute);
+            REQUIRE(result.samples.size() == 180);
+            CHECK(result.samples.front() == AggregateSample{START, {0.0, 59.0, 1'770.0, 60}});
+
+            // The last minute is still open.
+            CHECK(result.samples.back() ==
+                  AggregateSample{START + 179 * MINUTE, {0.0, 59.0, 1'770.0, 60}});
+        }
+
+        THEN("A step of some hours should be served from the 1-hour aggregates") {
+            const RollupQueryResult result{
+                engineUnderTest.query("moisture", START, lastTimestamp, 2 * HOUR)};
+
+            CHECK(result.resolution == Resolution::Hour);
+            REQUIRE(result.samples.size() == 3);
+            for (const AggregateSample& sample : result.samples) {
+                CHECK(sample.aggregate.count == 3'600);
+                CHECK(sample.aggregate.getMean() == Catch::Approx(29.5));
+            }
+        }
+
+        THEN("A step of days should be served from the open day") {
+            const RollupQueryResult result{
+                engineUnderTest.query("moisture", START, lastTimestamp, 7 * DAY)};
+
+            CHECK(result.resolution == Resolution::Day);
+            REQUIRE(result.samples.size() == 1);
+            CHECK(result.samples[0].timestamp == START);
+            CHECK(result.samples[0].aggregate.count == SAMPLES_COUNT);
+        }
+
+        THEN("The invalid samples should be rejected") {
+            CHECK_THROWS_AS(engineUnderTest.append("moisture", START, 1.0), std::invalid_argument);
+            CHECK_THROWS_AS(engineUnderTest.append("", lastTimestamp, 1.0), std::invalid_argument);
+            CHECK_THROWS_AS(engineUnderTest.query("", START, lastTimestamp, 0),
+                            std::invalid_argument);
+        }
+
+        WHEN("A NaN is appended") {
+            engineUnderTest.append("moisture", lastTimestamp + SECOND,
+                                   std::numeric_limits<double>::quiet_NaN());
+
+            THEN("It should be stored but not aggregated") {
+                const RollupQueryResult rawResult{
+                    engineUnderTest.query("moisture", lastTimestamp + SECOND, DAY + START, 0)};
+                REQUIRE(rawResult.samples.size() == 1);
+                CHECK(std::isnan(rawResult.samples[0].aggregate.sum));
+
+                const RollupQueryResult dayResult{
+                    engineUnderTest.query("moisture", START, DAY + START, DAY)};
+                REQUIRE(dayResult.samples.size() == 1);
+                CHECK(dayResult.samples[0].aggregate.count == SAMPLES_COUNT);
+            }
+        }
+    }
+
+    GIVEN("An engine closed in the middle of a minute") {
+        {
+            RollupEngine engine{engineDirectory};
+            appendSamples(engine, 0, 90);
+        }
+
+        WHEN("It's opened again and the minute is continued") {
+            RollupEngine engineUnderTest{engineDirectory};
+            appendSamples(engineUnderTest, 90, 180);
+
+            THEN("The two parts of the minute should be merged") {
+                const RollupQueryResult result{
+                    engineUnderTest.query("moisture", START, START + 180 * SECOND, MINUTE)};
+
+                REQUIRE(result.samples.size() == 3);
+                for (const AggregateSample& sample : result.samples)
+                    CHECK(sample.aggregate == Aggregate{0.0, 59.0, 1'770.0, 60});
+            }
+        }
+    }
+
+    GIVEN("An engine that keeps the raw samples for an hour") {
+        RollupOptions options{};
+        options.rawRetention = HOUR;
+        options.storeOptions.maxSamplesPerChunk = 600;
+
+        RollupEngine engineUnderTest{engineDirectory, options};
+        appendSamples(engineUnderTest, 0, SAMPLES_COUNT);
+
+        THEN("The old raw samples should be deleted") {
+            const RollupQueryResult result{engineUnderTest.query(
+                "moisture", START, START + SAMPLES_COUNT * SECOND, 0)};
+
+            // The raw samples don't reach the start of the range anymore.
+            CHECK(result.resolution == Resolution::Minute);
+            CHECK(result.samples.size() == 180);
+        }
+
+        THEN("The recent raw samples should still be queried") {
+            const RollupQueryResult result{engineUnderTest.query(
+                "moisture", START + 2 * HOUR, START + SAMPLES_COUNT * SECOND, 0)};
+
+            CHECK(result.resolution == Resolution::Raw);
+            CHECK(result.samples.size() == 3'600);
+        }
+    }
+
+    std::filesystem::remove_all(engineDirectory);
+}
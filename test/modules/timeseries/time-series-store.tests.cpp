@@ -0,0 +1,203 @@
+// Copyright (c) 2023 Andrea Ballestrazzi
+#include <timeseries/time-series-store.hpp>
+
+#include <testing-core.hpp>
+
+// C++ STL
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+TEST_CASE("TimeSeriesStore unit tests",
+          "[unit][sociable][modules][timeseries][TimeSeriesStore]") {
+    using namespace gc::timeseries;
+
+    const std::filesystem::path storeDirectory{std::filesystem::temp_directory_path() /
+                                               "fep-time-series-store-tests"};
+    std::filesystem::remove_all(storeDirectory);
+
+    constexpr StoreOptions OPTIONS{.maxSamplesPerChunk = 100, .flushThreshold = 16};
+
+    std::vector<Sample> samples{};
+    for (timestamp_type i{}; i < 350; ++i)
+        samples.push_back(Sample{i * 1'000, 18.0 + static_cast<double>(i % 40) * 0.25});
+
+    GIVEN("A store with a series spanning many chunks") {
+        TimeSeriesStore storeUnderTest{storeDirectory, OPTIONS};
+        for (const Sample& sample : samples)
+            storeUnderTest.append("moisture", sample.timestamp, sample.value);
+
+        THEN("The series should be split in chunk files") {
+            std::size_t chunkFilesCount{};
+            for ([[maybe_unused]] const auto& entry :
+                 std::filesystem::directory_iterator{storeDirectory / "moisture"})
+                ++chunkFilesCount;
+
+            CHECK(chunkFilesCount == 4);
+        }
+
+        THEN("The whole range should return all the samples, including the buffered ones") {
+            CHECK(storeUnderTest.query("moisture", 0, 349'000) == samples);
+        }
+
+        THEN("A range across the chunks should return only the samples inside it") {
+            const std::vector<Sample> expectedSamples{samples.begin() + 95,
+                                                      samples.begin() + 206};
+            CHECK(storeUnderTest.query("moisture", 94'500, 205'000) == expectedSamples);
+        }
+
+        THEN("The ranges without samples should return nothing") {
+            CHECK(storeUnderTest.query("moisture", 500'000, 600'000).empty());
+            CHECK(storeUnderTest.query("moisture", 2'000, 1'000).empty());
+            CHECK(storeUnderTest.query("temperature", 0, 349'000).empty());
+        }
+
+        THEN("The query should append to the given vector") {
+            std::vector<Sample> queriedSamples{samples[0]};
+            storeUnderTest.query("moisture", 1'000, 1'000, queriedSamples);
+
+            CHECK(queriedSamples == std::vector<Sample>{samples[0], samples[1]});
+        }
+
+        THEN("The chunks older than a timestamp should be deleted as a whole") {
+            CHECK(storeUnderTest.getFirstTimestamp("moisture") == 0);
+            CHECK(storeUnderTest.removeBefore("moisture", 250'000) == 200);
+            CHECK(storeUnderTest.getFirstTimestamp("moisture") == 200'000);
+            CHECK_FALSE(storeUnderTest.getFirstTimestamp("temperature").has_value());
+        }
+
+        THEN("The chunk that is being appended should never be deleted") {
+            CHECK(storeUnderTest.removeBefore("moisture", 1'000'000) == 300);
+
+            const std::vector<Sample> expectedSamples{samples.begin() + 300, samples.end()};
+            CHECK(storeUnderTest.query("moisture", 0, 349'000) == expectedSamples);
+        }
+
+        THEN("A timestamp before the last one should be rejected") {
+            CHECK_THROWS_AS(storeUnderTest.append("moisture", 348'000, 1.0), std::invalid_argument);
+            CHECK_NOTHROW(storeUnderTest.append("moisture", 349'000, 1.0));
+        }
+
+        THEN("The invalid series names should be rejected") {
+            CHECK_THROWS_AS(storeUnderTest.append("", 0, 1.0), std::invalid_argument);
+            CHECK_THROWS_AS(storeUnderTest.append("..", 0, 1.0), std::invalid_argument);
+            CHECK_THROWS_AS(storeUnderTest.append("north/moisture", 0, 1.0),
+                            std::invalid_argument);
+            CHECK_THROWS_AS(storeUnderTest.query("../moisture", 0, 1), std::invalid_argument);
+        }
+
+        WHEN("Another series is appended") {
+            storeUnderTest.append("temperature", 0, 21.5);
+
+            THEN("The series should be listed by name") {
+                CHECK(storeUnderTest.listSeries() ==
+                      std::vector<std::string>{"moisture", "temperature"});
+            }
+        }
+    }
+
+    GIVEN("A store that has been closed") {
+        {
+            TimeSeriesStore store{storeDirectory, OPTIONS};
+            for (std::size_t i{}; i < 150; ++i)
+                store.append("moisture", samples[i].timestamp, samples[i].value);
+        }
+
+        WHEN("It's opened again and the series is continued") {
+            TimeSeriesStore storeUnderTest{storeDirectory, OPTIONS};
+            for (std::size_t i{150}; i < samples.size(); ++i)
+                storeUnderTest.append("moisture", samples[i].timestamp, samples[i].value);
+
+            THEN("The old and the new samples should be returned") {
+                CHECK(storeUnderTest.query("moisture", 0, 349'000) == samples);
+            }
+        }
+
+        WHEN("It's opened again and a sample precedes the stored ones") {
+            TimeSeriesStore storeUnderTest{storeDirectory, OPTIONS};
+
+            THEN("The sample should be rejected") {
+                CHECK_THROWS_AS(storeUnderTest.append("moisture", 148'000, 1.0),
+                                std::invalid_argument);
+            }
+        }
+    }
+
+    GIVEN("A store with a corrupted chunk file") {
+        std::filesystem::create_directories(storeDirectory / "moisture");
+        std::ofstream{storeDirectory / "moisture" / "chunk-0000000000.gcts"} << "not a chunk";
+
+        TimeSeriesStore storeUnderTest{storeDirectory, OPTIONS};
+
+        THEN("The query should skip it") {
+            CHECK(storeUnderTest.query("moisture", 0, 1).empty());
+        }
+
+        WHEN("The series is continued") {
+            storeUnderTest.append("moisture", 1'000, 20.0);
+
+            THEN("The new samples should be returned") {
+                CHECK(storeUnderTest.query("moisture", 0, 1'000) ==
+                      std::vector<Sample>{Sample{1'000, 20.0}});
+            }
+        }
+    }
+
+    GIVEN("A store closed by a power failure while its last chunk was written back") {
+        {
+            TimeSeriesStore store{storeDirectory, OPTIONS};
+            for (std::size_t i{}; i < 150; ++i)
+                store.append("moisture", samples[i].timestamp, samples[i].value);
+        }
+
+        // The header of the last chunk was written back, but the end of its samples wasn't.
+        const std::filesystem::path lastChunkPath{storeDirectory / "moisture" /
+                                                  "chunk-0000000001.gcts"};
+        std::filesystem::resize_file(lastChunkPath, std::filesystem::file_size(lastChunkPath) - 24);
+
+        WHEN("It's opened again") {
+            TimeSeriesStore storeUnderTest{storeDirectory, OPTIONS};
+            const std::vector<Sample> storedSamples{storeUnderTest.query("moisture", 0, 349'000)};
+
+            THEN("The complete samples of the truncated chunk should be returned") {
+                REQUIRE(storedSamples.size() > 100);
+                REQUIRE(storedSamples.size() < 150);
+                CHECK(std::equal(storedSamples.begin(), storedSamples.end(), samples.begin()));
+            }
+
+            AND_WHEN("The series is continued") {
+                for (std::size_t i{150}; i < samples.size(); ++i)
+                    storeUnderTest.append("moisture", samples[i].timestamp, samples[i].value);
+
+                THEN("The new samples should follow the recovered ones") {
+                    std::vector<Sample> expectedSamples{storedSamples};
+                    expectedSamples.insert(expectedSamples.end(), samples.begin() + 150,
+                                           samples.end());
+                    CHECK(storeUnderTest.query("moisture", 0, 349'000) == expectedSamples);
+                }
+            }
+        }
+
+        WHEN("The last chunk lost its header too, and the store is opened again") {
+            std::filesystem::resize_file(lastChunkPath, 10);
+            TimeSeriesStore storeUnderTest{storeDirectory, OPTIONS};
+
+            THEN("The samples of the other chunks should be returned") {
+                const std::vector<Sample> expectedSamples{samples.begin(), samples.begin() + 100};
+                CHECK(storeUnderTest.query("moisture", 0, 349'000) == expectedSamples);
+            }
+
+            THEN("The series should be continued after the last readable sample") {
+                CHECK_THROWS_AS(storeUnderTest.append("moisture", 98'000, 1.0),
+                                std::invalid_argument);
+                CHECK_NOTHROW(storeUnderTest.append("moisture", 99'000, 1.0));
+            }
+        }
+    }
+
+    std::filesystem::remove_all(storeDirectory);
+}
@@ -0,0 +1,158 @@
+// Copyright (c) 2023 Andrea Ballestrazzi
+#include <workflows/coroutine-scheduler.hpp>
+
+#include <testing-core.hpp>
+
+// C++ STL
+#include <chrono>
+#include <stdexcept>
+#include <stop_token>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace tests {
+
+using namespace std::chrono_literals;
+using gc::workflows::coroutines::Task;
+
+Task SleepingTask(std::vector<std::string>& events, std::string name,
+                  gc::workflows::coroutines::clock_type::duration duration) {
+    events.push_back(name + "-start");
+    co_await gc::workflows::coroutines::Delay(duration);
+    events.push_back(name + "-end");
+    co_return true;
+}
+
+Task FailingTask() {
+    co_await gc::workflows::coroutines::Delay(1ms);
+    co_return false;
+}
+
+Task ParentTask(std::vector<std::string>& events, bool& bChildResult) {
+    events.emplace_back("parent-start");
+    bChildResult = co_await SleepingTask(events, "child", 1ms);
+    events.emplace_back("parent-end");
+    co_return bChildResult;
+}
+
+Task ValveTask(std::vector<std::string>& events, gc::workflows::coroutines::EdgeType edge,
+               gc::workflows::coroutines::clock_type::duration timeout) {
+    events.emplace_back("valve-open");
+    const bool bEdgeDetected{co_await gc::workflows::coroutines::PinEdge(4, edge, timeout)};
+    events.emplace_back(bEdgeDetected ? "edge" : "timeout");
+    co_return bEdgeDetected;
+}
+
+} // namespace tests
+
+TEST_CASE("Coroutine Scheduler unit tests",
+          "[unit][solitary][modules][workflows][coroutines][Scheduler]") {
+    using namespace gc::workflows::coroutines;
+    using namespace std::chrono_literals;
+
+    Scheduler scheduler{};
+    std::vector<std::string> events{};
+
+    GIVEN("Two tasks sleeping for different times") {
+        scheduler.spawn(tests::SleepingTask(events, "long", 30ms));
+        scheduler.spawn(tests::SleepingTask(events, "short", 5ms));
+
+        WHEN("The loop runs") {
+            const std::size_t completedTasksCount{scheduler.run()};
+
+            THEN("Both tasks should share the thread and wake up in deadline order") {
+                CHECK(completedTasksCount == 2);
+                CHECK(events == std::vector<std::string>{"long-start", "short-start", "short-end",
+                                                         "long-end"});
+                CHECK(scheduler.getPendingTasksCount() == 0);
+                CHECK(scheduler.getFailedTasksCount() == 0);
+            }
+        }
+    }
+
+    GIVEN("A task that awaits another task") {
+        bool bChildResult{};
+        scheduler.spawn(tests::ParentTask(events, bChildResult));
+        scheduler.spawn(tests::FailingTask());
+
+        WHEN("The loop runs") {
+            CHECK(scheduler.run() == 2);
+
+            THEN("The parent should resume with the result of the child") {
+                CHECK(bChildResult);
+                CHECK(events == std::vector<std::string>{"parent-start", "child-start",
+                                                         "child-end", "parent-end"});
+                CHECK(scheduler.getFailedTasksCount() == 1);
+            }
+        }
+    }
+
+    GIVEN("A task waiting for a rising edge on a pin") {
+        scheduler.spawn(tests::ValveTask(events, EdgeType::Rising, 10s));
+
+        WHEN("The edge is notified by another thread") {
+            std::jthread notifier{[&scheduler] {
+                std::this_thread::sleep_for(10ms);
+                scheduler.notifyPinEdge(3, EdgeType::Rising);
+                scheduler.notifyPinEdge(4, EdgeType::Falling);
+                scheduler.notifyPinEdge(4, EdgeType::Rising);
+            }};
+
+            CHECK(scheduler.run() == 1);
+
+            THEN("The task should be resumed by the matching edge") {
+                CHECK(events == std::vector<std::string>{"valve-open", "edge"});
+                CHECK(scheduler.getFailedTasksCount() == 0);
+            }
+        }
+
+        WHEN("The edge never comes") {
+            Scheduler timeoutScheduler{};
+            std::vector<std::string> timeoutEvents{};
+            timeoutScheduler.spawn(tests::ValveTask(timeoutEvents, EdgeType::Both, 5ms));
+
+            CHECK(timeoutScheduler.run() == 1);
+
+            THEN("The task should be resumed by the timeout") {
+                CHECK(timeoutEvents == std::vector<std::string>{"valve-open", "timeout"});
+                CHECK(timeoutScheduler.getFailedTasksCount() == 1);
+            }
+        }
+    }
+
+    GIVEN("A task that has been moved from") {
+        Task task{tests::SleepingTask(events, "moved", 1ms)};
+        scheduler.spawn(std::move(task));
+
+        THEN("Spawning the moved-from task should throw a std::invalid_argument") {
+            CHECK_THROWS_AS(scheduler.spawn(std::move(task)), std::invalid_argument);
+        }
+
+        THEN("Only the valid task should be run") {
+            CHECK(scheduler.run() == 1);
+            CHECK(events == std::vector<std::string>{"moved-start", "moved-end"});
+        }
+    }
+
+    GIVEN("A task sleeping for a long time") {
+        scheduler.spawn(tests::SleepingTask(events, "long", 1h));
+
+        WHEN("A stop is requested") {
+            std::stop_source stopSource{};
+            std::jthread stopper{[&stopSource] {
+                std::this_thread::sleep_for(10ms);
+                stopSource.request_stop();
+            }};
+
+            const std::size_t completedTasksCount{scheduler.run(stopSource.get_token())};
+
+            THEN("The loop should return leaving the task suspended") {
+                CHECK(completedTasksCount == 0);
+                CHECK(scheduler.getPendingTasksCount() == 1);
+                CHECK(events == std::vector<std::string>{"long-start"});
+            }
+        }
+    }
+}
@@ -0,0 +1,130 @@
+// Copyright (c) 2023 Andrea Ballestrazzi
+#include <workflows/parallel-workflow-executor.hpp>
+
+#include <testing-core.hpp>
+
+// C++ STL
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+TEST_CASE("WorkflowGraph unit tests", "[unit][solitary][modules][workflows][WorkflowGraph]") {
+    using namespace gc::workflows;
+
+    WorkflowGraph graphUnderTest{"test-graph"};
+    std::vector<std::string> executedSteps{};
+
+    const auto makeStep{[&executedSteps](std::string id, bool bResult = true) {
+        return std::make_unique<steps::Function>(id, [&executedSteps, id, bResult] {
+            executedSteps.push_back(id);
+            return bResult;
+        });
+    }};
+
+    GIVEN("A graph with a step") {
+        REQUIRE(graphUnderTest.addStep(makeStep("first")));
+
+        THEN("A step with the same id should be rejected") {
+            CHECK_FALSE(graphUnderTest.addStep(makeStep("first")));
+            CHECK(graphUnderTest.size() == 1);
+        }
+
+        THEN("A step with an unknown dependency should be rejected") {
+            CHECK_FALSE(graphUnderTest.addStep(makeStep("second"), {"unknown"}));
+            CHECK_FALSE(graphUnderTest.findStep("second").has_value());
+        }
+
+        WHEN("A dependent step is added") {
+            REQUIRE(graphUnderTest.addStep(makeStep("second"), {"first", "first"}));
+
+            THEN("The dependency edge should be recorded once") {
+                const auto firstIndex{graphUnderTest.findStep("first")};
+                const auto secondIndex{graphUnderTest.findStep("second")};
+                REQUIRE(firstIndex.has_value());
+                REQUIRE(secondIndex.has_value());
+
+                CHECK(graphUnderTest.getDependenciesCount(*secondIndex) == 1);
+                CHECK(graphUnderTest.getDependents(*firstIndex) ==
+                      std::vector<WorkflowGraph::step_index>{*secondIndex});
+            }
+
+            THEN("The sequential execution should follow the insertion order") {
+                CHECK(graphUnderTest.execute());
+                CHECK(executedSteps == std::vector<std::string>{"first", "second"});
+            }
+        }
+    }
+}
+
+TEST_CASE("ParallelWorkflowExecutor unit tests",
+          "[unit][sociable][modules][workflows][ParallelWorkflowExecutor]") {
+    using namespace gc::workflows;
+
+    WorkStealingThreadPool threadPool{4};
+    ParallelWorkflowExecutor executorUnderTest{threadPool};
+    WorkflowGraph graph{"test-graph"};
+
+    std::mutex executedStepsMutex{};
+    std::vector<std::string> executedSteps{};
+    const auto makeStep{[&](std::string id, bool bResult = true) {
+        return std::make_unique<steps::Function>(id, [&, id, bResult] {
+            std::lock_guard lock{executedStepsMutex};
+            executedSteps.push_back(id);
+            return bResult;
+        });
+    }};
+
+    GIVEN("An empty graph") {
+        THEN("The execution should succeed") {
+            CHECK(executorUnderTest.execute(graph));
+        }
+    }
+
+    GIVEN("A wide graph with a final step depending on all the others") {
+        constexpr std::size_t ZONES_COUNT{32};
+        std::vector<std::string> zoneIds{};
+        for (std::size_t i{}; i < ZONES_COUNT; ++i) {
+            zoneIds.push_back("zone-" + std::to_string(i));
+            REQUIRE(graph.addStep(makeStep(zoneIds.back())));
+        }
+
+        REQUIRE(graph.addStep(makeStep("irrigation"),
+                              std::vector<IdView>{zoneIds.begin(), zoneIds.end()}));
+
+        WHEN("The graph is executed") {
+            const bool bResult{executorUnderTest.execute(graph)};
+
+            THEN("All the steps should be executed and the final one should be the last") {
+                CHECK(bResult);
+                REQUIRE(executedSteps.size() == ZONES_COUNT + 1);
+                CHECK(executedSteps.back() == "irrigation");
+            }
+        }
+
+        WHEN("The graph is executed more than once") {
+            CHECK(executorUnderTest.execute(graph));
+            CHECK(executorUnderTest.execute(graph));
+
+            THEN("Every execution should run all the steps") {
+                CHECK(executedSteps.size() == 2 * (ZONES_COUNT + 1));
+            }
+        }
+    }
+
+    GIVEN("A chain with a failing step") {
+        REQUIRE(graph.addStep(makeStep("check")));
+        REQUIRE(graph.addStep(makeStep("failure", false), {"check"}));
+        REQUIRE(graph.addStep(makeStep("irrigation"), {"failure"}));
+
+        WHEN("The graph is executed") {
+            const bool bResult{executorUnderTest.execute(graph)};
+
+            THEN("The execution should fail and the remaining steps should be cancelled") {
+                CHECK_FALSE(bResult);
+                CHECK(executedSteps == std::vector<std::string>{"check", "failure"});
+            }
+        }
+    }
+}
@@ -0,0 +1,83 @@
+// Copyright (c) 2023 Andrea Ballestrazzi
+#include <workflows/static-workflow.hpp>
+#include <workflows/workflow-loop.hpp>
+
+#include <testing-core.hpp>
+
+// C++ STL
+#include <string>
+#include <vector>
+
+namespace tests {
+
+struct CountingStep {
+    int& counter;
+
+    constexpr bool execute() noexcept {
+        ++counter;
+        return true;
+    }
+};
+
+} // namespace tests
+
+TEST_CASE("StaticWorkflow unit tests", "[unit][solitary][modules][workflows][StaticWorkflow]") {
+    using namespace gc::workflows;
+
+    STATIC_CHECK(StaticWorkflowStep<tests::CountingStep>);
+    STATIC_CHECK(ExecutableWorkflow<Workflow>);
+    STATIC_CHECK(ExecutableWorkflow<StaticWorkflow<tests::CountingStep>>);
+
+    std::vector<std::string> executedSteps{};
+
+    GIVEN("A static workflow whose steps all succeed") {
+        auto workflow{MakeStaticWorkflow(
+            "test-workflow",
+            [&executedSteps] {
+                executedSteps.emplace_back("first");
+                return true;
+            },
+            [&executedSteps] {
+                executedSteps.emplace_back("second");
+                return true;
+            })};
+
+        STATIC_CHECK(decltype(workflow)::size() == 2);
+
+        THEN("The steps should be executed in order") {
+            CHECK(workflow.execute());
+            CHECK(executedSteps == std::vector<std::string>{"first", "second"});
+            CHECK(workflow.id() == "test-workflow");
+        }
+
+        WHEN("The workflow is looped a fixed number of times") {
+            WorkflowLoop loop{workflow, repeat_modes::Fixed<3>{}};
+
+            THEN("The steps should be executed for every iteration") {
+                CHECK(loop.loopWorkflow());
+                CHECK(executedSteps.size() == 6);
+            }
+        }
+    }
+
+    GIVEN("A static workflow with a failing step") {
+        int counter{};
+        StaticWorkflow workflow{"test-workflow", tests::CountingStep{counter},
+                                steps::StaticFunction{[] { return false; }},
+                                tests::CountingStep{counter}};
+
+        THEN("The execution should stop at the failing step") {
+            CHECK_FALSE(workflow.execute());
+            CHECK(counter == 1);
+        }
+
+        WHEN("The workflow is looped") {
+            WorkflowLoop loop{workflow, repeat_modes::Dynamic{5}};
+
+            THEN("The loop should stop at the first failed iteration") {
+                CHECK_FALSE(loop.loopWorkflow());
+                CHECK(counter == 1);
+            }
+        }
+    }
+}
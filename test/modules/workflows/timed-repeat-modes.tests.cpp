@@ -0,0 +1,211 @@
+// Copyright (c) 2023 Andrea Ballestrazzi
+#include <workflows/static-workflow.hpp>
+#include <workflows/timed-repeat-modes.hpp>
+#include <workflows/workflow-loop.hpp>
+
+#include <testing-core.hpp>
+
+// C++ STL
+#include <chrono>
+#include <cstddef>
+#include <stdexcept>
+#include <stop_token>
+#include <thread>
+#include <vector>
+
+namespace tests {
+
+//!!
+//! \brief A timed and scheduled repeat mode that counts the notifications it receives.
+//!
+class CountingRepeatMode final {
+public:
+    std::size_t remainingIterations{3};
+    std::size_t startsCount{};
+    std::size_t waitsCount{};
+
+    [[nodiscard]] bool canRepeat() const noexcept {
+        return remainingIterations > 0;
+    }
+
+    [[nodiscard]] bool waitNextIteration(std::stop_token) noexcept {
+        ++waitsCount;
+        return true;
+    }
+
+    [[nodiscard]] gc::workflows::clock_type::time_point getNextIterationTime() noexcept {
+        return gc::workflows::clock_type::now();
+    }
+
+    void iterationStarted() noexcept {
+        ++startsCount;
+    }
+
+    void iterationDone() noexcept {
+        --remainingIterations;
+    }
+};
+
+} // namespace tests
+
+TEST_CASE("Timed repeat modes unit tests",
+          "[unit][solitary][modules][workflows][TimedRepeatModes]") {
+    using namespace gc::workflows;
+    using namespace std::chrono_literals;
+    using repeat_modes::MissedDeadlinePolicy;
+
+    STATIC_CHECK(TimedRepeatMode<repeat_modes::FixedRate>);
+    STATIC_CHECK(TimedRepeatMode<repeat_modes::FixedDelay>);
+    STATIC_CHECK(!TimedRepeatMode<repeat_modes::Dynamic>);
+    STATIC_CHECK(ScheduledRepeatMode<repeat_modes::FixedRate>);
+    STATIC_CHECK(ScheduledRepeatMode<repeat_modes::FixedDelay>);
+    STATIC_CHECK(TimedRepeatMode<tests::CountingRepeatMode>);
+    STATIC_CHECK(ScheduledRepeatMode<tests::CountingRepeatMode>);
+
+    std::vector<clock_type::time_point> startTimes{};
+    auto workflow{MakeStaticWorkflow("timed-workflow", [&startTimes] {
+        startTimes.push_back(clock_type::now());
+        return true;
+    })};
+
+    GIVEN("A fixed-rate repeat mode") {
+        constexpr auto period{20ms};
+        WorkflowLoop loop{workflow, repeat_modes::FixedRate{period, {}, 3}};
+
+        WHEN("The workflow is looped") {
+            const clock_type::time_point startTime{clock_type::now()};
+            CHECK(loop.loopWorkflow());
+
+            THEN("The iterations should start one period apart from each other") {
+                REQUIRE(startTimes.size() == 3);
+                CHECK(startTimes[0] - startTime < period);
+                CHECK(startTimes[2] - startTime >= 2 * period);
+                CHECK(loop.getRepeatMode().getStatistics().iterations == 3);
+                CHECK(loop.getRepeatMode().getStatistics().overruns == 0);
+            }
+        }
+
+        WHEN("A stop is requested while the loop waits the next iteration") {
+            WorkflowLoop longLoop{workflow, repeat_modes::FixedRate{1h}};
+            std::stop_source stopSource{};
+            std::jthread stopper{[&stopSource] {
+                std::this_thread::sleep_for(20ms);
+                stopSource.request_stop();
+            }};
+
+            const clock_type::time_point startTime{clock_type::now()};
+            const bool bResult{longLoop.loopWorkflow(stopSource.get_token())};
+
+            THEN("The loop should return immediately after the first iteration") {
+                CHECK(bResult);
+                CHECK(startTimes.size() == 1);
+                CHECK(clock_type::now() - startTime < 10s);
+            }
+        }
+    }
+
+    GIVEN("A fixed-rate repeat mode with iterations longer than the period") {
+        constexpr auto period{10ms};
+        auto slowWorkflow{MakeStaticWorkflow("slow-workflow", [&startTimes] {
+            startTimes.push_back(clock_type::now());
+            std::this_thread::sleep_for(25ms);
+            return true;
+        })};
+
+        WHEN("The missed activations are skipped") {
+            WorkflowLoop loop{slowWorkflow,
+                              repeat_modes::FixedRate{period, MissedDeadlinePolicy::Skip, 3}};
+            const clock_type::time_point startTime{clock_type::now()};
+            CHECK(loop.loopWorkflow());
+
+            THEN("Every iteration should start on the original schedule") {
+                REQUIRE(startTimes.size() == 3);
+                CHECK(loop.getRepeatMode().getStatistics().overruns == 3);
+                CHECK(startTimes[1] - startTime >= 3 * period);
+            }
+        }
+
+        WHEN("The schedule is restarted") {
+            WorkflowLoop loop{slowWorkflow,
+                              repeat_modes::FixedRate{period, MissedDeadlinePolicy::Restart, 3}};
+            CHECK(loop.loopWorkflow());
+
+            THEN("Every overrun should be recorded") {
+                REQUIRE(startTimes.size() == 3);
+                CHECK(loop.getRepeatMode().getStatistics().overruns == 3);
+            }
+        }
+
+        WHEN("The missed activations are caught up") {
+            WorkflowLoop loop{slowWorkflow,
+                              repeat_modes::FixedRate{period, MissedDeadlinePolicy::CatchUp, 3}};
+            CHECK(loop.loopWorkflow());
+
+            THEN("The lateness of the caught up iterations should be recorded") {
+                REQUIRE(startTimes.size() == 3);
+                CHECK(loop.getRepeatMode().getStatistics().worstLateness >= period);
+            }
+        }
+    }
+
+    GIVEN("A fixed-delay repeat mode") {
+        constexpr auto delay{15ms};
+        WorkflowLoop loop{workflow, repeat_modes::FixedDelay{delay, 3}};
+
+        WHEN("The workflow is looped") {
+            CHECK(loop.loopWorkflow());
+
+            THEN("The iterations should be separated by the delay") {
+                REQUIRE(startTimes.size() == 3);
+                CHECK(startTimes[1] - startTimes[0] >= delay);
+                CHECK(startTimes[2] - startTimes[1] >= delay);
+                CHECK(loop.getRepeatMode().getStatistics().iterations == 3);
+            }
+        }
+
+        WHEN("The stop is requested before the loop starts") {
+            std::stop_source stopSource{};
+            stopSource.request_stop();
+
+            THEN("No iteration should be executed") {
+                CHECK(loop.loopWorkflow(stopSource.get_token()));
+                CHECK(startTimes.empty());
+            }
+        }
+    }
+
+    GIVEN("A fixed-rate repeat mode without a positive period") {
+        THEN("It should be rejected") {
+            CHECK_THROWS_AS(repeat_modes::FixedRate{0ms}, std::invalid_argument);
+            CHECK_THROWS_AS(repeat_modes::FixedRate{-10ms}, std::invalid_argument);
+        }
+    }
+
+    GIVEN("A fixed-delay repeat mode with a negative delay") {
+        WorkflowLoop loop{workflow, repeat_modes::FixedDelay{-1h, 3}};
+
+        WHEN("The workflow is looped") {
+            const auto loopStart{clock_type::now()};
+            CHECK(loop.loopWorkflow());
+
+            THEN("The iterations should run back-to-back") {
+                CHECK(startTimes.size() == 3);
+                CHECK(clock_type::now() - loopStart < 1s);
+            }
+        }
+    }
+
+    GIVEN("A timed repeat mode that is also scheduled") {
+        WorkflowLoop loop{workflow, tests::CountingRepeatMode{}};
+
+        WHEN("The workflow is looped") {
+            CHECK(loop.loopWorkflow());
+
+            THEN("Every iteration should be started exactly once") {
+                REQUIRE(startTimes.size() == 3);
+                CHECK(loop.getRepeatMode().waitsCount == 3);
+                CHECK(loop.getRepeatMode().startsCount == 3);
+            }
+        }
+    }
+}
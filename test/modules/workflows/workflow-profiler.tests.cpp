@@ -0,0 +1,144 @@
+// Copyright (c) 2023 Andrea Ballestrazzi
+#include <workflows/latency-histogram.hpp>
+#include <workflows/workflow-profiler.hpp>
+#include <workflows/workflow.hpp>
+
+#include <testing-core.hpp>
+
+// C++ STL
+#include <chrono>
+#include <memory>
+#include <sstream>
+#include <thread>
+#include <vector>
+
+TEST_CASE("LatencyHistogram unit tests",
+          "[unit][solitary][modules][workflows][LatencyHistogram]") {
+    using gc::workflows::LatencyHistogram;
+
+    SECTION("Small values have their own bucket") {
+        STATIC_CHECK(LatencyHistogram::GetBucketIndex(0) == 0);
+        STATIC_CHECK(LatencyHistogram::GetBucketIndex(7) == 7);
+        STATIC_CHECK(LatencyHistogram::GetBucketIndex(8) == 8);
+    }
+
+    SECTION("Every bucket contains the values between its bounds") {
+        for (std::size_t i{}; i < LatencyHistogram::BUCKETS_COUNT; ++i) {
+            const auto lowerBound{LatencyHistogram::GetBucketLowerBound(i)};
+            const auto upperBound{LatencyHistogram::GetBucketUpperBound(i)};
+
+            CHECK(LatencyHistogram::GetBucketIndex(lowerBound) == i);
+            CHECK(LatencyHistogram::GetBucketIndex(upperBound) == i);
+            CHECK(upperBound - lowerBound <=
+                  lowerBound / LatencyHistogram::SUB_BUCKETS_COUNT + 1);
+        }
+
+        CHECK(LatencyHistogram::GetBucketIndex(LatencyHistogram::MAX_VALUE + 1000) ==
+              LatencyHistogram::BUCKETS_COUNT - 1);
+    }
+
+    SECTION("Quantiles are estimated within the bucket resolution") {
+        LatencyHistogram histogram{};
+        for (std::uint64_t value{1}; value <= 1000; ++value) {
+            histogram.record(value * 1000);
+        }
+
+        CHECK(histogram.getCount() == 1000);
+        CHECK(histogram.getMax() == 1'000'000);
+        CHECK(histogram.getMean() == 500'500.0);
+
+        const auto median{histogram.getValueAtQuantile(0.5)};
+        CHECK(median >= 500'000);
+        CHECK(median <= 500'000 + 500'000 / LatencyHistogram::SUB_BUCKETS_COUNT);
+        CHECK(histogram.getValueAtQuantile(1.0) == 1'000'000);
+    }
+}
+
+TEST_CASE("WorkflowProfiler unit tests",
+          "[unit][solitary][modules][workflows][WorkflowProfiler]") {
+    using namespace gc::workflows;
+    using namespace std::chrono_literals;
+
+    GIVEN("A workflow with a profiler attached") {
+        WorkflowProfiler profiler{8, 4};
+        bool bSecondStepSucceeds{true};
+
+        Workflow workflow{"irrigation"};
+        workflow.addStep(std::make_unique<steps::Function>("open-valve", [] { return true; }));
+        workflow.setProfiler(&profiler);
+        workflow.addStep(std::make_unique<steps::Function>("wait", [&bSecondStepSucceeds] {
+            std::this_thread::sleep_for(1ms);
+            return bSecondStepSucceeds;
+        }));
+
+        WHEN("The workflow is executed, sometimes failing") {
+            CHECK(workflow.execute());
+            CHECK(workflow.execute());
+            bSecondStepSucceeds = false;
+            CHECK_FALSE(workflow.execute());
+
+            const std::vector<StepProfile> profiles{profiler.getProfiles()};
+
+            THEN("Every step and the whole workflow should be profiled") {
+                REQUIRE(profiles.size() == 3);
+                CHECK(profiles[0].name == "irrigation");
+                CHECK(profiles[0].callsCount == 3);
+                CHECK(profiles[0].failuresCount == 1);
+
+                CHECK(profiles[1].name == "irrigation/open-valve");
+                CHECK(profiles[1].callsCount == 3);
+                CHECK(profiles[1].failuresCount == 0);
+
+                CHECK(profiles[2].name == "irrigation/wait");
+                CHECK(profiles[2].callsCount == 3);
+                CHECK(profiles[2].failuresCount == 1);
+                CHECK(profiles[2].latency.getValueAtQuantile(0.5) >= 1'000'000);
+            }
+
+            THEN("The profiles should be printed as a table and as JSON") {
+                std::ostringstream table{};
+                PrintProfilesTable(table, profiles);
+                CHECK(table.str().find("irrigation/wait") != std::string::npos);
+
+                std::ostringstream json{};
+                WriteProfilesJson(json, profiles);
+                CHECK(json.str().starts_with(
+                    R"([{"name":"irrigation","calls":3,"failures":1)"));
+            }
+        }
+
+        WHEN("The profiler is detached") {
+            workflow.setProfiler(nullptr);
+            CHECK(workflow.execute());
+
+            THEN("No sample should be recorded") {
+                CHECK(profiler.getProfiles()[0].callsCount == 0);
+            }
+        }
+    }
+
+    GIVEN("A profiler with fewer slots than the recording threads") {
+        WorkflowProfiler profiler{1, 2};
+        const auto stepIndex{profiler.registerStep("step")};
+        REQUIRE(stepIndex.has_value());
+        CHECK_FALSE(profiler.registerStep("another-step").has_value());
+
+        WHEN("Three threads record samples") {
+            {
+                std::vector<std::jthread> threads{};
+                for (int i{}; i < 3; ++i) {
+                    threads.emplace_back([&profiler, &stepIndex] {
+                        for (int sample{}; sample < 100; ++sample) {
+                            profiler.record(*stepIndex, 1us, true);
+                        }
+                    });
+                }
+            }
+
+            THEN("The samples of the thread without a slot should be dropped") {
+                CHECK(profiler.getProfiles()[0].callsCount == 200);
+                CHECK(profiler.getDroppedSamplesCount() == 100);
+            }
+        }
+    }
+}
@@ -0,0 +1,189 @@
+// Copyright (c) 2023 Andrea Ballestrazzi
+#include <workflows/static-workflow.hpp>
+#include <workflows/timed-repeat-modes.hpp>
+#include <workflows/workflow-loop.hpp>
+#include <workflows/workflow-runner.hpp>
+
+#include <testing-core.hpp>
+
+// C++ STL
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <vector>
+
+TEST_CASE("WorkflowRunner unit tests", "[unit][solitary][modules][workflows][WorkflowRunner]") {
+    using namespace gc::workflows;
+    using namespace std::chrono_literals;
+
+    GIVEN("Many counting loops and a runner with two workers") {
+        constexpr std::size_t LOOPS_COUNT{50};
+        constexpr std::size_t ITERATIONS_COUNT{10};
+
+        std::atomic<std::size_t> executionsCount{};
+        auto workflow{MakeStaticWorkflow("counting-workflow", [&executionsCount] {
+            executionsCount.fetch_add(1);
+            return true;
+        })};
+
+        WorkflowRunner runner{2};
+        std::vector<WorkflowRunner::loop_id_type> loopIds{};
+        for (std::size_t i{}; i < LOOPS_COUNT; ++i) {
+            loopIds.push_back(
+                runner.addLoop(WorkflowLoop{workflow, repeat_modes::Dynamic{ITERATIONS_COUNT}}));
+        }
+
+        CHECK(runner.getState(loopIds.front()) == LoopState::Idle);
+
+        WHEN("All the loops are started") {
+            for (const auto loopId : loopIds) {
+                CHECK(runner.start(loopId));
+            }
+
+            THEN("All the loops should complete all their iterations") {
+                for (const auto loopId : loopIds) {
+                    CHECK(runner.wait(loopId) == LoopState::Completed);
+                }
+
+                CHECK(executionsCount.load() == LOOPS_COUNT * ITERATIONS_COUNT);
+
+                const WorkflowRunnerMetrics metrics{runner.getMetrics()};
+                CHECK(metrics.iterationsCount == LOOPS_COUNT * ITERATIONS_COUNT);
+                CHECK(metrics.workersCount == 2);
+                CHECK(metrics.runningLoopsCount == 0);
+                CHECK(metrics.waitingLoopsCount == 0);
+                CHECK(metrics.getUtilization() >= 0.0);
+                CHECK(metrics.getUtilization() <= 1.0);
+            }
+        }
+    }
+
+    GIVEN("A loop whose workflow fails") {
+        auto workflow{MakeStaticWorkflow("failing-workflow", [] { return false; })};
+        WorkflowRunner runner{1};
+        const auto loopId{runner.addLoop(WorkflowLoop{workflow, repeat_modes::Indefinitely{}})};
+
+        THEN("The loop should fail") {
+            CHECK(runner.start(loopId));
+            CHECK(runner.wait(loopId) == LoopState::Failed);
+            CHECK_FALSE(runner.start(loopId));
+        }
+    }
+
+    GIVEN("A loop with a fixed rate") {
+        std::vector<clock_type::time_point> startTimes{};
+        auto workflow{MakeStaticWorkflow("timed-workflow", [&startTimes] {
+            startTimes.push_back(clock_type::now());
+            return true;
+        })};
+
+        WorkflowRunner runner{2};
+        const clock_type::time_point startTime{clock_type::now()};
+        const auto loopId{
+            runner.addLoop(WorkflowLoop{workflow, repeat_modes::FixedRate{10ms, {}, 4}})};
+
+        THEN("The iterations should be executed when they're due") {
+            CHECK(runner.start(loopId));
+            CHECK(runner.wait(loopId) == LoopState::Completed);
+
+            REQUIRE(startTimes.size() == 4);
+            CHECK(startTimes.back() - startTime >= 30ms);
+        }
+    }
+
+    GIVEN("An endless loop with a fixed delay") {
+        std::atomic<std::size_t> executionsCount{};
+        auto workflow{MakeStaticWorkflow("endless-workflow", [&executionsCount] {
+            executionsCount.fetch_add(1);
+            return true;
+        })};
+
+        WorkflowRunner runner{1};
+        const auto loopId{runner.addLoop(WorkflowLoop{workflow, repeat_modes::FixedDelay{2ms}})};
+        REQUIRE(runner.start(loopId));
+
+        WHEN("The loop is paused") {
+            while (executionsCount.load() < 3) {
+                std::this_thread::sleep_for(1ms);
+            }
+
+            CHECK(runner.pause(loopId));
+            while (runner.getState(loopId) != LoopState::Paused) {
+                std::this_thread::sleep_for(1ms);
+            }
+
+            const std::size_t pausedExecutionsCount{executionsCount.load()};
+            std::this_thread::sleep_for(20ms);
+
+            THEN("No iteration should be executed until it's started again") {
+                CHECK(executionsCount.load() == pausedExecutionsCount);
+
+                CHECK(runner.start(loopId));
+                while (executionsCount.load() == pausedExecutionsCount) {
+                    std::this_thread::sleep_for(1ms);
+                }
+
+                CHECK(runner.stop(loopId));
+                CHECK(runner.wait(loopId) == LoopState::Stopped);
+                CHECK_FALSE(runner.start(loopId));
+            }
+        }
+    }
+
+    GIVEN("A high and a low priority loop sharing a single worker") {
+        // Only the worker thread writes the order, one iteration at a time.
+        std::vector<LoopPriority> executionsOrder{};
+        auto lowWorkflow{MakeStaticWorkflow("low-workflow", [&executionsOrder] {
+            executionsOrder.push_back(LoopPriority::Low);
+            return true;
+        })};
+        auto highWorkflow{MakeStaticWorkflow("high-workflow", [&executionsOrder] {
+            executionsOrder.push_back(LoopPriority::High);
+            return true;
+        })};
+
+        // Keeps the worker busy until both loops are ready.
+        std::atomic<bool> bBlockerRunning{};
+        std::atomic<bool> bReleaseBlocker{};
+        auto blockerWorkflow{MakeStaticWorkflow("blocker-workflow", [&] {
+            bBlockerRunning = true;
+            while (!bReleaseBlocker) {
+                std::this_thread::sleep_for(1ms);
+            }
+            return true;
+        })};
+
+        WorkflowRunner runner{1};
+        const auto blockerLoopId{
+            runner.addLoop(WorkflowLoop{blockerWorkflow, repeat_modes::Once{}})};
+        const auto lowLoopId{runner.addLoop(WorkflowLoop{lowWorkflow, repeat_modes::Dynamic{8}},
+                                            LoopPriority::Low)};
+        const auto highLoopId{runner.addLoop(
+            WorkflowLoop{highWorkflow, repeat_modes::Dynamic{8}}, LoopPriority::High)};
+
+        WHEN("Both loops are started") {
+            CHECK(runner.start(blockerLoopId));
+            while (!bBlockerRunning) {
+                std::this_thread::sleep_for(1ms);
+            }
+
+            CHECK(runner.start(lowLoopId));
+            CHECK(runner.start(highLoopId));
+            bReleaseBlocker = true;
+
+            CHECK(runner.wait(lowLoopId) == LoopState::Completed);
+            CHECK(runner.wait(highLoopId) == LoopState::Completed);
+
+            THEN("The high priority loop should get more iterations without starving the other") {
+                REQUIRE(executionsOrder.size() == 16);
+
+                const auto highInFirstSix{std::count(executionsOrder.begin(),
+                                                     executionsOrder.begin() + 6,
+                                                     LoopPriority::High)};
+                CHECK(highInFirstSix >= 4);
+                CHECK(executionsOrder.back() == LoopPriority::Low);
+            }
+        }
+    }
+}
@@ -0,0 +1,206 @@
+// Copyright (c) 2023 Andrea Ballestrazzi
+#include <testing-core.hpp>
+
+#include <application/event-loop.hpp>
+
+// C++ STL
+#include <chrono>
+#include <stdexcept>
+#include <string>
+#include <thread>
+
+// POSIX
+#include <csignal>
+#include <unistd.h>
+
+namespace tests {
+
+//!!
+//! \brief A pipe whose ends are closed on destruction.
+//!
+struct Pipe {
+    int readEnd{-1};
+    int writeEnd{-1};
+
+    Pipe() {
+        int fileDescriptors[2]{};
+        REQUIRE(::pipe(fileDescriptors) == 0);
+        readEnd = fileDescriptors[0];
+        writeEnd = fileDescriptors[1];
+    }
+
+    ~Pipe() noexcept {
+        ::close(readEnd);
+        if (writeEnd >= 0) {
+            ::close(writeEnd);
+        }
+    }
+
+    void write(const std::string& data) const {
+        REQUIRE(::write(writeEnd, data.data(), data.size()) ==
+                static_cast<ssize_t>(data.size()));
+    }
+
+    void closeWriteEnd() noexcept {
+        ::close(writeEnd);
+        writeEnd = -1;
+    }
+};
+
+} // namespace tests
+
+TEST_CASE("EventLoop unit tests", "[unit][solitary][rpi_gc][application][EventLoop]") {
+    using rpi_gc::EventLoop;
+    using namespace std::chrono_literals;
+
+    EventLoop eventLoop{};
+
+    GIVEN("A pipe watched by the event loop") {
+        tests::Pipe pipe{};
+        std::string receivedData{};
+        bool bClosed{};
+
+        const auto sourceId{eventLoop.addReadableSource(pipe.readEnd, [&] {
+            char buffer[64]{};
+            const ssize_t bytesRead{::read(pipe.readEnd, buffer, sizeof(buffer))};
+            if (bytesRead <= 0) {
+                bClosed = true;
+                eventLoop.stop();
+                return;
+            }
+
+            receivedData.append(buffer, static_cast<std::size_t>(bytesRead));
+        })};
+        CHECK(eventLoop.getSourcesCount() == 1);
+
+        WHEN("Nothing is written") {
+            THEN("No event should be dispatched") {
+                CHECK(eventLoop.runOnce(0ms) == 0);
+            }
+        }
+
+        WHEN("Data is written and the pipe is closed") {
+            pipe.write("status\n");
+            pipe.closeWriteEnd();
+            eventLoop.run();
+
+            THEN("The callback should receive the data and the hang up") {
+                CHECK(receivedData == "status\n");
+                CHECK(bClosed);
+            }
+        }
+
+        WHEN("The source is removed") {
+            CHECK(eventLoop.removeSource(sourceId));
+            CHECK_FALSE(eventLoop.removeSource(sourceId));
+            pipe.write("status\n");
+
+            THEN("The callback shouldn't be invoked anymore") {
+                CHECK(eventLoop.runOnce(10ms) == 0);
+                CHECK(receivedData.empty());
+                CHECK(eventLoop.getSourcesCount() == 0);
+            }
+        }
+    }
+
+    GIVEN("A one-shot and a periodic timer") {
+        int oneShotExpirationsCount{};
+        int periodicExpirationsCount{};
+
+        eventLoop.addTimer(1ms, 0ms, [&oneShotExpirationsCount] {
+            ++oneShotExpirationsCount;
+        });
+
+        const auto startTime{EventLoop::clock_type::now()};
+        const auto periodicTimerId{eventLoop.addTimer(2ms, 2ms, [&] {
+            if (++periodicExpirationsCount == 3) {
+                eventLoop.stop();
+            }
+        })};
+
+        WHEN("The loop runs until the periodic timer expires three times") {
+            eventLoop.run();
+
+            THEN("The one-shot timer should have expired once and then removed") {
+                CHECK(oneShotExpirationsCount == 1);
+                CHECK(periodicExpirationsCount == 3);
+                CHECK(EventLoop::clock_type::now() - startTime >= 6ms);
+                CHECK(eventLoop.getSourcesCount() == 1);
+                CHECK(eventLoop.removeSource(periodicTimerId));
+            }
+        }
+    }
+
+    GIVEN("Tasks posted from another thread") {
+        std::thread::id executionThreadId{};
+        int executedTasksCount{};
+
+        std::thread producer{[&] {
+            eventLoop.post([&executedTasksCount] {
+                ++executedTasksCount;
+            });
+            eventLoop.post([&] {
+                ++executedTasksCount;
+                executionThreadId = std::this_thread::get_id();
+                eventLoop.stop();
+            });
+        }};
+
+        eventLoop.run();
+        producer.join();
+
+        THEN("They should be executed in order on the loop thread") {
+            CHECK(executedTasksCount == 2);
+            CHECK(executionThreadId == std::this_thread::get_id());
+        }
+    }
+
+    GIVEN("A signal handled by the event loop") {
+        int receivedSignal{};
+        const auto sourceId{eventLoop.addSignalHandler(SIGUSR1, [&](const int signal) {
+            receivedSignal = signal;
+            eventLoop.stop();
+        })};
+
+        CHECK_THROWS_AS(eventLoop.addSignalHandler(SIGUSR1, [](int) {}), std::invalid_argument);
+
+        WHEN("The signal is raised") {
+            REQUIRE(::raise(SIGUSR1) == 0);
+            eventLoop.run();
+
+            THEN("The handler should receive it on the loop") {
+                CHECK(receivedSignal == SIGUSR1);
+            }
+        }
+
+        CHECK(eventLoop.removeSource(sourceId));
+    }
+
+    GIVEN("A signal that isn't handled by the event loop anymore") {
+        REQUIRE(eventLoop.removeSource(eventLoop.addSignalHandler(SIGUSR2, [](int) {})));
+
+        WHEN("The signal is raised") {
+            REQUIRE(::raise(SIGUSR2) == 0);
+
+            THEN("It should be left pending instead of terminating the process") {
+                sigset_t pendingSignals{};
+                REQUIRE(sigpending(&pendingSignals) == 0);
+                CHECK(sigismember(&pendingSignals, SIGUSR2) == 1);
+
+                sigset_t signalSet{};
+                sigemptyset(&signalSet);
+                sigaddset(&signalSet, SIGUSR2);
+                const timespec noTimeout{};
+                CHECK(sigtimedwait(&signalSet, nullptr, &noTimeout) == SIGUSR2);
+            }
+        }
+    }
+
+    GIVEN("A stop request made before running the loop") {
+        eventLoop.stop();
+
+        THEN("The loop should return immediately") {
+            CHECK_NOTHROW(eventLoop.run());
+        }
+    }
+}
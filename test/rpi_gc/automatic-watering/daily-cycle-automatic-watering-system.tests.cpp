@@ -2,6 +2,7 @@
 
 #include <automatic-watering/daily-cycle-automatic-watering-system.hpp>
 #include <automatic-watering/time-providers/daily-cycle-aws-time-provider.hpp>
+#include <metrics/metrics-registry.hpp>
 
 // Test Doubles
 #include <gh_hal/test-doubles/hardware-access/board-digital-pin.mock.hpp>
@@ -11,9 +12,13 @@
 
 #include <testing-core.hpp>
 
+#include <catch2/catch_approx.hpp>
+
 // C++ STL
 #include <atomic>
 #include <chrono>
+#include <filesystem>
+#include <memory>
 #include <thread>
 
 namespace tests {
@@ -146,6 +151,54 @@ TEST_CASE("DailyCycleAutomaticWateringSystem unit tests",
             }
         }
     }
+
+    GIVEN("An automatic watering system whose time provider gives no activation time") {
+        constexpr WateringSystemTimeProvider::time_unit DEACTIVATION_TIME{20};
+
+        EXPECT_CALL(*timeProviderMock, getWateringSystemActivationDuration)
+            .WillRepeatedly(testing::Return(WateringSystemTimeProvider::time_unit::zero()));
+        EXPECT_CALL(*timeProviderMock, getWateringSystemDeactivationDuration)
+            .WillRepeatedly(testing::Return(DEACTIVATION_TIME));
+        EXPECT_CALL(*timeProviderMock, getPumpValveDeactivationTimeSeparation).Times(0);
+
+        // The strict pins fail the test if the system touches them.
+        StrictMock<gh_hal::hardware_access::mocks::BoardDigitalPinMock> waterValveOutput{},
+            waterPumpOutput{};
+        EXPECT_CALL(hardwareControllerMockRef, getWaterValveDigitalOut)
+            .WillRepeatedly(testing::Return(&waterValveOutput));
+        EXPECT_CALL(hardwareControllerMockRef, getWaterPumpDigitalOut)
+            .WillRepeatedly(testing::Return(&waterPumpOutput));
+
+        WHEN("The watering system runs some cycles") {
+            gc::metrics::Counter& cyclesCounter{gc::metrics::GetDefaultRegistry().counter(
+                "gc_aws_cycles_total", "Number of completed automatic watering cycles.")};
+            gc::metrics::Counter& irrigationsCounter{gc::metrics::GetDefaultRegistry().counter(
+                "gc_aws_irrigations_total",
+                "Number of times the watering hardware has been activated.")};
+            const auto previousCyclesCount{cyclesCounter.getValue()};
+            const auto previousIrrigationsCount{irrigationsCounter.getValue()};
+
+            awsUnderTest.startAutomaticWatering({});
+            std::this_thread::sleep_for(tests::WAIT_FOR_THREAD_TO_START);
+            const bool bWasRunning{awsUnderTest.isRunning()};
+            awsUnderTest.requestShutdown();
+
+            // The worker has ended if no cycle is completed after the shutdown.
+            const auto shutdownCyclesCount{cyclesCounter.getValue()};
+            std::this_thread::sleep_for(DEACTIVATION_TIME * 5);
+
+            THEN("The cycles should be completed without operating the hardware") {
+                CHECK(cyclesCounter.getValue() > previousCyclesCount);
+                CHECK(irrigationsCounter.getValue() == previousIrrigationsCount);
+            }
+
+            THEN("The system should be running until it's shut down") {
+                CHECK(bWasRunning);
+                CHECK_FALSE(awsUnderTest.isRunning());
+                CHECK(cyclesCounter.getValue() == shutdownCyclesCount);
+            }
+        }
+    }
 }
 
 TEST_CASE("DailyCycleAutomaticWateringSystem integration tests",
@@ -177,12 +230,19 @@ TEST_CASE("DailyCycleAutomaticWateringSystem integration tests",
     std::atomic<WateringSystemTimeProvider*> timeProviderAtomic{awsTimeProvider.get()};
     std::mutex hardwareAccessMutex{};
 
+    const std::filesystem::path ledgersPath{std::filesystem::temp_directory_path() /
+                                            "fep-aws-water-usage-tests"};
+    std::filesystem::remove_all(ledgersPath);
+    std::shared_ptr<WaterUsageLedgerFolder> waterUsageLedgers{
+        std::make_shared<WaterUsageLedgerFolder>(ledgersPath)};
+
     DailyCycleAutomaticWateringSystem awsUnderTest{
         std::ref(hardwareAccessMutex), mainLoggerMock, userLoggerMock,
-        std::ref(atomicHardwareController), std::ref(timeProviderAtomic)};
+        std::ref(atomicHardwareController), std::ref(timeProviderAtomic), waterUsageLedgers};
+    awsUnderTest.setFlowRate(12.0);
 
     WHEN("The automatic watering system is activated") {
-        awsUnderTest.startAutomaticWatering({});
+        awsUnderTest.startAutomaticWatering("Tomatoes");
 
         AND_WHEN("The aws is sent to IDLE mode") {
             std::this_thread::sleep_for(awsTimeProvider->getWateringSystemActivationDuration() +
@@ -202,6 +262,23 @@ TEST_CASE("DailyCycleAutomaticWateringSystem integration tests",
                 THEN("The automatic watering system shouldn\'t be in run mode") {
                     CHECK_FALSE(awsUnderTest.isRunning());
                 }
+
+                THEN("The water delivered by the activation should be recorded for the flow") {
+                    const WaterUsage totalUsage{
+                        waterUsageLedgers->getFlowLedger("Tomatoes").getTotalUsage()};
+                    REQUIRE(totalUsage.actuations == 1);
+                    CHECK(totalUsage.valveOpenTime >=
+                          awsTimeProvider->getWateringSystemActivationDuration());
+                    CHECK(totalUsage.pumpOnTime >= totalUsage.valveOpenTime);
+
+                    // 12 litres per minute, for the time the valve has been open.
+                    const double expectedLitres{
+                        12.0 * static_cast<double>(totalUsage.valveOpenTime.count()) / 60'000.0};
+                    CHECK(totalUsage.litres == Catch::Approx(expectedLitres));
+
+                    CHECK(waterUsageLedgers->getFlowLedger("Peppers").getTotalUsage().actuations ==
+                          0);
+                }
             }
 
             AND_WHEN("An abort request is issued") {
@@ -216,10 +293,40 @@ TEST_CASE("DailyCycleAutomaticWateringSystem integration tests",
                     CHECK(totalWait < std::chrono::milliseconds{1000});
                 }
 
-                THEN("The automatic watering system shouldn\'t be in run mode") {
+                THEN("The automatic watering system shouldn\'t be in run mode once shut down") {
+                    // The abort doesn't wait for the worker: the owner joins it.
+                    awsUnderTest.requestShutdown();
+                    CHECK_FALSE(awsUnderTest.isRunning());
+                }
+
+                THEN("It should be possible to start it again once the worker has ended") {
+                    std::this_thread::sleep_for(tests::WAIT_FOR_THREAD_TO_START);
+                    awsUnderTest.startAutomaticWatering({});
+                    std::this_thread::sleep_for(tests::WAIT_FOR_THREAD_TO_START);
+
+                    CHECK(awsUnderTest.isRunning());
+                    awsUnderTest.requestShutdown();
                     CHECK_FALSE(awsUnderTest.isRunning());
                 }
             }
         }
     }
+
+    WHEN("The automatic watering system is activated with both the devices disabled") {
+        awsUnderTest.setWaterValveEnabled(false);
+        awsUnderTest.setWaterPumpEnabled(false);
+        awsUnderTest.startAutomaticWatering({});
+
+        // The job stops by itself after the activation, as the devices are disabled.
+        std::this_thread::sleep_for(awsTimeProvider->getWateringSystemActivationDuration() +
+                                    std::chrono::milliseconds(100));
+        awsUnderTest.requestShutdown();
+
+        THEN("No actuation should be recorded") {
+            const WaterUsage totalUsage{
+                waterUsageLedgers->getFlowLedger("Unnamed-flow-1").getTotalUsage()};
+            CHECK(totalUsage.actuations == 0);
+            CHECK(totalUsage.litres == 0.0);
+        }
+    }
 }
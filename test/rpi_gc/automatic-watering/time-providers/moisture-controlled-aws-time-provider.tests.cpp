@@ -0,0 +1,110 @@
+// Copyright (c) 2023 Andrea Ballestrazzi
+#include <automatic-watering/time-providers/configurable-daily-cycle-aws-time-provider.hpp>
+#include <automatic-watering/time-providers/moisture-controlled-aws-time-provider.hpp>
+
+#include <testing-core.hpp>
+
+// C++ STL
+#include <chrono>
+#include <cstdint>
+#include <functional>
+
+namespace {
+
+//! \return The current time in milliseconds since the epoch, as the sensor samples.
+[[nodiscard]] std::int64_t GetNowTimestamp() {
+    return std::chrono::duration_cast<std::chrono::milliseconds>(
+               std::chrono::system_clock::now().time_since_epoch())
+        .count();
+}
+
+} // namespace
+
+TEST_CASE("MoistureControlledAWSTimeProvider unit tests",
+          "[unit][sociable][rpi_gc][automatic-watering][MoistureControlledAWSTimeProvider]") {
+    using rpi_gc::automatic_watering::ConfigurableDailyCycleAWSTimeProvider;
+    using rpi_gc::automatic_watering::MoistureControlledAWSTimeProvider;
+    using rpi_gc::automatic_watering::MoistureControlParameters;
+    using rpi_gc::automatic_watering::MoistureWateringLimits;
+    using rpi_gc::sensors::SensorSample;
+    using rpi_gc::sensors::SensorSampleRing;
+    using namespace std::chrono_literals;
+
+    GIVEN("A moisture controlled provider with a fallback provider") {
+        SensorSampleRing moistureSamples{16};
+        ConfigurableDailyCycleAWSTimeProvider fallbackProvider{6000ms, 600'000ms, 600ms};
+        MoistureControlledAWSTimeProvider providerUnderTest{
+            moistureSamples, std::ref(fallbackProvider),
+            MoistureControlParameters{.setpoint = 35.0,
+                                      .hysteresis = 3.0,
+                                      .proportionalGain = 0.05,
+                                      .integralGain = 0.0001},
+            MoistureWateringLimits{.maxActivationTime = 20'000ms,
+                                   .minDeactivationTime = 300'000ms,
+                                   .maxDeactivationTime = 1'800'000ms,
+                                   .readingsTimeout = 900'000ms}};
+
+        WHEN("There are no readings") {
+            THEN("The fallback durations should be used") {
+                CHECK(providerUnderTest.isUsingFallback());
+                CHECK(providerUnderTest.getWateringSystemActivationDuration() == 6000ms);
+                CHECK(providerUnderTest.getWateringSystemDeactivationDuration() == 600'000ms);
+                CHECK(providerUnderTest.getPumpValveDeactivationTimeSeparation() == 600ms);
+            }
+        }
+
+        WHEN("The users set the durations") {
+            providerUnderTest.setWateringSystemActivationDuration(1000ms);
+            providerUnderTest.setWateringSystemDeactivationDuration(2000ms);
+            providerUnderTest.setPumpValveDeactivationTimeSeparation(300ms);
+
+            THEN("They should be set to the fallback provider") {
+                CHECK(fallbackProvider.getWateringSystemActivationDuration() == 1000ms);
+                CHECK(fallbackProvider.getWateringSystemDeactivationDuration() == 2000ms);
+                CHECK(fallbackProvider.getPumpValveDeactivationTimeSeparation() == 300ms);
+            }
+        }
+
+        WHEN("The soil is dry") {
+            // Two readings averaged to 25: half of the maximum demand.
+            moistureSamples.push(SensorSample{GetNowTimestamp(), 24.0});
+            moistureSamples.push(SensorSample{GetNowTimestamp(), 26.0});
+
+            THEN("The durations should follow the demand") {
+                CHECK_FALSE(providerUnderTest.isUsingFallback());
+                CHECK(providerUnderTest.getWateringSystemActivationDuration() == 10'000ms);
+                CHECK(providerUnderTest.getWateringSystemDeactivationDuration() == 1'050'000ms);
+            }
+
+            AND_WHEN("The durations are requested again without new readings") {
+                const auto activationTime{providerUnderTest.getWateringSystemActivationDuration()};
+                const auto integral{providerUnderTest.getControlOutput().integral};
+
+                THEN("The controller should not change") {
+                    CHECK(providerUnderTest.getWateringSystemActivationDuration() ==
+                          activationTime);
+                    CHECK(providerUnderTest.getControlOutput().integral == integral);
+                }
+            }
+        }
+
+        WHEN("The soil is wet") {
+            moistureSamples.push(SensorSample{GetNowTimestamp(), 45.0});
+
+            THEN("It should not water and check again after the longest deactivation") {
+                CHECK(providerUnderTest.getWateringSystemActivationDuration() == 0ms);
+                CHECK(providerUnderTest.getWateringSystemDeactivationDuration() == 1'800'000ms);
+                CHECK_FALSE(providerUnderTest.getControlOutput().bWatering);
+            }
+        }
+
+        WHEN("The last reading is too old") {
+            moistureSamples.push(SensorSample{GetNowTimestamp() - 3'600'000, 10.0});
+
+            THEN("The fallback durations should be used") {
+                CHECK(providerUnderTest.isUsingFallback());
+                CHECK(providerUnderTest.getWateringSystemActivationDuration() == 6000ms);
+            }
+        }
+    }
+}
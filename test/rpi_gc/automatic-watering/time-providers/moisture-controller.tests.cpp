@@ -0,0 +1,114 @@
+// Copyright (c) 2023 Andrea Ballestrazzi
+#include <automatic-watering/time-providers/moisture-controller.hpp>
+
+#include <testing-core.hpp>
+
+#include <catch2/catch_approx.hpp>
+
+// C++ STL
+#include <chrono>
+
+TEST_CASE("MoistureController unit tests",
+          "[unit][solitary][rpi_gc][automatic-watering][MoistureController]") {
+    using rpi_gc::automatic_watering::MoistureControlOutput;
+    using rpi_gc::automatic_watering::MoistureController;
+    using rpi_gc::automatic_watering::MoistureControlParameters;
+    using namespace std::chrono_literals;
+
+    const MoistureControlParameters parameters{.setpoint = 35.0,
+                                               .hysteresis = 3.0,
+                                               .proportionalGain = 0.05,
+                                               .integralGain = 0.0001,
+                                               .maxStepTime = 3600s};
+
+    GIVEN("A new controller") {
+        MoistureController controllerUnderTest{parameters};
+
+        WHEN("The soil is above the hysteresis band") {
+            const MoistureControlOutput output{controllerUnderTest.step(40.0, 0ms)};
+
+            THEN("It should not water") {
+                CHECK_FALSE(output.bWatering);
+                CHECK(output.demand == 0.0);
+            }
+        }
+
+        WHEN("The soil is below the hysteresis band") {
+            const MoistureControlOutput output{controllerUnderTest.step(25.0, 0ms)};
+
+            THEN("It should water with the proportional demand") {
+                CHECK(output.bWatering);
+                CHECK(output.demand == Catch::Approx(0.5));
+            }
+
+            AND_WHEN("The soil gets wetter, but stays inside the band") {
+                const MoistureControlOutput bandOutput{controllerUnderTest.step(36.0, 0ms)};
+
+                THEN("It should keep watering with a demand that can't be negative") {
+                    CHECK(bandOutput.bWatering);
+                    CHECK(bandOutput.demand == 0.0);
+                }
+            }
+
+            AND_WHEN("The soil gets above the band") {
+                const MoistureControlOutput wetOutput{controllerUnderTest.step(38.5, 0ms)};
+
+                THEN("It should stop watering") {
+                    CHECK_FALSE(wetOutput.bWatering);
+                    CHECK(wetOutput.demand == 0.0);
+                }
+
+                AND_WHEN("The soil dries inside the band") {
+                    const MoistureControlOutput bandOutput{controllerUnderTest.step(33.0, 0ms)};
+
+                    THEN("It should not restart watering") {
+                        CHECK_FALSE(bandOutput.bWatering);
+                    }
+                }
+            }
+
+            AND_WHEN("The soil stays dry for a while") {
+                controllerUnderTest.step(25.0, 60s);
+                const MoistureControlOutput output{controllerUnderTest.step(25.0, 60s)};
+
+                THEN("The integral term should increase the demand") {
+                    CHECK(output.integral == Catch::Approx(1200.0));
+                    CHECK(output.demand == Catch::Approx(0.5 + 0.12));
+                }
+            }
+        }
+
+        WHEN("A step is longer than the maximum step time") {
+            MoistureControlParameters slowParameters{parameters};
+            slowParameters.integralGain = 0.000001;
+            MoistureController slowController{slowParameters};
+
+            slowController.step(25.0, 0ms);
+            const MoistureControlOutput output{slowController.step(25.0, 24h)};
+
+            THEN("Only the maximum step time should be integrated") {
+                CHECK(output.integral == Catch::Approx(10.0 * 3600.0));
+                CHECK(output.demand == Catch::Approx(0.5 + 0.036));
+            }
+        }
+
+        WHEN("The soil is so dry that the demand saturates") {
+            controllerUnderTest.step(0.0, 0ms);
+            for (int i{}; i < 24; ++i)
+                controllerUnderTest.step(0.0, 3600s);
+
+            THEN("The integral should not wind up") {
+                CHECK(controllerUnderTest.getOutput().demand == 1.0);
+                CHECK(controllerUnderTest.getOutput().integral == 0.0);
+            }
+
+            AND_WHEN("The soil gets close to the setpoint") {
+                const MoistureControlOutput output{controllerUnderTest.step(31.0, 0ms)};
+
+                THEN("The demand should drop immediately") {
+                    CHECK(output.demand == Catch::Approx(0.2));
+                }
+            }
+        }
+    }
+}
@@ -0,0 +1,71 @@
+// Copyright (c) 2023 Andrea Ballestrazzi
+#include <automatic-watering/water-usage/water-usage-ledger-folder.hpp>
+
+#include <testing-core.hpp>
+
+// C++ STL
+#include <chrono>
+#include <filesystem>
+
+TEST_CASE("WaterUsageLedgerFolder unit tests",
+          "[unit][sociable][rpi_gc][automatic-watering][WaterUsageLedgerFolder]") {
+    using namespace rpi_gc::automatic_watering;
+    using namespace std::chrono_literals;
+
+    const std::filesystem::path ledgersPath{std::filesystem::temp_directory_path() /
+                                            "fep-water-usage-ledger-folder-tests"};
+    std::filesystem::remove_all(ledgersPath);
+
+    const WaterUsageLedger::clock_type::time_point actuationEnd{
+        std::chrono::sys_days{std::chrono::year{2023} / 6 / 1} + 6h};
+    const WaterUsage cycleUsage{.valveOpenTime = 6'000ms,
+                                .pumpOnTime = 6'500ms,
+                                .litres = 1.5,
+                                .actuations = 1};
+
+    GIVEN("A new ledgers folder") {
+        WaterUsageLedgerFolder folderUnderTest{ledgersPath};
+
+        THEN("The folder should be created") {
+            CHECK(std::filesystem::is_directory(ledgersPath));
+        }
+
+        WHEN("The actuations of two flows are recorded") {
+            folderUnderTest.getFlowLedger("Tomatoes").recordActuation(actuationEnd, cycleUsage);
+            folderUnderTest.getFlowLedger("Tomatoes").recordActuation(actuationEnd, cycleUsage);
+            folderUnderTest.getFlowLedger("Peppers").recordActuation(actuationEnd, cycleUsage);
+
+            THEN("Every flow should account only its own actuations") {
+                CHECK(folderUnderTest.getFlowLedger("Tomatoes").getTotalUsage().actuations == 2);
+                CHECK(folderUnderTest.getFlowLedger("Peppers").getTotalUsage().actuations == 1);
+                CHECK(folderUnderTest.getFlowLedger("Basil").getTotalUsage().actuations == 0);
+            }
+
+            THEN("Every flow should have its own file") {
+                CHECK(std::filesystem::exists(ledgersPath / "Tomatoes.gcwu"));
+                CHECK(std::filesystem::exists(ledgersPath / "Peppers.gcwu"));
+            }
+
+            AND_WHEN("The folder is opened again") {
+                WaterUsageLedgerFolder reopenedFolder{ledgersPath};
+
+                THEN("The usage of every flow should be restored") {
+                    CHECK(reopenedFolder.getFlowLedger("Tomatoes").getTotalUsage().litres == 3.0);
+                    CHECK(reopenedFolder.getFlowLedger("Peppers").getTotalUsage().litres == 1.5);
+                }
+            }
+        }
+    }
+
+    GIVEN("Flow names with characters that aren't allowed in the file names") {
+        THEN("They should be encoded in the file names") {
+            CHECK(WaterUsageLedgerFolder::GetFlowLedgerFileName("Tomatoes_1-A") ==
+                  "Tomatoes_1-A.gcwu");
+            CHECK(WaterUsageLedgerFolder::GetFlowLedgerFileName("../flow 1") ==
+                  "%2E%2E%2Fflow%201.gcwu");
+            CHECK(WaterUsageLedgerFolder::GetFlowLedgerFileName("50%") == "50%25.gcwu");
+        }
+    }
+
+    std::filesystem::remove_all(ledgersPath);
+}
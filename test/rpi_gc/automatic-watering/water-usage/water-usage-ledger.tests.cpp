@@ -0,0 +1,136 @@
+// Copyright (c) 2023 Andrea Ballestrazzi
+#include <automatic-watering/water-usage/water-usage-ledger.hpp>
+
+#include <testing-core.hpp>
+
+// C++ STL
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <stdexcept>
+
+TEST_CASE("WaterUsageLedger unit tests",
+          "[unit][sociable][rpi_gc][automatic-watering][WaterUsageLedger]") {
+    using namespace rpi_gc::automatic_watering;
+    using namespace std::chrono_literals;
+
+    const std::filesystem::path ledgerPath{std::filesystem::temp_directory_path() /
+                                           "fep-water-usage-ledger-tests.gcwu"};
+    std::filesystem::remove(ledgerPath);
+
+    // 2023-06-01 at 06:00 UTC.
+    const WaterUsageLedger::clock_type::time_point firstDay{
+        std::chrono::sys_days{std::chrono::year{2023} / 6 / 1} + 6h};
+    const WaterUsage cycleUsage{.valveOpenTime = 6'000ms,
+                                .pumpOnTime = 6'500ms,
+                                .litres = 1.5,
+                                .actuations = 1};
+
+    GIVEN("A new ledger") {
+        WaterUsageLedger ledgerUnderTest{ledgerPath};
+
+        THEN("The counters should be empty") {
+            CHECK(ledgerUnderTest.getDayUsage(firstDay).actuations == 0);
+            CHECK(ledgerUnderTest.getTotalUsage().litres == 0.0);
+        }
+
+        WHEN("Some actuations of the same day are recorded") {
+            ledgerUnderTest.recordActuation(firstDay, cycleUsage);
+            ledgerUnderTest.recordActuation(firstDay + 1h, cycleUsage);
+            ledgerUnderTest.recordActuation(firstDay + 17h, cycleUsage);
+
+            THEN("They should be accumulated in the bucket of the day") {
+                const WaterUsage dayUsage{ledgerUnderTest.getDayUsage(firstDay + 2h)};
+                CHECK(dayUsage.valveOpenTime == 18'000ms);
+                CHECK(dayUsage.pumpOnTime == 19'500ms);
+                CHECK(dayUsage.litres == 4.5);
+                CHECK(dayUsage.actuations == 3);
+                CHECK(ledgerUnderTest.getTotalUsage().actuations == 3);
+                CHECK(ledgerUnderTest.getLastActuationUsage().litres == 1.5);
+            }
+
+            THEN("The file should contain a single bucket") {
+                CHECK(std::filesystem::file_size(ledgerPath) == 16 + 72);
+            }
+
+            AND_WHEN("An actuation of the next day is recorded") {
+                ledgerUnderTest.recordActuation(firstDay + 24h, cycleUsage);
+
+                THEN("A new bucket should be started and the total should keep growing") {
+                    CHECK(ledgerUnderTest.getDayUsage(firstDay + 24h).actuations == 1);
+                    CHECK(ledgerUnderTest.getDayUsage(firstDay + 24h).litres == 1.5);
+                    CHECK(ledgerUnderTest.getTotalUsage().actuations == 4);
+                    CHECK(ledgerUnderTest.getTotalUsage().litres == 6.0);
+                    CHECK(std::filesystem::file_size(ledgerPath) == 16 + 2 * 72);
+                }
+
+                THEN("The previous day should not be the current bucket anymore") {
+                    CHECK(ledgerUnderTest.getDayUsage(firstDay).actuations == 0);
+                }
+            }
+        }
+    }
+
+    GIVEN("A ledger with recorded actuations") {
+        {
+            WaterUsageLedger previousLedger{ledgerPath};
+            previousLedger.recordActuation(firstDay, cycleUsage);
+            previousLedger.recordActuation(firstDay + 24h, cycleUsage);
+            previousLedger.recordActuation(firstDay + 25h, cycleUsage);
+        }
+
+        WHEN("It's opened again") {
+            WaterUsageLedger ledgerUnderTest{ledgerPath};
+
+            THEN("The counters of the last day and the total should be restored") {
+                CHECK(ledgerUnderTest.getDayUsage(firstDay + 26h).actuations == 2);
+                CHECK(ledgerUnderTest.getDayUsage(firstDay + 26h).pumpOnTime == 13'000ms);
+                CHECK(ledgerUnderTest.getTotalUsage().litres == 4.5);
+            }
+
+            THEN("The last actuation should not be known") {
+                CHECK(ledgerUnderTest.getLastActuationUsage().actuations == 0);
+            }
+
+            AND_WHEN("An actuation of the same day is recorded") {
+                ledgerUnderTest.recordActuation(firstDay + 30h, cycleUsage);
+
+                THEN("It should be added to the restored bucket") {
+                    CHECK(ledgerUnderTest.getDayUsage(firstDay + 30h).actuations == 3);
+                    CHECK(ledgerUnderTest.getTotalUsage().actuations == 4);
+                    CHECK(std::filesystem::file_size(ledgerPath) == 16 + 2 * 72);
+                }
+            }
+        }
+
+        WHEN("An append has been interrupted") {
+            std::filesystem::resize_file(ledgerPath, 16 + 2 * 72 + 10);
+            WaterUsageLedger ledgerUnderTest{ledgerPath};
+
+            THEN("The partial bucket should be ignored") {
+                CHECK(ledgerUnderTest.getTotalUsage().actuations == 3);
+            }
+
+            AND_WHEN("An actuation of a new day is recorded") {
+                ledgerUnderTest.recordActuation(firstDay + 48h, cycleUsage);
+
+                THEN("It should overwrite the partial bucket") {
+                    CHECK(std::filesystem::file_size(ledgerPath) == 16 + 3 * 72);
+                }
+            }
+        }
+    }
+
+    GIVEN("A file that isn't a ledger") {
+        {
+            std::ofstream invalidFile{ledgerPath};
+            invalidFile << "moisture,temperature\n0.5,21.0\n";
+        }
+
+        THEN("It should not be opened") {
+            CHECK_THROWS_AS(WaterUsageLedger{ledgerPath}, std::runtime_error);
+        }
+    }
+
+    std::filesystem::remove(ledgerPath);
+}
@@ -10,6 +10,7 @@
 
 // C++ STL
 #include <memory>
+#include <sstream>
 
 TEST_CASE("AbortCommand execution unit tests",
           "[unit][solitary][rpi_gc][commands][AbortCommand][execution]") {
@@ -24,8 +25,9 @@ TEST_CASE("AbortCommand execution unit tests",
         auto optionParserMock{std::make_unique<NiceMock<gh_cmd::mocks::OptionParserMock<char>>>()};
         auto& optionParserMockRef{*optionParserMock};
 
-        AbortCommand commandUnderTest{
-            loggerMock, {stoppableSystemMock}, std::move(optionParserMock)};
+        std::ostringstream outputStream{};
+        AbortCommand commandUnderTest{loggerMock, {stoppableSystemMock},
+                                      std::move(optionParserMock), outputStream};
 
         WHEN("execute() is called") {
             THEN("emergencyAbort() should be called on the stoppable system") {
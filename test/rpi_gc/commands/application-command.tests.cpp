@@ -199,4 +199,46 @@ TEST_CASE("ApplicationCommand execution unit tests",
             }
         }
     }
+
+    GIVEN("An input line with an application option and a bivalent command option") {
+        using OptionPointer = std::shared_ptr<gh_cmd::CommandOption<CharType>>;
+
+        std::vector<ApplicationCommand::string_type> inputLine{
+            StringType{strings::application::EXECUTABLE_NAME}, "--script", "provisioning.txt",
+            "--version"};
+
+        std::shared_ptr<NiceMock<CommandOptionMock>> scriptOptionMock{
+            std::make_shared<NiceMock<CommandOptionMock>>()};
+        ON_CALL(*scriptOptionMock, getLongName).WillByDefault(testing::Return("script"));
+        ON_CALL(*scriptOptionMock, isSet).WillByDefault(testing::Return(true));
+
+        std::shared_ptr<NiceMock<CommandOptionMock>> versionCommandOptionMock{
+            std::make_shared<NiceMock<CommandOptionMock>>()};
+        ON_CALL(*versionCommandOptionMock, getLongName)
+            .WillByDefault(testing::Return(StringType{strings::commands::VERSION}));
+        ON_CALL(*versionCommandOptionMock, isSet).WillByDefault(testing::Return(true));
+
+        ON_CALL(optionParser, getOptions())
+            .WillByDefault(testing::Return(
+                std::vector<OptionPointer>{scriptOptionMock, versionCommandOptionMock}));
+
+        StrictMock<BivalentCommandMock> versionCommandMock{};
+        EXPECT_CALL(versionCommandMock, getAsOption)
+            .WillRepeatedly(testing::Return(versionCommandOptionMock));
+
+        commandUnderTest.addApplicationOption(scriptOptionMock);
+        commandUnderTest.addBivalentCommand(versionCommandMock);
+
+        commandUnderTest.processInputOptions(inputLine);
+
+        WHEN("The command is executed") {
+            THEN("Only the bivalent command should be executed") {
+                EXPECT_CALL(versionCommandMock, executeAsOption)
+                    .Times(1)
+                    .WillOnce(testing::Return(true));
+
+                CHECK(commandUnderTest.execute());
+            }
+        }
+    }
 }
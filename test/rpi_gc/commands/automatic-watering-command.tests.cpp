@@ -45,6 +45,7 @@ TEST_CASE("AutomaticWateringCommand Events unit tests",
 
                 CHECK(optionPointer->getLongName() == OPTION_NAME);
                 bEventCalled = true;
+                return true;
             };
 
         commandUnderTest.registerOptionEvent(OPTION_NAME, eventMock);
@@ -60,10 +61,37 @@ TEST_CASE("AutomaticWateringCommand Events unit tests",
                     std::vector<AutomaticWateringCommand::option_parser::option_pointer>{
                         optionMock}));
 
-            commandUnderTest.execute();
+            const bool bExecuted{commandUnderTest.execute()};
 
             THEN("The command should trigger the event") {
                 CHECK(bEventCalled);
+                CHECK(bExecuted);
+            }
+        }
+
+        AND_WHEN("Another event of the option fails") {
+            commandUnderTest.registerOptionEvent(
+                OPTION_NAME,
+                []([[maybe_unused]] AutomaticWateringCommand::option_parser::const_option_pointer
+                       optionPointer) {
+                    return false;
+                });
+
+            using CommandOptionStub = testing::NiceMock<gh_cmd::mocks::CommandOptionMock<CharType>>;
+            auto optionMock{
+                tests::ConfigureCommandOptionMock<CommandOptionStub>(OPTION_NAME, true)};
+
+            EXPECT_CALL(*optionParserRef, getOptions())
+                .Times(1)
+                .WillOnce(testing::Return(
+                    std::vector<AutomaticWateringCommand::option_parser::option_pointer>{
+                        optionMock}));
+
+            const bool bExecuted{commandUnderTest.execute()};
+
+            THEN("The command execution should fail") {
+                CHECK(bEventCalled);
+                CHECK_FALSE(bExecuted);
             }
         }
 
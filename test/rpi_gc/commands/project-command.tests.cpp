@@ -11,16 +11,20 @@
 // C++ STL
 #include <map>
 #include <memory>
+#include <sstream>
 #include <tuple>
 
 TEST_CASE("ProjectCommand unit tests", "[unit][solitary][rpi_gc][commands][ProjectCommand]") {
     using namespace rpi_gc;
 
+    std::ostringstream outputStream{};
+
     SECTION("getName() should return the correct name") {
         auto dummyOptionParser{
             std::make_unique<testing::NiceMock<gh_cmd::mocks::OptionParserMock<char>>>()};
         const commands::ProjectCommand commandUnderTest{
-            std::move(dummyOptionParser), commands::ProjectCommand::event_handler_map{}};
+            std::move(dummyOptionParser), commands::ProjectCommand::event_handler_map{},
+            outputStream};
 
         CHECK(commandUnderTest.getName() == strings::commands::PROJECT);
     }
@@ -31,8 +35,9 @@ TEST_CASE("ProjectCommand unit tests", "[unit][solitary][rpi_gc][commands][Proje
                 std::make_unique<testing::StrictMock<gh_cmd::mocks::OptionParserMock<char>>>()};
             auto& optionParserMockRef{*optionParserMock};
 
-            commands::ProjectCommand commandUnderTest{
-                std::move(optionParserMock), commands::ProjectCommand::event_handler_map{}};
+            commands::ProjectCommand commandUnderTest{std::move(optionParserMock),
+                                                      commands::ProjectCommand::event_handler_map{},
+                                                      outputStream};
 
             WHEN("input options are processed") {
                 const std::vector<commands::ProjectCommand::string_type> inputOptions{"--help",
@@ -53,7 +58,8 @@ TEST_CASE("ProjectCommand unit tests", "[unit][solitary][rpi_gc][commands][Proje
             std::make_unique<testing::NiceMock<gh_cmd::mocks::OptionParserMock<char>>>()};
         auto& optionParserStub{*dummyOptionParser};
         std::map<std::string, bool> callsPool{
-            {"test", false}
+            {"test",    false},
+            {"failing", false}
         };
         commands::ProjectCommand::event_handler_map eventHandlerMap{
             {"test",
@@ -61,11 +67,19 @@ TEST_CASE("ProjectCommand unit tests", "[unit][solitary][rpi_gc][commands][Proje
                  [[maybe_unused]] commands::ProjectCommand::option_parser::const_option_pointer
                      optionPointer) {
                  callsPool["test"] = true;
+                 return true;
+             }},
+            {"failing",
+             [&callsPool](
+                 [[maybe_unused]] commands::ProjectCommand::option_parser::const_option_pointer
+                     optionPointer) {
+                 callsPool["failing"] = true;
+                 return false;
              }}
         };
 
         commands::ProjectCommand commandUnderTest{std::move(dummyOptionParser),
-                                                  std::move(eventHandlerMap)};
+                                                  std::move(eventHandlerMap), outputStream};
 
         SECTION("processInputOptions() should always return true") {
             const std::vector<commands::ProjectCommand::string_type> inputOptions{"--help", "junk"};
@@ -92,5 +106,40 @@ TEST_CASE("ProjectCommand unit tests", "[unit][solitary][rpi_gc][commands][Proje
                 CHECK(bRes);
             }
         }
+
+        WHEN("The command is executed with an option whose handler fails") {
+            auto failingOptionMock{
+                std::make_shared<testing::NiceMock<gh_cmd::mocks::CommandOptionMock<char>>>()};
+            ON_CALL(*failingOptionMock, getLongName).WillByDefault(testing::Return("failing"));
+            ON_CALL(*failingOptionMock, isSet).WillByDefault(testing::Return(true));
+
+            auto testOptionMock{
+                std::make_shared<testing::NiceMock<gh_cmd::mocks::CommandOptionMock<char>>>()};
+            ON_CALL(*testOptionMock, getLongName).WillByDefault(testing::Return("test"));
+            ON_CALL(*testOptionMock, isSet).WillByDefault(testing::Return(true));
+
+            ON_CALL(optionParserStub, getOptions())
+                .WillByDefault(testing::Return(
+                    std::vector<commands::ProjectCommand::option_parser::option_pointer>{
+                        failingOptionMock, testOptionMock}));
+            const bool bRes{commandUnderTest.execute()};
+
+            THEN("The execution should fail without handling the following options") {
+                CHECK_FALSE(bRes);
+                CHECK(callsPool["failing"]);
+                CHECK_FALSE(callsPool["test"]);
+            }
+        }
+
+        WHEN("The command is executed without any option") {
+            ON_CALL(optionParserStub, getOptions())
+                .WillByDefault(testing::Return(
+                    std::vector<commands::ProjectCommand::option_parser::option_pointer>{}));
+            static_cast<void>(commandUnderTest.execute());
+
+            THEN("The help page should be printed to the given output stream") {
+                CHECK(outputStream.str().starts_with("[NAME]"));
+            }
+        }
     }
 }
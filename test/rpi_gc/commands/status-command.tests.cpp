@@ -10,7 +10,10 @@
 #include <testing-core.hpp>
 
 // C++ STL
+#include <cstdint>
 #include <sstream>
+#include <stdexcept>
+#include <string>
 #include <tuple>
 
 namespace tests {
@@ -103,9 +106,8 @@ TEST_CASE("Status command unit tests", "[unit][solitary][rpi_gc][commands][Statu
                 ON_CALL(*optionParserMock, getOptions())
                     .WillByDefault(testing::Return(optionPointers));
 
-                THEN("It should print the help page without printing any diagnostics") {
-                    EXPECT_CALL(diagnosticMock, printDiagnostic(testing::Ref(dummyOutputStream)))
-                        .Times(0);
+                THEN("It should print the help page without capturing any diagnostics") {
+                    EXPECT_CALL(diagnosticMock, captureDiagnostic).Times(0);
 
                     [[maybe_unused]] const bool bExec{commandUnderTest.execute()};
                 }
@@ -118,18 +120,110 @@ TEST_CASE("Status command unit tests", "[unit][solitary][rpi_gc][commands][Statu
             }
 
             WHEN("The command is passed without any arguments") {
-                THEN("It should be printed the diagnosticable object status") {
-                    EXPECT_CALL(diagnosticMock, printDiagnostic(testing::Ref(dummyOutputStream)))
-                        .Times(1);
+                const diagnostics::DiagnosticSnapshot snapshot{
+                    .system = "test-system",
+                    .title = "Test system",
+                    .fields = {diagnostics::DiagnosticField{"cycles", "Cycles",
+                                                            std::uint64_t{3}}}};
+
+                THEN("The diagnosticable object status should be captured only once") {
+                    EXPECT_CALL(diagnosticMock, captureDiagnostic)
+                        .Times(1)
+                        .WillOnce(testing::Return(snapshot));
 
                     [[maybe_unused]] const bool bExec{commandUnderTest.execute()};
                 }
 
-                THEN("The execution should succeed") {
-                    EXPECT_CALL(diagnosticMock, printDiagnostic(testing::_));
+                THEN("The status should be printed as text inside a diagnostic section") {
+                    EXPECT_CALL(diagnosticMock, captureDiagnostic)
+                        .WillOnce(testing::Return(snapshot));
+
+                    const bool bExec{commandUnderTest.execute()};
+                    CHECK(bExec);
+                    CHECK(dummyOutputStream.str() ==
+                          "<Diagnostic section start>\n"
+                          "\n [Diagnostic]:\tTest system\n"
+                          " [Cycles]:\t3\n"
+                          "\n<section end>\n");
+                }
+
+                THEN("The execution should fail if the status can't be captured") {
+                    EXPECT_CALL(diagnosticMock, captureDiagnostic)
+                        .WillOnce(testing::Throw(std::runtime_error{"Capture failed"}));
+
+                    const bool bExec{commandUnderTest.execute()};
+                    CHECK_FALSE(bExec);
+                    CHECK(dummyOutputStream.str().find("Capture failed") != std::string::npos);
+                }
+            }
+
+            WHEN("A json option is passed as an argument to the command") {
+                auto jsonOptionMock = std::make_shared<HelpOptionMock>();
+                EXPECT_CALL(*jsonOptionMock, getLongName)
+                    .Times(testing::AtLeast(1))
+                    .WillRepeatedly(testing::Return("json"));
+
+                EXPECT_CALL(*jsonOptionMock, isSet).WillOnce(testing::Return(true));
+                EXPECT_CALL(*jsonOptionMock, clear).Times(1);
+
+                optionPointers.push_back(jsonOptionMock);
+                ON_CALL(*optionParserMock, getOptions())
+                    .WillByDefault(testing::Return(optionPointers));
+
+                THEN("The status should be printed as a single line of JSON") {
+                    EXPECT_CALL(diagnosticMock, captureDiagnostic)
+                        .WillOnce(testing::Return(diagnostics::DiagnosticSnapshot{
+                            .system = "test-system",
+                            .title = "Test system",
+                            .fields = {diagnostics::DiagnosticField{"running", "Running",
+                                                                    true}}}));
 
                     const bool bExec{commandUnderTest.execute()};
                     CHECK(bExec);
+                    CHECK(dummyOutputStream.str() ==
+                          "{\"systems\":[{\"system\":\"test-system\",\"running\":true}]}\n");
+                }
+            }
+
+            WHEN("A watch is started and then stopped") {
+                auto watchOptionMock = std::make_shared<HelpOptionMock>();
+                auto unwatchOptionMock = std::make_shared<HelpOptionMock>();
+                EXPECT_CALL(*watchOptionMock, getLongName)
+                    .WillRepeatedly(testing::Return("watch"));
+                EXPECT_CALL(*unwatchOptionMock, getLongName)
+                    .WillRepeatedly(testing::Return("unwatch"));
+
+                // The first execution starts the watch, the second one stops it.
+                EXPECT_CALL(*watchOptionMock, isSet)
+                    .WillOnce(testing::Return(true))
+                    .WillRepeatedly(testing::Return(false));
+                EXPECT_CALL(*unwatchOptionMock, isSet)
+                    .WillOnce(testing::Return(false))
+                    .WillRepeatedly(testing::Return(true));
+                EXPECT_CALL(*watchOptionMock, clear).Times(2);
+                EXPECT_CALL(*unwatchOptionMock, clear).Times(2);
+
+                optionPointers.push_back(watchOptionMock);
+                optionPointers.push_back(unwatchOptionMock);
+                ON_CALL(*optionParserMock, getOptions())
+                    .WillByDefault(testing::Return(optionPointers));
+
+                THEN("The full status should be printed once by the watcher") {
+                    EXPECT_CALL(diagnosticMock, getChangeNotifier)
+                        .WillOnce(testing::Return(nullptr));
+                    EXPECT_CALL(diagnosticMock, captureDiagnostic)
+                        .Times(testing::AtLeast(1))
+                        .WillRepeatedly(testing::Return(diagnostics::DiagnosticSnapshot{
+                            .system = "test-system", .title = "Test system"}));
+
+                    CHECK(commandUnderTest.execute());
+                    CHECK(commandUnderTest.execute());
+
+                    // The watcher has been joined, so the stream can be read safely.
+                    const std::string output{dummyOutputStream.str()};
+                    CHECK(output.starts_with("Watching the status every 500ms."));
+                    CHECK(output.find("\n [Diagnostic]:\tTest system\n") != std::string::npos);
+                    CHECK(output.ends_with("Status watch stopped.\n"));
                 }
             }
         }
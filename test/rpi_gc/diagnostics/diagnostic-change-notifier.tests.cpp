@@ -0,0 +1,43 @@
+// Copyright (c) 2023 Andrea Ballestrazzi
+#include <diagnostics/diagnostic-change-notifier.hpp>
+
+#include <testing-core.hpp>
+
+TEST_CASE("Diagnostic change notifier unit tests",
+          "[unit][solitary][rpi_gc][diagnostics][DiagnosticChangeNotifier]") {
+    using namespace rpi_gc::diagnostics;
+
+    DiagnosticChangeNotifier notifierUnderTest{};
+
+    GIVEN("Two subscribed listeners") {
+        int firstNotificationsCount{};
+        int secondNotificationsCount{};
+
+        const auto firstSubscription{notifierUnderTest.subscribe([&firstNotificationsCount] {
+            ++firstNotificationsCount;
+        })};
+        [[maybe_unused]] const auto secondSubscription{
+            notifierUnderTest.subscribe([&secondNotificationsCount] {
+                ++secondNotificationsCount;
+            })};
+
+        WHEN("A change is notified") {
+            notifierUnderTest.notifyChanged();
+
+            THEN("Every listener should be invoked once") {
+                CHECK(firstNotificationsCount == 1);
+                CHECK(secondNotificationsCount == 1);
+            }
+        }
+
+        WHEN("A listener unsubscribes before the change is notified") {
+            notifierUnderTest.unsubscribe(firstSubscription);
+            notifierUnderTest.notifyChanged();
+
+            THEN("Only the other listener should be invoked") {
+                CHECK(firstNotificationsCount == 0);
+                CHECK(secondNotificationsCount == 1);
+            }
+        }
+    }
+}
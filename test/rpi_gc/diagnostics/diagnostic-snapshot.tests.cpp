@@ -0,0 +1,114 @@
+// Copyright (c) 2023 Andrea Ballestrazzi
+#include <diagnostics/diagnostic-snapshot.hpp>
+
+#include <testing-core.hpp>
+
+// C++ STL
+#include <cstdint>
+#include <limits>
+#include <string>
+
+TEST_CASE("Diagnostic snapshot rendering unit tests",
+          "[unit][solitary][rpi_gc][diagnostics][DiagnosticSnapshot]") {
+    using namespace rpi_gc::diagnostics;
+
+    GIVEN("A snapshot with top-level fields and a section") {
+        const DiagnosticSnapshot snapshot{
+            .system = "automatic-watering",
+            .title = "Automatic watering system (AWS)",
+            .fields = {DiagnosticField{"name", "AWS Name", std::string{"north \"A\""}},
+                       DiagnosticField{"offset", "Offset", std::int64_t{-12}}},
+            .sections = {DiagnosticSection{
+                .key = "flow",
+                .title = "AWS Flow",
+                .fields = {DiagnosticField{"valveEnabled", "Water valve status", false},
+                           DiagnosticField{"activationTimeMs", "Activation time",
+                                           std::int64_t{1500}, "ms"},
+                           DiagnosticField{"ratio", "Ratio", 0.5}}}}};
+
+        WHEN("It's rendered as text") {
+            std::string output{};
+            AppendDiagnosticText(output, snapshot);
+
+            THEN("Every field should be printed on its own line") {
+                CHECK(output == "\n [Diagnostic]:\tAutomatic watering system (AWS)\n"
+                                " [AWS Name]:\tnorth \"A\"\n"
+                                " [Offset]:\t-12\n"
+                                " {AWS Flow}\n"
+                                "\t [Water valve status]: Disabled\n"
+                                "\t [Activation time]: 1500ms\n"
+                                "\t [Ratio]: 0.5\n");
+            }
+        }
+
+        WHEN("It's rendered as JSON") {
+            std::string output{"["};
+            AppendDiagnosticJson(output, snapshot);
+
+            THEN("It should be appended as a compact object with the strings escaped") {
+                CHECK(output == "[{\"system\":\"automatic-watering\",\"name\":\"north \\\"A\\\"\","
+                                "\"offset\":-12,\"flow\":{\"valveEnabled\":false,"
+                                "\"activationTimeMs\":1500,\"ratio\":0.5}}");
+            }
+        }
+    }
+
+    GIVEN("Two snapshots of the same system") {
+        const DiagnosticSnapshot previous{
+            .title = "Test system",
+            .fields = {DiagnosticField{"status", "Status", std::string{"Idling"}},
+                       DiagnosticField{"threadId", "Thread ID", std::string{"42"}}},
+            .sections = {DiagnosticSection{
+                .key = "flow",
+                .title = "Flow",
+                .fields = {DiagnosticField{"cycles", "Cycles", std::uint64_t{1}},
+                           DiagnosticField{"pin", "Pin", std::uint64_t{26}}}}}};
+
+        WHEN("Some fields have changed or have been removed") {
+            DiagnosticSnapshot current{previous};
+            current.fields[0].value = std::string{"Irrigating"};
+            current.fields.pop_back();
+            current.sections[0].fields[0].value = std::uint64_t{2};
+
+            std::string output{};
+            const bool bChanged{AppendDiagnosticTextChanges(output, previous, current)};
+
+            THEN("Only the changed fields should be printed") {
+                CHECK(bChanged);
+                CHECK(output == "\n [Diagnostic]:\tTest system\n"
+                                " [Status]:\tIrrigating\n"
+                                " [Thread ID]:\tn/a\n"
+                                " {Flow}\n"
+                                "\t [Cycles]: 2\n");
+            }
+        }
+
+        WHEN("Nothing has changed") {
+            std::string output{"previous frame"};
+            const bool bChanged{AppendDiagnosticTextChanges(output, previous, previous)};
+
+            THEN("Nothing should be appended") {
+                CHECK_FALSE(bChanged);
+                CHECK(output == "previous frame");
+            }
+        }
+    }
+
+    GIVEN("A snapshot with values that have no plain JSON representation") {
+        const DiagnosticSnapshot snapshot{
+            .system = "test",
+            .fields = {DiagnosticField{"text", "Text", std::string{"a\\b\n\x01"}},
+                       DiagnosticField{"nan", "NaN", std::numeric_limits<double>::quiet_NaN()}},
+            .sections = {DiagnosticSection{.key = "empty", .title = "Empty"}}};
+
+        WHEN("It's rendered as JSON") {
+            std::string output{};
+            AppendDiagnosticJson(output, snapshot);
+
+            THEN("The control characters should be escaped and the NaN should be null") {
+                CHECK(output == "{\"system\":\"test\",\"text\":\"a\\\\b\\n\\u0001\","
+                                "\"nan\":null,\"empty\":{}}");
+            }
+        }
+    }
+}
@@ -0,0 +1,111 @@
+// Copyright (c) 2023 Andrea Ballestrazzi
+#include <diagnostics/diagnostic-watcher.hpp>
+
+#include <testing-core.hpp>
+
+// C++ STL
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <optional>
+#include <sstream>
+#include <string>
+
+namespace {
+
+//!!
+//! \brief A system with a counter that notifies its changes and counts its captures.
+//!
+class CountingSystem final : public rpi_gc::diagnostics::DiagnosticStatusProbeable {
+public:
+    [[nodiscard]] rpi_gc::diagnostics::DiagnosticSnapshot captureDiagnostic() const override {
+        std::lock_guard countersLock{m_countersMutex};
+        ++m_capturesCount;
+        m_captureListener.notify_all();
+
+        return rpi_gc::diagnostics::DiagnosticSnapshot{
+            .title = "Counting system",
+            .fields = {rpi_gc::diagnostics::DiagnosticField{"counter", "Counter", m_counter},
+                       rpi_gc::diagnostics::DiagnosticField{"name", "Name",
+                                                            std::string{"counting"}}}};
+    }
+
+    [[nodiscard]] rpi_gc::diagnostics::DiagnosticChangeNotifier* getChangeNotifier()
+        const noexcept override {
+        return &m_changeNotifier;
+    }
+
+    void increment() {
+        {
+            std::lock_guard countersLock{m_countersMutex};
+            ++m_counter;
+        }
+
+        m_changeNotifier.notifyChanged();
+    }
+
+    //! \return True if the system has been captured the given number of times.
+    [[nodiscard]] bool waitForCaptures(const std::uint64_t capturesCount) const {
+        std::unique_lock countersLock{m_countersMutex};
+        return m_captureListener.wait_for(countersLock, std::chrono::seconds{5},
+                                          [this, capturesCount] {
+                                              return m_capturesCount >= capturesCount;
+                                          });
+    }
+
+    [[nodiscard]] std::uint64_t getCapturesCount() const {
+        std::lock_guard countersLock{m_countersMutex};
+        return m_capturesCount;
+    }
+
+private:
+    mutable std::mutex m_countersMutex{};
+    mutable std::condition_variable m_captureListener{};
+    mutable std::uint64_t m_capturesCount{};
+    std::uint64_t m_counter{};
+    mutable rpi_gc::diagnostics::DiagnosticChangeNotifier m_changeNotifier{};
+};
+
+} // namespace
+
+TEST_CASE("Diagnostic watcher unit tests",
+          "[unit][sociable][rpi_gc][diagnostics][DiagnosticWatcher]") {
+    using namespace rpi_gc::diagnostics;
+
+    CountingSystem countingSystem{};
+    std::ostringstream outputStream{};
+
+    GIVEN("A watcher of a system that notifies its changes") {
+        std::optional<DiagnosticWatcher> watcherUnderTest{};
+        watcherUnderTest.emplace(
+            std::vector<DiagnosticWatcher::diagnostic_probeable_ref>{std::cref(countingSystem)},
+            outputStream, std::chrono::milliseconds{1});
+
+        WHEN("The system changes") {
+            REQUIRE(countingSystem.waitForCaptures(1));
+            countingSystem.increment();
+            REQUIRE(countingSystem.waitForCaptures(2));
+
+            // The watcher is joined, so the stream can be read safely.
+            watcherUnderTest.reset();
+
+            THEN("The full status and then only the changed field should be printed") {
+                CHECK(outputStream.str() == "\n [Diagnostic]:\tCounting system\n"
+                                            " [Counter]:\t0\n"
+                                            " [Name]:\tcounting\n"
+                                            "\n [Diagnostic]:\tCounting system\n"
+                                            " [Counter]:\t1\n");
+            }
+        }
+
+        WHEN("The system doesn't change") {
+            REQUIRE(countingSystem.waitForCaptures(1));
+            watcherUnderTest.reset();
+
+            THEN("The system should be captured only once") {
+                CHECK(countingSystem.getCapturesCount() == 1);
+            }
+        }
+    }
+}
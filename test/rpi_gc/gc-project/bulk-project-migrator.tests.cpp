@@ -0,0 +1,111 @@
+// Copyright (c) 2023 Andrea Ballestrazzi
+#include <gc-project/migration/bulk-project-migrator.hpp>
+#include <gc-project/upgraders/project-upgraders.hpp>
+
+#include <project-management/project-io/project-reader.hpp>
+#include <project-management/project-io/project-writer.hpp>
+
+#include <testing-core.hpp>
+
+// C++ STL
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <string>
+
+namespace tests {
+
+[[nodiscard]] gc::project_management::Project CreateV1_1Project(std::string title) {
+    using namespace gc::project_management;
+    using namespace std::string_literals;
+
+    Project project{Project::time_point_type{}, std::move(title), semver::version{1, 1, 0}};
+
+    ProjectNode flowNode{};
+    flowNode.addValue("isWaterValveEnabled"s, true)
+        .addValue("isWaterPumpEnabled"s, false)
+        .addValue("valvePinID"s, std::uint64_t{26});
+
+    ProjectNode awsNode{};
+    awsNode.addObject("flow"s, std::move(flowNode));
+    project.addObject("automaticWateringSystem"s, std::move(awsNode));
+
+    return project;
+}
+
+} // namespace tests
+
+TEST_CASE("BulkProjectMigrator unit tests",
+          "[unit][sociable][rpi_gc][gc-project][migration][BulkProjectMigrator]") {
+    using namespace rpi_gc::gc_project;
+    using namespace gc::project_management;
+    using namespace std::string_literals;
+
+    const std::filesystem::path testDirectory{std::filesystem::temp_directory_path() /
+                                              "rpi-gc-bulk-project-migrator-tests"};
+    const std::filesystem::path inputDirectory{testDirectory / "input"};
+    const std::filesystem::path outputDirectory{testDirectory / "output"};
+    std::filesystem::remove_all(testDirectory);
+    std::filesystem::create_directories(inputDirectory);
+
+    constexpr semver::version TARGET_VERSION{1, 2, 0};
+
+    *project_io::createJsonProjectFileWriter(inputDirectory / "old.json")
+        << tests::CreateV1_1Project("old");
+    *project_io::createJsonProjectFileWriter(inputDirectory / "current.json")
+        << Project{Project::time_point_type{}, "current", TARGET_VERSION};
+    std::ofstream{inputDirectory / "broken.json"} << "{ \"title\": ";
+    std::ofstream{inputDirectory / "notes.txt"} << "not a project";
+
+    const auto upgraderRegistry{upgraders::CreateProjectUpgraderRegistry()};
+    const migration::BulkProjectMigrator migratorUnderTest{upgraderRegistry, TARGET_VERSION, 2};
+
+    WHEN("The directory is migrated to another directory") {
+        const migration::MigrationReport report{
+            migratorUnderTest.migrateDirectory(inputDirectory, outputDirectory)};
+
+        THEN("The report should count every project file") {
+            CHECK(report.getProcessedProjects() == 3);
+            CHECK(report.migratedProjects == 1);
+            CHECK(report.upToDateProjects == 1);
+            CHECK(report.processedBytes > 0);
+            REQUIRE(report.failures.size() == 1);
+            CHECK(report.failures[0].projectPath.filename() == "broken.json");
+        }
+
+        THEN("The migrated project should have the new layout") {
+            Project project{};
+            *project_io::CreateJsonProjectFileReader(outputDirectory / "old.json") >> project;
+
+            CHECK(project.getVersion() == TARGET_VERSION);
+            const ProjectNode& flowNode{
+                project.getObject("automaticWateringSystem"s).getObject("flow"s)};
+            CHECK(flowNode.getObjectArray("devices"s).size() == 2);
+            CHECK_FALSE(flowNode.contains("valvePinID"s));
+        }
+
+        THEN("The up to date project should be copied and the sources left untouched") {
+            CHECK(std::filesystem::exists(outputDirectory / "current.json"));
+            CHECK_FALSE(std::filesystem::exists(outputDirectory / "broken.json"));
+
+            Project project{};
+            *project_io::CreateJsonProjectFileReader(inputDirectory / "old.json") >> project;
+            CHECK(project.getVersion() == semver::version{1, 1, 0});
+        }
+    }
+
+    WHEN("The directory is migrated in place") {
+        const migration::MigrationReport report{migratorUnderTest.migrateDirectory(inputDirectory)};
+
+        THEN("The old project should be replaced") {
+            CHECK(report.migratedProjects == 1);
+
+            Project project{};
+            *project_io::CreateJsonProjectFileReader(inputDirectory / "old.json") >> project;
+            CHECK(project.getVersion() == TARGET_VERSION);
+            CHECK_FALSE(std::filesystem::exists(inputDirectory / "old.json.migrating"));
+        }
+    }
+
+    std::filesystem::remove_all(testDirectory);
+}
@@ -1,11 +1,15 @@
 // Copyright (c) 2023 Andrea Ballestrazzi
 #include <testing-core.hpp>
 
+#include <commands/project-command.hpp>
 #include <greenhouse-controller-application.hpp>
 #include <version/version-numbers.hpp>
 
+#include <gh_cmd/gh_cmd.hpp>
+
 // User interface
 #include <user-interface/application-strings.hpp>
+#include <user-interface/commands-strings.hpp>
 
 // Test doubles
 #include <gh_log/test-doubles/logger.mock.hpp>
@@ -13,8 +17,12 @@
 #include <rpi_gc/test-doubles/commands/terminal-command.mock.hpp>
 
 // C++ STL
+#include <chrono>
 #include <cstdint>
 
+// POSIX
+#include <unistd.h>
+
 namespace tests {
 
 void VerifyLineEqual(const std::size_t lineNum, rpi_gc::OutputStringStream& actual,
@@ -166,3 +174,182 @@ TEST_CASE("GreenhouseControllerApplication termination unit tests",
         }
     }
 }
+
+TEST_CASE("GreenhouseControllerApplication event loop input unit tests",
+          "[unit][sociable][rpi_gc][GreenhouseControllerApplication][event-loop]") {
+    using namespace rpi_gc;
+    using namespace std::chrono_literals;
+
+    GIVEN("An application that reads the user input through an event loop") {
+        using testing::NiceMock;
+
+        int inputPipe[2]{};
+        REQUIRE(::pipe(inputPipe) == 0);
+
+        InputStringStream inputStream{};
+        OutputStringStream outputStream{};
+        gc_project::ProjectController projectController{};
+        GreenhouseControllerApplication applicationUnderTest{
+            outputStream, inputStream, std::make_shared<NiceMock<gh_log::mocks::LoggerMock>>(),
+            projectController};
+
+        EventLoop eventLoop{};
+        applicationUnderTest.useEventLoop(eventLoop, inputPipe[0]);
+
+        WHEN("The user types a command split in many writes and then exits from a timer") {
+            const std::string firstChunk{"unknown-co"};
+            const std::string secondChunk{"mmand\n"};
+            REQUIRE(::write(inputPipe[1], firstChunk.data(), firstChunk.size()) ==
+                    static_cast<ssize_t>(firstChunk.size()));
+            REQUIRE(::write(inputPipe[1], secondChunk.data(), secondChunk.size()) ==
+                    static_cast<ssize_t>(secondChunk.size()));
+
+            bool bTimerExpired{};
+            eventLoop.addTimer(5ms, 0ms, [&bTimerExpired, &inputPipe] {
+                bTimerExpired = true;
+                const std::string exitCommand{"exit\n"};
+                REQUIRE(::write(inputPipe[1], exitCommand.data(), exitCommand.size()) ==
+                        static_cast<ssize_t>(exitCommand.size()));
+            });
+
+            applicationUnderTest.run();
+
+            THEN("The whole command should be processed while the timer is dispatched") {
+                const StringType output{outputStream.str()};
+                CHECK(bTimerExpired);
+                CHECK(output.find("unknown-command: ") != StringType::npos);
+                CHECK(output.find(strings::commands::feedbacks::GOODBYE) != StringType::npos);
+                CHECK(eventLoop.getSourcesCount() == 0);
+            }
+        }
+
+        WHEN("The input is closed without the exit command") {
+            ::close(inputPipe[1]);
+            inputPipe[1] = -1;
+
+            THEN("The application should terminate") {
+                applicationUnderTest.run();
+                CHECK(outputStream.str().find(strings::commands::feedbacks::GOODBYE) !=
+                      StringType::npos);
+            }
+        }
+
+        ::close(inputPipe[0]);
+        if (inputPipe[1] >= 0) {
+            ::close(inputPipe[1]);
+        }
+    }
+}
+
+TEST_CASE("GreenhouseControllerApplication script execution unit tests",
+          "[unit][sociable][rpi_gc][GreenhouseControllerApplication][script]") {
+    using namespace rpi_gc;
+    using ScriptErrorPolicy = GreenhouseControllerApplication::ScriptErrorPolicy;
+
+    GIVEN("An application with a supported command and a terminable system") {
+        using testing::NiceMock;
+        using testing::Return;
+        using TerminalCommandMock = NiceMock<mocks::TerminalCommandMock<CharType>>;
+        using TerminableSystemMock = NiceMock<abort_system::mocks::TerminableSystemMock>;
+
+        InputStringStream inputStream{};
+        OutputStringStream outputStream{};
+        gc_project::ProjectController projectController{};
+        GreenhouseControllerApplication applicationUnderTest{
+            outputStream, inputStream, std::make_shared<NiceMock<gh_log::mocks::LoggerMock>>(),
+            projectController};
+
+        auto commandMockPtr{std::make_unique<TerminalCommandMock>()};
+        TerminalCommandMock& commandMock{*commandMockPtr};
+        ON_CALL(commandMock, getName).WillByDefault(Return("configure"));
+        ON_CALL(commandMock, processInputOptions).WillByDefault(Return(true));
+        ON_CALL(commandMock, execute).WillByDefault(Return(true));
+        applicationUnderTest.addSupportedCommand(std::move(commandMockPtr));
+
+        const auto terminableSystemMock{std::make_shared<TerminableSystemMock>()};
+        applicationUnderTest.addTerminableSystem(terminableSystemMock);
+
+        WHEN("A script with comments and empty lines is run") {
+            InputStringStream scriptStream{
+                "# Provisioning\n\nconfigure -A 10\n  \nconfigure -D 20\n"};
+
+            EXPECT_CALL(commandMock, execute).Times(2);
+            EXPECT_CALL(*terminableSystemMock, requestShutdown).Times(1);
+
+            const bool bSucceeded{
+                applicationUnderTest.runScript(scriptStream, ScriptErrorPolicy::FailFast)};
+
+            THEN("Only the commands should be executed, without the header and the prompt") {
+                CHECK(bSucceeded);
+
+                const StringType output{outputStream.str()};
+                CHECK(output.find(strings::application::NAME) == StringType::npos);
+                CHECK(output.find("controller@") == StringType::npos);
+            }
+        }
+
+        WHEN("A fail-fast script contains an unknown command") {
+            InputStringStream scriptStream{"configure -A 10\nunknown\nconfigure -D 20\n"};
+
+            EXPECT_CALL(commandMock, execute).Times(1);
+
+            const bool bSucceeded{
+                applicationUnderTest.runScript(scriptStream, ScriptErrorPolicy::FailFast)};
+
+            THEN("The script should stop at the failed line and report it") {
+                CHECK_FALSE(bSucceeded);
+                CHECK(outputStream.str().find("Script line 2 failed: unknown") !=
+                      StringType::npos);
+            }
+        }
+
+        WHEN("A fail-fast script loads a project that can't be loaded") {
+            auto projectOptionParser{
+                std::make_unique<gh_cmd::DefaultOptionParser<CharType>>("Project Command Options")};
+            projectOptionParser->addOption(std::make_shared<gh_cmd::Value<CharType, StringType>>(
+                'l', "load", "Loads the given project."));
+
+            // The load handler fails as the project file doesn't exist.
+            commands::ProjectCommand::event_handler_map projectEventHandlers{
+                {"load",
+                 []([[maybe_unused]] const commands::ProjectCommand::option_parser::
+                        const_option_pointer& option) {
+                     return false;
+                 }}
+            };
+            applicationUnderTest.addSupportedCommand(std::make_unique<commands::ProjectCommand>(
+                std::move(projectOptionParser), std::move(projectEventHandlers), outputStream));
+
+            InputStringStream scriptStream{"project --load missing.json\nconfigure -A 10\n"};
+
+            EXPECT_CALL(commandMock, execute).Times(0);
+
+            const bool bSucceeded{
+                applicationUnderTest.runScript(scriptStream, ScriptErrorPolicy::FailFast)};
+
+            THEN("The script should stop at the failed load") {
+                CHECK_FALSE(bSucceeded);
+                CHECK(outputStream.str().find(
+                          "Script line 1 failed: project --load missing.json") != StringType::npos);
+            }
+        }
+
+        WHEN("A continue-on-error script contains a command with invalid options") {
+            InputStringStream scriptStream{"configure --wrong\nconfigure -D 20\nexit\nconfigure\n"};
+
+            EXPECT_CALL(commandMock, processInputOptions)
+                .WillOnce(Return(false))
+                .WillOnce(Return(true));
+            EXPECT_CALL(commandMock, execute).Times(1);
+
+            const bool bSucceeded{
+                applicationUnderTest.runScript(scriptStream, ScriptErrorPolicy::ContinueOnError)};
+
+            THEN("The following commands should be executed until the exit command") {
+                CHECK_FALSE(bSucceeded);
+                CHECK(outputStream.str().find("Script line 1 failed: configure --wrong") !=
+                      StringType::npos);
+            }
+        }
+    }
+}
@@ -0,0 +1,247 @@
+// Copyright (c) 2023 Andrea Ballestrazzi
+#include <testing-core.hpp>
+
+#include <application/event-loop.hpp>
+#include <commands/project-command.hpp>
+#include <remote/command-client.hpp>
+#include <remote/command-server.hpp>
+
+// Test doubles
+#include <gh_log/test-doubles/logger.mock.hpp>
+
+#include <gh_cmd/gh_cmd.hpp>
+
+// C++ STL
+#include <filesystem>
+#include <memory>
+#include <string>
+#include <system_error>
+#include <thread>
+#include <vector>
+
+// POSIX
+#include <unistd.h>
+
+namespace tests {
+
+//!!
+//! \brief A command that writes its arguments to its output stream, the first line
+//!  starting with a dot to exercise the escaping of the protocol.
+//!
+class EchoCommand final : public rpi_gc::TerminalCommandType {
+public:
+    explicit EchoCommand(std::ostream& outputStream) noexcept : m_outputStream{outputStream} {}
+
+    [[nodiscard]] name_type getName() const noexcept override {
+        return "echo";
+    }
+
+    bool processInputOptions(const std::vector<string_type>& inputTokens) override {
+        m_arguments.assign(inputTokens.begin() + 1, inputTokens.end());
+        return true;
+    }
+
+    bool execute() noexcept override {
+        m_outputStream.get() << ".echo" << '\n';
+        for (const string_type& argument : m_arguments) {
+            m_outputStream.get() << argument << '\n';
+        }
+
+        return true;
+    }
+
+    void printHelp(help_ostream_type) const noexcept override {}
+
+private:
+    std::reference_wrapper<std::ostream> m_outputStream;
+    std::vector<string_type> m_arguments{};
+};
+
+//!!
+//! \brief Creates the echo command of every client.
+//!
+[[nodiscard]] std::vector<rpi_gc::remote::CommandServer::command_pointer> CreateEchoCommands(
+    std::ostream& outputStream) {
+    std::vector<rpi_gc::remote::CommandServer::command_pointer> commands{};
+    commands.push_back(std::make_unique<EchoCommand>(outputStream));
+    return commands;
+}
+
+//!!
+//! \brief Creates the project command of every client, without any event handler.
+//!
+[[nodiscard]] std::vector<rpi_gc::remote::CommandServer::command_pointer> CreateProjectCommands(
+    std::ostream& outputStream) {
+    auto optionParser{
+        std::make_unique<gh_cmd::DefaultOptionParser<char>>("Project Command Options")};
+    optionParser->addSwitch(
+        std::make_shared<gh_cmd::Switch<char>>('h', "help", "Displays the help page"));
+
+    std::vector<rpi_gc::remote::CommandServer::command_pointer> commands{};
+    commands.push_back(std::make_unique<rpi_gc::commands::ProjectCommand>(
+        std::move(optionParser), rpi_gc::commands::ProjectCommand::event_handler_map{},
+        outputStream));
+    return commands;
+}
+
+//!!
+//! \brief Runs a command server on a background event loop.
+//!
+class ServerFixture {
+public:
+    explicit ServerFixture(std::size_t maxClientsCount,
+                           rpi_gc::remote::CommandServer::commands_factory commandsFactory =
+                               &CreateEchoCommands)
+        : m_commandServer{m_eventLoop, std::move(commandsFactory),
+                          std::make_shared<testing::NiceMock<gh_log::mocks::LoggerMock>>(),
+                          maxClientsCount} {
+        m_commandServer.start(socketPath);
+        m_loopThread = std::thread{[this] {
+            m_eventLoop.run();
+        }};
+    }
+
+    ~ServerFixture() noexcept {
+        stopLoop();
+    }
+
+    void stopLoop() noexcept {
+        if (m_loopThread.joinable()) {
+            m_eventLoop.stop();
+            m_loopThread.join();
+        }
+    }
+
+    [[nodiscard]] rpi_gc::remote::CommandServer& getServer() noexcept {
+        return m_commandServer;
+    }
+
+    const std::filesystem::path socketPath{
+        std::filesystem::temp_directory_path() /
+        ("rpi_gc-tests-" + std::to_string(::getpid()) + ".sock")};
+
+private:
+    rpi_gc::EventLoop m_eventLoop{};
+    rpi_gc::remote::CommandServer m_commandServer;
+    std::thread m_loopThread{};
+};
+
+} // namespace tests
+
+TEST_CASE("CommandServer unit tests", "[unit][sociable][rpi_gc][remote][CommandServer]") {
+    using rpi_gc::remote::CommandClient;
+
+    GIVEN("A running command server") {
+        tests::ServerFixture serverFixture{8};
+        CHECK(serverFixture.getServer().isListening());
+        CHECK(std::filesystem::is_socket(serverFixture.socketPath));
+
+        WHEN("Many clients pipeline their commands concurrently") {
+            constexpr std::size_t CLIENTS_COUNT{4};
+            constexpr std::size_t REQUESTS_COUNT{200};
+
+            std::vector<std::size_t> correctResponsesCount(CLIENTS_COUNT);
+            {
+                std::vector<std::jthread> clientThreads{};
+                for (std::size_t clientIndex{}; clientIndex < CLIENTS_COUNT; ++clientIndex) {
+                    clientThreads.emplace_back([&, clientIndex] {
+                        CommandClient client{};
+                        client.connect(serverFixture.socketPath);
+
+                        const std::string argument{"client-" + std::to_string(clientIndex)};
+                        for (std::size_t i{}; i < REQUESTS_COUNT; ++i) {
+                            client.send("echo " + argument);
+                        }
+
+                        for (std::size_t i{}; i < REQUESTS_COUNT; ++i) {
+                            if (client.receiveResponse() == ".echo\n" + argument + "\n") {
+                                ++correctResponsesCount[clientIndex];
+                            }
+                        }
+                    });
+                }
+            }
+
+            serverFixture.stopLoop();
+
+            THEN("Every client should receive its own responses in order") {
+                for (const std::size_t responsesCount : correctResponsesCount) {
+                    CHECK(responsesCount == REQUESTS_COUNT);
+                }
+
+                CHECK(serverFixture.getServer().getExecutedCommandsCount() ==
+                      CLIENTS_COUNT * REQUESTS_COUNT);
+            }
+        }
+
+        WHEN("A client sends an unknown command, an empty line and exits") {
+            CommandClient client{};
+            client.connect(serverFixture.socketPath);
+
+            const std::string unknownCommandResponse{client.execute("water --now")};
+            const std::string emptyLineResponse{client.execute("   ")};
+            client.send("exit");
+
+            THEN("The server should answer and then close the connection") {
+                CHECK(unknownCommandResponse.starts_with("water: "));
+                CHECK(emptyLineResponse.empty());
+                CHECK_THROWS_AS(client.receiveResponse(), std::system_error);
+            }
+        }
+
+        WHEN("A client sends a line that is too long") {
+            CommandClient client{};
+            client.connect(serverFixture.socketPath);
+            client.send(std::string(rpi_gc::remote::CommandServer::MAX_LINE_LENGTH * 2, 'x'));
+
+            THEN("The client should be disconnected") {
+                CHECK(client.receiveResponse().starts_with("The command line is too long"));
+                CHECK_THROWS_AS(client.receiveResponse(), std::system_error);
+            }
+        }
+
+        WHEN("The server is stopped") {
+            serverFixture.stopLoop();
+            serverFixture.getServer().stop();
+
+            THEN("The socket file should be removed") {
+                CHECK_FALSE(serverFixture.getServer().isListening());
+                CHECK_FALSE(std::filesystem::exists(serverFixture.socketPath));
+            }
+        }
+    }
+
+    GIVEN("A command server that gives a project command to every client") {
+        tests::ServerFixture serverFixture{2, &tests::CreateProjectCommands};
+
+        WHEN("A client asks the help of the project command") {
+            CommandClient client{};
+            client.connect(serverFixture.socketPath);
+
+            const std::string helpResponse{client.execute("project --help")};
+
+            THEN("The help page should be sent back to the client") {
+                CHECK(helpResponse.starts_with("[NAME]"));
+                CHECK(helpResponse.find("Project Command Options") != std::string::npos);
+            }
+        }
+    }
+
+    GIVEN("A command server that accepts a single client") {
+        tests::ServerFixture serverFixture{1};
+
+        CommandClient firstClient{};
+        firstClient.connect(serverFixture.socketPath);
+        REQUIRE(firstClient.execute("echo first") == ".echo\nfirst\n");
+
+        WHEN("Another client connects") {
+            CommandClient secondClient{};
+            secondClient.connect(serverFixture.socketPath);
+
+            THEN("It should be rejected") {
+                CHECK(secondClient.receiveResponse().starts_with("Too many clients"));
+                CHECK_THROWS_AS(secondClient.receiveResponse(), std::system_error);
+            }
+        }
+    }
+}
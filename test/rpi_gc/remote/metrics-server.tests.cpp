@@ -0,0 +1,239 @@
+// Copyright (c) 2023 Andrea Ballestrazzi
+#include <testing-core.hpp>
+
+#include <application/event-loop.hpp>
+#include <remote/metrics-server.hpp>
+
+#include <metrics/metrics-registry.hpp>
+
+// Test doubles
+#include <gh_log/test-doubles/logger.mock.hpp>
+
+// C++ STL
+#include <array>
+#include <cstddef>
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <thread>
+
+// POSIX
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+namespace tests {
+
+//!!
+//! \brief A blocking HTTP client that reads the responses by their content length.
+//!
+class HttpTestClient {
+public:
+    explicit HttpTestClient(const std::uint16_t port) {
+        m_socket = ::socket(AF_INET, SOCK_STREAM | SOCK_CLOEXEC, 0);
+
+        sockaddr_in address{};
+        address.sin_family = AF_INET;
+        address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+        address.sin_port = htons(port);
+        m_bConnected = m_socket >= 0 && ::connect(m_socket,
+                                                  reinterpret_cast<const sockaddr*>(&address),
+                                                  sizeof(address)) == 0;
+    }
+
+    ~HttpTestClient() noexcept {
+        if (m_socket >= 0)
+            ::close(m_socket);
+    }
+
+    HttpTestClient(const HttpTestClient&) = delete;
+    HttpTestClient& operator=(const HttpTestClient&) = delete;
+
+    [[nodiscard]] bool isConnected() const noexcept {
+        return m_bConnected;
+    }
+
+    void send(std::string_view request) {
+        [[maybe_unused]] const ssize_t bytesSent{
+            ::send(m_socket, request.data(), request.size(), MSG_NOSIGNAL)};
+    }
+
+    //! \return The whole response, or no value if the connection has been closed before.
+    [[nodiscard]] std::optional<std::string> receiveResponse(const bool bWithBody = true) {
+        while (true) {
+            const std::size_t headerEnd{m_input.find("\r\n\r\n")};
+            if (headerEnd != std::string::npos) {
+                const std::size_t responseSize{headerEnd + 4 +
+                                               (bWithBody ? getContentLength(headerEnd) : 0)};
+                if (m_input.size() >= responseSize) {
+                    std::string response{m_input.substr(0, responseSize)};
+                    m_input.erase(0, responseSize);
+                    return response;
+                }
+            }
+
+            if (!receive())
+                return std::nullopt;
+        }
+    }
+
+    //! \return True if the server has closed the connection.
+    [[nodiscard]] bool isClosedByServer() {
+        return m_input.empty() && !receive();
+    }
+
+private:
+    int m_socket{-1};
+    bool m_bConnected{};
+    std::string m_input{};
+
+    [[nodiscard]] bool receive() {
+        std::array<char, 4096> buffer{};
+        const ssize_t bytesRead{::recv(m_socket, buffer.data(), buffer.size(), 0)};
+        if (bytesRead <= 0)
+            return false;
+
+        m_input.append(buffer.data(), static_cast<std::size_t>(bytesRead));
+        return true;
+    }
+
+    [[nodiscard]] std::size_t getContentLength(const std::size_t headerEnd) const {
+        constexpr std::string_view CONTENT_LENGTH_FIELD{"Content-Length: "};
+
+        const std::size_t fieldPosition{m_input.find(CONTENT_LENGTH_FIELD)};
+        if (fieldPosition == std::string::npos || fieldPosition > headerEnd)
+            return 0;
+
+        return std::stoul(m_input.substr(fieldPosition + CONTENT_LENGTH_FIELD.size()));
+    }
+};
+
+} // namespace tests
+
+TEST_CASE("MetricsServer unit tests", "[unit][sociable][rpi_gc][remote][MetricsServer]") {
+    using rpi_gc::remote::MetricsServer;
+
+    GIVEN("A metrics server listening on a free loopback port") {
+        gc::metrics::MetricsRegistry registry{};
+        registry.counter("gc_test_cycles_total", "Number of cycles.").increment(7);
+
+        rpi_gc::EventLoop eventLoop{};
+        MetricsServer metricsServer{
+            eventLoop, registry, std::make_shared<testing::NiceMock<gh_log::mocks::LoggerMock>>()};
+        metricsServer.start(0);
+
+        REQUIRE(metricsServer.isListening());
+        REQUIRE(metricsServer.getPort() != 0);
+
+        std::jthread loopThread{[&eventLoop] {
+            eventLoop.run();
+        }};
+
+        tests::HttpTestClient client{metricsServer.getPort()};
+        REQUIRE(client.isConnected());
+
+        WHEN("The metrics are scraped twice on the same connection") {
+            client.send("GET /metrics HTTP/1.1\r\nHost: localhost\r\n\r\n");
+            const std::optional<std::string> firstResponse{client.receiveResponse()};
+
+            registry.counter("gc_test_cycles_total", "Number of cycles.").increment();
+            client.send("GET /metrics?format=text HTTP/1.1\r\nHost: localhost\r\n\r\n");
+            const std::optional<std::string> secondResponse{client.receiveResponse()};
+
+            THEN("Both the responses should contain the current metrics") {
+                REQUIRE(firstResponse.has_value());
+                CHECK(firstResponse->starts_with("HTTP/1.1 200 OK\r\n"));
+                CHECK(firstResponse->find("Content-Type: text/plain; version=0.0.4") !=
+                      std::string::npos);
+                CHECK(firstResponse->ends_with("\r\n\r\n# HELP gc_test_cycles_total Number of "
+                                               "cycles.\n# TYPE gc_test_cycles_total counter\n"
+                                               "gc_test_cycles_total 7\n"));
+
+                REQUIRE(secondResponse.has_value());
+                CHECK(secondResponse->ends_with("gc_test_cycles_total 8\n"));
+            }
+        }
+
+        WHEN("Other paths and methods are requested") {
+            client.send("GET / HTTP/1.1\r\n\r\nPOST /metrics HTTP/1.1\r\n\r\n"
+                        "HEAD /metrics HTTP/1.1\r\n\r\n");
+            const std::optional<std::string> notFoundResponse{client.receiveResponse()};
+            const std::optional<std::string> notAllowedResponse{client.receiveResponse()};
+            const std::optional<std::string> headResponse{client.receiveResponse(false)};
+
+            THEN("They should be answered with the matching status") {
+                REQUIRE(notFoundResponse.has_value());
+                CHECK(notFoundResponse->starts_with("HTTP/1.1 404 Not Found\r\n"));
+
+                REQUIRE(notAllowedResponse.has_value());
+                CHECK(notAllowedResponse->starts_with("HTTP/1.1 405 Method Not Allowed\r\n"));
+                CHECK(notAllowedResponse->find("Allow: GET, HEAD\r\n") != std::string::npos);
+
+                REQUIRE(headResponse.has_value());
+                CHECK(headResponse->starts_with("HTTP/1.1 200 OK\r\n"));
+                CHECK(headResponse->ends_with("\r\n\r\n"));
+            }
+        }
+
+        WHEN("A client pipelines more requests than a dispatch reads while another one scrapes") {
+            // Every request is padded to 1 KiB, so the batch takes several dispatches.
+            constexpr std::size_t REQUESTS_COUNT{
+                2 * MetricsServer::MAX_READ_SIZE_PER_DISPATCH / 1024};
+            const std::string paddedRequest{"HEAD /metrics HTTP/1.1\r\nX-Padding: " +
+                                            std::string(1024 - 40, 'x') + "\r\n\r\n"};
+
+            std::string pipelinedRequests{};
+            for (std::size_t i{}; i < REQUESTS_COUNT; ++i)
+                pipelinedRequests.append(paddedRequest);
+
+            client.send(pipelinedRequests);
+
+            tests::HttpTestClient otherClient{metricsServer.getPort()};
+            REQUIRE(otherClient.isConnected());
+            otherClient.send("GET /metrics HTTP/1.1\r\n\r\n");
+            const std::optional<std::string> otherResponse{otherClient.receiveResponse()};
+
+            std::size_t answeredRequestsCount{};
+            while (answeredRequestsCount < REQUESTS_COUNT) {
+                const std::optional<std::string> response{client.receiveResponse(false)};
+                if (!response.has_value() || !response->starts_with("HTTP/1.1 200 OK\r\n"))
+                    break;
+
+                ++answeredRequestsCount;
+            }
+
+            THEN("Both the clients should be answered") {
+                REQUIRE(otherResponse.has_value());
+                CHECK(otherResponse->ends_with("gc_test_cycles_total 7\n"));
+                CHECK(answeredRequestsCount == REQUESTS_COUNT);
+            }
+        }
+
+        WHEN("The client asks to close the connection") {
+            client.send("GET /metrics HTTP/1.1\r\nConnection: close\r\n\r\n");
+            const std::optional<std::string> response{client.receiveResponse()};
+
+            THEN("The connection should be closed after the response") {
+                REQUIRE(response.has_value());
+                CHECK(response->find("Connection: close\r\n") != std::string::npos);
+                CHECK(client.isClosedByServer());
+            }
+        }
+
+        WHEN("A malformed request is sent") {
+            client.send("GARBAGE\r\n\r\n");
+            const std::optional<std::string> response{client.receiveResponse()};
+
+            THEN("It should be answered with 400 and the connection closed") {
+                REQUIRE(response.has_value());
+                CHECK(response->starts_with("HTTP/1.1 400 Bad Request\r\n"));
+                CHECK(client.isClosedByServer());
+            }
+        }
+
+        eventLoop.stop();
+        loopThread.join();
+    }
+}
@@ -0,0 +1,146 @@
+// Copyright (c) 2023 Andrea Ballestrazzi
+#include <sensors/sensor-acquisition-pipeline.hpp>
+
+#include <gh_hal/backends/simulated/scripted-sensor-source.hpp>
+
+#include <testing-core.hpp>
+
+// C++ STL
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace {
+
+using gh_hal::backends::simulated::ScriptedSensorSource;
+using gh_hal::backends::simulated::SensorScriptStep;
+
+[[nodiscard]] std::shared_ptr<ScriptedSensorSource> CreateConstantSource(const double value) {
+    return std::make_shared<ScriptedSensorSource>(std::vector<SensorScriptStep>{
+        SensorScriptStep{.kind = SensorScriptStep::Kind::Constant, .fromValue = value}});
+}
+
+} // namespace
+
+TEST_CASE("SensorAcquisitionPipeline registration unit tests",
+          "[unit][sociable][rpi_gc][sensors][SensorAcquisitionPipeline]") {
+    using rpi_gc::sensors::SensorAcquisitionPipeline;
+    using namespace std::chrono_literals;
+
+    GIVEN("A pipeline with a registered sensor") {
+        SensorAcquisitionPipeline pipelineUnderTest{};
+        const auto sensorId{
+            pipelineUnderTest.registerSensor("temperature", CreateConstantSource(21.5), 10ms)};
+
+        THEN("The sensor should be found by its name") {
+            CHECK(pipelineUnderTest.getSensorsCount() == 1);
+            CHECK(pipelineUnderTest.findSensor("temperature") == sensorId);
+            CHECK(pipelineUnderTest.getSensorName(sensorId) == "temperature");
+            CHECK_FALSE(pipelineUnderTest.findSensor("moisture").has_value());
+        }
+
+        THEN("Invalid sensors should be rejected") {
+            CHECK_THROWS_AS(
+                pipelineUnderTest.registerSensor("temperature", CreateConstantSource(0.0), 10ms),
+                std::invalid_argument);
+            CHECK_THROWS_AS(pipelineUnderTest.registerSensor("moisture", nullptr, 10ms),
+                            std::invalid_argument);
+            CHECK_THROWS_AS(
+                pipelineUnderTest.registerSensor("moisture", CreateConstantSource(0.0), 0ms),
+                std::invalid_argument);
+        }
+    }
+}
+
+TEST_CASE("SensorAcquisitionPipeline sampling tests",
+          "[unit][sociable][rpi_gc][sensors][SensorAcquisitionPipeline][sampling]") {
+    using rpi_gc::sensors::SensorAcquisitionPipeline;
+    using rpi_gc::sensors::SensorSample;
+    using namespace std::chrono_literals;
+
+    GIVEN("A pipeline with a fast and a slow sensor") {
+        SensorAcquisitionPipeline pipelineUnderTest{};
+        const auto fastSource{std::make_shared<ScriptedSensorSource>(
+            std::vector<SensorScriptStep>{
+                SensorScriptStep{.kind = SensorScriptStep::Kind::Constant, .fromValue = 1.0},
+                SensorScriptStep{.kind = SensorScriptStep::Kind::Failure}})};
+        const auto slowSource{CreateConstantSource(2.0)};
+        const auto fastSensorId{pipelineUnderTest.registerSensor("fast", fastSource, 10ms)};
+        const auto slowSensorId{pipelineUnderTest.registerSensor("slow", slowSource, 1h)};
+
+        WHEN("The pipeline runs for a while") {
+            pipelineUnderTest.start();
+            std::this_thread::sleep_for(300ms);
+            pipelineUnderTest.stop();
+
+            THEN("Every sensor should be sampled at its own period") {
+                CHECK(fastSource->getReadsCount() >= 10);
+                CHECK(slowSource->getReadsCount() == 1);
+            }
+
+            THEN("The successful reads should be in the rings and the failures counted") {
+                std::vector<SensorSample> fastSamples{};
+                pipelineUnderTest.getSamples(fastSensorId).readFrom(0, fastSamples);
+
+                CHECK(fastSamples.size() + pipelineUnderTest.getFailedReadsCount(fastSensorId) ==
+                      fastSource->getReadsCount());
+                CHECK(pipelineUnderTest.getFailedReadsCount(fastSensorId) ==
+                      fastSource->getReadsCount() / 2);
+                for (const SensorSample& sample : fastSamples)
+                    CHECK(sample.value == 1.0);
+
+                REQUIRE(pipelineUnderTest.getSamples(slowSensorId).getLatest().has_value());
+                CHECK(pipelineUnderTest.getSamples(slowSensorId).getLatest()->value == 2.0);
+            }
+        }
+    }
+
+    GIVEN("A pipeline loaded with hundreds of sensors") {
+        constexpr std::size_t SENSORS_COUNT{256};
+        SensorAcquisitionPipeline pipelineUnderTest{};
+        std::vector<std::shared_ptr<ScriptedSensorSource>> sources{};
+        for (std::size_t i{}; i < SENSORS_COUNT; ++i) {
+            sources.push_back(std::make_shared<ScriptedSensorSource>(
+                std::vector<SensorScriptStep>{SensorScriptStep{.kind = SensorScriptStep::Kind::Ramp,
+                                                               .fromValue = 0.0,
+                                                               .toValue = 100.0,
+                                                               .readsCount = 101}},
+                true, 0.5, i + 1));
+            pipelineUnderTest.registerSensor("sensor-" + std::to_string(i), sources.back(), 20ms,
+                                             64);
+        }
+
+        WHEN("The pipeline runs while a consumer reads every sensor") {
+            pipelineUnderTest.start();
+
+            std::vector<std::uint64_t> positions(SENSORS_COUNT);
+            std::vector<std::size_t> readSamplesCounts(SENSORS_COUNT);
+            std::vector<SensorSample> samples{};
+            const auto consumingEnd{std::chrono::steady_clock::now() + 400ms};
+            while (std::chrono::steady_clock::now() < consumingEnd) {
+                for (std::size_t i{}; i < SENSORS_COUNT; ++i) {
+                    samples.clear();
+                    positions[i] = pipelineUnderTest.getSamples(i).readFrom(positions[i], samples);
+                    readSamplesCounts[i] += samples.size();
+                }
+
+                std::this_thread::sleep_for(5ms);
+            }
+
+            pipelineUnderTest.stop();
+
+            THEN("Every sensor should have been sampled and consumed") {
+                for (std::size_t i{}; i < SENSORS_COUNT; ++i) {
+                    CHECK(sources[i]->getReadsCount() >= 5);
+                    CHECK(readSamplesCounts[i] > 0);
+                    CHECK(pipelineUnderTest.getFailedReadsCount(i) == 0);
+                }
+            }
+        }
+    }
+}
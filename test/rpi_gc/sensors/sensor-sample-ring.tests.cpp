@@ -0,0 +1,116 @@
+// Copyright (c) 2023 Andrea Ballestrazzi
+#include <sensors/sensor-sample-ring.hpp>
+
+#include <testing-core.hpp>
+
+// C++ STL
+#include <atomic>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+TEST_CASE("SensorSampleRing unit tests",
+          "[unit][solitary][rpi_gc][sensors][SensorSampleRing]") {
+    using rpi_gc::sensors::SensorSample;
+    using rpi_gc::sensors::SensorSampleRing;
+
+    GIVEN("An empty ring") {
+        SensorSampleRing ringUnderTest{5};
+
+        THEN("Its capacity should be rounded up to a power of two") {
+            CHECK(ringUnderTest.getCapacity() == 8);
+        }
+
+        THEN("It should have no samples") {
+            std::vector<SensorSample> samples{};
+
+            CHECK_FALSE(ringUnderTest.getLatest().has_value());
+            CHECK(ringUnderTest.readFrom(0, samples) == 0);
+            CHECK(samples.empty());
+        }
+
+        WHEN("Fewer samples than its capacity are pushed") {
+            for (std::int64_t i{}; i < 3; ++i)
+                ringUnderTest.push(SensorSample{i, static_cast<double>(i) * 2.0});
+
+            THEN("They should all be read in order") {
+                std::vector<SensorSample> samples{};
+
+                CHECK(ringUnderTest.readFrom(0, samples) == 3);
+                CHECK(samples == std::vector<SensorSample>{{0, 0.0}, {1, 2.0}, {2, 4.0}});
+                CHECK(ringUnderTest.getLatest() == SensorSample{2, 4.0});
+            }
+
+            THEN("A consumer should read only the samples after its position") {
+                std::vector<SensorSample> samples{};
+
+                CHECK(ringUnderTest.readFrom(2, samples) == 3);
+                CHECK(samples == std::vector<SensorSample>{{2, 4.0}});
+            }
+        }
+
+        WHEN("More samples than its capacity are pushed") {
+            for (std::int64_t i{}; i < 20; ++i)
+                ringUnderTest.push(SensorSample{i, static_cast<double>(i)});
+
+            THEN("Only the last samples should be read") {
+                std::vector<SensorSample> samples{};
+
+                CHECK(ringUnderTest.readFrom(0, samples) == 20);
+                REQUIRE(samples.size() == 8);
+                CHECK(samples.front() == SensorSample{12, 12.0});
+                CHECK(samples.back() == SensorSample{19, 19.0});
+                CHECK(ringUnderTest.getWrittenCount() == 20);
+            }
+        }
+    }
+}
+
+TEST_CASE("SensorSampleRing concurrency tests",
+          "[unit][solitary][rpi_gc][sensors][SensorSampleRing][concurrency]") {
+    using rpi_gc::sensors::SensorSample;
+    using rpi_gc::sensors::SensorSampleRing;
+
+    GIVEN("A small ring written by a producer thread") {
+        constexpr std::int64_t SAMPLES_COUNT{200'000};
+        SensorSampleRing ringUnderTest{16};
+        std::atomic_bool bInconsistentSample{};
+        std::atomic_bool bUnorderedSamples{};
+
+        WHEN("Two consumers read it while it's written") {
+            std::vector<std::jthread> consumerThreads{};
+            for (int i{}; i < 2; ++i) {
+                consumerThreads.emplace_back([&] {
+                    std::vector<SensorSample> samples{};
+                    std::uint64_t position{};
+                    std::int64_t lastTimestamp{-1};
+                    while (position < static_cast<std::uint64_t>(SAMPLES_COUNT)) {
+                        samples.clear();
+                        position = ringUnderTest.readFrom(position, samples);
+
+                        for (const SensorSample& sample : samples) {
+                            // The producer writes the timestamp as the value, so a torn copy
+                            // has different ones.
+                            if (sample.value != static_cast<double>(sample.timestamp))
+                                bInconsistentSample = true;
+                            if (sample.timestamp <= lastTimestamp)
+                                bUnorderedSamples = true;
+                            lastTimestamp = sample.timestamp;
+                        }
+                    }
+                });
+            }
+
+            for (std::int64_t i{}; i < SAMPLES_COUNT; ++i)
+                ringUnderTest.push(SensorSample{i, static_cast<double>(i)});
+            consumerThreads.clear();
+
+            THEN("The consumers should read only consistent samples, in order") {
+                CHECK_FALSE(bInconsistentSample.load());
+                CHECK_FALSE(bUnorderedSamples.load());
+                CHECK(ringUnderTest.getLatest() == SensorSample{SAMPLES_COUNT - 1,
+                                                                SAMPLES_COUNT - 1.0});
+            }
+        }
+    }
+}
@@ -0,0 +1,311 @@
+// Copyright (c) 2023 Andrea Ballestrazzi
+#include <sensors/signal-filters.hpp>
+
+#include <testing-core.hpp>
+
+#include <catch2/catch_approx.hpp>
+
+// C++ STL
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <random>
+#include <span>
+#include <stdexcept>
+#include <vector>
+
+namespace {
+
+//! \return A noisy sine with a spike every 37 samples, as a moisture probe with bad contacts.
+[[nodiscard]] std::vector<double> MakeNoisySignal(const std::size_t samplesCount) {
+    // The raw output of the engine is the same on every standard library, unlike the
+    // distributions.
+    std::mt19937 generator{42};
+    const auto noise{[&generator] {
+        return static_cast<double>(generator()) / static_cast<double>(std::mt19937::max()) - 0.5;
+    }};
+
+    std::vector<double> signal(samplesCount);
+    for (std::size_t i{}; i < samplesCount; ++i) {
+        signal[i] = 30.0 + 5.0 * std::sin(static_cast<double>(i) * 0.05) + noise();
+        if (i % 37 == 36)
+            signal[i] += 40.0;
+    }
+
+    return signal;
+}
+
+//!!
+//! \brief Filters a signal in blocks of irregular sizes, to check that the filters carry
+//!  their state over the blocks.
+//!
+template <typename Filter>
+std::vector<double> FilterInBlocks(Filter& filter, const std::vector<double>& signal) {
+    constexpr std::array<std::size_t, 7> BLOCK_SIZES{1, 3, 7, 64, 2, 129, 5};
+
+    std::vector<double> output(signal.size());
+    std::size_t position{};
+    for (std::size_t block{}; position < signal.size(); ++block) {
+        const std::size_t blockSize{
+            std::min(BLOCK_SIZES[block % BLOCK_SIZES.size()], signal.size() - position)};
+        filter.process(std::span{signal}.subspan(position, blockSize),
+                       std::span{output}.subspan(position, blockSize));
+        position += blockSize;
+    }
+
+    return output;
+}
+
+//!!
+//! \brief Checks that two filtered signals have the same bits, so that the NaNs and the signs
+//!  of the zeros are compared too.
+//!
+void CheckSameBits(const std::vector<double>& actual, const std::vector<double>& expected) {
+    REQUIRE(actual.size() == expected.size());
+    for (std::size_t i{}; i < actual.size(); ++i) {
+        INFO("Sample: " << i);
+        REQUIRE(std::bit_cast<std::uint64_t>(actual[i]) ==
+                std::bit_cast<std::uint64_t>(expected[i]));
+    }
+}
+
+} // namespace
+
+TEST_CASE("Signal filters unit tests", "[unit][solitary][rpi_gc][sensors][SignalFilters]") {
+    using namespace rpi_gc::sensors;
+
+    GIVEN("The scalar backend") {
+        constexpr SignalFilterBackend backend{SignalFilterBackend::Scalar};
+
+        THEN("It should always be supported") {
+            CHECK(IsSignalFilterBackendSupported(backend));
+        }
+
+        THEN("The best backend should be supported") {
+            CHECK(IsSignalFilterBackendSupported(GetBestSignalFilterBackend()));
+        }
+
+        WHEN("A moving average filters a block") {
+            MovingAverageFilter filterUnderTest{2, backend};
+            const std::vector<double> input{1.0, 2.0, 3.0, 5.0};
+            std::vector<double> output(input.size());
+            filterUnderTest.process(input, output);
+
+            THEN("Every output should be the mean of the window, starting from the first sample") {
+                CHECK(output == std::vector<double>{1.0, 1.5, 2.5, 4.0});
+            }
+
+            AND_WHEN("It's reset") {
+                filterUnderTest.reset();
+                const std::vector<double> newInput{10.0, 20.0};
+                std::vector<double> newOutput(newInput.size());
+                filterUnderTest.process(newInput, newOutput);
+
+                THEN("It should forget the previous samples") {
+                    CHECK(newOutput == std::vector<double>{10.0, 15.0});
+                }
+            }
+        }
+
+        WHEN("An exponential smoothing filters a block") {
+            ExponentialSmoothingFilter filterUnderTest{0.5, backend};
+            const std::vector<double> input{2.0, 4.0, 4.0, 0.0};
+            std::vector<double> output(input.size());
+            filterUnderTest.process(input, output);
+
+            THEN("Every output should move halfway towards the sample") {
+                CHECK(output == std::vector<double>{2.0, 3.0, 3.5, 1.75});
+            }
+        }
+
+        WHEN("A median filters a block with a spike") {
+            MedianFilter filterUnderTest{3, backend};
+            const std::vector<double> input{1.0, 9.0, 2.0, 3.0, 4.0};
+            std::vector<double> output(input.size());
+            filterUnderTest.process(input, output);
+
+            THEN("The spike should be removed") {
+                CHECK(output == std::vector<double>{1.0, 1.0, 2.0, 3.0, 3.0});
+            }
+        }
+
+        WHEN("An outlier rejection filters a block with a spike") {
+            OutlierRejectionFilter filterUnderTest{3, 2.0, backend};
+            const std::vector<double> input{1.0, 1.5, 1.0, 10.0, 2.0, 2.5};
+            std::vector<double> output(input.size());
+            const std::size_t rejectedCount{filterUnderTest.process(input, output)};
+
+            THEN("Only the spike should be replaced by the median") {
+                CHECK(rejectedCount == 1);
+                CHECK(output == std::vector<double>{1.0, 1.5, 1.0, 1.5, 2.0, 2.5});
+            }
+        }
+
+        THEN("The filters should reject the invalid configurations") {
+            CHECK_THROWS_AS(MovingAverageFilter(0, backend), std::invalid_argument);
+            CHECK_THROWS_AS(ExponentialSmoothingFilter(0.0, backend), std::invalid_argument);
+            CHECK_THROWS_AS(ExponentialSmoothingFilter(1.5, backend), std::invalid_argument);
+            CHECK_THROWS_AS(MedianFilter(4, backend), std::invalid_argument);
+            CHECK_THROWS_AS(MedianFilter(MedianFilter::MAX_WINDOW_SIZE + 2, backend),
+                            std::invalid_argument);
+            CHECK_THROWS_AS(OutlierRejectionFilter(3, -1.0, backend), std::invalid_argument);
+        }
+
+        THEN("The filters should reject an output smaller than the input") {
+            MedianFilter filterUnderTest{3, backend};
+            const std::vector<double> input{1.0, 2.0};
+            std::vector<double> output(1);
+            CHECK_THROWS_AS(filterUnderTest.process(input, output), std::invalid_argument);
+        }
+    }
+
+    GIVEN("Some samples read from a ring") {
+        const std::vector<SensorSample> samples{{1000, 20.0}, {2000, 21.0}};
+
+        WHEN("Their values are extracted") {
+            std::vector<double> values{19.0};
+            ExtractSampleValues(samples, values);
+
+            THEN("They should be appended to the vector") {
+                CHECK(values == std::vector<double>{19.0, 20.0, 21.0});
+            }
+        }
+    }
+}
+
+TEST_CASE("Signal filters backends tests", "[unit][solitary][rpi_gc][sensors][SignalFilters]") {
+    using namespace rpi_gc::sensors;
+
+    const std::vector<double> signal{MakeNoisySignal(1000)};
+
+    GIVEN("The scalar filters applied to the whole signal at once") {
+        constexpr SignalFilterBackend scalarBackend{SignalFilterBackend::Scalar};
+        std::vector<double> expectedMovingAverage(signal.size());
+        std::vector<double> expectedSmoothing(signal.size());
+        std::vector<double> expectedMedian(signal.size());
+        std::vector<double> expectedRejection(signal.size());
+
+        MovingAverageFilter{8, scalarBackend}.process(signal, expectedMovingAverage);
+        ExponentialSmoothingFilter{0.2, scalarBackend}.process(signal, expectedSmoothing);
+        MedianFilter{5, scalarBackend}.process(signal, expectedMedian);
+        const std::size_t expectedRejectedCount{
+            OutlierRejectionFilter{5, 3.0, scalarBackend}.process(signal, expectedRejection)};
+
+        THEN("Every spike should be rejected") {
+            CHECK(expectedRejectedCount == signal.size() / 37);
+        }
+
+        WHEN("Every supported backend filters the signal block by block") {
+            THEN("The results should match the scalar ones") {
+                for (const SignalFilterBackend backend :
+                     {SignalFilterBackend::Scalar, SignalFilterBackend::Sse2,
+                      SignalFilterBackend::Avx, SignalFilterBackend::Neon}) {
+                    if (!IsSignalFilterBackendSupported(backend))
+                        continue;
+
+                    INFO("Backend: " << GetSignalFilterBackendName(backend));
+
+                    MovingAverageFilter movingAverage{8, backend};
+                    ExponentialSmoothingFilter smoothing{0.2, backend};
+                    MedianFilter median{5, backend};
+                    OutlierRejectionFilter rejection{5, 3.0, backend};
+
+                    // The windows are sorted in the same order by all the backends, while the
+                    // running sums restart with the blocks and the vector smoothing rounds
+                    // differently from the recurrence.
+                    CHECK(FilterInBlocks(median, signal) == expectedMedian);
+                    CHECK(FilterInBlocks(rejection, signal) == expectedRejection);
+
+                    const std::vector<double> movingAverageOutput{
+                        FilterInBlocks(movingAverage, signal)};
+                    const std::vector<double> smoothingOutput{FilterInBlocks(smoothing, signal)};
+                    for (std::size_t i{}; i < signal.size(); ++i) {
+                        REQUIRE(movingAverageOutput[i] ==
+                                Catch::Approx(expectedMovingAverage[i]).epsilon(1e-12));
+                        REQUIRE(smoothingOutput[i] ==
+                                Catch::Approx(expectedSmoothing[i]).epsilon(1e-12));
+                    }
+                }
+            }
+        }
+    }
+
+    GIVEN("A signal with NaNs and zeros of both signs") {
+        constexpr double NaN{std::numeric_limits<double>::quiet_NaN()};
+        std::vector<double> specialSignal{MakeNoisySignal(200)};
+        for (std::size_t i{}; i < specialSignal.size(); ++i) {
+            if (i % 23 == 5)
+                specialSignal[i] = NaN;
+            else if (i % 7 == 2)
+                specialSignal[i] = -0.0;
+            else if (i % 7 == 4)
+                specialSignal[i] = 0.0;
+        }
+
+        constexpr SignalFilterBackend scalarBackend{SignalFilterBackend::Scalar};
+        std::vector<double> expectedMovingAverage(specialSignal.size());
+        std::vector<double> expectedMedian(specialSignal.size());
+        std::vector<double> expectedRejection(specialSignal.size());
+
+        MovingAverageFilter{4, scalarBackend}.process(specialSignal, expectedMovingAverage);
+        MedianFilter{5, scalarBackend}.process(specialSignal, expectedMedian);
+        OutlierRejectionFilter{5, 3.0, scalarBackend}.process(specialSignal, expectedRejection);
+
+        THEN("Only the averages of the windows with a NaN should be NaN") {
+            for (std::size_t i{}; i < specialSignal.size(); ++i) {
+                bool bWindowHasNaN{};
+                for (std::size_t k{i < 3 ? 0 : i - 3}; k <= i; ++k)
+                    bWindowHasNaN = bWindowHasNaN || std::isnan(specialSignal[k]);
+
+                INFO("Sample: " << i);
+                REQUIRE(std::isnan(expectedMovingAverage[i]) == bWindowHasNaN);
+            }
+        }
+
+        WHEN("Every supported backend filters the signal block by block") {
+            THEN("The medians and the rejections should have the same bits as the scalar ones") {
+                for (const SignalFilterBackend backend :
+                     {SignalFilterBackend::Scalar, SignalFilterBackend::Sse2,
+                      SignalFilterBackend::Avx, SignalFilterBackend::Neon}) {
+                    if (!IsSignalFilterBackendSupported(backend))
+                        continue;
+
+                    INFO("Backend: " << GetSignalFilterBackendName(backend));
+
+                    MovingAverageFilter movingAverage{4, backend};
+                    MedianFilter median{5, backend};
+                    OutlierRejectionFilter rejection{5, 3.0, backend};
+
+                    CheckSameBits(FilterInBlocks(median, specialSignal), expectedMedian);
+                    CheckSameBits(FilterInBlocks(rejection, specialSignal), expectedRejection);
+
+                    const std::vector<double> movingAverageOutput{
+                        FilterInBlocks(movingAverage, specialSignal)};
+                    for (std::size_t i{}; i < specialSignal.size(); ++i) {
+                        INFO("Sample: " << i);
+                        if (std::isnan(expectedMovingAverage[i])) {
+                            REQUIRE(std::isnan(movingAverageOutput[i]));
+                        } else {
+                            REQUIRE(movingAverageOutput[i] ==
+                                    Catch::Approx(expectedMovingAverage[i]).margin(1e-12));
+                        }
+                    }
+                }
+            }
+        }
+
+        WHEN("The median is taken of a window of zeros of both signs") {
+            const std::vector<double> zeros{-0.0, 0.0, -0.0};
+            std::vector<double> output(zeros.size());
+            MedianFilter{3, scalarBackend}.process(zeros, output);
+
+            THEN("The zeros should keep their order, as they are equal") {
+                CheckSameBits(output, std::vector<double>{-0.0, -0.0, 0.0});
+            }
+        }
+    }
+}
@@ -11,7 +11,8 @@ namespace rpi_gc::diagnostics::mocks {
 
 class DiagnosticStatusProbeableMock : public DiagnosticStatusProbeable {
 public:
-    MOCK_METHOD(void, printDiagnostic, (std::ostream&), (const, noexcept, final));
+    MOCK_METHOD(DiagnosticSnapshot, captureDiagnostic, (), (const, final));
+    MOCK_METHOD(DiagnosticChangeNotifier*, getChangeNotifier, (), (const, noexcept, final));
 };
 
 } // namespace rpi_gc::diagnostics::mocks
@@ -0,0 +1,240 @@
+// Copyright (c) 2023 Andrea Ballestrazzi
+#include <automatic-watering/daily-cycle-automatic-watering-system.hpp>
+#include <watchdog/heartbeat.hpp>
+#include <watchdog/watchdog-supervisor.hpp>
+
+#include <testing-core.hpp>
+
+// Test Doubles
+#include <gh_hal/test-doubles/hardware-access/board-digital-pin.mock.hpp>
+#include <gh_log/test-doubles/logger.mock.hpp>
+#include <rpi_gc/test-doubles/abort-system/emergency-stoppable-system.mock.hpp>
+#include <rpi_gc/test-doubles/automatic-watering/hardware-controllers/watering-system-hardware-controller.mock.hpp>
+#include <rpi_gc/test-doubles/automatic-watering/time-providers/watering-system-time-provider.mock.hpp>
+
+// C++ STL
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+TEST_CASE("Heartbeat unit tests", "[unit][solitary][rpi_gc][watchdog][Heartbeat]") {
+    using rpi_gc::watchdog::Heartbeat;
+    using namespace std::chrono_literals;
+
+    GIVEN("A heartbeat that never beat") {
+        Heartbeat heartbeatUnderTest{};
+
+        THEN("It should never be overdue") {
+            CHECK_FALSE(heartbeatUnderTest.isOverdue(Heartbeat::clock_type::now() + 24h, 100ms));
+        }
+
+        WHEN("The worker beats") {
+            heartbeatUnderTest.beat();
+            const Heartbeat::clock_type::time_point beatTime{Heartbeat::clock_type::now()};
+
+            THEN("It should be overdue only after the timeout") {
+                CHECK_FALSE(heartbeatUnderTest.isOverdue(beatTime, 100ms));
+                CHECK(heartbeatUnderTest.isOverdue(beatTime + 200ms, 100ms));
+            }
+
+            AND_WHEN("The worker stops") {
+                heartbeatUnderTest.stop();
+
+                THEN("It should not be overdue anymore") {
+                    CHECK_FALSE(heartbeatUnderTest.isOverdue(beatTime + 24h, 100ms));
+                }
+            }
+        }
+
+        WHEN("The worker announces a silence") {
+            heartbeatUnderTest.beatFor(1h);
+            const Heartbeat::clock_type::time_point beatTime{Heartbeat::clock_type::now()};
+
+            THEN("It should be overdue only after the silence and the timeout") {
+                CHECK_FALSE(heartbeatUnderTest.isOverdue(beatTime + 1h, 100ms));
+                CHECK(heartbeatUnderTest.isOverdue(beatTime + 1h + 200ms, 100ms));
+            }
+        }
+    }
+}
+
+TEST_CASE("WatchdogSupervisor unit tests",
+          "[unit][sociable][rpi_gc][watchdog][WatchdogSupervisor]") {
+    using rpi_gc::watchdog::Heartbeat;
+    using rpi_gc::watchdog::WatchdogSupervisor;
+    using testing::NiceMock;
+    using namespace std::chrono_literals;
+
+    GIVEN("A supervisor with a 100ms timeout supervising one worker") {
+        auto stoppableSystemMock{std::make_shared<
+            NiceMock<rpi_gc::abort_system::mocks::EmergencyStoppableSystemMock>>()};
+        auto loggerMock{std::make_shared<NiceMock<gh_log::mocks::LoggerMock>>()};
+
+        std::atomic<std::size_t> cutoffsCount{};
+        std::promise<std::size_t> abortPromise{};
+        std::future<std::size_t> abortFuture{abortPromise.get_future()};
+        ON_CALL(*stoppableSystemMock, emergencyAbort).WillByDefault([&] {
+            abortPromise.set_value(cutoffsCount.load());
+        });
+
+        Heartbeat workerHeartbeat{};
+        WatchdogSupervisor supervisorUnderTest{[&cutoffsCount] {
+                                                   cutoffsCount++;
+                                                   return std::size_t{2};
+                                               },
+                                               loggerMock};
+        supervisorUnderTest.supervise("test", workerHeartbeat, stoppableSystemMock);
+
+        WHEN("The worker stops beating") {
+            workerHeartbeat.beat();
+            supervisorUnderTest.start(WatchdogSupervisor::MIN_TIMEOUT);
+
+            THEN("The outputs should be forced off before the system is aborted") {
+                REQUIRE(abortFuture.wait_for(5s) == std::future_status::ready);
+                CHECK(abortFuture.get() == 1);
+
+                AND_THEN("The hang should be detected only once") {
+                    std::this_thread::sleep_for(300ms);
+                    supervisorUnderTest.stop();
+
+                    CHECK(supervisorUnderTest.getTripsCount() == 1);
+                    CHECK(cutoffsCount.load() == 1);
+                }
+            }
+        }
+
+        WHEN("The worker keeps beating") {
+            workerHeartbeat.beat();
+            supervisorUnderTest.start(WatchdogSupervisor::MIN_TIMEOUT);
+
+            const auto beatingEnd{std::chrono::steady_clock::now() + 500ms};
+            while (std::chrono::steady_clock::now() < beatingEnd) {
+                workerHeartbeat.beat();
+                std::this_thread::sleep_for(10ms);
+            }
+            supervisorUnderTest.stop();
+
+            THEN("The worker should not be aborted") {
+                CHECK(supervisorUnderTest.getTripsCount() == 0);
+                CHECK(cutoffsCount.load() == 0);
+            }
+        }
+
+        WHEN("The worker announces a silence longer than the timeout") {
+            workerHeartbeat.beatFor(1h);
+            supervisorUnderTest.start(WatchdogSupervisor::MIN_TIMEOUT);
+            std::this_thread::sleep_for(300ms);
+            supervisorUnderTest.stop();
+
+            THEN("The worker should not be aborted") {
+                CHECK(supervisorUnderTest.getTripsCount() == 0);
+            }
+        }
+
+        WHEN("The worker has stopped") {
+            workerHeartbeat.stop();
+            supervisorUnderTest.start(WatchdogSupervisor::MIN_TIMEOUT);
+            std::this_thread::sleep_for(300ms);
+            supervisorUnderTest.stop();
+
+            THEN("The worker should not be aborted") {
+                CHECK(supervisorUnderTest.getTripsCount() == 0);
+            }
+        }
+    }
+}
+
+TEST_CASE("WatchdogSupervisor integration tests",
+          "[integration][rpi_gc][watchdog][WatchdogSupervisor]") {
+    using namespace rpi_gc::automatic_watering;
+    using rpi_gc::watchdog::WatchdogSupervisor;
+    using testing::NiceMock;
+    using namespace std::chrono_literals;
+
+    GIVEN("An automatic watering system whose worker hangs while activating the valve") {
+        auto loggerMock{std::make_shared<NiceMock<gh_log::mocks::LoggerMock>>()};
+
+        // The valve activation blocks until the hardware is released by the test.
+        std::promise<void> hardwareReleasePromise{};
+        std::shared_future<void> hardwareRelease{hardwareReleasePromise.get_future().share()};
+        std::promise<void> hangPromise{};
+        std::future<void> hangFuture{hangPromise.get_future()};
+
+        NiceMock<gh_hal::hardware_access::mocks::BoardDigitalPinMock> waterValveOutput{},
+            waterPumpOutput{};
+        EXPECT_CALL(waterValveOutput, activate)
+            .WillOnce([&hangPromise, hardwareRelease] {
+                hangPromise.set_value();
+                hardwareRelease.wait();
+            })
+            .WillRepeatedly(testing::Return());
+
+        NiceMock<mocks::WateringSystemHardwareControllerMock> hardwareControllerMock{};
+        ON_CALL(hardwareControllerMock, getWaterValveDigitalOut)
+            .WillByDefault(testing::Return(&waterValveOutput));
+        ON_CALL(hardwareControllerMock, getWaterPumpDigitalOut)
+            .WillByDefault(testing::Return(&waterPumpOutput));
+        std::atomic<WateringSystemHardwareController*> atomicHardwareController{
+            &hardwareControllerMock};
+
+        NiceMock<mocks::WateringSystemTimeProviderMock> timeProviderMock{};
+        ON_CALL(timeProviderMock, getWateringSystemActivationDuration)
+            .WillByDefault(testing::Return(WateringSystemTimeProvider::time_unit{60}));
+        ON_CALL(timeProviderMock, getWateringSystemDeactivationDuration)
+            .WillByDefault(testing::Return(WateringSystemTimeProvider::time_unit{100}));
+        ON_CALL(timeProviderMock, getPumpValveDeactivationTimeSeparation)
+            .WillByDefault(testing::Return(WateringSystemTimeProvider::time_unit{10}));
+        std::atomic<WateringSystemTimeProvider*> timeProviderAtomic{&timeProviderMock};
+
+        std::mutex hardwareAccessMutex{};
+        auto automaticWateringSystem{std::make_shared<DailyCycleAutomaticWateringSystem>(
+            std::ref(hardwareAccessMutex), loggerMock, loggerMock,
+            std::ref(atomicHardwareController), std::ref(timeProviderAtomic))};
+
+        std::atomic<std::size_t> cutoffsCount{};
+        WatchdogSupervisor supervisorUnderTest{[&cutoffsCount] {
+                                                   cutoffsCount++;
+                                                   return std::size_t{2};
+                                               },
+                                               loggerMock};
+        supervisorUnderTest.supervise("automatic watering",
+                                      automaticWateringSystem->getHeartbeat(),
+                                      automaticWateringSystem);
+
+        automaticWateringSystem->startAutomaticWatering({});
+        REQUIRE(hangFuture.wait_for(5s) == std::future_status::ready);
+
+        WHEN("The supervisor detects the hang") {
+            supervisorUnderTest.start(WatchdogSupervisor::MIN_TIMEOUT);
+            const auto tripDeadline{std::chrono::steady_clock::now() + 5s};
+            while (supervisorUnderTest.getTripsCount() == 0 &&
+                   std::chrono::steady_clock::now() < tripDeadline) {
+                std::this_thread::sleep_for(10ms);
+            }
+
+            // The supervisor can be stopped only if the trip has completed.
+            std::future<void> stopFuture{std::async(std::launch::async, [&supervisorUnderTest] {
+                supervisorUnderTest.stop();
+            })};
+            const std::future_status stopStatus{stopFuture.wait_for(5s)};
+
+            hardwareReleasePromise.set_value();
+            stopFuture.wait();
+            automaticWateringSystem->requestShutdown();
+
+            THEN("The trip should complete while the worker is still hung") {
+                CHECK(supervisorUnderTest.getTripsCount() == 1);
+                CHECK(cutoffsCount.load() == 1);
+                CHECK(stopStatus == std::future_status::ready);
+            }
+
+            THEN("The worker should stop once its hardware call returns") {
+                CHECK_FALSE(automaticWateringSystem->isRunning());
+            }
+        }
+    }
+}